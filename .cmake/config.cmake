@@ -30,6 +30,11 @@ option(BUILD_WITH_KOKKOS "Build with Kokkos" OFF)
 # *****************
 option(BUILD_WITH_TESTS "Build tests" ON)
 
+# *****************
+# BUILD WITH OPENMP
+# *****************
+option(BUILD_WITH_OPENMP "Build with OpenMP" ON)
+
 # **************
 # BUILD WITH MPI
 # **************
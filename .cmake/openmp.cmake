@@ -0,0 +1,10 @@
+find_package(OpenMP)
+
+if(OpenMP_CXX_FOUND)
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${OpenMP_CXX_FLAGS}")
+    link_libraries(OpenMP::OpenMP_CXX)
+    add_definitions(-DWITH_OPENMP)
+else()
+    message(WARNING "OpenMP not found - building without OpenMP")
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -Wno-unknown-pragmas")
+endif()
@@ -28,10 +28,11 @@
 #include <string>       // for string, char_traits
 #include <vector>       // for vector
 
-#include "commandLineArgs.hpp"   // for CommandLineArgs
-#include "engine.hpp"            // for Engine
-#include "inputFileReader.hpp"   // for readJobType
-#include "setup.hpp"             // for setupSimulation
+#include "commandLineArgs.hpp"        // for CommandLineArgs
+#include "engine.hpp"                 // for Engine
+#include "inputFileReader.hpp"        // for readJobType
+#include "replicaExchangeSetup.hpp"   // for setupReplicaExchange
+#include "setup.hpp"                  // for setupSimulation
 
 #ifdef WITH_MPI
 #include <mpi.h>   // for MPI_Abort, MPI_COMM_WORLD, MPI_Finalize
@@ -52,6 +53,7 @@ static int PQ(int argc, const std::vector<std::string> &arguments)
     input::readJobType(commandLineArgs.getInputFileName(), engine);
 
     setup::setupRequestedJob(commandLineArgs.getInputFileName(), *engine);
+    setup::setupReplicaExchange(commandLineArgs.getInputFileName(), engine);
 
     /*
         HERE STARTS THE MAIN LOOP
@@ -0,0 +1,72 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include <cstdlib>      // for EXIT_SUCCESS, EXIT_FAILURE
+#include <exception>    // for exception
+#include <filesystem>   // for path
+#include <iostream>     // for operator<<
+#include <string>       // for string
+
+#include "observableFileReader.hpp"   // for ObservableFileReader
+
+/**
+ * @brief converts a binary observable file into the text output files
+ *
+ * @details usage: PQ_observables <observable file> [prefix]
+ *
+ * The text files are written to "<prefix>.<extension>", e.g. "<prefix>.en"
+ * and "<prefix>.stress". If no prefix is given, the name of the observable
+ * file without its extension is used.
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 2 || argc > 3)
+    {
+        std::cout << "Usage: " << argv[0] << " <observable file> [prefix]\n";
+        return EXIT_FAILURE;
+    }
+
+    const auto fileName = std::string(argv[1]);
+    auto       prefix   = std::filesystem::path(fileName).replace_extension();
+
+    if (argc == 3)
+        prefix = argv[2];
+
+    try
+    {
+        auto reader = output::ObservableFileReader(fileName);
+        reader.read();
+        reader.convert(prefix.string());
+
+        if (reader.isTruncated())
+            std::cout << "Warning: the last block of " << fileName
+                      << " is incomplete and was skipped\n";
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "Exception: " << e.what() << '\n' << std::flush;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -50,6 +50,7 @@ namespace QM
         virtual void writeCoordsFile(pq::SimBox &) = 0;
         virtual void readStressTensor(pq::Box &, pq::PhysicalData &) {};
 
+        void writePointChargesFile() const;
         void readForceFile(pq::SimBox &, pq::PhysicalData &);
 
         /*******************************
@@ -28,8 +28,10 @@
 #define SINGULARITY_  _SINGULARITY_
 #define STATIC_BUILD_ _STATIC_BUILD_
 
+#include <cstddef>
 #include <stop_token>
 #include <string>
+#include <vector>
 
 #include "timer.hpp"
 #include "typeAliases.hpp"
@@ -44,11 +46,35 @@ namespace QM
      */
     class QMRunner : public timings::Timer
     {
+       protected:
+        bool _isQMRegionChanged = false;
+
+        pq::Vec3DVec        _qmAtomPositions;
+        pq::Vec3DVec        _pointChargePositions;
+        std::vector<double> _pointCharges;
+
        public:
         virtual ~QMRunner() = default;
 
         void throwAfterTimeout(const std::stop_token stopToken) const;
         virtual void run(pq::SimBox &, pq::PhysicalData &) = 0;
+
+        void setPointCharges(const pq::Vec3DVec &, const std::vector<double> &);
+        void clearPointCharges();
+
+        void setQMAtomPositions(const pq::Vec3DVec &positions);
+        [[nodiscard]] pq::Vec3D getQMAtomPosition(pq::SimBox &, const size_t)
+            const;
+
+        /*******************************
+         * standard getter and setters *
+         *******************************/
+
+        [[nodiscard]] bool isQMRegionChanged() const;
+        [[nodiscard]] const pq::Vec3DVec        &getPointChargePositions() const;
+        [[nodiscard]] const std::vector<double> &getPointCharges() const;
+
+        void setQMRegionChanged(const bool isQMRegionChanged);
     };
 }   // namespace QM
 
@@ -39,6 +39,8 @@ namespace defaults
     static constexpr size_t _NUMBER_OF_GUFF_ENTRIES_       = 28;
 
     static constexpr char _RESTART_FILE_DEFAULT_[]  = "default.rst";
+    static constexpr char _CHK_FILE_DEFAULT_[]      = "default.chk";
+    static constexpr char _OBS_FILE_DEFAULT_[]      = "default.obs";
     static constexpr char _ENERGY_FILE_DEFAULT_[]   = "default.en";
     static constexpr char _INSTEN_FILE_DEFAULT_[]   = "default.instant_en";
     static constexpr char _MOMENTUM_FILE_DEFAULT_[] = "default.mom";
@@ -54,13 +56,14 @@ namespace defaults
     static constexpr char _BOX_FILE_DEFAULT_[]      = "default.box";
     static constexpr char _OPT_FILE_DEFAULT_[]      = "default.opt";
     static constexpr char _TIMINGS_FILE_DEFAULT_[]  = "default.timings";
-
+    static constexpr char _TRACE_FILE_DEFAULT_[]    = "default.trace.json";
     static constexpr char _RPMD_RST_FILE_DEFAULT_[]    = "default.rpmd.rst";
     static constexpr char _RPMD_TRAJ_FILE_DEFAULT_[]   = "default.rpmd.xyz";
     static constexpr char _RPMD_VEL_FILE_DEFAULT_[]    = "default.rpmd.vel";
     static constexpr char _RPMD_FORCE_FILE_DEFAULT_[]  = "default.rpmd.force";
     static constexpr char _RPMD_CHARGE_FILE_DEFAULT_[] = "default.rpmd.charge";
     static constexpr char _RPMD_ENERGY_FILE_DEFAULT_[] = "default.rpmd.en";
+    static constexpr char _REX_FILE_DEFAULT_[]         = "default.rex";
 
     static constexpr double _COULOMB_CUT_OFF_DEFAULT_           = 12.5;   // in Angstrom
     static constexpr double _SCALE_14_COULOMB_DEFAULT_          = 1.0;
@@ -83,17 +86,35 @@ namespace defaults
 
     static constexpr double _BERENDSEN_MANOSTAT_RELAX_TIME_ = 1.0;        // in ps
     static constexpr double _COMPRESSIBILITY_WATER_DEFAULT_ = 4.591e-5;   // in bar^-1 default value for berendsen manostat
+    static constexpr size_t _MONTE_CARLO_MANOSTAT_FREQ_     = 25;         // in steps
+    static constexpr double _MONTE_CARLO_VOLUME_CHANGE_     = 0.01;       // relative to the box volume
+    static constexpr double _MONTE_CARLO_MAX_VOLUME_CHANGE_ = 0.5;        // relative to the box volume
 
     static constexpr size_t _DIMENSIONALITY_DEFAULT_ = 3;
 
     static constexpr double _QM_LOOP_TIME_LIMIT_DEFAULT_ = -1.0;   // in s
 
+    static constexpr size_t _REPLICA_EXCHANGE_FREQUENCY_DEFAULT_ = 100;   // in steps
+
     static constexpr char   _OPTIMIZER_DEFAULT_[]           = "gradient-descent";
     static constexpr size_t _N_EPOCHS_DEFAULT_              = 100;
     static constexpr size_t _LR_UPDATE_FREQUENCY_DEFAULT_   = 1;
     static constexpr double _INITIAL_LEARNING_RATE_DEFAULT_ = 1.0e-4;
     static constexpr double _MIN_LEARNING_RATE_DEFAULT_     = 1e-15;
 
+    static constexpr size_t _LBFGS_MEMORY_DEFAULT_              = 10;
+    static constexpr size_t _LBFGS_MAX_LINESEARCH_ITER_DEFAULT_ = 10;
+    static constexpr double _LBFGS_MAX_STEP_DEFAULT_            = 0.2;   // in Angstrom
+
+    static constexpr double _FIRE_TIMESTEP_DEFAULT_          = 0.01;
+    static constexpr double _FIRE_MAX_TIMESTEP_DEFAULT_      = 0.1;
+    static constexpr size_t _FIRE_N_MIN_DEFAULT_             = 5;
+    static constexpr double _FIRE_TIMESTEP_INCREASE_DEFAULT_ = 1.1;
+    static constexpr double _FIRE_TIMESTEP_DECREASE_DEFAULT_ = 0.5;
+    static constexpr double _FIRE_ALPHA_START_DEFAULT_       = 0.1;
+    static constexpr double _FIRE_ALPHA_DECREASE_DEFAULT_    = 0.99;
+    static constexpr double _FIRE_MAX_STEP_DEFAULT_          = 0.2;   // in Angstrom
+
     static constexpr char   _EN_CONV_STRATEGY_DEFAULT_[] = "rigorous";
     static constexpr char   _FORCE_CONV_STRATEGY_DEFAULT_[]  = "rigorous";
     static constexpr double _REL_ENERGY_CONV_DEFAULT_        = 1.0e-6;
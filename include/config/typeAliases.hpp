@@ -24,15 +24,16 @@
 
 #define _TYPE_ALIASES_HPP_
 
-#include <chrono>       // for std::chrono
-#include <cstddef>      // for size_t
-#include <deque>        // for std::queue
-#include <functional>   // for std::function
-#include <memory>       // for std::shared_ptr
-#include <optional>     // for std::optional
-#include <set>          // for std::set
-#include <string>       // for std::string
-#include <vector>       // for std::vector
+#include <chrono>        // for std::chrono
+#include <cstddef>       // for size_t
+#include <deque>         // for std::queue
+#include <functional>    // for std::function
+#include <memory>        // for std::shared_ptr
+#include <optional>      // for std::optional
+#include <set>           // for std::set
+#include <string>        // for std::string
+#include <string_view>   // for std::string_view
+#include <vector>        // for std::vector
 
 #include "matrix.hpp"
 #include "staticMatrix.hpp"
@@ -129,6 +130,12 @@ namespace output
     class BoxFileOutput;      // forward declaration
     class TimingsOutput;      // forward declaration
     class OptOutput;          // forward declaration
+    class FrameSnapshot;      // forward declaration
+
+    class CheckpointFileOutput;    // forward declaration
+    class ObservableOutput;        // forward declaration
+    class TimingsTraceOutput;      // forward declaration
+    class ReplicaExchangeOutput;   // forward declaration
 
     class RingPolymerRestartFileOutput;   // forward declaration
     class RingPolymerTrajectoryOutput;    // forward declaration
@@ -184,6 +191,7 @@ namespace integrator
 {
     class Integrator;       // forward declaration
     class VelocityVerlet;   // forward declaration
+    class BAOAB;            // forward declaration
 }   // namespace integrator
 
 namespace resetKinetics
@@ -206,11 +214,13 @@ namespace input
 
 namespace pq
 {
-    using Time = std::chrono::time_point<std::chrono::high_resolution_clock>;
+    using Clock    = std::chrono::steady_clock;
+    using Time     = std::chrono::time_point<Clock>;
     using Duration = std::chrono::duration<double>;
 
-    using strings   = std::vector<std::string>;
-    using stringSet = std::set<std::string>;
+    using strings     = std::vector<std::string>;
+    using stringViews = std::vector<std::string_view>;
+    using stringSet   = std::set<std::string>;
 
     using stlVectorUL     = std::vector<size_t>;
     using stlVector3d     = std::vector<std::vector<std::vector<double>>>;
@@ -252,6 +262,7 @@ namespace pq
 
     using Integrator     = integrator::Integrator;
     using VelocityVerlet = integrator::VelocityVerlet;
+    using BAOAB          = integrator::BAOAB;
 
     using UniqueIntegrator = std::unique_ptr<Integrator>;
 
@@ -414,6 +425,12 @@ namespace pq
     using BoxFileOutput    = output::BoxFileOutput;
     using TimingsOutput    = output::TimingsOutput;
     using OptOutput        = output::OptOutput;
+    using FrameSnapshot    = output::FrameSnapshot;
+
+    using CheckpointFileOutput  = output::CheckpointFileOutput;
+    using ObservableOutput      = output::ObservableOutput;
+    using TimingsTraceOutput    = output::TimingsTraceOutput;
+    using ReplicaExchangeOutput = output::ReplicaExchangeOutput;
 
     using RPMDRstFileOutput = output::RingPolymerRestartFileOutput;
     using RPMDTrajOutput    = output::RingPolymerTrajectoryOutput;
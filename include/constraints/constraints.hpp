@@ -32,6 +32,8 @@
 #include "distanceConstraint.hpp"   // for DistanceConstraint
 #include "mShake.hpp"               // for MShake
 #include "physicalData.hpp"         // for PhysicalData
+#include "settle.hpp"               // for Settle
+#include "shakeClusters.hpp"        // for ShakeClusters
 #include "timer.hpp"                // for Timer
 #include "typeAliases.hpp"
 
@@ -51,7 +53,9 @@ namespace constraints
     class Constraints : public timings::Timer
     {
        private:
-        MShake _mShake;
+        MShake        _mShake;
+        Settle        _settle;
+        ShakeClusters _shakeClusters;
 
         bool _shakeActivated         = defaults::_CONSTRAINTS_ACTIVE_DEFAULT_;
         bool _mShakeActivated        = defaults::_CONSTRAINTS_ACTIVE_DEFAULT_;
@@ -73,14 +77,19 @@ namespace constraints
         void calculateConstraintBondRefs(const pq::SimBox &simulationBox);
 
         void initMShake();
+        void initSettle(pq::SimBox &simulationBox);
+        void _initSettleFromMShake(pq::SimBox &simulationBox);
+        void _initSettleFromShake();
 
         void applyShake(pq::SimBox &simulationBox);
         void _applyShake(pq::SimBox &simulationBox);
         void _applyMShake(pq::SimBox &simulationBox);
+        void _applySettle(pq::SimBox &simulationBox);
 
         void applyRattle(pq::SimBox &simulationBox);
         void _applyRattle();
         void _applyMRattle(pq::SimBox &simulationBox);
+        void _applySettleRattle(pq::SimBox &simulationBox);
 
         void applyDistanceConstraints(
             const pq::SimBox &,
@@ -120,10 +129,13 @@ namespace constraints
         [[nodiscard]] const pq::BondConstraintsVec &getBondConstraints() const;
         [[nodiscard]] const pq::DistConstraintsVec &getDistConstraints() const;
         [[nodiscard]] const pq::MShakeReferenceVec &getMShakeReferences() const;
+        [[nodiscard]] const ShakeClusters          &getShakeClusters() const;
+        [[nodiscard]] const Settle                 &getSettle() const;
 
         [[nodiscard]] size_t getNumberOfBondConstraints() const;
         [[nodiscard]] size_t getNumberOfMShakeConstraints(pq::SimBox &) const;
         [[nodiscard]] size_t getNumberOfDistanceConstraints() const;
+        [[nodiscard]] size_t getNumberOfSettleMolecules() const;
 
         [[nodiscard]] size_t getShakeMaxIter() const;
         [[nodiscard]] size_t getRattleMaxIter() const;
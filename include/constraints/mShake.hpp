@@ -24,10 +24,11 @@
 
 #define _M_SHAKE_HPP_
 
+#include <set>      // for set
 #include <vector>   // for vector
 
 #include "mShakeReference.hpp"   // for MShakeReference
-#include "matrix.hpp"            // for Matrix
+#include "staticMatrix.hpp"      // for StaticMatrix, StaticLUDecomposition
 #include "typeAliases.hpp"       // for SimBox, Vec3D, MShakeRef
 #include "vector3d.hpp"          // for Vec3D
 
@@ -39,16 +40,28 @@ namespace constraints
      *
      * @brief class containing all information about the mShake algorithm
      *
-     * @details it performs the mShake algorithm on all bond constraints
+     * @details it performs the mShake algorithm on all bond constraints.
+     * All matrices and vectors are of static size, limiting the number of
+     * atoms per M-Shake molecule to _MSHAKE_MAX_ATOMS_.
      */
     class MShake
     {
-       private:
-        pq::MShakeRefVec                 _mShakeReferences;
-        std::vector<std::vector<double>> _mShakeRSquaredRefs;
+       public:
+        static constexpr size_t _MSHAKE_MAX_ATOMS_ = 8;
+        static constexpr size_t _MSHAKE_MAX_BONDS_ =
+            _MSHAKE_MAX_ATOMS_ * (_MSHAKE_MAX_ATOMS_ - 1) / 2;
 
-        std::vector<linearAlgebra::Matrix<double>> _mShakeMatrices;
-        std::vector<linearAlgebra::Matrix<double>> _mShakeInvMatrices;
+        // clang-format off
+        using MShakeMatrix = linearAlgebra::StaticMatrix<double, _MSHAKE_MAX_BONDS_>;
+        using MShakeVector = linearAlgebra::StaticVector<double, _MSHAKE_MAX_BONDS_>;
+        using MShakeLU     = linearAlgebra::StaticLUDecomposition<double, _MSHAKE_MAX_BONDS_>;
+        // clang-format on
+
+       private:
+        pq::MShakeRefVec          _mShakeReferences;
+        std::vector<MShakeVector> _mShakeRSquaredRefs;
+        std::vector<MShakeLU>     _mShakeLUs;
+        std::set<size_t>          _settleMolTypes;
 
        public:
         MShake()  = default;
@@ -68,11 +81,13 @@ namespace constraints
         ) const;
 
         [[nodiscard]] bool   isMShakeType(const size_t moltype) const;
+        [[nodiscard]] bool   isSettleType(const size_t moltype) const;
         [[nodiscard]] size_t findMShakeReferenceIndex(const size_t) const;
         [[nodiscard]] const pq::MShakeRef    &findMShakeRef(const size_t) const;
         [[nodiscard]] const pq::MShakeRefVec &getMShakeReferences() const;
 
         void addMShakeReference(const pq::MShakeRef &mShakeReference);
+        void addSettleType(const size_t moltype);
     };
 }   // namespace constraints
 
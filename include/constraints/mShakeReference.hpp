@@ -61,7 +61,8 @@ namespace constraints
          ***************************/
 
         [[nodiscard]] size_t                 getNumberOfAtoms() const;
-        [[nodiscard]] std::vector<pq::Atom> &getAtoms();
+        [[nodiscard]] std::vector<pq::Atom>       &getAtoms();
+        [[nodiscard]] const std::vector<pq::Atom> &getAtoms() const;
         [[nodiscard]] pq::MoleculeType      &getMoleculeType() const;
     };
 }   // namespace constraints
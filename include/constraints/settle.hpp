@@ -0,0 +1,112 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef _SETTLE_HPP_
+
+#define _SETTLE_HPP_
+
+#include <array>      // for array
+#include <cstddef>    // for size_t
+#include <optional>   // for optional
+#include <vector>     // for vector
+
+#include "typeAliases.hpp"
+
+namespace constraints
+{
+    /**
+     * @brief geometry and mass parameters of a rigid three-site molecule
+     *
+     * @details the molecule consists of an apex atom A and two base atoms B
+     * and C with equal masses and equal distances to A (e.g. O, H, H of
+     * water). The parameters follow Miyamoto and Kollman, J. Comput. Chem.
+     * 13, 952 (1992).
+     */
+    struct SettleParameters
+    {
+        double massA;
+        double massB;
+        double distAB;
+        double distBC;
+
+        double wh;     // massB / total mass
+        double ra;     // distance of A from the center of mass
+        double rb;     // distance of B and C from the center of mass along y
+        double rc;     // half distance between B and C
+        double irc2;   // 1 / distBC
+    };
+
+    /**
+     * @class Settle
+     *
+     * @brief analytic SETTLE solver for rigid three-site molecules
+     *
+     * @details positions are constrained with the analytic SETTLE algorithm
+     * and velocities with the analytic solution of the 3x3 RATTLE system.
+     * Both are non-iterative and processed in parallel over all molecules.
+     */
+    class Settle
+    {
+       private:
+        std::vector<SettleParameters> _parameters;
+
+        std::vector<size_t>     _paramIndices;
+        std::vector<pq::Atom *> _atomsA;
+        std::vector<pq::Atom *> _atomsB;
+        std::vector<pq::Atom *> _atomsC;
+
+        std::vector<pq::Vec3D> _refsAB;
+        std::vector<pq::Vec3D> _refsAC;
+
+       public:
+        [[nodiscard]] static SettleParameters calculateParameters(
+            const double massA,
+            const double massB,
+            const double distAB,
+            const double distBC
+        );
+
+        [[nodiscard]] static std::optional<std::array<size_t, 3>> findApex(
+            const std::array<double, 3> &masses,
+            const std::array<double, 3> &squaredDistances
+        );
+
+        size_t addParameters(const SettleParameters &parameters);
+        void   addMolecule(pq::Atom *, pq::Atom *, pq::Atom *, const size_t);
+
+        void calculateReferences(const pq::SimBox &simBox);
+
+        [[nodiscard]] size_t applySettle(const pq::SimBox &, const double);
+        void                 applySettleRattle(const pq::SimBox &);
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] bool   isActive() const { return !_atomsA.empty(); }
+        [[nodiscard]] size_t getNumberOfMolecules() const;
+        [[nodiscard]] size_t getNumberOfParameters() const;
+    };
+
+}   // namespace constraints
+
+#endif   // _SETTLE_HPP_
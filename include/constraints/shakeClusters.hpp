@@ -0,0 +1,105 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef _SHAKE_CLUSTERS_HPP_
+
+#define _SHAKE_CLUSTERS_HPP_
+
+#include <cstddef>   // for size_t
+#include <vector>    // for vector
+
+#include "typeAliases.hpp"
+
+namespace constraints
+{
+    /**
+     * @class ShakeClusters
+     *
+     * @brief independent clusters of bond constraints in SoA layout
+     *
+     * @details The bond constraints are grouped into connected components
+     * of the constraint graph, i.e. clusters that do not share any atom.
+     * Each cluster is iterated only until it converges and clusters are
+     * processed in parallel. The order of the bonds within a cluster is the
+     * same as in the original bond constraint vector, therefore the results
+     * are identical to the serial SHAKE/RATTLE sweep over all bonds.
+     * Bonds handled by a different algorithm (e.g. SETTLE) can be excluded.
+     */
+    class ShakeClusters
+    {
+       private:
+        bool   _isInitialized    = false;
+        size_t _nBondConstraints = 0;
+
+        std::vector<bool>   _isExcluded;
+        std::vector<size_t> _bondOrder;
+        std::vector<size_t> _clusterOffsets;
+
+        std::vector<pq::Atom *> _atoms1;
+        std::vector<pq::Atom *> _atoms2;
+
+        std::vector<double> _invMasses1;
+        std::vector<double> _invMasses2;
+        std::vector<double> _targetLengthsSquared;
+
+        std::vector<double> _refX;
+        std::vector<double> _refY;
+        std::vector<double> _refZ;
+
+        template <typename Func>
+        size_t iterateClusters(const size_t maxIter, Func &&applyToBond);
+
+        static size_t findRoot(std::vector<size_t> &parents, size_t index);
+
+       public:
+        void init(const pq::BondConstraintsVec &bondConstraints);
+        void update(const pq::BondConstraintsVec &bondConstraints);
+
+        [[nodiscard]] size_t applyShake(
+            const pq::SimBox &simBox,
+            const double      tolerance,
+            const size_t      maxIter,
+            const double      timeStep
+        );
+        [[nodiscard]] size_t applyRattle(
+            const double tolerance,
+            const size_t maxIter
+        );
+
+        void excludeBond(const size_t bondIndex);
+        void reset() { _isInitialized = false; }
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] bool   isInitialized() const { return _isInitialized; }
+        [[nodiscard]] size_t getNumberOfClusters() const;
+        [[nodiscard]] size_t getNumberOfBonds() const;
+
+        [[nodiscard]] const std::vector<size_t> &getBondOrder() const;
+        [[nodiscard]] const std::vector<size_t> &getClusterOffsets() const;
+    };
+
+}   // namespace constraints
+
+#endif   // _SHAKE_CLUSTERS_HPP_
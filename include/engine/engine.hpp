@@ -38,6 +38,7 @@
 #include "potential.hpp"
 #include "potentialBruteForce.hpp"
 #include "potentialCellList.hpp"
+#include "settingsInstance.hpp"
 #include "simulationBox.hpp"
 #include "typeAliases.hpp"
 #include "virial.hpp"
@@ -64,6 +65,9 @@ namespace engine
         size_t _step   = 1;
         size_t _nSteps = 0;
 
+        settings::SettingsInstance _settings =
+            settings::SettingsInstance::getActive();
+
         EngineOutput _engineOutput;
 
         timings::GlobalTimer _timer;
@@ -123,6 +127,8 @@ namespace engine
         [[nodiscard]] pq::Virial       &getVirial();
         [[nodiscard]] pq::Potential    &getPotential();
 
+        [[nodiscard]] settings::SettingsInstance &getSettings();
+
         /*************************
          * output getter methods *
          *************************/
@@ -132,6 +138,8 @@ namespace engine
         [[nodiscard]] pq::StdoutOutput  &getStdoutOutput();
         [[nodiscard]] pq::TimingsOutput &getTimingsOutput();
 
+        [[nodiscard]] pq::TimingsTraceOutput &getTimingsTraceOutput();
+
         [[nodiscard]] pq::TrajectoryOutput &getXyzOutput();
         [[nodiscard]] pq::TrajectoryOutput &getForceOutput();
         [[nodiscard]] pq::InfoOutput       &getInfoOutput();
@@ -181,6 +189,7 @@ namespace engine
         [[nodiscard]] timings::GlobalTimer &getTimer() { return _timer; }
 
         void setTimer(const timings::GlobalTimer &timer) { _timer = timer; }
+        void setStep(const size_t step) { _step = step; }
 
 #ifdef WITH_KOKKOS
         [[nodiscard]] pq::KokkosSimBox    &getKokkosSimulationBox();
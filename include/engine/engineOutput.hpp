@@ -29,10 +29,12 @@
 #include <vector>    // for vector
 
 #include "boxOutput.hpp"
+#include "checkpointFileOutput.hpp"
 #include "energyOutput.hpp"
 #include "infoOutput.hpp"
 #include "logOutput.hpp"
 #include "momentumOutput.hpp"
+#include "observableOutput.hpp"
 #include "optOutput.hpp"
 #include "ringPolymerEnergyOutput.hpp"
 #include "ringPolymerRestartFileOutput.hpp"
@@ -42,6 +44,7 @@
 #include "stressOutput.hpp"
 #include "timer.hpp"   // for Timer
 #include "timingsOutput.hpp"
+#include "timingsTraceOutput.hpp"
 #include "trajectoryOutput.hpp"
 #include "typeAliases.hpp"
 #include "virialOutput.hpp"
@@ -67,6 +70,9 @@ namespace engine
         std::unique_ptr<pq::TrajectoryOutput> _chargeOutput;
         std::unique_ptr<pq::RstFileOutput>    _rstFileOutput;
 
+        std::unique_ptr<pq::CheckpointFileOutput> _checkpointFileOutput;
+        std::unique_ptr<pq::ObservableOutput>     _observableOutput;
+
         std::unique_ptr<pq::LogOutput>    _logOutput;
         std::unique_ptr<pq::StdoutOutput> _stdoutOutput;
 
@@ -84,7 +90,8 @@ namespace engine
         pq::UniqueRPMDTrajOutput    _rpmdChargeOutput;
         pq::UniqueRPMDEnergyOutput  _rpmdEnergyOutput;
 
-        std::unique_ptr<pq::TimingsOutput> _timingsOutput;
+        std::unique_ptr<pq::TimingsOutput>      _timingsOutput;
+        std::unique_ptr<pq::TimingsTraceOutput> _timingsTraceOutput;
 
        public:
         EngineOutput();
@@ -98,11 +105,24 @@ namespace engine
         void writeInfoFile(const double simulationTime, const pq::PhysicalData &);
         void writeRstFile(pq::SimBox &, const pq::Thermostat &, const size_t);
         void writeOptRstFile(pq::SimBox &, const size_t);
+        void writeCheckpointFile(
+            pq::SimBox &,
+            const pq::Thermostat &,
+            const pq::Manostat &,
+            const pq::Integrator &,
+            const size_t
+        );
 
         void writeMomentumFile(const size_t step, const pq::PhysicalData &);
         void writeVirialFile(const size_t, const pq::PhysicalData &);
         void writeStressFile(const size_t, const pq::PhysicalData &);
         void writeBoxFile(const size_t, const pq::Box &);
+        void recordObservables(
+            const size_t,
+            const pq::PhysicalData &,
+            const pq::PhysicalData &,
+            const pq::Box &
+        );
         void writeOptFile(const size_t, const pq::Optimizer &);
 
         void writeRingPolymerRstFile(std::vector<pq::SimBox> &, const size_t);
@@ -112,7 +132,7 @@ namespace engine
         void writeRingPolymerChargeFile(std::vector<pq::SimBox> &);
         void writeRingPolymerEnergyFile(const size_t, const std::vector<pq::PhysicalData> &);
 
-        void writeTimingsFile(timings::GlobalTimer &);
+        void writeTimingsFile(timings::GlobalTimer &, const size_t);
 
         /***************************
          * standard getter methods *
@@ -137,6 +157,9 @@ namespace engine
 
         [[nodiscard]] pq::OptOutput &getOptOutput();
 
+        [[nodiscard]] pq::CheckpointFileOutput &getCheckpointFileOutput();
+        [[nodiscard]] pq::ObservableOutput     &getObservableOutput();
+
         [[nodiscard]] pq::RPMDRstFileOutput &getRingPolymerRstFileOutput();
         [[nodiscard]] pq::RPMDTrajOutput    &getRingPolymerXyzOutput();
         [[nodiscard]] pq::RPMDTrajOutput    &getRingPolymerVelOutput();
@@ -144,7 +167,8 @@ namespace engine
         [[nodiscard]] pq::RPMDTrajOutput    &getRingPolymerChargeOutput();
         [[nodiscard]] pq::RPMDEnergyOutput  &getRingPolymerEnergyOutput();
 
-        [[nodiscard]] pq::TimingsOutput &getTimingsOutput();
+        [[nodiscard]] pq::TimingsOutput      &getTimingsOutput();
+        [[nodiscard]] pq::TimingsTraceOutput &getTimingsTraceOutput();
     };
 
 }   // namespace engine
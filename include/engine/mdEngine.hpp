@@ -24,9 +24,12 @@
 
 #define _MD_ENGINE_HPP_
 
+#include <memory>   // for unique_ptr
+
 #include "engine.hpp"
 #include "integrator.hpp"
 #include "manostat.hpp"
+#include "outputThread.hpp"   // for OutputThread
 #include "resetKinetics.hpp"
 #include "thermostat.hpp"
 #include "typeAliases.hpp"
@@ -48,6 +51,10 @@ namespace engine
        protected:
         pq::ResetKinetics _resetKinetics;
 
+        std::unique_ptr<OutputThread> _outputThread;
+
+        bool _isFusedUpdate = false;
+
         // clang-format off
         pq::UniqueIntegrator _integrator = std::make_unique<pq::VelocityVerlet>();
         pq::UniqueThermostat _thermostat = std::make_unique<pq::Thermostat>();
@@ -59,11 +66,21 @@ namespace engine
         ~MDEngine() override = default;
 
         void run() override;
+        void startRun();
+        void finishRun();
         void writeOutput() override;
         virtual void takeStep();
 
         void takeStepBeforeForces();
         void takeStepAfterForces();
+        void applyFusedUpdate(const bool calculateKinetics);
+        void submitOutputFrame(const size_t effStep, const double simTime);
+
+        [[nodiscard]] bool canFuseUpdate() const;
+        [[nodiscard]] bool isOutputStep() const;
+        [[nodiscard]] bool isKineticsRequired() const;
+        [[nodiscard]] bool isVirialRequired() const;
+        [[nodiscard]] bool isManostatVirialBased() const;
 
         virtual void calculateForces() = 0;
 
@@ -71,6 +88,8 @@ namespace engine
          * standard getter methods *
          ***************************/
 
+        [[nodiscard]] bool isFusedUpdate() const { return _isFusedUpdate; }
+
         [[nodiscard]] pq::ResetKinetics     &getResetKinetics();
         [[nodiscard]] pq::Integrator        &getIntegrator();
         [[nodiscard]] pq::Thermostat        &getThermostat();
@@ -89,6 +108,9 @@ namespace engine
         [[nodiscard]] pq::RPMDTrajOutput    &getRingPolymerChargeOutput();
         [[nodiscard]] pq::RPMDEnergyOutput  &getRingPolymerEnergyOutput();
 
+        [[nodiscard]] pq::CheckpointFileOutput &getCheckpointFileOutput();
+        [[nodiscard]] pq::ObservableOutput     &getObservableOutput();
+
         /***************************
          * make unique_ptr methods *
          ***************************/
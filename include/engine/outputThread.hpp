@@ -0,0 +1,105 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _OUTPUT_THREAD_HPP_
+
+#define _OUTPUT_THREAD_HPP_
+
+#include <array>                // for array
+#include <condition_variable>   // for condition_variable
+#include <cstddef>              // for size_t
+#include <exception>            // for exception_ptr
+#include <mutex>                // for mutex
+#include <queue>                // for queue
+#include <thread>               // for thread
+#include <vector>               // for vector
+
+#include "frameSnapshot.hpp"   // for FrameSnapshot
+#include "timer.hpp"           // for Timer
+
+namespace settings
+{
+    class SettingsInstance;   // forward declaration
+}   // namespace settings
+
+namespace engine
+{
+    class EngineOutput;   // forward declaration
+
+    /**
+     * @class OutputThread
+     *
+     * @brief writes the MD output files on a background thread
+     *
+     * @details The simulation thread captures each output frame into one of
+     * two reusable snapshot buffers and hands it over to the writer thread,
+     * which formats and writes all output files of the frame. While the
+     * writer works on one buffer the simulation thread can fill the other
+     * one. If both buffers are still pending the simulation thread blocks
+     * until the writer has finished a frame (back-pressure). Exceptions
+     * thrown on the writer thread are rethrown on the simulation thread.
+     * The writer thread uses the settings instance that was active on the
+     * simulation thread when the output thread was constructed.
+     */
+    class OutputThread : public timings::Timer
+    {
+       private:
+        static constexpr size_t _N_BUFFERS_ = 2;
+
+        EngineOutput               &_engineOutput;
+        settings::SettingsInstance &_settings;
+
+        std::array<pq::FrameSnapshot, _N_BUFFERS_> _snapshots;
+
+        std::vector<size_t> _freeBuffers;
+        std::queue<size_t>  _pendingBuffers;
+        size_t              _acquiredBuffer = _N_BUFFERS_;
+
+        bool               _isBusy = false;
+        bool               _stop   = false;
+        std::exception_ptr _exception;
+
+        std::mutex              _mutex;
+        std::condition_variable _condition;
+        std::thread             _thread;
+
+        void run();
+        void writeFrame(const pq::FrameSnapshot &);
+        void rethrowException();
+
+       public:
+        explicit OutputThread(EngineOutput &engineOutput);
+        ~OutputThread();
+
+        OutputThread(const OutputThread &)            = delete;
+        OutputThread &operator=(const OutputThread &) = delete;
+
+        [[nodiscard]] pq::FrameSnapshot &acquireSnapshot();
+
+        void submitSnapshot();
+        void flush();
+    };
+
+}   // namespace engine
+
+#endif   // _OUTPUT_THREAD_HPP_
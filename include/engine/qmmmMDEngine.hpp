@@ -24,7 +24,10 @@
 
 #define _QM_MM_MD_ENGINE_HPP_
 
+#include <vector>   // for vector
+
 #include "hybridMDEngine.hpp"
+#include "typeAliases.hpp"
 
 namespace engine
 {
@@ -32,16 +35,39 @@ namespace engine
      * @brief class QMMMMDEngine
      *
      * @details This class is a class that inherits from HybridMDEngine
-     * and is used to implement the QM/MM MD engine.
+     * and is used to implement the adaptive QM/MM MD engine. In every step the
+     * QM region is selected around the QM center, the QM forces are blended
+     * with the MM forces in the smoothing region and the MM atoms within the
+     * layer radius are passed as point charges to the QM runner. The MM
+     * interaction between QM and MM atoms, which the QM program does not
+     * know of, is kept as coupling force of the QM atoms.
      *
      */
     class QMMMMDEngine : public HybridMDEngine
     {
+       private:
+        pq::SharedAtomVec   _previousQMAtoms;
+        pq::Vec3DVec        _mmForcesQMAtoms;
+        pq::Vec3DVec        _couplingForces;
+        std::vector<double> _smoothingFactors;
+        std::vector<bool>   _isQMMolecule;
+
+        [[nodiscard]] bool isPointCharge(const pq::Vec3D &, const pq::Vec3D &)
+            const;
+
        public:
         QMMMMDEngine()  = default;
         ~QMMMMDEngine() = default;
 
-        void calculateForces() override {};   // TODO: implement
+        void calculateForces() override;
+
+        void updateQMRegion(const pq::Vec3D &qmCenter);
+        void updatePointCharges(const pq::Vec3D &qmCenter);
+        void calculateCouplingForces(const pq::Vec3D &qmCenter);
+        void subtractIntraEnergies();
+        void mixForces();
+
+        [[nodiscard]] static double calculateSmoothingFactor(const double);
     };
 
 }   // namespace engine
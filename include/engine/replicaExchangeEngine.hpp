@@ -0,0 +1,141 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef _REPLICA_EXCHANGE_ENGINE_HPP_
+
+#define _REPLICA_EXCHANGE_ENGINE_HPP_
+
+#include <atomic>      // for atomic
+#include <barrier>     // for barrier
+#include <cstddef>     // for size_t
+#include <deque>       // for deque
+#include <exception>   // for exception_ptr
+#include <memory>      // for unique_ptr
+#include <random>      // for mt19937, uniform_real_distribution
+#include <string>      // for string
+#include <vector>      // for vector
+
+#include "engine.hpp"                  // for Engine
+#include "mdEngine.hpp"                // for MDEngine
+#include "replicaExchangeOutput.hpp"   // for ReplicaExchangeOutput
+#include "trajectoryOutput.hpp"        // for TrajectoryOutput
+
+class progressbar;   // forward declaration
+
+namespace engine
+{
+    /**
+     * @class ReplicaExchangeEngine
+     *
+     * @brief temperature replica exchange (parallel tempering) engine
+     *
+     * @details every replica is a complete MD engine with its own settings
+     * instance and output files. The replicas are propagated concurrently,
+     * one thread per replica, and meet at a barrier every exchange frequency
+     * steps. At the barrier swaps of the temperatures of neighbouring
+     * replicas are attempted with the Metropolis criterion, alternating
+     * between the even and the odd pairs of temperatures. On an accepted
+     * swap the target temperature of the thermostats is exchanged and the
+     * velocities are rescaled to the new temperature.
+     */
+    class ReplicaExchangeEngine : public Engine
+    {
+       private:
+        /**
+         * @brief completion step of the barrier at the exchange steps
+         */
+        struct ExchangeCompletion
+        {
+            ReplicaExchangeEngine *_engine;
+
+            void operator()() const noexcept { _engine->attemptExchanges(); }
+        };
+
+        using ExchangeBarrier = std::barrier<ExchangeCompletion>;
+
+        std::vector<std::unique_ptr<MDEngine>> _replicas;
+
+        std::vector<double> _temperatures;
+        std::vector<double> _potentialEnergies;
+        std::vector<size_t> _replicaOfTemperature;
+        std::vector<size_t> _nAttempts;
+        std::vector<size_t> _nAccepted;
+
+        size_t _exchangeFrequency = 0;
+        size_t _nExchanges        = 0;
+        size_t _exchangeStep      = 0;
+
+        std::atomic<bool>  _isFailed = false;
+        std::exception_ptr _exchangeException;
+        progressbar       *_progressbar = nullptr;
+
+        std::mt19937                           _generator;
+        std::uniform_real_distribution<double> _distribution{0.0, 1.0};
+
+        pq::ReplicaExchangeOutput        _replicaExchangeOutput{"default.rex"};
+        std::deque<pq::TrajectoryOutput> _temperatureTrajOutputs;
+
+        void runReplica(const size_t replica, ExchangeBarrier &barrier);
+        void setReplicaTemperature(const size_t, const double, const double);
+
+       public:
+        ReplicaExchangeEngine();
+
+        void run() override;
+        void writeOutput() override;
+
+        void addReplica(std::unique_ptr<MDEngine> replica);
+        void attemptExchanges() noexcept;
+        void setupOutputFiles(const std::string &replicaExchangeFileName);
+
+        [[nodiscard]] bool isExchangeAccepted(
+            const size_t temperatureIndex,
+            const double random
+        ) const;
+
+        /***************************
+         * standard setter methods *
+         ***************************/
+
+        void setTemperatures(const std::vector<double> &temperatures);
+        void setExchangeFrequency(const size_t exchangeFrequency);
+        void setPotentialEnergy(const size_t replica, const double energy);
+        void setSeed(const size_t seed);
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] size_t getNumberOfReplicas() const;
+        [[nodiscard]] size_t getNumberOfExchanges() const;
+
+        [[nodiscard]] MDEngine                  &getReplica(const size_t);
+        [[nodiscard]] const std::vector<size_t> &getReplicaOfTemperature(
+        ) const;
+        [[nodiscard]] const std::vector<size_t> &getNumberOfAttempts() const;
+        [[nodiscard]] const std::vector<size_t> &getNumberOfAccepted() const;
+
+        [[nodiscard]] pq::ReplicaExchangeOutput &getReplicaExchangeOutput();
+    };
+}   // namespace engine
+
+#endif   // _REPLICA_EXCHANGE_ENGINE_HPP_
@@ -54,6 +54,7 @@ namespace forceField
             const size_t                       type
         );
 
+        template <bool computeForces = true>
         void calculateEnergyAndForces(
             const pq::SimBox     &simBox,
             pq::PhysicalData     &data,
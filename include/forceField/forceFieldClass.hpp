@@ -25,7 +25,9 @@
 #define _Force_FIELD_CLASS_HPP_
 
 #include <cstddef>
+#include <functional>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "angleForceField.hpp"
@@ -36,10 +38,13 @@
 #include "dihedralType.hpp"
 #include "jCouplingForceField.hpp"
 #include "jCouplingType.hpp"
+#include "packedBondedTerms.hpp"
 #include "typeAliases.hpp"
 
 namespace forceField
 {
+    using MoleculeWeight = std::function<double(const pq::Molecule *)>;
+
     /**
      * @class ForceField
      *
@@ -63,18 +68,36 @@ namespace forceField
         std::vector<DihedralType>  _improperDihedralTypes;
         std::vector<JCouplingType> _jCouplingTypes;
 
+        // id -> index into the type vectors for constant time lookups
+        std::unordered_map<size_t, size_t> _bondTypeIndices;
+        std::unordered_map<size_t, size_t> _angleTypeIndices;
+        std::unordered_map<size_t, size_t> _dihedralTypeIndices;
+        std::unordered_map<size_t, size_t> _improperTypeIndices;
+        std::unordered_map<size_t, size_t> _jCouplingTypeIndices;
+
+        PackedBondedTerms _packedBondedTerms;
+
         std::shared_ptr<pq::NonCoulombPot> _nonCoulombPot;
         std::shared_ptr<pq::CoulombPot>    _coulombPotential;
 
        public:
         std::shared_ptr<ForceField> clone() const;
 
+        template <bool computeForces = true>
         void calculateBondedInteractions(const pq::SimBox &, pq::PhysicalData &);
         void calculateBondInteractions(const pq::SimBox &, pq::PhysicalData &);
         void calculateAngleInteractions(const pq::SimBox &, pq::PhysicalData &);
         void calculateDihedralInteractions(const pq::SimBox &, pq::PhysicalData &);
         void calculateImproperDihedralInteractions(const pq::SimBox &, pq::PhysicalData &);
         void calculateJCouplingInteractions(const pq::SimBox &, pq::PhysicalData &);
+        template <bool computeForces = true>
+        void calculateLinkerInteractions(const pq::SimBox &, pq::PhysicalData &);
+
+        void calculateWeightedBondedEnergies(
+            const pq::SimBox &,
+            pq::PhysicalData &,
+            const MoleculeWeight &
+        );
 
         const BondType      &findBondTypeById(size_t id) const;
         const AngleType     &findAngleTypeById(size_t id) const;
@@ -143,6 +166,7 @@ namespace forceField
         [[nodiscard]] const std::vector<DihedralType> &getDihedralTypes() const;
         [[nodiscard]] const std::vector<DihedralType> &getImproperTypes() const;
         [[nodiscard]] const std::vector<JCouplingType> &getJCouplTypes() const;
+        [[nodiscard]] const PackedBondedTerms &getPackedBondedTerms() const;
     };
 
 }   // namespace forceField
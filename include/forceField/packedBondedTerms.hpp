@@ -0,0 +1,123 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _PACKED_BONDED_TERMS_HPP_
+
+#define _PACKED_BONDED_TERMS_HPP_
+
+#include <array>     // for array
+#include <cstddef>         // for size_t
+#include <unordered_map>   // for unordered_map
+#include <vector>          // for vector
+
+#include "angleForceField.hpp"      // for AngleForceField
+#include "bondForceField.hpp"       // for BondForceField
+#include "dihedralForceField.hpp"   // for DihedralForceField
+#include "typeAliases.hpp"
+
+namespace forceField
+{
+    /**
+     * @class PackedBondedTerms
+     *
+     * @brief packed SoA representation of all bonds, angles, dihedrals and
+     * improper dihedrals
+     *
+     * @details each term stores indices into a flat table of all atoms
+     * participating in bonded interactions, while the type parameters are
+     * stored in separate contiguous arrays per term family. The families are
+     * processed in parallel, each thread accumulating its forces and virial
+     * into its own buffer, which are reduced afterwards. Linker terms need
+     * the non-bonded correction of the respective molecule pair and are
+     * therefore not packed - their indices are kept to be evaluated via the
+     * force field objects.
+     */
+    class PackedBondedTerms
+    {
+       private:
+        bool _isBuilt = false;
+
+        std::vector<pq::Atom *>                     _atoms;
+        std::unordered_map<const pq::Atom *, size_t> _atomToIndex;
+
+        std::vector<std::array<size_t, 2>> _bondAtoms;
+        std::vector<double>                _bondForceConstants;
+        std::vector<double>                _bondEquilLengths;
+
+        std::vector<std::array<size_t, 3>> _angleAtoms;
+        std::vector<double>                _angleForceConstants;
+        std::vector<double>                _angleEquilAngles;
+
+        size_t                             _nProperDihedrals = 0;
+        std::vector<std::array<size_t, 4>> _dihedralAtoms;
+        std::vector<double>                _dihedralForceConstants;
+        std::vector<double>                _dihedralPeriodicities;
+        std::vector<double>                _dihedralPhaseShifts;
+
+        std::vector<size_t> _linkerBonds;
+        std::vector<size_t> _linkerAngles;
+        std::vector<size_t> _linkerDihedrals;
+        std::vector<size_t> _linkerImproperDihedrals;
+
+        std::vector<std::vector<pq::Vec3D>> _threadForces;
+        std::vector<pq::tensor3D>           _threadVirials;
+
+        size_t addAtom(pq::Molecule *molecule, const size_t atomIndex);
+        void   addDihedrals(
+              const std::vector<DihedralForceField> &dihedrals,
+              std::vector<size_t>                   &linkers
+          );
+
+       public:
+        void build(
+            const std::vector<BondForceField>     &bonds,
+            const std::vector<AngleForceField>    &angles,
+            const std::vector<DihedralForceField> &dihedrals,
+            const std::vector<DihedralForceField> &improperDihedrals
+        );
+
+        template <bool computeForces = true>
+        void calculate(const pq::SimBox &, pq::PhysicalData &);
+
+        void reset() { _isBuilt = false; }
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] bool   isBuilt() const { return _isBuilt; }
+        [[nodiscard]] size_t getNumberOfAtoms() const;
+        [[nodiscard]] size_t getNumberOfBonds() const;
+        [[nodiscard]] size_t getNumberOfAngles() const;
+        [[nodiscard]] size_t getNumberOfDihedrals() const;
+        [[nodiscard]] size_t getNumberOfImproperDihedrals() const;
+
+        [[nodiscard]] const std::vector<size_t> &getLinkerBonds() const;
+        [[nodiscard]] const std::vector<size_t> &getLinkerAngles() const;
+        [[nodiscard]] const std::vector<size_t> &getLinkerDihedrals() const;
+        [[nodiscard]] const std::vector<size_t> &getLinkerImpropers() const;
+    };
+
+}   // namespace forceField
+
+#endif   // _PACKED_BONDED_TERMS_HPP_
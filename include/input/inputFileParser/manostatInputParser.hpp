@@ -49,6 +49,8 @@ namespace input
         void parseManostatRelaxationTime(const pq::strings &, const size_t);
         void parseCompressibility(const pq::strings &, const size_t);
         void parseIsotropy(const pq::strings &, const size_t);
+        void parseMonteCarloFrequency(const pq::strings &, const size_t);
+        void parseVolumeChange(const pq::strings &, const size_t);
     };
 
 }   // namespace input
@@ -41,6 +41,15 @@ namespace input
         explicit OptInputParser(pq::Engine &);
 
         void parseOptimizer(const pq::strings &, const size_t);
+        void parseLBFGSMemory(const pq::strings &, const size_t);
+
+        void parseFireTimestep(const pq::strings &, const size_t);
+        void parseFireMaxTimestep(const pq::strings &, const size_t);
+        void parseFireNMin(const pq::strings &, const size_t);
+        void parseFireTimestepIncrease(const pq::strings &, const size_t);
+        void parseFireTimestepDecrease(const pq::strings &, const size_t);
+        void parseFireAlphaStart(const pq::strings &, const size_t);
+        void parseFireAlphaDecrease(const pq::strings &, const size_t);
 
         void parseLearningRateStrategy(const pq::strings &, const size_t);
         void parseInitialLearningRate(const pq::strings &, const size_t);
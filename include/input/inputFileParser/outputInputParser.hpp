@@ -46,6 +46,9 @@ namespace input
 
         void parseOutputFreq(const pq::strings &, const size_t);
         void parseFilePrefix(const pq::strings &, const size_t);
+        void parseAsyncOutput(const pq::strings &, const size_t);
+        void parseObservableOutput(const pq::strings &, const size_t);
+        void parseTimingsTrace(const pq::strings &, const size_t);
 
         void parseLogFilename(const pq::strings &, const size_t);
         void parseRefFilename(const pq::strings &, const size_t);
@@ -56,6 +59,8 @@ namespace input
         void parseVelocityFilename(const pq::strings &, const size_t);
         void parseForceFilename(const pq::strings &, const size_t);
         void parseRestartFilename(const pq::strings &, const size_t);
+        void parseCheckpointFilename(const pq::strings &, const size_t);
+        void parseObservableFilename(const pq::strings &, const size_t);
         void parseChargeFilename(const pq::strings &, const size_t);
         void parseMomentumFilename(const pq::strings &, const size_t);
 
@@ -63,6 +68,7 @@ namespace input
         void parseStressFilename(const pq::strings &, const size_t);
         void parseBoxFilename(const pq::strings &, const size_t);
         void parseTimingsFilename(const pq::strings &, const size_t);
+        void parseTimingsTraceFilename(const pq::strings &, const size_t);
         void parseOptFilename(const pq::strings &, const size_t);
 
         void parseRPMDRestartFilename(const pq::strings &, const size_t);
@@ -71,6 +77,8 @@ namespace input
         void parseRPMDForceFilename(const pq::strings &, const size_t);
         void parseRPMDChargeFilename(const pq::strings &, const size_t);
         void parseRPMDEnergyFilename(const pq::strings &, const size_t);
+
+        void parseReplicaExchangeFilename(const pq::strings &, const size_t);
     };
 
 }   // namespace input
@@ -47,6 +47,7 @@ namespace input
         void parseCoulombRadius(const pq::strings &, const size_t);
         void parseDensity(const pq::strings &, const size_t);
         void parseInitializeVelocities(const pq::strings &, const size_t);
+        void parseHMRHydrogenMass(const pq::strings &, const size_t);
     };
 
 }   // namespace input
@@ -46,6 +46,7 @@ namespace input
 
         void parseTimeStep(const pq::strings &, const size_t);
         void parseNumberOfSteps(const pq::strings &, const size_t);
+        void parseHardwareCounters(const pq::strings &, const size_t);
     };
 
 }   // namespace input
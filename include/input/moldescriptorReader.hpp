@@ -24,11 +24,11 @@
 
 #define _MOLDESCRIPTOR_READER_HPP_
 
-#include <fstream>   // for ifstream
-#include <string>    // for string
-#include <vector>    // for vector
+#include <string>   // for string
+#include <vector>   // for vector
 
 #include "defaults.hpp"
+#include "mappedFile.hpp"   // for MappedFile
 #include "typeAliases.hpp"
 
 namespace input::molDescriptor
@@ -44,9 +44,9 @@ namespace input::molDescriptor
     class MoldescriptorReader
     {
        private:
-        int           _lineNumber;
-        std::string   _fileName = defaults::_MOLDESCRIPTOR_FILE_DEFAULT_;
-        std::ifstream _fp;
+        int                   _lineNumber;
+        std::string           _fileName;
+        utilities::MappedFile _fp;
 
         pq::Engine &_engine;
 
@@ -24,12 +24,12 @@
 
 #define _PARAMETER_FILE_READER_HPP_
 
-#include <fstream>   // for ifstream
-#include <memory>    // for unique_ptr
+#include <memory>   // for unique_ptr
 #include <string>
 #include <string_view>   // for string_view
 #include <vector>        // for vector
 
+#include "mappedFile.hpp"   // for MappedFile
 #include "parameterFileSection.hpp"
 #include "typeAliases.hpp"
 
@@ -47,9 +47,9 @@ namespace input::parameterFile
     class ParameterFileReader
     {
        private:
-        std::string   _fileName;
-        std::ifstream _fp;
-        pq::Engine   &_engine;
+        std::string           _fileName;
+        utilities::MappedFile _fp;
+        pq::Engine           &_engine;
 
         pq::UniqueParamFileSectionVec _parameterFileSections;
 
@@ -24,10 +24,10 @@
 
 #define _PARAMETER_FILE_SECTION_HPP_
 
-#include <iosfwd>   // for ifstream
 #include <string>   // for string, allocator
 #include <vector>   // for vector
 
+#include "mappedFile.hpp"   // for MappedFile
 #include "typeAliases.hpp"
 namespace input::parameterFile
 {
@@ -40,8 +40,8 @@ namespace input::parameterFile
     class ParameterFileSection
     {
        protected:
-        int            _lineNumber;
-        std::ifstream *_fp;
+        int                    _lineNumber;
+        utilities::MappedFile *_fp;
 
        public:
         virtual ~ParameterFileSection() = default;
@@ -54,7 +54,7 @@ namespace input::parameterFile
         virtual void processHeader(pq::strings &lineElements, pq::Engine &) = 0;
 
         void setLineNumber(const int lineNumber);
-        void setFp(std::ifstream *fp);
+        void setFp(utilities::MappedFile *fp);
 
         [[nodiscard]] int getLineNumber() const;
     };
@@ -49,11 +49,15 @@ namespace input::restartFile
     class AtomSection : public RestartFileSection
     {
        private:
-        void processQMAtomLine(pq::strings &lineElements, pq::SimBox &);
-        void processAtomLine(pq::strings &, pq::SimBox &, pq::Molecule &) const;
+        void processQMAtomLine(pq::stringViews &, pq::SimBox &);
+        void processAtomLine(
+            pq::stringViews &,
+            pq::SimBox &,
+            pq::Molecule &
+        ) const;
 
-        void checkAtomLine(pq::strings &lineElements, const pq::Molecule &);
-        void setAtomPropertyVectors(pq::strings &, pq::SharedAtom &) const;
+        void checkAtomLine(pq::stringViews &, const pq::Molecule &);
+        void setAtomPropertyVectors(pq::stringViews &, pq::SharedAtom &) const;
 
 #ifdef WITH_TESTS
         FRIEND_TEST(::TestAtomSection, testProcessAtomLine);
@@ -61,8 +65,9 @@ namespace input::restartFile
 #endif
 
        public:
-        void checkNumberOfLineArguments(pq::strings &) const;
+        void checkNumberOfLineArguments(pq::stringViews &) const;
         void process(pq::strings &lineElements, pq::Engine &) override;
+        void processViews(pq::stringViews &, pq::Engine &) override;
 
         [[nodiscard]] std::string keyword() override;
         [[nodiscard]] bool        isHeader() override;
@@ -43,6 +43,8 @@ namespace input::restartFile
        public:
         void process(pq::strings &lineElements, pq::Engine &) override;
 
+        static void setBox(const pq::Vec3D &, const pq::Vec3D &, pq::Engine &);
+
         [[nodiscard]] std::string keyword() override;
         [[nodiscard]] bool        isHeader() override;
     };
@@ -0,0 +1,77 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _CHECKPOINT_FILE_READER_HPP_
+
+#define _CHECKPOINT_FILE_READER_HPP_
+
+#include <cstddef>   // for size_t
+#include <string>    // for string
+#include <vector>    // for vector
+
+#include "typeAliases.hpp"
+
+namespace input::restartFile
+{
+    /**
+     * @class CheckpointFileReader
+     *
+     * @brief Reads a binary checkpoint file and sets the simulation box in
+     * the engine
+     *
+     * @details The whole file is read with a single read call and the
+     * header is validated before any data is used. Positions, velocities
+     * and forces are copied in bulk from the file buffer. For the layout of
+     * the file see output::CheckpointFileOutput.
+     */
+    class CheckpointFileReader
+    {
+       private:
+        const std::string _fileName;
+        pq::Engine       &_engine;
+
+        std::string _data;
+        size_t      _offset = 0;
+
+        template <typename T>
+        [[nodiscard]] T readValue();
+
+        template <typename T>
+        [[nodiscard]] std::vector<T> readArray(const size_t);
+
+        [[nodiscard]] std::string readString();
+
+        void readHeader();
+        void readAtoms();
+
+       public:
+        CheckpointFileReader(const std::string &, pq::Engine &);
+
+        void read();
+
+        [[nodiscard]] static bool isCheckpointFile(const std::string &);
+    };
+
+}   // namespace input::restartFile
+
+#endif   // _CHECKPOINT_FILE_READER_HPP_
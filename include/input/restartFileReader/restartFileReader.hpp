@@ -24,12 +24,12 @@
 
 #define _RESTART_FILE_READER_HPP_
 
-#include <fstream>   // for ifstream
-#include <memory>    // for unique_ptr, make_unique
-#include <string>    // for string
-#include <vector>    // for vector
+#include <memory>   // for unique_ptr, make_unique
+#include <string>   // for string
+#include <vector>   // for vector
 
 #include "atomSection.hpp"          // for AtomSection
+#include "mappedFile.hpp"           // for MappedFile
 #include "restartFileSection.hpp"   // for RstFileSection
 #include "typeAliases.hpp"
 
@@ -46,9 +46,9 @@ namespace input::restartFile
     class RestartFileReader
     {
        private:
-        const std::string _fileName;
-        std::ifstream     _fp;
-        pq::Engine       &_engine;
+        const std::string     _fileName;
+        utilities::MappedFile _fp;
+        pq::Engine           &_engine;
 
         pq::UniqueRestartSection _atomSection = std::make_unique<AtomSection>();
         pq::UniqueRestartSectionVec _sections;
@@ -57,7 +57,7 @@ namespace input::restartFile
         RestartFileReader(const std::string &, pq::Engine &);
 
         void                read();
-        RestartFileSection *determineSection(pq::strings &lineElements);
+        RestartFileSection *determineSection(pq::stringViews &lineElements);
     };
 
 }   // namespace input::restartFile
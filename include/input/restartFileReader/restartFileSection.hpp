@@ -24,10 +24,10 @@
 
 #define _RESTART_FILE_SECTION_HPP_
 
-#include <fstream>   // for ifstream
-#include <string>    // for string, allocator
-#include <vector>    // for vector
+#include <string>   // for string, allocator
+#include <vector>   // for vector
 
+#include "mappedFile.hpp"   // for MappedFile
 #include "typeAliases.hpp"
 
 namespace input::restartFile
@@ -42,12 +42,13 @@ namespace input::restartFile
     {
        public:
         virtual ~RestartFileSection() = default;
-        int            _lineNumber;
-        std::ifstream *_fp;
+        int                    _lineNumber;
+        utilities::MappedFile *_fp;
 
         virtual std::string keyword()                                 = 0;
         virtual bool        isHeader()                                = 0;
         virtual void process(pq::strings &lineElements, pq::Engine &) = 0;
+        virtual void processViews(pq::stringViews &, pq::Engine &);
     };
 
 }   // namespace input::restartFile
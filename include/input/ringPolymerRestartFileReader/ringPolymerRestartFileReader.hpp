@@ -24,9 +24,9 @@
 
 #define _RING_POLYMER_RESTART_FILE_READER_HPP_
 
-#include <fstream>   // IWYU pragma: keep
-#include <string>    // for string
+#include <string>   // for string
 
+#include "mappedFile.hpp"   // for MappedFile
 #include "typeAliases.hpp"
 
 namespace input::ringPolymer
@@ -43,7 +43,7 @@ namespace input::ringPolymer
     {
        private:
         const std::string      _fileName;
-        std::ifstream          _fp;
+        utilities::MappedFile  _fp;
         pq::RingPolymerEngine &_engine;
 
        public:
@@ -27,6 +27,7 @@
 #include <string>   // for allocator, string
 #include <vector>   // for vector
 
+#include "bondForceField.hpp"    // for BondForceField
 #include "topologySection.hpp"   // for TopologySection
 #include "typeAliases.hpp"
 
@@ -40,8 +41,20 @@ namespace input::topology
      */
     class BondSection : public TopologySection
     {
+       private:
+        [[nodiscard]] forceField::BondForceField parseBond(
+            pq::strings &,
+            pq::SimBox &,
+            const int
+        ) const;
+
        public:
         void processSection(pq::strings &, pq::Engine &) override;
+        void processLines(
+            const pq::stringViews &,
+            const std::vector<int> &,
+            pq::Engine &
+        ) override;
 
         [[nodiscard]] std::string keyword() override;
         void                      endedNormally(const bool) const override;
@@ -24,6 +24,9 @@
 
 #define _DIHEDRAL_SECTION_HPP_
 
+#include <vector>   // for vector
+
+#include "dihedralForceField.hpp"   // for DihedralForceField
 #include "topologySection.hpp"
 #include "typeAliases.hpp"
 
@@ -37,8 +40,20 @@ namespace input::topology
      */
     class DihedralSection : public TopologySection
     {
+       private:
+        [[nodiscard]] forceField::DihedralForceField parseDihedral(
+            pq::strings &,
+            pq::SimBox &,
+            const int
+        ) const;
+
        public:
-        void processSection(pq::strings&, pq::Engine&) override;
+        void processSection(pq::strings &, pq::Engine &) override;
+        void processLines(
+            const pq::stringViews &,
+            const std::vector<int> &,
+            pq::Engine &
+        ) override;
 
         [[nodiscard]] std::string keyword() override;
         void                      endedNormally(const bool) const override;
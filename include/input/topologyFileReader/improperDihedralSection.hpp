@@ -24,6 +24,9 @@
 
 #define _IMPROPER_DIHEDRAL_SECTION_HPP_
 
+#include <vector>   // for vector
+
+#include "dihedralForceField.hpp"   // for DihedralForceField
 #include "topologySection.hpp"
 #include "typeAliases.hpp"
 namespace input::topology
@@ -36,8 +39,20 @@ namespace input::topology
      */
     class ImproperDihedralSection : public TopologySection
     {
+       private:
+        [[nodiscard]] forceField::DihedralForceField parseImproperDihedral(
+            pq::strings &,
+            pq::SimBox &,
+            const int
+        ) const;
+
        public:
         void processSection(pq::strings &, pq::Engine &) override;
+        void processLines(
+            const pq::stringViews &,
+            const std::vector<int> &,
+            pq::Engine &
+        ) override;
 
         [[nodiscard]] std::string keyword() override;
         void                      endedNormally(const bool) const override;
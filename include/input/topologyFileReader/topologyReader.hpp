@@ -24,12 +24,12 @@
 
 #define _TOPOLOGY_READER_HPP_
 
-#include <fstream>   // for ifstream
 #include <memory>
 #include <string>
 #include <string_view>   // for string_view
 #include <vector>        // for vector
 
+#include "mappedFile.hpp"   // for MappedFile
 #include "topologySection.hpp"
 #include "typeAliases.hpp"
 
@@ -47,9 +47,9 @@ namespace input::topology
     class TopologyReader
     {
        private:
-        std::string     _fileName;
-        std::ifstream   _fp;
-        engine::Engine &_engine;
+        std::string           _fileName;
+        utilities::MappedFile _fp;
+        engine::Engine       &_engine;
 
         std::vector<std::unique_ptr<TopologySection>> _topologySections;
 
@@ -24,10 +24,10 @@
 
 #define _TOPOLOGY_SECTION_HPP_
 
-#include <iosfwd>   // for ifstream
 #include <string>   // for string, allocator
 #include <vector>   // for vector
 
+#include "mappedFile.hpp"   // for MappedFile
 #include "typeAliases.hpp"
 
 namespace input::topology
@@ -37,28 +37,47 @@ namespace input::topology
      *
      * @brief base class for reading topology file sections
      *
+     * @details all lines of a section are collected first and then handed to
+     * processLines. By default they are processed one by one with
+     * processSection. Sections with many lines override processLines and
+     * parse the lines in parallel with parseLines.
      */
     class TopologySection
     {
        protected:
-        int            _lineNumber;
-        std::ifstream *_fp;
+        int                    _lineNumber;
+        utilities::MappedFile *_fp;
+
+        template <typename T, typename Func>
+        std::vector<T> parseLines(
+            const pq::stringViews  &lines,
+            const std::vector<int> &lineNumbers,
+            Func                  &&parseLine
+        ) const;
 
        public:
         virtual ~TopologySection() = default;
 
         void process(pq::strings &, pq::Engine &);
 
+        virtual void processLines(
+            const pq::stringViews &,
+            const std::vector<int> &,
+            pq::Engine &
+        );
+
         virtual std::string keyword()                                   = 0;
         virtual void        processSection(pq::strings &, pq::Engine &) = 0;
         virtual void        endedNormally(const bool) const             = 0;
 
         void setLineNumber(const int lineNumber);
-        void setFp(std::ifstream *fp);
+        void setFp(utilities::MappedFile *fp);
 
         [[nodiscard]] int getLineNumber() const;
     };
 
 }   // namespace input::topology
 
+#include "topologySection.tpp.hpp"   // DO NOT MOVE THIS LINE
+
 #endif   // _TOPOLOGY_SECTION_HPP_
\ No newline at end of file
@@ -0,0 +1,96 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _TOPOLOGY_SECTION_TPP_
+
+#define _TOPOLOGY_SECTION_TPP_
+
+#include <cstddef>     // for size_t
+#include <exception>   // for exception_ptr, current_exception
+#include <optional>    // for optional
+#include <vector>      // for vector
+
+#include "stringUtilities.hpp"   // for splitString
+#include "topologySection.hpp"
+
+namespace input::topology
+{
+    /**
+     * @brief parses the lines of a section in parallel
+     *
+     * @details the lines are split into static chunks over all threads. Each
+     * line is tokenized and converted by parseLine, which must not modify any
+     * shared state. The results are returned in the order of the lines.
+     * Exceptions are caught per line and the one of the first erroneous line
+     * is rethrown, so the error is the same as for a serial read.
+     *
+     * @tparam T type of the parsed object
+     * @tparam Func callable (pq::strings &, int lineNumber) -> T
+     * @param lines raw lines of the section without comments
+     * @param lineNumbers line number of each line in the topology file
+     * @param parseLine
+     * @return std::vector<T>
+     */
+    template <typename T, typename Func>
+    std::vector<T> TopologySection::parseLines(
+        const pq::stringViews  &lines,
+        const std::vector<int> &lineNumbers,
+        Func                  &&parseLine
+    ) const
+    {
+        const auto nLines = lines.size();
+
+        std::vector<std::optional<T>>   results(nLines);
+        std::vector<std::exception_ptr> exceptions(nLines);
+
+        // clang-format off
+        #pragma omp parallel for schedule(static)
+        // clang-format on
+        for (size_t i = 0; i < nLines; ++i)
+        {
+            try
+            {
+                auto lineElements = utilities::splitString(lines[i]);
+                results[i].emplace(parseLine(lineElements, lineNumbers[i]));
+            }
+            catch (...)
+            {
+                exceptions[i] = std::current_exception();
+            }
+        }
+
+        for (const auto &exception : exceptions)
+            if (exception)
+                std::rethrow_exception(exception);
+
+        std::vector<T> parsed;
+        parsed.reserve(nLines);
+
+        for (auto &result : results) parsed.push_back(std::move(*result));
+
+        return parsed;
+    }
+
+}   // namespace input::topology
+
+#endif   // _TOPOLOGY_SECTION_TPP_
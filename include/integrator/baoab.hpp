@@ -0,0 +1,83 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _BAOAB_HPP_
+
+#define _BAOAB_HPP_
+
+#include "integrator.hpp"
+#include "philox.hpp"   // for Philox
+#include "typeAliases.hpp"
+
+namespace integrator
+{
+    /**
+     * @class BAOAB inherits Integrator
+     *
+     * @brief BAOAB Langevin splitting integrator of Leimkuhler and Matthews
+     *
+     * @details one step consists of a half kick (B), a half drift (A), an
+     * exact Ornstein-Uhlenbeck velocity update over the full timestep (O), a
+     * second half drift (A) and, after the force calculation, the final half
+     * kick (B). The configurational sampling error of this splitting is
+     * much smaller than the one of a thermostat applied around velocity
+     * verlet, which allows larger timesteps. The target temperature is read
+     * from the thermostat settings in every step, therefore temperature
+     * ramping and replica exchange are supported. The random velocities
+     * of the O part are not constrained, therefore BAOAB cannot be combined
+     * with SHAKE, M-SHAKE or SETTLE.
+     *
+     * @link https://doi.org/10.1093/amrx/abs010
+     *
+     */
+    class BAOAB : public Integrator
+    {
+       private:
+        utilities::Philox _random;
+
+        double _friction = 0.0;
+
+       public:
+        explicit BAOAB();
+
+        void firstStep(pq::SimBox &) override;
+        void secondStep(pq::SimBox &) override;
+
+        [[nodiscard]] std::string getRandomState() const override;
+        void                      setRandomState(const std::string &) override;
+
+        /********************************
+         * standard getters and setters *
+         ********************************/
+
+        void setFriction(const double friction);
+        void setRandom(const utilities::Philox &random);
+
+        [[nodiscard]] double getFriction() const;
+
+        [[nodiscard]] const utilities::Philox &getRandom() const;
+    };
+
+}   // namespace integrator
+
+#endif   // _BAOAB_HPP_
@@ -54,6 +54,9 @@ namespace integrator
         void integrateVelocities(pq::Atom *) const;
         void integratePositions(pq::Atom *, const pq::SimBox &) const;
 
+        [[nodiscard]] virtual std::string getRandomState() const;
+        virtual void                      setRandomState(const std::string &);
+
         /********************************
          * standard getters and setters *
          ********************************/
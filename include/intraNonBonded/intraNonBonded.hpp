@@ -26,10 +26,12 @@
 
 #include <cstddef>   // for size_t
 #include <memory>    // for shared_ptr
+#include <utility>   // for pair
 #include <vector>    // for vector
 
 #include "intraNonBondedContainer.hpp"   // for IntraNonBondedContainer
 #include "intraNonBondedMap.hpp"         // for IntraNonBondedMap
+#include "intraNonBondedPairList.hpp"    // for IntraNonBondedPairList
 #include "timer.hpp"                     // for Timer
 #include "typeAliases.hpp"
 
@@ -57,19 +59,27 @@ namespace intraNonBonded
        protected:
         IntraNonBondedType _intraNonBondedType = IntraNonBondedType::NONE;
         bool               _isActivated        = false;
+        bool               _computeShiftForces = true;
 
         std::shared_ptr<pq::NonCoulombPot> _nonCoulombPot;
         std::shared_ptr<pq::CoulombPot>    _coulombPotential;
         std::vector<IntraNonBondedMap>     _intraNonBondedMaps;
+        IntraNonBondedPairList             _pairList;
 
         std::vector<IntraNonBondedContainer> _intraNonBondedContainers;
 
        public:
         std::shared_ptr<IntraNonBonded> clone() const;
 
+        template <bool computeForces = true>
         void calculate(const pq::SimBox &, pq::PhysicalData &);
         void fillIntraNonBondedMaps(pq::SimBox &);
 
+        [[nodiscard]] std::pair<double, double> calculateMoleculeEnergies(
+            const pq::SimBox &,
+            const pq::Molecule &
+        );
+
         [[nodiscard]] IntraNonBondedContainer *findIntraNonBondedContainerByMolType(
             const size_t
         );
@@ -95,6 +105,7 @@ namespace intraNonBonded
 
         void setNonCoulombPotential(const pq::SharedNonCoulombPot &pot);
         void setCoulombPotential(const pq::SharedCoulombPot &pot);
+        void setComputeShiftForces(const bool computeShiftForces);
 
         /***************************
          * standard getter methods *
@@ -105,6 +116,7 @@ namespace intraNonBonded
         ) const;
         [[nodiscard]] std::vector<IntraNonBondedMap> getIntraNonBondedMaps(
         ) const;
+        [[nodiscard]] const IntraNonBondedPairList &getPairList() const;
     };
 
 }   // namespace intraNonBonded
@@ -0,0 +1,103 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _INTRA_NON_BONDED_PAIR_LIST_HPP_
+
+#define _INTRA_NON_BONDED_PAIR_LIST_HPP_
+
+#include <cstddef>   // for size_t
+#include <utility>   // for pair
+#include <vector>    // for vector
+
+#include "intraNonBondedMap.hpp"   // for IntraNonBondedMap
+#include "typeAliases.hpp"
+
+namespace intraNonBonded
+{
+    /**
+     * @class IntraNonBondedPairList
+     *
+     * @brief flattened list of all intra molecular non-bonded pairs of the
+     * system
+     *
+     * @details the list is compiled once from the IntraNonBondedMaps. For
+     * each pair the atoms, the Coulomb and non-Coulomb scaling factors (1-4
+     * interactions) and the index of the resolved non-Coulomb pair are
+     * stored in contiguous arrays. The pairs are grouped by molecule, which
+     * allows a conflict free parallel evaluation over the molecules.
+     */
+    class IntraNonBondedPairList
+    {
+       private:
+        bool _isBuilt = false;
+
+        std::vector<size_t> _moleculeOffsets;
+
+        std::vector<pq::Atom *> _atoms1;
+        std::vector<pq::Atom *> _atoms2;
+        std::vector<double>     _coulombScales;
+        std::vector<double>     _nonCoulombScales;
+        std::vector<size_t>     _nonCoulPairIndices;
+
+        std::vector<pq::SharedNonCoulPair> _nonCoulPairs;
+
+        template <bool computeForces, bool computeShiftForces>
+        std::pair<double, double> calculateMolecule(
+            const pq::CoulombPot &coulombPot,
+            const pq::Box        &box,
+            const size_t          molecule
+        ) const;
+
+       public:
+        void build(const std::vector<IntraNonBondedMap> &, pq::NonCoulombPot &);
+
+        template <
+            bool computeForces      = true,
+            bool computeShiftForces = computeForces>
+        void calculate(
+            const pq::CoulombPot &coulombPot,
+            const pq::SimBox     &simBox,
+            pq::PhysicalData     &physicalData
+        ) const;
+
+        [[nodiscard]] std::pair<double, double> calculateMoleculeEnergies(
+            const pq::CoulombPot &coulombPot,
+            const pq::SimBox     &simBox,
+            const size_t          molecule
+        ) const;
+
+        void reset() { _isBuilt = false; }
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] bool   isBuilt() const { return _isBuilt; }
+        [[nodiscard]] size_t getNumberOfPairs() const;
+        [[nodiscard]] size_t getNumberOfMolecules() const;
+        [[nodiscard]] size_t getNumberOfNonCoulPairs() const;
+    };
+
+}   // namespace intraNonBonded
+
+#endif   // _INTRA_NON_BONDED_PAIR_LIST_HPP_
@@ -24,6 +24,8 @@
 
 #define _STATIC_MATRIX_INTERFACE_HPP_
 
+#include "staticMatrix/staticLUDecomposition.hpp"
 #include "staticMatrix/staticMatrix3x3.hpp"
+#include "staticMatrix/staticMatrixClass.hpp"
 
 #endif // _STATIC_MATRIX_INTERFACE_HPP_ 
\ No newline at end of file
@@ -0,0 +1,71 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _STATIC_LU_DECOMPOSITION_HPP_
+
+#define _STATIC_LU_DECOMPOSITION_HPP_
+
+#include <array>     // for array
+#include <cstddef>   // for size_t
+
+#include "staticMatrixClass.hpp"   // for StaticMatrix, StaticVector
+
+namespace linearAlgebra
+{
+    /**
+     * @class StaticLUDecomposition
+     *
+     * @brief LU decomposition with partial pivoting of a square StaticMatrix
+     *
+     * @details N is the compile time capacity of the system, while the
+     * actual size of the system can be smaller and is given at runtime. Only
+     * the leading size x size block of the matrix is used. The
+     * decomposition can be computed once and reused for solving many right
+     * hand sides without any heap allocation.
+     *
+     * @tparam T
+     * @tparam N
+     */
+    template <typename T, size_t N>
+    class StaticLUDecomposition
+    {
+       private:
+        size_t                _size = 0;
+        StaticMatrix<T, N>    _lu;
+        std::array<size_t, N> _pivots{};
+
+       public:
+        StaticLUDecomposition() = default;
+        explicit StaticLUDecomposition(const StaticMatrix<T, N> &, const size_t);
+
+        void decompose(const StaticMatrix<T, N> &matrix, const size_t size);
+        void solve(StaticVector<T, N> &rhs) const;
+
+        [[nodiscard]] size_t size() const { return _size; }
+    };
+
+}   // namespace linearAlgebra
+
+#include "staticLUDecomposition.tpp.hpp"   // DO NOT MOVE THIS LINE
+
+#endif   // _STATIC_LU_DECOMPOSITION_HPP_
@@ -0,0 +1,169 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _STATIC_LU_DECOMPOSITION_TPP_
+
+#define _STATIC_LU_DECOMPOSITION_TPP_
+
+#include <cmath>     // for abs
+#include <format>    // for format
+#include <utility>   // for swap
+
+#include "exceptions.hpp"
+#include "staticLUDecomposition.hpp"
+
+namespace linearAlgebra
+{
+    /**
+     * @brief Construct a new Static LU Decomposition object
+     *
+     * @tparam T
+     * @tparam N
+     * @param matrix
+     * @param size actual size of the system (<= N)
+     */
+    template <typename T, size_t N>
+    StaticLUDecomposition<T, N>::StaticLUDecomposition(
+        const StaticMatrix<T, N> &matrix,
+        const size_t              size
+    )
+    {
+        decompose(matrix, size);
+    }
+
+    /**
+     * @brief computes the LU decomposition of the leading size x size block
+     * of the matrix with partial pivoting
+     *
+     * @details L (unit lower triangular) and U are stored in the same
+     * matrix, the row permutation in the pivot array
+     *
+     * @tparam T
+     * @tparam N
+     * @param matrix
+     * @param size actual size of the system (<= N)
+     *
+     * @throw customException::LinearAlgebraException if size > N or the
+     * matrix is singular
+     */
+    template <typename T, size_t N>
+    void StaticLUDecomposition<T, N>::decompose(
+        const StaticMatrix<T, N> &matrix,
+        const size_t              size
+    )
+    {
+        if (size > N)
+            throw customException::LinearAlgebraException(std::format(
+                "system size {} exceeds the static capacity of {}",
+                size,
+                N
+            ));
+
+        _size = size;
+        _lu   = matrix;
+
+        for (size_t k = 0; k < _size; ++k)
+        {
+            /*******************************************
+             * partial pivoting - largest |element| of *
+             * column k is moved onto the diagonal     *
+             *******************************************/
+
+            size_t pivot    = k;
+            T      maxValue = std::abs(_lu(k, k));
+
+            for (size_t i = k + 1; i < _size; ++i)
+                if (std::abs(_lu(i, k)) > maxValue)
+                {
+                    maxValue = std::abs(_lu(i, k));
+                    pivot    = i;
+                }
+
+            if (maxValue == T(0))
+                throw customException::LinearAlgebraException(
+                    "LU decomposition of singular matrix"
+                );
+
+            _pivots[k] = pivot;
+
+            if (pivot != k)
+                for (size_t j = 0; j < _size; ++j)
+                    std::swap(_lu(k, j), _lu(pivot, j));
+
+            /***************************
+             * elimination of column k *
+             ***************************/
+
+            const auto invDiagonal = T(1) / _lu(k, k);
+
+            for (size_t i = k + 1; i < _size; ++i)
+            {
+                _lu(i, k) *= invDiagonal;
+
+                const auto factor = _lu(i, k);
+
+                for (size_t j = k + 1; j < _size; ++j)
+                    _lu(i, j) -= factor * _lu(k, j);
+            }
+        }
+    }
+
+    /**
+     * @brief solves the linear system A * x = rhs in place
+     *
+     * @details only the first size elements of rhs are used and
+     * overwritten with the solution x
+     *
+     * @tparam T
+     * @tparam N
+     * @param rhs
+     */
+    template <typename T, size_t N>
+    void StaticLUDecomposition<T, N>::solve(StaticVector<T, N> &rhs) const
+    {
+        for (size_t k = 0; k < _size; ++k)
+            if (_pivots[k] != k)
+                std::swap(rhs[k], rhs[_pivots[k]]);
+
+        /***********************************
+         * forward substitution - L * y = b *
+         ***********************************/
+
+        for (size_t i = 1; i < _size; ++i)
+            for (size_t j = 0; j < i; ++j) rhs[i] -= _lu(i, j) * rhs[j];
+
+        /************************************
+         * backward substitution - U * x = y *
+         ************************************/
+
+        for (size_t i = _size; i-- > 0;)
+        {
+            for (size_t j = i + 1; j < _size; ++j) rhs[i] -= _lu(i, j) * rhs[j];
+
+            rhs[i] /= _lu(i, i);
+        }
+    }
+
+}   // namespace linearAlgebra
+
+#endif   // _STATIC_LU_DECOMPOSITION_TPP_
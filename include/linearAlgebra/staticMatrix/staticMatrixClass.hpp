@@ -0,0 +1,81 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _STATIC_MATRIX_CLASS_HPP_
+
+#define _STATIC_MATRIX_CLASS_HPP_
+
+#include <array>     // for array
+#include <cstddef>   // for size_t
+
+namespace linearAlgebra
+{
+    /**
+     * @brief fixed size vector with compile time size N
+     *
+     * @tparam T
+     * @tparam N
+     */
+    template <typename T, size_t N>
+    using StaticVector = std::array<T, N>;
+
+    /**
+     * @class StaticMatrix
+     *
+     * @brief template Matrix class with N rows and M columns stored in row
+     * major order on the stack
+     *
+     * @details used for small linear systems (e.g. M-Shake) where heap
+     * allocations in every step have to be avoided
+     *
+     * @tparam T
+     * @tparam N
+     * @tparam M
+     */
+    template <typename T, size_t N, size_t M = N>
+    class StaticMatrix
+    {
+       private:
+        std::array<T, N * M> _data{};
+
+       public:
+        StaticMatrix() = default;
+
+        explicit StaticMatrix(const T t);
+
+        T       &operator()(const size_t index_i, const size_t index_j);
+        const T &operator()(const size_t index_i, const size_t index_j) const;
+
+        friend bool operator==(const StaticMatrix &, const StaticMatrix &) =
+            default;
+
+        [[nodiscard]] static constexpr size_t rows() { return N; }
+        [[nodiscard]] static constexpr size_t cols() { return M; }
+        [[nodiscard]] static constexpr size_t size() { return N * M; }
+    };
+
+}   // namespace linearAlgebra
+
+#include "staticMatrixClass.tpp.hpp"   // DO NOT MOVE THIS LINE
+
+#endif   // _STATIC_MATRIX_CLASS_HPP_
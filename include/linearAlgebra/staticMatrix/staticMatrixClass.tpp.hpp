@@ -0,0 +1,86 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _STATIC_MATRIX_CLASS_TPP_
+
+#define _STATIC_MATRIX_CLASS_TPP_
+
+#include "staticMatrixClass.hpp"
+
+namespace linearAlgebra
+{
+    /**
+     * @brief Construct a new Static Matrix object with all elements set to t
+     *
+     * @tparam T
+     * @tparam N
+     * @tparam M
+     * @param t
+     */
+    template <typename T, size_t N, size_t M>
+    StaticMatrix<T, N, M>::StaticMatrix(const T t)
+    {
+        _data.fill(t);
+    }
+
+    /**
+     * @brief index operator
+     *
+     * @tparam T
+     * @tparam N
+     * @tparam M
+     * @param index_i row index
+     * @param index_j column index
+     * @return T&
+     */
+    template <typename T, size_t N, size_t M>
+    T &StaticMatrix<T, N, M>::operator()(
+        const size_t index_i,
+        const size_t index_j
+    )
+    {
+        return _data[index_i * M + index_j];
+    }
+
+    /**
+     * @brief index operator
+     *
+     * @tparam T
+     * @tparam N
+     * @tparam M
+     * @param index_i row index
+     * @param index_j column index
+     * @return const T&
+     */
+    template <typename T, size_t N, size_t M>
+    const T &StaticMatrix<T, N, M>::operator()(
+        const size_t index_i,
+        const size_t index_j
+    ) const
+    {
+        return _data[index_i * M + index_j];
+    }
+
+}   // namespace linearAlgebra
+
+#endif   // _STATIC_MATRIX_CLASS_TPP_
@@ -24,6 +24,8 @@
 
 #define _MANOSTAT_HPP_
 
+#include <string>   // for string
+
 #include "manostatSettings.hpp"
 #include "staticMatrix.hpp"   // for tensor3D
 #include "timer.hpp"          // for Timer
@@ -54,6 +56,11 @@ namespace manostat
         
         void rotateMu(linearAlgebra::tensor3D &mu) const;
 
+        [[nodiscard]] virtual bool isVirialBased() const;
+
+        [[nodiscard]] virtual std::string getRandomState() const;
+        virtual void                      setRandomState(const std::string &);
+
         virtual pq::ManostatType getManostatType() const;
         virtual pq::Isotropy     getIsotropy() const;
     };
@@ -24,24 +24,97 @@
 
 #define _MONTE_CARLO_MANOSTAT_HPP_
 
-#include <random>   // for std::random_device, std::mt19937
+#include <cstddef>   // for size_t
+#include <string>    // for string
+#include <vector>    // for vector
 
 #include "manostat.hpp"      // for Manostat
+#include "philox.hpp"        // for Philox
 #include "typeAliases.hpp"   // for PhysicalData, SimulationBox
 
 namespace manostat
 {
+    /**
+     * @class MonteCarloManostat inherits from Manostat
+     *
+     * @brief Monte Carlo barostat with molecular volume moves
+     *
+     * @details Every _frequency steps a random volume change is attempted.
+     * The box is scaled and the centers of mass of the molecules are scaled
+     * with it, therefore only the inter molecular energy changes and has to
+     * be re-evaluated. The move is accepted with the NPT Metropolis
+     * criterion. As the acceptance only depends on energies, the manostat
+     * does not need the virial nor the kinetic energy tensor.
+     *
+     * @link https://doi.org/10.1016/0010-4655(95)00059-O
+     *
+     */
     class MonteCarloManostat : public Manostat
     {
        private:
-        std::random_device _randomDevice{};
-        std::mt19937       _generator{_randomDevice()};
+        pq::SharedPotential _potential;
+        pq::SharedCellList  _cellList;
+
+        utilities::Philox _random;
+
+        pq::Isotropy        _isotropy;
+        size_t              _2DAnisotropicAxis = 2;
+        std::vector<size_t> _2DIsotropicAxes   = {0, 1};
+
+        size_t _frequency;
+        double _volumeChange;
+
+        size_t _nSteps          = 0;
+        size_t _nAttempts       = 0;
+        size_t _nAccepted       = 0;
+        size_t _nAcceptedTuning = 0;
+
+        static constexpr size_t _N_TUNING_ATTEMPTS_ = 10;
+
+        [[nodiscard]] pq::tensor3D calculateMu(const double, const double)
+            const;
+        void calculateInterEnergy(pq::SimBox &, pq::PhysicalData &) const;
+
+        void tuneVolumeChange();
 
        public:
-        explicit MonteCarloManostat() = default;
+        MonteCarloManostat() = default;
+        explicit MonteCarloManostat(
+            const double       targetPressure,
+            const size_t       frequency,
+            const double       volumeChange,
+            const pq::Isotropy isotropy
+        );
+
+        void applyManostat(pq::SimBox &, pq::PhysicalData &) override;
+
+        bool attemptVolumeMove(pq::SimBox &, pq::PhysicalData &);
+
+        [[nodiscard]] bool isVirialBased() const override;
+
+        [[nodiscard]] std::string getRandomState() const override;
+        void                      setRandomState(const std::string &) override;
+
+        [[nodiscard]] pq::ManostatType getManostatType() const override;
+        [[nodiscard]] pq::Isotropy     getIsotropy() const override;
+
+        /***************************
+         * standard setter methods *
+         ***************************/
+
+        void setPotential(const pq::SharedPotential &potential);
+        void setCellList(const pq::SharedCellList &cellList);
+        void set2DAxes(const size_t, const std::vector<size_t> &);
+
+        /***************************
+         * standard getter methods *
+         ***************************/
 
-        void applyManostat(pq::SimBox &, pq::PhysicalData &) override {};
+        [[nodiscard]] size_t getFrequency() const;
+        [[nodiscard]] double getVolumeChange() const;
+        [[nodiscard]] size_t getNumberOfAttempts() const;
+        [[nodiscard]] size_t getNumberOfAccepted() const;
     };
 }   // namespace manostat
 
-#endif   // _MONTE_CARLO_MANOSTAT_HPP_
+#endif   // _MONTE_CARLO_MANOSTAT_HPP_
\ No newline at end of file
@@ -25,6 +25,7 @@
 #define _STOCHASTIC_RESCALING_MANOSTAT_HPP_
 
 #include <random>   // for std::random_device, std::mt19937
+#include <string>   // for string
 
 #include "manostat.hpp"      // for Manostat
 #include "typeAliases.hpp"   // for PhysicalData, SimulationBox
@@ -60,6 +61,9 @@ namespace manostat
 
         [[nodiscard]] virtual pq::tensor3D calculateMu(const double);
 
+        [[nodiscard]] std::string getRandomState() const override;
+        void                      setRandomState(const std::string &) override;
+
         [[nodiscard]] pq::ManostatType getManostatType() const override;
         [[nodiscard]] pq::Isotropy     getIsotropy() const override;
 
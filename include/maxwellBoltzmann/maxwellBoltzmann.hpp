@@ -24,8 +24,7 @@
 
 #define _MAXWELL_BOLTZMANN_HPP_
 
-#include <random>
-
+#include "philox.hpp"   // for Philox
 #include "typeAliases.hpp"
 
 namespace maxwellBoltzmann
@@ -36,6 +35,10 @@ namespace maxwellBoltzmann
      * @brief class to initialize velocities of particles with a random maxwell
      * boltzmann distribution
      *
+     * @details the random numbers are drawn from the velocity stream of the
+     * global seed, every call of initializeVelocities uses a new step of the
+     * stream
+     *
      * @link https://www.biodiversitylibrary.org/item/53795#page/33/mode/1up
      * @link https://www.biodiversitylibrary.org/item/20012#page/37/mode/1up
      *
@@ -43,10 +46,11 @@ namespace maxwellBoltzmann
     class MaxwellBoltzmann
     {
        private:
-        std::random_device _randomDevice{};
-        std::mt19937       _generator{_randomDevice()};
+        utilities::Philox _random;
 
        public:
+        MaxwellBoltzmann();
+
         void initializeVelocities(pq::SimBox &);
     };
 }   // namespace maxwellBoltzmann
@@ -36,6 +36,10 @@ namespace opt
      * @brief Base class for all evaluators (e.g. MM, QM, ...)
      *        Evaluators are used to evaluate forces/hessians
      *
+     * @details evaluateEnergy only calculates the energies of the current
+     * configuration, e.g. for line searches or Monte Carlo acceptance tests.
+     * It neither touches the forces nor the virial.
+     *
      */
     class Evaluator
     {
@@ -54,8 +58,9 @@ namespace opt
         Evaluator()          = default;
         virtual ~Evaluator() = default;
 
-        virtual pq::SharedEvaluator clone() const = 0;
-        virtual void                evaluate()    = 0;
+        virtual pq::SharedEvaluator clone() const    = 0;
+        virtual void                evaluate()       = 0;
+        virtual void                evaluateEnergy() = 0;
 
         /***************************
          * standard setter methods *
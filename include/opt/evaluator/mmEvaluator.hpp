@@ -42,6 +42,7 @@ namespace opt
 
         pq::SharedEvaluator clone() const override;
         void                evaluate() override;
+        void                evaluateEnergy() override;
     };
 
 }   // namespace opt
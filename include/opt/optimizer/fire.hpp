@@ -0,0 +1,100 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _FIRE_HPP_
+
+#define _FIRE_HPP_
+
+#include <cstddef>   // for size_t
+
+#include "defaults.hpp"    // for _FIRE_TIMESTEP_DEFAULT_
+#include "optimizer.hpp"   // for Optimizer
+
+namespace opt
+{
+    /**
+     * @brief parameters of the FIRE optimizer
+     *
+     * @details the default values follow Bitzek et al., Phys. Rev. Lett.
+     * 97, 170201 (2006)
+     */
+    struct FIREParameters
+    {
+        // clang-format off
+        double timestep         = defaults::_FIRE_TIMESTEP_DEFAULT_;
+        double maxTimestep      = defaults::_FIRE_MAX_TIMESTEP_DEFAULT_;
+        size_t nMin             = defaults::_FIRE_N_MIN_DEFAULT_;
+        double timestepIncrease = defaults::_FIRE_TIMESTEP_INCREASE_DEFAULT_;
+        double timestepDecrease = defaults::_FIRE_TIMESTEP_DECREASE_DEFAULT_;
+        double alphaStart       = defaults::_FIRE_ALPHA_START_DEFAULT_;
+        double alphaDecrease    = defaults::_FIRE_ALPHA_DECREASE_DEFAULT_;
+        double maxStep          = defaults::_FIRE_MAX_STEP_DEFAULT_;
+        // clang-format on
+    };
+
+    /**
+     * @class FIRE
+     *
+     * @brief Fast Inertial Relaxation Engine
+     *
+     * @details damped dynamics on the velocity fields of the atoms with unit
+     * masses. The velocities are mixed towards the direction of the forces
+     * and the timestep grows while the power F * v stays positive. As soon
+     * as the system moves uphill, the velocities are set to zero and the
+     * timestep is decreased.
+     */
+    class FIRE : public Optimizer
+    {
+       private:
+        constexpr static size_t _maxHistoryLength = 2;
+
+        FIREParameters _parameters;
+
+        double _timestep    = defaults::_FIRE_TIMESTEP_DEFAULT_;
+        double _alpha       = defaults::_FIRE_ALPHA_START_DEFAULT_;
+        size_t _nPositive   = 0;
+        bool   _isFirstStep = true;
+
+       public:
+        explicit FIRE(const size_t nEpochs);
+        explicit FIRE(const size_t nEpochs, const FIREParameters &parameters);
+
+        FIRE()        = default;
+        ~FIRE() final = default;
+
+        [[nodiscard]] pq::SharedOptimizer clone() const final;
+        [[nodiscard]] size_t              maxHistoryLength() const final;
+
+        void update(const double learningRate, const size_t step) final;
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] double getTimestep() const { return _timestep; }
+        [[nodiscard]] double getAlpha() const { return _alpha; }
+    };
+
+}   // namespace opt
+
+#endif   // _FIRE_HPP_
@@ -0,0 +1,112 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _LBFGS_HPP_
+
+#define _LBFGS_HPP_
+
+#include <cstddef>   // for size_t
+#include <vector>    // for vector
+
+#include "defaults.hpp"    // for _LBFGS_MEMORY_DEFAULT_
+#include "optimizer.hpp"   // for Optimizer
+
+namespace opt
+{
+    /**
+     * @class LBFGS
+     *
+     * @brief limited memory BFGS optimizer with backtracking line search
+     *
+     * @details The search direction is obtained by the two-loop recursion
+     * over the last _memory position and gradient differences, which are
+     * stored as flat ring buffers of size _memory * 3 * nAtoms. The step
+     * along the search direction is determined by a backtracking line
+     * search on the Armijo condition, for which the evaluator is called
+     * directly by the optimizer. The accepted point is left evaluated in
+     * the simulation box and physical data, therefore the OptEngine does
+     * not evaluate it a second time.
+     */
+    class LBFGS : public Optimizer
+    {
+       private:
+        constexpr static size_t _maxHistoryLength = 2;
+
+        // clang-format off
+        size_t _memory            = defaults::_LBFGS_MEMORY_DEFAULT_;
+        size_t _maxLineSearchIter = defaults::_LBFGS_MAX_LINESEARCH_ITER_DEFAULT_;
+        double _maxStep           = defaults::_LBFGS_MAX_STEP_DEFAULT_;
+        double _armijo            = 1.0e-4;
+        double _backtrackFactor   = 0.5;
+        // clang-format on
+
+        size_t _nStored      = 0;
+        size_t _head         = 0;
+        size_t _nEvaluations = 0;
+
+        std::vector<double> _sHistory;
+        std::vector<double> _yHistory;
+        std::vector<double> _rho;
+        std::vector<double> _alpha;
+
+        std::vector<double> _direction;
+        std::vector<double> _gradient;
+        std::vector<double> _gradientNew;
+        std::vector<double> _positions;
+
+        void gatherGradient(std::vector<double> &gradient) const;
+        void calculateDirection();
+        void storeCorrection(const double stepLength);
+        void moveAtoms(const double stepLength);
+        void resetHistory();
+
+        [[nodiscard]] double evaluateEnergy();
+
+       public:
+        explicit LBFGS(const size_t nEpochs, const size_t nAtoms);
+        explicit LBFGS(const size_t, const size_t, const size_t);
+
+        LBFGS()        = default;
+        ~LBFGS() final = default;
+
+        [[nodiscard]] pq::SharedOptimizer clone() const final;
+        [[nodiscard]] size_t              maxHistoryLength() const final;
+        [[nodiscard]] bool                evaluatesInUpdate() const final;
+
+        void update(const double learningRate, const size_t step) final;
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] size_t getMemory() const { return _memory; }
+        [[nodiscard]] size_t getNumberOfStored() const { return _nStored; }
+        [[nodiscard]] size_t getNumberOfEvaluations() const
+        {
+            return _nEvaluations;
+        }
+    };
+
+}   // namespace opt
+
+#endif   // _LBFGS_HPP_
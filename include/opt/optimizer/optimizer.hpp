@@ -46,6 +46,7 @@ namespace opt
 
         opt::Convergence _convergence;
 
+        pq::SharedEvaluator    _evaluator;
         pq::SharedSimBox       _simulationBox;
         pq::SharedPhysicalData _physicalData;
         pq::SharedPhysicalData _physicalDataOld;
@@ -65,6 +66,7 @@ namespace opt
         virtual pq::SharedOptimizer clone() const                      = 0;
         virtual void                update(const double, const size_t) = 0;
         virtual size_t              maxHistoryLength() const           = 0;
+        virtual bool                evaluatesInUpdate() const;
 
         void updateHistory();
         bool hasConverged();
@@ -74,6 +76,7 @@ namespace opt
          ***************************/
 
         void setConvergence(const opt::Convergence);
+        void setEvaluator(const pq::SharedEvaluator);
 
         void setSimulationBox(const pq::SharedSimBox);
         void setPhysicalData(const pq::SharedPhysicalData);
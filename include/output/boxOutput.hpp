@@ -26,7 +26,8 @@
 
 #include <cstddef>   // for size_t
 
-#include "output.hpp"
+#include "observableTable.hpp"   // for ObservableVisitor
+#include "output.hpp"            // for Output
 #include "typeAliases.hpp"
 
 namespace output
@@ -43,6 +44,13 @@ namespace output
         using Output::Output;
 
         void write(const size_t, const pq::Box &);
+        void write(const size_t, const pq::Vec3D &, const pq::Vec3D &);
+
+        static void visitObservables(
+            const pq::Vec3D &,
+            const pq::Vec3D &,
+            const ObservableVisitor &
+        );
     };
 
 }   // namespace output
@@ -0,0 +1,102 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _CHECKPOINT_FILE_OUTPUT_HPP_
+
+#define _CHECKPOINT_FILE_OUTPUT_HPP_
+
+#include <cstddef>         // for size_t
+#include <cstdint>         // for uint32_t, uint64_t
+#include <string>          // for string
+#include <string_view>     // for string_view
+#include <unordered_map>   // for unordered_map
+#include <vector>          // for vector
+
+#include "output.hpp"
+#include "typeAliases.hpp"
+
+namespace output
+{
+    /**
+     * @class CheckpointFileOutput inherits from Output
+     *
+     * @brief binary checkpoint file for exact restarts
+     *
+     * @details The file consists of a fixed size header followed by the
+     * payload. The header contains a magic string, the format version, an
+     * endianness marker, the size of the payload and a FNV-1a checksum of
+     * the payload. All floating point values are stored as raw doubles,
+     * therefore a restart from a checkpoint continues with exactly the same
+     * state. Each checkpoint is written to a temporary file which is renamed
+     * into place afterwards, so that a crash while writing never destroys
+     * the previous checkpoint.
+     *
+     * The payload of version 1 consists of
+     *  - the step count
+     *  - the box dimensions and box angles
+     *  - the chi and zeta values of the Nose-Hoover chain
+     *  - the random number generator states of thermostat and manostat
+     *  - the number of atoms and a table of all unique atom names
+     *  - per atom the index into the name table and the molecule type
+     *  - positions, velocities and forces of all atoms
+     */
+    class CheckpointFileOutput : public Output
+    {
+       private:
+        std::string _payload;
+
+        std::vector<std::string>                  _names;
+        std::vector<uint32_t>                     _nameIndices;
+        std::unordered_map<std::string, uint32_t> _nameTable;
+
+        template <typename T>
+        void appendValue(const T value);
+        void appendString(const std::string_view);
+
+        void buildNameTable(const pq::FrameSnapshot &);
+
+       public:
+        // clang-format off
+        static constexpr std::string_view _MAGIC_       = {"PQCHKPT", 8};
+        static constexpr uint32_t         _VERSION_     = 1;
+        static constexpr uint32_t         _ENDIANNESS_  = 0x01020304;
+        static constexpr size_t           _HEADER_SIZE_ = 32;
+        // clang-format on
+
+        using Output::Output;
+
+        void write(
+            pq::SimBox &,
+            const pq::Thermostat &,
+            const pq::Manostat &,
+            const pq::Integrator &,
+            const size_t
+        );
+        void write(const pq::FrameSnapshot &);
+
+        [[nodiscard]] static uint64_t calculateChecksum(const std::string_view);
+    };
+
+}   // namespace output
+
+#endif   // _CHECKPOINT_FILE_OUTPUT_HPP_
@@ -26,7 +26,8 @@
 
 #include <cstddef>   // for size_t
 
-#include "output.hpp"   // for Output
+#include "observableTable.hpp"   // for ObservableVisitor
+#include "output.hpp"            // for Output
 #include "typeAliases.hpp"
 
 namespace output
@@ -43,6 +44,11 @@ namespace output
         using Output::Output;
 
         void write(const size_t step, const pq::PhysicalData &);
+
+        static void visitObservables(
+            const pq::PhysicalData &,
+            const ObservableVisitor &
+        );
     };
 
 }   // namespace output
@@ -0,0 +1,129 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _FRAME_SNAPSHOT_HPP_
+
+#define _FRAME_SNAPSHOT_HPP_
+
+#include <cstddef>   // for size_t
+#include <string>    // for string
+#include <vector>    // for vector
+
+#include "physicalData.hpp"   // for PhysicalData
+#include "typeAliases.hpp"
+#include "vector3d.hpp"   // for Vec3D
+
+namespace output
+{
+    /**
+     * @class FrameSnapshot
+     *
+     * @brief copy of all data needed to write one output frame
+     *
+     * @details The snapshot decouples the formatting of the output files
+     * from the simulation box. All per atom data is stored in flat arrays in
+     * the order of the molecules of the simulation box, which is the order
+     * in which the atoms are written. The buffers are reused between frames,
+     * therefore capturing a frame does not allocate after the first frame.
+     */
+    class FrameSnapshot
+    {
+       private:
+        size_t _step           = 0;
+        double _simulationTime = 0.0;
+
+        pq::Vec3D _boxDimensions;
+        pq::Vec3D _boxAngles;
+        double    _totalForce = 0.0;
+
+        std::vector<std::string> _atomNames;
+        std::vector<size_t>      _moleculeTypes;
+        std::vector<size_t>      _atomIndices;
+
+        std::vector<pq::Vec3D> _positions;
+        std::vector<pq::Vec3D> _velocities;
+        std::vector<pq::Vec3D> _forces;
+        std::vector<double>    _partialCharges;
+
+        bool                _isNoseHoover = false;
+        std::vector<double> _chi;
+        std::vector<double> _zeta;
+
+        std::string _thermostatRandomState;
+        std::string _manostatRandomState;
+
+        pq::PhysicalData _physicalData;
+        pq::PhysicalData _averagePhysicalData;
+
+        void captureTopology(pq::SimBox &);
+
+       public:
+        void captureSimulationBox(pq::SimBox &);
+        void captureThermostat(const pq::Thermostat &);
+        void captureIntegrator(const pq::Integrator &);
+        void captureManostat(const pq::Manostat &);
+        void capturePhysicalData(const pq::PhysicalData &);
+        void captureAveragePhysicalData(const pq::PhysicalData &);
+
+        /***************************
+         * standard setter methods *
+         ***************************/
+
+        void setStep(const size_t step);
+        void setSimulationTime(const double simulationTime);
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] size_t getStep() const;
+        [[nodiscard]] double getSimulationTime() const;
+        [[nodiscard]] size_t getNumberOfAtoms() const;
+
+        [[nodiscard]] const pq::Vec3D &getBoxDimensions() const;
+        [[nodiscard]] const pq::Vec3D &getBoxAngles() const;
+        [[nodiscard]] double           getTotalForce() const;
+
+        [[nodiscard]] const std::string &getAtomName(const size_t) const;
+        [[nodiscard]] size_t             getMoleculeType(const size_t) const;
+        [[nodiscard]] size_t             getAtomIndex(const size_t) const;
+
+        [[nodiscard]] const pq::Vec3D &getPosition(const size_t) const;
+        [[nodiscard]] const pq::Vec3D &getVelocity(const size_t) const;
+        [[nodiscard]] const pq::Vec3D &getForce(const size_t) const;
+        [[nodiscard]] double           getPartialCharge(const size_t) const;
+
+        [[nodiscard]] bool                       isNoseHoover() const;
+        [[nodiscard]] const std::vector<double> &getChi() const;
+        [[nodiscard]] const std::vector<double> &getZeta() const;
+
+        [[nodiscard]] const std::string &getThermostatRandomState() const;
+        [[nodiscard]] const std::string &getManostatRandomState() const;
+
+        [[nodiscard]] const pq::PhysicalData &getPhysicalData() const;
+        [[nodiscard]] const pq::PhysicalData &getAveragePhysicalData() const;
+    };
+
+}   // namespace output
+
+#endif   // _FRAME_SNAPSHOT_HPP_
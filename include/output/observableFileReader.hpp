@@ -0,0 +1,87 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _OBSERVABLE_FILE_READER_HPP_
+
+#define _OBSERVABLE_FILE_READER_HPP_
+
+#include <cstddef>       // for size_t
+#include <ostream>       // for ostream
+#include <string>        // for string
+#include <string_view>   // for string_view
+#include <vector>        // for vector
+
+#include "observableTable.hpp"   // for ObservableTable
+
+namespace output
+{
+    /**
+     * @class ObservableFileReader
+     *
+     * @brief reads a binary observable file written by ObservableOutput and
+     * converts it back into the text output files
+     *
+     * @details The text files are formatted with the layout stored in the
+     * header of the binary file, therefore they are identical to the files
+     * written directly during the simulation. A trailing block which was
+     * only partially written (e.g. because the simulation was killed) is
+     * ignored and reported via isTruncated().
+     */
+    class ObservableFileReader
+    {
+       private:
+        static constexpr size_t _FLUSH_SIZE_ = 1 << 20;
+
+        std::string      _fileName;
+        std::string_view _data;
+        size_t           _offset      = 0;
+        bool             _isTruncated = false;
+
+        std::vector<ObservableTable> _tables;
+
+        template <typename T>
+        [[nodiscard]] T readValue();
+        [[nodiscard]] std::string readString();
+
+        void readHeader();
+        bool readBlock();
+
+       public:
+        explicit ObservableFileReader(const std::string &fileName);
+
+        void read();
+
+        void writeTextFile(const size_t tableIndex, std::ostream &) const;
+        void convert(const std::string &prefix) const;
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] bool isTruncated() const { return _isTruncated; }
+        [[nodiscard]] const std::vector<ObservableTable> &getTables() const;
+    };
+
+}   // namespace output
+
+#endif   // _OBSERVABLE_FILE_READER_HPP_
@@ -0,0 +1,113 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _OBSERVABLE_OUTPUT_HPP_
+
+#define _OBSERVABLE_OUTPUT_HPP_
+
+#include <cstddef>       // for size_t
+#include <cstdint>       // for uint32_t, uint64_t
+#include <string>        // for string
+#include <string_view>   // for string_view
+#include <vector>        // for vector
+
+#include "observableTable.hpp"   // for ObservableTable
+#include "output.hpp"            // for Output
+#include "typeAliases.hpp"
+
+namespace output
+{
+    /**
+     * @class ObservableOutput inherits from Output
+     *
+     * @brief records all scalar and tensor observables of an MD run into a
+     * single binary columnar file
+     *
+     * @details The observables of the energy, instant energy, momentum,
+     * virial, stress and box files are recorded into in-memory columnar
+     * tables. Whenever the tables hold the configured number of rows they
+     * are flushed as one block per table and the rows are reused, so that
+     * an output step only copies a few doubles. The file is self-describing:
+     *
+     *  - header: magic string, format version, endianness marker and the
+     *    layout of all tables (name, text file extension, step format and
+     *    name and format of every column)
+     *  - blocks: table index, number of rows, the steps of all rows, the
+     *    values column by column and a FNV-1a checksum of steps and values
+     *
+     * ObservableFileReader converts the file back into the text files.
+     */
+    class ObservableOutput : public Output
+    {
+       private:
+        size_t _blockSize       = _DEFAULT_BLOCK_SIZE_;
+        bool   _isHeaderWritten = false;
+
+        std::vector<ObservableTable> _tables;
+        std::vector<double>          _values;
+        std::string                  _payload;
+
+        template <typename T>
+        void appendValue(const T value);
+        void appendString(const std::string_view);
+
+        void initTables();
+        void writeHeader();
+        void writeBlock(const size_t tableIndex);
+
+       public:
+        // clang-format off
+        static constexpr std::string_view _MAGIC_              = {"PQOBSRV", 8};
+        static constexpr uint32_t         _VERSION_            = 1;
+        static constexpr uint32_t         _ENDIANNESS_         = 0x01020304;
+        static constexpr size_t           _DEFAULT_BLOCK_SIZE_ = 1024;
+        // clang-format on
+
+        using Output::Output;
+
+        void record(
+            const size_t            step,
+            const pq::PhysicalData &physicalData,
+            const pq::PhysicalData &averagePhysicalData,
+            const pq::Vec3D        &boxDimensions,
+            const pq::Vec3D        &boxAngles
+        );
+        void flush();
+
+        /***************************
+         * standard setter methods *
+         ***************************/
+
+        void setBlockSize(const size_t blockSize);
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] size_t getBlockSize() const { return _blockSize; }
+        [[nodiscard]] const std::vector<ObservableTable> &getTables() const;
+    };
+
+}   // namespace output
+
+#endif   // _OBSERVABLE_OUTPUT_HPP_
@@ -0,0 +1,144 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _OBSERVABLE_TABLE_HPP_
+
+#define _OBSERVABLE_TABLE_HPP_
+
+#include <cstddef>       // for size_t
+#include <cstdint>       // for uint32_t, uint64_t
+#include <functional>    // for function
+#include <span>          // for span
+#include <string>        // for string
+#include <string_view>   // for string_view
+#include <vector>        // for vector
+
+namespace output
+{
+    class OutputBuffer;   // forward declaration
+
+    /**
+     * @enum ObservableNotation
+     *
+     * @brief notation of a floating point column in the text files
+     *
+     */
+    enum class ObservableNotation : uint32_t
+    {
+        FIXED,
+        SCIENTIFIC
+    };
+
+    /**
+     * @brief text format of an observable, i.e. "{:w.pf}" or "{:w.pe}"
+     *
+     */
+    struct ObservableFormat
+    {
+        ObservableNotation notation;
+        uint32_t           width;
+        uint32_t           precision;
+    };
+
+    /**
+     * @brief named column of an observable table
+     *
+     */
+    struct ObservableColumn
+    {
+        std::string      name;
+        ObservableFormat format;
+    };
+
+    using ObservableVisitor = std::function<
+        void(const std::string_view, const ObservableFormat &, const double)>;
+
+    /**
+     * @class ObservableTable
+     *
+     * @brief columnar storage of the observables of one text output file
+     *
+     * @details A line of the corresponding text file consists of the step
+     * followed by the values of all columns separated by tabs. The values
+     * of each column are stored contiguously, therefore a block of rows can
+     * be written column by column without any conversion. The layout of
+     * the table (name, file extension, step and column formats) is stored
+     * in the header of the binary observable file, so that the text files
+     * can be reproduced exactly from the binary file.
+     */
+    class ObservableTable
+    {
+       private:
+        std::string _name;
+        std::string _extension;
+        uint32_t    _stepWidth;
+        bool        _isStepLeftAligned;
+
+        std::vector<ObservableColumn>    _columns;
+        std::vector<uint64_t>            _steps;
+        std::vector<std::vector<double>> _values;
+
+       public:
+        ObservableTable(
+            const std::string_view name,
+            const std::string_view extension,
+            const uint32_t         stepWidth,
+            const bool             isStepLeftAligned
+        );
+
+        void addColumn(const std::string_view, const ObservableFormat &);
+
+        void reserve(const size_t nRows);
+        void clearRows();
+        void appendRow(const uint64_t step, const std::span<const double>);
+        void appendColumnValue(const size_t column, const double value);
+        void appendStep(const uint64_t step);
+
+        void formatRow(OutputBuffer &buffer, const size_t row) const;
+
+        static void appendValue(
+            OutputBuffer &,
+            const ObservableFormat &,
+            const double
+        );
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] const std::string &getName() const { return _name; }
+        [[nodiscard]] const std::string &getExtension() const;
+        [[nodiscard]] uint32_t getStepWidth() const { return _stepWidth; }
+        [[nodiscard]] bool     isStepLeftAligned() const;
+
+        [[nodiscard]] size_t getNumberOfColumns() const;
+        [[nodiscard]] size_t getNumberOfRows() const { return _steps.size(); }
+
+        [[nodiscard]] const std::vector<ObservableColumn> &getColumns() const;
+        [[nodiscard]] const std::vector<uint64_t>         &getSteps() const;
+        [[nodiscard]] const std::vector<double> &getValues(const size_t) const;
+    };
+
+}   // namespace output
+
+#endif   // _OBSERVABLE_TABLE_HPP_
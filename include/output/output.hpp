@@ -28,6 +28,8 @@
 #include <string>        // for string
 #include <string_view>   // for string_view
 
+#include "outputBuffer.hpp"   // for OutputBuffer
+
 #ifdef WITH_TESTS
 #include <gtest/gtest_prod.h>   // for FRIEND_TEST
 #endif
@@ -49,6 +51,8 @@ namespace output
         std::ofstream _fp;
         int           _rank;
 
+        OutputBuffer _buffer;
+
         void openFile();
 
        public:
@@ -0,0 +1,93 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _OUTPUT_BUFFER_HPP_
+
+#define _OUTPUT_BUFFER_HPP_
+
+#include <cstddef>       // for size_t
+#include <ostream>       // for ostream
+#include <string>        // for string
+#include <string_view>   // for string_view
+
+#include "typeAliases.hpp"
+
+namespace output
+{
+    /**
+     * @class OutputBuffer
+     *
+     * @brief reusable character buffer for formatting output files
+     *
+     * @details All numbers are formatted with std::to_chars into a local
+     * character array and appended with the requested padding. The results
+     * are identical to the corresponding std::format specifications:
+     *
+     * - appendFixed(value, w, p)      -> "{:w.pf}"
+     * - appendScientific(value, w, p) -> "{:w.pe}"
+     * - appendInteger(value, w)       -> "{:wd}"
+     * - appendInteger(value, w, true) -> "{:<w}"
+     * - appendLeft(string, w)         -> "{:<w}"
+     * - appendRight(string, w)        -> "{:>w}"
+     * - appendGeneral(value)          -> std::ostream << value
+     *
+     * The capacity of the buffer is kept between frames, therefore writing a
+     * frame does not allocate after the first frame.
+     */
+    class OutputBuffer
+    {
+       private:
+        // the fixed representation of a double has up to 309 integer digits
+        static constexpr size_t _MAX_NUMBER_LENGTH_ = 512;
+
+        std::string _buffer;
+
+        void appendPadded(const std::string_view, const size_t, const bool);
+
+       public:
+        void clear();
+        void reserve(const size_t size);
+        void writeTo(std::ostream &stream);
+
+        void append(const char character);
+        void append(const std::string_view string);
+        void appendLeft(const std::string_view string, const size_t width);
+        void appendRight(const std::string_view string, const size_t width);
+
+        void appendFixed(const double, const size_t, const int);
+        void appendScientific(const double, const size_t, const int);
+        void appendGeneral(const double value);
+        void appendGeneral(const pq::Vec3D &vector);
+        void appendInteger(const size_t, const size_t, const bool = false);
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] const std::string &str() const { return _buffer; }
+        [[nodiscard]] size_t size() const { return _buffer.size(); }
+    };
+
+}   // namespace output
+
+#endif   // _OUTPUT_BUFFER_HPP_
@@ -39,6 +39,7 @@ namespace references
     static constexpr char _NOSE_HOOVER_CHAIN_FILE_[]    = "nose_hoover_chain.ref";
     static constexpr char _LANGEVIN_FILE_[]             = "langevin.ref";
     static constexpr char _STOCHASTIC_RESCALING_FILE_[] = "stochastic_rescaling.ref";
+    static constexpr char _MONTE_CARLO_FILE_[]          = "monte_carlo.ref";
 
     // QM Programs
     static constexpr char _DFTBPLUS_FILE_[]  = "dftbplus.ref";
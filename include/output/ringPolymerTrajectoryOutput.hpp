@@ -24,6 +24,7 @@
 
 #define _RING_POLYMER_TRAJECTORY_OUTPUT_HPP_
 
+#include <string>   // for string
 #include <vector>   // for vector
 
 #include "output.hpp"
@@ -40,6 +41,12 @@ namespace output
      */
     class RingPolymerTrajectoryOutput : public Output
     {
+       private:
+        std::vector<std::string> _paddedAtomNames;
+
+        void updateAtomNames(pq::SimBox &);
+        void writeAtomName(const size_t atomIndex, const size_t bead);
+
        public:
         using Output::Output;
 
@@ -43,7 +43,8 @@ namespace output
         using Output::Output;
 
         void write(pq::SimBox &, const pq::Thermostat &, const size_t);
-        void writeNHChain(const pq::Thermostat &, std::ostringstream &);
+        void write(const pq::FrameSnapshot &);
+        void writeNHChain(const pq::FrameSnapshot &);
     };
 
 }   // namespace output
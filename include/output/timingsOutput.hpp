@@ -24,6 +24,7 @@
 
 #define __TIMINGS_OUTPUT_HPP__
 
+#include <cstddef>       // for size_t
 #include <string_view>   // for string_view
 
 #include "output.hpp"   // for Output
@@ -40,10 +41,13 @@ namespace output
      */
     class TimingsOutput : public Output
     {
+       private:
+        void writeHardwareCounters(const pq::GlobalTimer &, const size_t);
+
        public:
         using Output::Output;
 
-        void write(pq::GlobalTimer &timer);
+        void write(pq::GlobalTimer &timer, const size_t nAtoms);
     };
 
 }   // namespace output
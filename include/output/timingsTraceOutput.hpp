@@ -0,0 +1,57 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef _TIMINGS_TRACE_OUTPUT_HPP_
+
+#define _TIMINGS_TRACE_OUTPUT_HPP_
+
+#include <string>        // for string
+#include <string_view>   // for string_view
+
+#include "output.hpp"   // for Output
+#include "typeAliases.hpp"
+
+namespace output
+{
+    /**
+     * @class TimingsTraceOutput inherits from Output
+     *
+     * @brief Output file for the recorded timings events
+     *
+     * @details the events of all timers are written in the Chrome trace
+     * event format, which can be opened with chrome://tracing or
+     * https://ui.perfetto.dev. Every thread is shown as separate track.
+     */
+    class TimingsTraceOutput : public Output
+    {
+       private:
+        [[nodiscard]] static std::string escape(const std::string_view);
+
+       public:
+        using Output::Output;
+
+        void write(const pq::GlobalTimer &timer);
+    };
+
+}   // namespace output
+
+#endif   // _TIMINGS_TRACE_OUTPUT_HPP_
@@ -40,11 +40,16 @@ namespace output
        public:
         using Output::Output;
 
-        void writeHeader(const pq::SimBox &);
+        void writeHeader(const pq::FrameSnapshot &);
         void writeXyz(pq::SimBox &);
         void writeVelocities(pq::SimBox &);
         void writeForces(pq::SimBox &);
         void writeCharges(pq::SimBox &);
+
+        void writeXyz(const pq::FrameSnapshot &);
+        void writeVelocities(const pq::FrameSnapshot &);
+        void writeForces(const pq::FrameSnapshot &);
+        void writeCharges(const pq::FrameSnapshot &);
     };
 
 }   // namespace output
@@ -82,11 +82,23 @@ namespace physicalData
 
         double _ringPolymerEnergy = 0.0;
 
+        double _nKineticsSkipped = 0.0;
+        double _nVirialSkipped   = 0.0;
+
        public:
         void calculateTemperature(pq::SimBox &);
         void calculateKinetics(pq::SimBox &);
+
+        template <typename Func>
+        void calculateKinetics(pq::SimBox &, Func &&updateAtom);
+
         void changeKineticVirialToAtomic();
 
+        void skipKinetics();
+        void skipVirial();
+
+        [[nodiscard]] bool isKineticsSkipped() const;
+
         std::function<pq::tensor3D()> getKinEnergyVirialTensor =
             std::bind_front(&PhysicalData::getKinEnergyMolTensor, this);
 
@@ -204,4 +216,6 @@ namespace physicalData
 
 }   // namespace physicalData
 
+#include "physicalData.tpp.hpp"   // DO NOT MOVE THIS LINE
+
 #endif   // _PHYSICAL_DATA_HPP_
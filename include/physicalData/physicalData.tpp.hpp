@@ -0,0 +1,103 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _PHYSICAL_DATA_TPP_
+
+#define _PHYSICAL_DATA_TPP_
+
+#include <algorithm>   // for for_each
+#include <cstddef>     // for size_t
+
+#include "atom.hpp"                                  // for Atom
+#include "constants/conversionFactors.hpp"           // for _FS_TO_S_
+#include "constants/internalConversionFactors.hpp"   // for _KINETIC_ENERGY_FACTOR_
+#include "molecule.hpp"                              // for Molecule
+#include "physicalData.hpp"
+#include "simulationBox.hpp"   // for SimulationBox
+
+namespace physicalData
+{
+    /**
+     * @brief Calculates kinetic energy and momentum of the system
+     *
+     * @details updateAtom is called for each atom with its index in the
+     * simulation box right before the contribution of the atom is
+     * accumulated. This allows to fuse per atom velocity updates with the
+     * calculation of the kinetics into a single pass over the atoms.
+     *
+     * @tparam Func
+     * @param simBox
+     * @param updateAtom callable with signature void(Atom &, size_t)
+     */
+    template <typename Func>
+    void PhysicalData::calculateKinetics(pq::SimBox &simBox, Func &&updateAtom)
+    {
+        using namespace constants;
+
+        startTimingsSection<"Calc Kinetics">();
+
+        _momentum                  = pq::Vec3D();
+        _kineticEnergyAtomicTensor = pq::tensor3D();
+        _kinEnergyMolTensor        = pq::tensor3D();
+
+        size_t atomIndex = 0;
+
+        auto kinEnergyAndMomOfMol = [this, &updateAtom, &atomIndex](auto &mol)
+        {
+            const auto numberOfAtoms   = mol.getNumberOfAtoms();
+            auto       momentumSquared = pq::tensor3D();
+
+            for (size_t i = 0; i < numberOfAtoms; ++i)
+            {
+                auto &atom = mol.getAtom(i);
+
+                updateAtom(atom, atomIndex++);
+
+                const auto velocities = atom.getVelocity();
+                const auto momentum   = velocities * atom.getMass();
+
+                _momentum                  += momentum;
+                _kineticEnergyAtomicTensor += tensorProduct(momentum, velocities);
+                momentumSquared            += tensorProduct(momentum, momentum);
+            }
+
+            _kinEnergyMolTensor += momentumSquared / mol.getMolMass();
+        };
+
+        std::ranges::for_each(simBox.getMolecules(), kinEnergyAndMomOfMol);
+
+        _kineticEnergyAtomicTensor *= _KINETIC_ENERGY_FACTOR_;
+        _kinEnergyMolTensor        *= _KINETIC_ENERGY_FACTOR_;
+        _kineticEnergy              = trace(_kineticEnergyAtomicTensor);
+
+        _angularMomentum  = simBox.calculateAngularMomentum(_momentum);
+        _angularMomentum *= _FS_TO_S_;
+
+        _momentum *= _FS_TO_S_;
+
+        stopTimingsSection<"Calc Kinetics">();
+    }
+
+}   // namespace physicalData
+
+#endif   // _PHYSICAL_DATA_TPP_
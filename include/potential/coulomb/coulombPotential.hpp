@@ -48,9 +48,9 @@ namespace potential
     class CoulombPotential
     {
        protected:
-        inline static double _coulombRadiusCutOff;
-        inline static double _coulombEnergyCutOff;
-        inline static double _coulombForceCutOff;
+        double _coulombRadiusCutOff;
+        double _coulombEnergyCutOff;
+        double _coulombForceCutOff;
 
        public:
         virtual ~CoulombPotential() = default;
@@ -63,17 +63,17 @@ namespace potential
          * standard setter methods *
          ***************************/
 
-        static void setCoulombRadiusCutOff(const double coulombRadiusCutOff);
-        static void setCoulombEnergyCutOff(const double coulombEnergyCutOff);
-        static void setCoulombForceCutOff(const double coulombForceCutOff);
+        void setCoulombRadiusCutOff(const double coulombRadiusCutOff);
+        void setCoulombEnergyCutOff(const double coulombEnergyCutOff);
+        void setCoulombForceCutOff(const double coulombForceCutOff);
 
         /***************************
          * standard getter methods *
          ***************************/
 
-        [[nodiscard]] static double getCoulombRadiusCutOff();
-        [[nodiscard]] static double getCoulombEnergyCutOff();
-        [[nodiscard]] static double getCoulombForceCutOff();
+        [[nodiscard]] double getCoulombRadiusCutOff() const;
+        [[nodiscard]] double getCoulombEnergyCutOff() const;
+        [[nodiscard]] double getCoulombForceCutOff() const;
     };
 
 }   // namespace potential
@@ -42,10 +42,10 @@ namespace potential
     class CoulombWolf : public CoulombPotential
     {
        protected:
-        inline static double _kappa;
-        inline static double _wolfParam1;
-        inline static double _wolfParam2;
-        inline static double _wolfParam3;
+        double _kappa;
+        double _wolfParam1;
+        double _wolfParam2;
+        double _wolfParam3;
 
        public:
         explicit CoulombWolf(
@@ -62,10 +62,10 @@ namespace potential
          * standard setter methods *
          ***************************/
 
-        static void setKappa(const double kappa);
-        static void setWolfParameter1(const double wolfParameter1);
-        static void setWolfParameter2(const double wolfParameter2);
-        static void setWolfParameter3(const double wolfParameter3);
+        void setKappa(const double kappa);
+        void setWolfParameter1(const double wolfParameter1);
+        void setWolfParameter2(const double wolfParameter2);
+        void setWolfParameter3(const double wolfParameter3);
 
         /***************************
          * standard getter methods *
@@ -29,6 +29,7 @@ Public License along with this program.  If not, see
 
 #include <cstddef>   // for size_t
 #include <memory>    // for shared_ptr, __shared_ptr_access, make_shared
+#include <tuple>     // for tuple
 #include <utility>   // for pair
 
 #include "timer.hpp"
@@ -36,6 +37,19 @@ Public License along with this program.  If not, see
 
 namespace potential
 {
+    /**
+     * @brief Coulomb and non-Coulomb parts of a single atom pair interaction
+     *
+     * @details the forces act on the first atom of the pair
+     */
+    struct PairInteraction
+    {
+        double    coulombEnergy    = 0.0;
+        double    nonCoulombEnergy = 0.0;
+        pq::Vec3D coulombForce     = {0.0, 0.0, 0.0};
+        pq::Vec3D nonCoulombForce  = {0.0, 0.0, 0.0};
+    };
+
     /**
      * @class Potential
      *
@@ -46,6 +60,11 @@ namespace potential
      * - brute force
      * - cell list
      *
+     * calculateEnergy evaluates only the Coulomb and non-Coulomb energies
+     * and leaves all forces, shift forces and the virial untouched.
+     * If _computeShiftForces is false calculateForces does not accumulate
+     * the shift forces needed for the virial.
+     *
      * @note _nonCoulPairsVec is just a container to store the
      * nonCoulombicPairs for later processing
      *
@@ -56,12 +75,18 @@ namespace potential
         pq::SharedCoulombPot    _coulombPotential;
         pq::SharedNonCoulombPot _nonCoulombPot;
 
+        bool _computeShiftForces = true;
+
        public:
         virtual ~Potential() = default;
 
         virtual void calculateForces(pq::SimBox &, pq::PhysicalData &, pq::CellList &) = 0;
+        virtual void calculateEnergy(pq::SimBox &, pq::PhysicalData &, pq::CellList &) = 0;
         virtual pq::SharedPotential clone() const = 0;
 
+        template <
+            bool computeForces      = true,
+            bool computeShiftForces = computeForces>
         std::pair<double, double> calculateSingleInteraction(
             const pq::Box &,
             pq::Molecule &,
@@ -70,6 +95,24 @@ namespace potential
             const size_t
         ) const;
 
+        [[nodiscard]] PairInteraction calculateSingleInteractionParts(
+            const pq::Box &,
+            pq::Molecule &,
+            pq::Molecule &,
+            const size_t,
+            const size_t
+        ) const;
+
+        [[nodiscard]] static std::tuple<double, double, double>
+        calculatePairInteraction(
+            const pq::CoulombPot  &coulombPot,
+            const pq::NonCoulPair &nonCoulombPair,
+            const double           distance,
+            const double           chargeProduct,
+            const double           coulombScale    = 1.0,
+            const double           nonCoulombScale = 1.0
+        );
+
         template <typename T>
         void makeCoulombPotential(T p);
 
@@ -81,6 +124,7 @@ namespace potential
          ***************************/
 
         void setNonCoulombPotential(const pq::SharedNonCoulombPot);
+        void setComputeShiftForces(const bool computeShiftForces);
 
         /***************************
          * standard getter methods *
@@ -90,6 +134,7 @@ namespace potential
         [[nodiscard]] pq::NonCoulombPot      &getNonCoulombPotential() const;
         [[nodiscard]] pq::SharedCoulombPot    getCoulombPotSharedPtr() const;
         [[nodiscard]] pq::SharedNonCoulombPot getNonCoulombPotSharedPtr() const;
+        [[nodiscard]] bool                    isComputeShiftForces() const;
     };
 
 }   // namespace potential
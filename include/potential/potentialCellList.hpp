@@ -37,11 +37,17 @@ namespace potential
      */
     class PotentialCellList : public Potential
     {
+       private:
+        template <bool computeForces, bool computeShiftForces = computeForces>
+        void calculate(pq::SimBox &, pq::PhysicalData &, pq::CellList &);
+
        public:
         ~PotentialCellList() override;
 
         void calculateForces(pq::SimBox &, pq::PhysicalData &, pq::CellList &)
             override;
+        void calculateEnergy(pq::SimBox &, pq::PhysicalData &, pq::CellList &)
+            override;
 
         pq::SharedPotential clone() const override;
     };
@@ -69,6 +69,8 @@ namespace resetKinetics
         void resetMomentum(pq::SimBox &);
         void resetAngularMomentum(pq::SimBox &);
 
+        [[nodiscard]] bool isResetStep(const size_t step) const;
+
         /********************
          * standard setters *
          *******************/
@@ -38,18 +38,27 @@ namespace settings
      */
     class ConstraintSettings
     {
-       private:
-        // clang-format off
-        static inline bool _shakeActive          = defaults::_CONSTRAINTS_ACTIVE_DEFAULT_;
-        static inline bool _mShakeActive         = defaults::_CONSTRAINTS_ACTIVE_DEFAULT_;
-        static inline bool _distanceConstsActive = defaults::_CONSTRAINTS_ACTIVE_DEFAULT_;
-
-        static inline size_t _shakeMaxIter  = defaults::_SHAKE_MAX_ITER_DEFAULT_;
-        static inline size_t _rattleMaxIter = defaults::_RATTLE_MAX_ITER_DEFAULT_;
+       public:
+        /**
+         * @brief per instance state of the ConstraintSettings
+         */
+        struct State
+        {
+            // clang-format off
+            bool _shakeActive          = defaults::_CONSTRAINTS_ACTIVE_DEFAULT_;
+            bool _mShakeActive         = defaults::_CONSTRAINTS_ACTIVE_DEFAULT_;
+            bool _distanceConstsActive = defaults::_CONSTRAINTS_ACTIVE_DEFAULT_;
+
+            size_t _shakeMaxIter  = defaults::_SHAKE_MAX_ITER_DEFAULT_;
+            size_t _rattleMaxIter = defaults::_RATTLE_MAX_ITER_DEFAULT_;
+
+            double _shakeTolerance  = defaults::_SHAKE_TOLERANCE_DEFAULT_;
+            double _rattleTolerance = defaults::_RATTLE_TOLERANCE_DEFAULT_;
+            // clang-format on
+        };
 
-        static inline double _shakeTolerance  = defaults::_SHAKE_TOLERANCE_DEFAULT_;
-        static inline double _rattleTolerance = defaults::_RATTLE_TOLERANCE_DEFAULT_;
-        // clang-format on
+       private:
+        [[nodiscard]] static State &state();
 
        public:
         ConstraintSettings()  = default;
@@ -55,25 +55,34 @@ namespace settings
      */
     class ConvSettings
     {
-       private:
-        static inline std::optional<double> _energyConv;
-        static inline std::optional<double> _relEnergyConv;
-        static inline std::optional<double> _absEnergyConv;
-
-        static inline std::optional<double> _forceConv;
-        static inline std::optional<double> _maxForceConv;
-        static inline std::optional<double> _rmsForceConv;
-
-        static inline bool _useEnergyConv   = true;
-        static inline bool _useForceConv    = true;
-        static inline bool _useMaxForceConv = true;
-        static inline bool _useRMSForceConv = true;
-
-        static inline std::optional<ConvStrategy> _energyConvStrategy;
+       public:
+        /**
+         * @brief per instance state of the ConvSettings
+         */
+        struct State
+        {
+            std::optional<double> _energyConv;
+            std::optional<double> _relEnergyConv;
+            std::optional<double> _absEnergyConv;
+
+            std::optional<double> _forceConv;
+            std::optional<double> _maxForceConv;
+            std::optional<double> _rmsForceConv;
+
+            bool _useEnergyConv   = true;
+            bool _useForceConv    = true;
+            bool _useMaxForceConv = true;
+            bool _useRMSForceConv = true;
+
+            std::optional<ConvStrategy> _energyConvStrategy;
+
+            // clang-format off
+            std::string _defaultEnergyConvStrategy = defaults::_EN_CONV_STRATEGY_DEFAULT_;
+            // clang-format on
+        };
 
-        // clang-format off
-        static inline std::string _defaultEnergyConvStrategy = defaults::_EN_CONV_STRATEGY_DEFAULT_;
-        // clang-format on
+       private:
+        [[nodiscard]] static State &state();
 
        public:
         [[nodiscard]] static ConvStrategy getConvStrategy(
@@ -39,27 +39,36 @@ namespace settings
      */
     class FileSettings
     {
+       public:
+        /**
+         * @brief per instance state of the FileSettings
+         */
+        struct State
+        {
+            // clang-format off
+            std::string _molDescriptorFile = defaults::_MOLDESCRIPTOR_FILE_DEFAULT_;
+            // clang-format on
+
+            std::string _guffDatFile = defaults::_GUFF_FILE_DEFAULT_;
+
+            std::string _topologyFile;
+            std::string _parameterFile;
+            std::string _intraNonBondedFile;
+            std::string _startFile;
+            std::string _rpmdStartFile;
+            std::string _mShakeFile;
+            std::string _dftbFile = defaults::_DFTB_FILE_DEFAULT_;
+
+            bool _isTopologyFileSet       = false;
+            bool _isParameterFileSet      = false;
+            bool _isIntraNonBondedFileSet = false;
+            bool _isRPMDStartFileSet      = false;
+            bool _isMShakeFileSet         = false;
+            bool _isDFTBFileSet           = false;
+        };
+
        private:
-        // clang-format off
-        static inline std::string _molDescriptorFile = defaults::_MOLDESCRIPTOR_FILE_DEFAULT_;
-        // clang-format on
-
-        static inline std::string _guffDatFile = defaults::_GUFF_FILE_DEFAULT_;
-
-        static inline std::string _topologyFile;
-        static inline std::string _parameterFile;
-        static inline std::string _intraNonBondedFile;
-        static inline std::string _startFile;
-        static inline std::string _rpmdStartFile;
-        static inline std::string _mShakeFile;
-        static inline std::string _dftbFile = defaults::_DFTB_FILE_DEFAULT_;
-
-        static bool inline _isTopologyFileSet       = false;
-        static bool inline _isParameterFileSet      = false;
-        static bool inline _isIntraNonBondedFileSet = false;
-        static bool inline _isRPMDStartFileSet      = false;
-        static bool inline _isMShakeFileSet         = false;
-        static bool inline _isDFTBFileSet           = false;
+        [[nodiscard]] static State &state();
 
        public:
         FileSettings()  = default;
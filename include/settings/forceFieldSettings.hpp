@@ -34,8 +34,17 @@ namespace settings
      */
     class ForceFieldSettings
     {
+       public:
+        /**
+         * @brief per instance state of the ForceFieldSettings
+         */
+        struct State
+        {
+            bool _active = false;
+        };
+
        private:
-        static inline bool _active = false;
+        [[nodiscard]] static State &state();
 
        public:
         ForceFieldSettings()  = default;
@@ -38,16 +38,25 @@ namespace settings
      */
     class HybridSettings
     {
-       private:
-        static inline std::string _coreCenterString      = "";
-        static inline std::string _coreOnlyListString    = "";
-        static inline std::string _nonCoreOnlyListString = "";
-
-        static inline bool _useQMCharges = false;
+       public:
+        /**
+         * @brief per instance state of the HybridSettings
+         */
+        struct State
+        {
+            std::string _coreCenterString      = "";
+            std::string _coreOnlyListString    = "";
+            std::string _nonCoreOnlyListString = "";
+
+            bool _useQMCharges = false;
+
+            double _coreRadius      = 0.0;
+            double _layerRadius     = 0.0;
+            double _smoothingRadius = 0.0;
+        };
 
-        static inline double _coreRadius      = 0.0;
-        static inline double _layerRadius     = 0.0;
-        static inline double _smoothingRadius = 0.0;
+       private:
+        [[nodiscard]] static State &state();
 
        public:
         /********************
@@ -42,7 +42,8 @@ namespace settings
     {
         NONE,
         BERENDSEN,
-        STOCHASTIC_RESCALING
+        STOCHASTIC_RESCALING,
+        MONTE_CARLO
     };
 
     /**
@@ -71,21 +72,34 @@ namespace settings
      */
     class ManostatSettings
     {
-       private:
-        static inline ManostatType _manostatType = ManostatType::NONE;
-        static inline Isotropy     _isotropy     = Isotropy::ISOTROPIC;
+       public:
+        /**
+         * @brief per instance state of the ManostatSettings
+         */
+        struct State
+        {
+            ManostatType _manostatType = ManostatType::NONE;
+            Isotropy     _isotropy     = Isotropy::ISOTROPIC;
+
+            bool _isPressureSet = false;
 
-        static inline bool _isPressureSet = false;
+            double _targetPressure;
 
-        static inline double _targetPressure;
+            // clang-format off
+            double _tauManostat     = defaults::_BERENDSEN_MANOSTAT_RELAX_TIME_;
+            double _compressibility = defaults::_COMPRESSIBILITY_WATER_DEFAULT_;
+            size_t _monteCarloFreq  = defaults::_MONTE_CARLO_MANOSTAT_FREQ_;
+            double _volumeChange    = defaults::_MONTE_CARLO_VOLUME_CHANGE_;
+            // clang-format on
 
-        // clang-format off
-        static inline double _tauManostat     = defaults::_BERENDSEN_MANOSTAT_RELAX_TIME_;
-        static inline double _compressibility = defaults::_COMPRESSIBILITY_WATER_DEFAULT_;
-        // clang-format on
+            std::vector<size_t> _2DIsotropicAxes;
+            size_t              _2DAnisotropicAxis;
 
-        static inline std::vector<size_t> _2DIsotropicAxes;
-        static inline size_t              _2DAnisotropicAxis;
+            std::string _randomState;
+        };
+
+       private:
+        [[nodiscard]] static State &state();
 
        public:
         ManostatSettings()  = default;
@@ -105,8 +119,11 @@ namespace settings
         static void setTargetPressure(const double targetPressure);
         static void setTauManostat(const double tauManostat);
         static void setCompressibility(const double compressibility);
+        static void setMonteCarloFrequency(const size_t frequency);
+        static void setVolumeChange(const double volumeChange);
         static void set2DIsotropicAxes(const std::vector<size_t> &indices);
         static void set2DAnisotropicAxis(const size_t index);
+        static void setRandomState(const std::string &randomState);
 
         /***************************
          * standard getter methods *
@@ -120,8 +137,11 @@ namespace settings
         [[nodiscard]] static double              getTargetPressure();
         [[nodiscard]] static double              getTauManostat();
         [[nodiscard]] static double              getCompressibility();
+        [[nodiscard]] static size_t              getMonteCarloFrequency();
+        [[nodiscard]] static double              getVolumeChange();
         [[nodiscard]] static std::vector<size_t> get2DIsotropicAxes();
         [[nodiscard]] static size_t              get2DAnisotropicAxis();
+        [[nodiscard]] static std::string         getRandomState();
     };
 
 }   // namespace settings
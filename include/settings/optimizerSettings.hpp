@@ -41,7 +41,9 @@ namespace settings
     {
         NONE,
         STEEPEST_DESCENT,
-        ADAM
+        ADAM,
+        LBFGS,
+        FIRE
     };
 
     /**
@@ -68,20 +70,38 @@ namespace settings
      */
     class OptimizerSettings
     {
-       private:
-        // clang-format off
-        static inline OptimizerType _optimizer = OptimizerType::STEEPEST_DESCENT;
-        static inline LREnum _LRStrategy   = LREnum::EXPONENTIAL_DECAY;
-
-        static inline size_t _nEpochs           = defaults::_N_EPOCHS_DEFAULT_;
-        static inline size_t _LRupdateFrequency = defaults::_LR_UPDATE_FREQUENCY_DEFAULT_;
-
-        static inline double _initialLearningRate = defaults::_INITIAL_LEARNING_RATE_DEFAULT_;
-        static inline double _minLearningRate     = defaults::_MIN_LEARNING_RATE_DEFAULT_;
-        // clang-format on
+       public:
+        /**
+         * @brief per instance state of the OptimizerSettings
+         */
+        struct State
+        {
+            // clang-format off
+            OptimizerType _optimizer = OptimizerType::STEEPEST_DESCENT;
+            LREnum _LRStrategy   = LREnum::EXPONENTIAL_DECAY;
+
+            size_t _nEpochs           = defaults::_N_EPOCHS_DEFAULT_;
+            size_t _LRupdateFrequency = defaults::_LR_UPDATE_FREQUENCY_DEFAULT_;
+            size_t _LBFGSMemory       = defaults::_LBFGS_MEMORY_DEFAULT_;
+
+            double _initialLearningRate = defaults::_INITIAL_LEARNING_RATE_DEFAULT_;
+            double _minLearningRate     = defaults::_MIN_LEARNING_RATE_DEFAULT_;
+
+            double _fireTimestep         = defaults::_FIRE_TIMESTEP_DEFAULT_;
+            double _fireMaxTimestep      = defaults::_FIRE_MAX_TIMESTEP_DEFAULT_;
+            size_t _fireNMin             = defaults::_FIRE_N_MIN_DEFAULT_;
+            double _fireTimestepIncrease = defaults::_FIRE_TIMESTEP_INCREASE_DEFAULT_;
+            double _fireTimestepDecrease = defaults::_FIRE_TIMESTEP_DECREASE_DEFAULT_;
+            double _fireAlphaStart       = defaults::_FIRE_ALPHA_START_DEFAULT_;
+            double _fireAlphaDecrease    = defaults::_FIRE_ALPHA_DECREASE_DEFAULT_;
+            // clang-format on
+
+            std::optional<double> _learningRateDecay;
+            std::optional<double> _maxLearningRate;
+        };
 
-        static inline std::optional<double> _learningRateDecay;
-        static inline std::optional<double> _maxLearningRate;
+       private:
+        [[nodiscard]] static State &state();
 
        public:
         /***************************
@@ -96,6 +116,7 @@ namespace settings
 
         static void setNumberOfEpochs(const size_t);
         static void setLRUpdateFrequency(const size_t);
+        static void setLBFGSMemory(const size_t);
 
         static void setInitialLearningRate(const double);
         static void setLearningRateDecay(const double);
@@ -103,6 +124,14 @@ namespace settings
         static void setMaxLearningRate(const double);
         static void setMinLearningRate(const double);
 
+        static void setFireTimestep(const double);
+        static void setFireMaxTimestep(const double);
+        static void setFireNMin(const size_t);
+        static void setFireTimestepIncrease(const double);
+        static void setFireTimestepDecrease(const double);
+        static void setFireAlphaStart(const double);
+        static void setFireAlphaDecrease(const double);
+
         /***************************
          * standard getter methods *
          ***************************/
@@ -112,10 +141,19 @@ namespace settings
 
         [[nodiscard]] static size_t getNumberOfEpochs();
         [[nodiscard]] static size_t getLRUpdateFrequency();
+        [[nodiscard]] static size_t getLBFGSMemory();
 
         [[nodiscard]] static double getInitialLearningRate();
         [[nodiscard]] static double getMinLearningRate();
 
+        [[nodiscard]] static double getFireTimestep();
+        [[nodiscard]] static double getFireMaxTimestep();
+        [[nodiscard]] static size_t getFireNMin();
+        [[nodiscard]] static double getFireTimestepIncrease();
+        [[nodiscard]] static double getFireTimestepDecrease();
+        [[nodiscard]] static double getFireAlphaStart();
+        [[nodiscard]] static double getFireAlphaDecrease();
+
         [[nodiscard]] static std::optional<double> getLearningRateDecay();
         [[nodiscard]] static std::optional<double> getMaxLearningRate();
 
@@ -40,40 +40,57 @@ namespace settings
      */
     class OutputFileSettings
     {
+       public:
+        /**
+         * @brief per instance state of the OutputFileSettings
+         */
+        struct State
+        {
+            size_t _outputFrequency = 1;
+            bool   _isAsyncOutput   = true;
+            bool   _isObsOutput     = false;
+            bool   _isTraceOutput   = false;
+
+            bool        _filePrefixSet = false;
+            std::string _filePrefix;
+
+            std::string _energyFile = defaults::_ENERGY_FILE_DEFAULT_;
+            std::string _instEnFile = defaults::_INSTEN_FILE_DEFAULT_;
+            std::string _rstFile  = defaults::_RESTART_FILE_DEFAULT_;
+            std::string _chkFile  = defaults::_CHK_FILE_DEFAULT_;
+            std::string _obsFile  = defaults::_OBS_FILE_DEFAULT_;
+            std::string _momFile  = defaults::_MOMENTUM_FILE_DEFAULT_;
+            std::string _trajFile = defaults::_TRAJ_FILE_DEFAULT_;
+            std::string _velFile  = defaults::_VEL_FILE_DEFAULT_;
+            std::string _forceFile  = defaults::_FORCE_FILE_DEFAULT_;
+            std::string _chargeFile = defaults::_CHARGE_FILE_DEFAULT_;
+            std::string _logFile    = defaults::_LOG_FILE_DEFAULT_;
+            std::string _refFile    = defaults::_REF_FILE_DEFAULT_;
+            std::string _infoFile   = defaults::_INFO_FILE_DEFAULT_;
+
+            std::string _virialFile = defaults::_VIRIAL_FILE_DEFAULT_;
+            std::string _stressFile = defaults::_STRESS_FILE_DEFAULT_;
+            std::string _boxFile    = defaults::_BOX_FILE_DEFAULT_;
+
+            std::string _optFile = defaults::_OPT_FILE_DEFAULT_;
+
+            // clang-format off
+            std::string _rpmdRstFile    = defaults::_RPMD_RST_FILE_DEFAULT_;
+            std::string _rpmdTrajFile   = defaults::_RPMD_TRAJ_FILE_DEFAULT_;
+            std::string _rpmdVelFile    = defaults::_RPMD_VEL_FILE_DEFAULT_;
+            std::string _rpmdForceFile  = defaults::_RPMD_FORCE_FILE_DEFAULT_;
+            std::string _rpmdChargeFile = defaults::_RPMD_CHARGE_FILE_DEFAULT_;
+            std::string _rpmdEnergyFile = defaults::_RPMD_ENERGY_FILE_DEFAULT_;
+            // clang-format on
+
+            std::string _timeFile  = defaults::_TIMINGS_FILE_DEFAULT_;
+            std::string _traceFile = defaults::_TRACE_FILE_DEFAULT_;
+
+            std::string _rexFile = defaults::_REX_FILE_DEFAULT_;
+        };
+
        private:
-        static inline size_t _outputFrequency = 1;
-
-        static inline bool        _filePrefixSet = false;
-        static inline std::string _filePrefix;
-
-        static inline std::string _energyFile = defaults::_ENERGY_FILE_DEFAULT_;
-        static inline std::string _instEnFile = defaults::_INSTEN_FILE_DEFAULT_;
-        static inline std::string _rstFile  = defaults::_RESTART_FILE_DEFAULT_;
-        static inline std::string _momFile  = defaults::_MOMENTUM_FILE_DEFAULT_;
-        static inline std::string _trajFile = defaults::_TRAJ_FILE_DEFAULT_;
-        static inline std::string _velFile  = defaults::_VEL_FILE_DEFAULT_;
-        static inline std::string _forceFile  = defaults::_FORCE_FILE_DEFAULT_;
-        static inline std::string _chargeFile = defaults::_CHARGE_FILE_DEFAULT_;
-        static inline std::string _logFile    = defaults::_LOG_FILE_DEFAULT_;
-        static inline std::string _refFile    = defaults::_REF_FILE_DEFAULT_;
-        static inline std::string _infoFile   = defaults::_INFO_FILE_DEFAULT_;
-
-        static inline std::string _virialFile = defaults::_VIRIAL_FILE_DEFAULT_;
-        static inline std::string _stressFile = defaults::_STRESS_FILE_DEFAULT_;
-        static inline std::string _boxFile    = defaults::_BOX_FILE_DEFAULT_;
-
-        static inline std::string _optFile = defaults::_OPT_FILE_DEFAULT_;
-
-        // clang-format off
-        static inline std::string _rpmdRstFile    = defaults::_RPMD_RST_FILE_DEFAULT_;
-        static inline std::string _rpmdTrajFile   = defaults::_RPMD_TRAJ_FILE_DEFAULT_;
-        static inline std::string _rpmdVelFile    = defaults::_RPMD_VEL_FILE_DEFAULT_;
-        static inline std::string _rpmdForceFile  = defaults::_RPMD_FORCE_FILE_DEFAULT_;
-        static inline std::string _rpmdChargeFile = defaults::_RPMD_CHARGE_FILE_DEFAULT_;
-        static inline std::string _rpmdEnergyFile = defaults::_RPMD_ENERGY_FILE_DEFAULT_;
-        // clang-format on
-
-        static inline std::string _timeFile = defaults::_TIMINGS_FILE_DEFAULT_;
+        [[nodiscard]] static State &state();
 
        public:
         OutputFileSettings()  = default;
@@ -82,6 +99,7 @@ namespace settings
         static void setOutputFrequency(const size_t outputFreq);
         static void setFilePrefix(const std::string_view prefix);
         static void replaceDefaultValues(const std::string &prefix);
+        static void addFileNameTag(const std::string &tag);
 
         [[nodiscard]] static std::string determineMostCommonPrefix();
 
@@ -90,6 +108,8 @@ namespace settings
          ***************************/
 
         static void setRestartFileName(const std::string_view);
+        static void setCheckpointFileName(const std::string_view);
+        static void setObservableFileName(const std::string_view);
         static void setEnergyFileName(const std::string_view);
         static void setInstantEnergyFileName(const std::string_view);
         static void setMomentumFileName(const std::string_view);
@@ -115,17 +135,28 @@ namespace settings
         static void setRingPolymerEnergyFileName(const std::string_view);
 
         static void setTimingsFileName(const std::string_view);
+        static void setTimingsTraceFileName(const std::string_view);
+        static void setReplicaExchangeFileName(const std::string_view);
+
+        static void setAsyncOutput(const bool isAsyncOutput);
+        static void setObservableOutput(const bool isObservableOutput);
+        static void setTimingsTraceOutput(const bool isTraceOutput);
 
         /***************************
          * standard getter methods *
          ***************************/
 
         [[nodiscard]] static size_t getOutputFrequency();
+        [[nodiscard]] static bool   isAsyncOutput();
+        [[nodiscard]] static bool   isObservableOutput();
+        [[nodiscard]] static bool   isTimingsTraceOutput();
 
         [[nodiscard]] static bool        isFilePrefixSet();
         [[nodiscard]] static std::string getFilePrefix();
 
         [[nodiscard]] static std::string getRestartFileName();
+        [[nodiscard]] static std::string getCheckpointFileName();
+        [[nodiscard]] static std::string getObservableFileName();
         [[nodiscard]] static std::string getEnergyFileName();
         [[nodiscard]] static std::string getInstantEnergyFileName();
         [[nodiscard]] static std::string getMomentumFileName();
@@ -151,6 +182,8 @@ namespace settings
         [[nodiscard]] static std::string getRPMDEnergyFileName();
 
         [[nodiscard]] static std::string getTimingsFileName();
+        [[nodiscard]] static std::string getTimingsTraceFileName();
+        [[nodiscard]] static std::string getReplicaExchangeFileName();
     };
 
 }   // namespace settings
@@ -73,17 +73,26 @@ namespace settings
      */
     class PotentialSettings
     {
-       private:
-        // clang-format off
-        static inline CoulombLongRangeType _coulombLRType  = CoulombLongRangeType::SHIFTED;
-        static inline NonCoulombType       _nonCoulombType = NonCoulombType::GUFF;
-
-        static inline double _coulombRadiusCutOff = defaults::_COULOMB_CUT_OFF_DEFAULT_;
-        static inline double _scale14Coulomb      = defaults::_SCALE_14_COULOMB_DEFAULT_;
-        static inline double _scale14VanDerWaals  = defaults::_SCALE_14_VAN_DER_WAALS_DEFAULT_;
-        // clang-format on
+       public:
+        /**
+         * @brief per instance state of the PotentialSettings
+         */
+        struct State
+        {
+            // clang-format off
+            CoulombLongRangeType _coulombLRType  = CoulombLongRangeType::SHIFTED;
+            NonCoulombType       _nonCoulombType = NonCoulombType::GUFF;
+
+            double _coulombRadiusCutOff = defaults::_COULOMB_CUT_OFF_DEFAULT_;
+            double _scale14Coulomb      = defaults::_SCALE_14_COULOMB_DEFAULT_;
+            double _scale14VanDerWaals  = defaults::_SCALE_14_VAN_DER_WAALS_DEFAULT_;
+            // clang-format on
+
+            double _wolfParameter = defaults::_WOLF_PARAM_DEFAULT_;
+        };
 
-        static inline double _wolfParameter = defaults::_WOLF_PARAM_DEFAULT_;
+       private:
+        [[nodiscard]] static State &state();
 
        public:
         PotentialSettings()  = default;
@@ -78,20 +78,29 @@ namespace settings
      */
     class QMSettings
     {
-       private:
-        static inline QMMethod      _qmMethod      = QMMethod::NONE;
-        static inline MaceModelSize _maceModelSize = MaceModelSize::MEDIUM;
-        static inline MaceModelType _maceModelType = MaceModelType::MACE_MP;
-
-        static inline std::string _qmScript         = "";
-        static inline std::string _qmScriptFullPath = "";
-        static inline std::string _maceModelPath    = "";
-
-        static inline bool _useDispersionCorrection = false;
+       public:
+        /**
+         * @brief per instance state of the QMSettings
+         */
+        struct State
+        {
+            QMMethod      _qmMethod      = QMMethod::NONE;
+            MaceModelSize _maceModelSize = MaceModelSize::MEDIUM;
+            MaceModelType _maceModelType = MaceModelType::MACE_MP;
+
+            std::string _qmScript         = "";
+            std::string _qmScriptFullPath = "";
+            std::string _maceModelPath    = "";
+
+            bool _useDispersionCorrection = false;
+
+            // clang-format off
+            double _qmLoopTimeLimit = defaults::_QM_LOOP_TIME_LIMIT_DEFAULT_;
+            // clang-format on
+        };
 
-        // clang-format off
-        static inline double _qmLoopTimeLimit = defaults::_QM_LOOP_TIME_LIMIT_DEFAULT_;
-        // clang-format on
+       private:
+        [[nodiscard]] static State &state();
 
        public:
         [[nodiscard]] static bool isExternalQMRunner();
@@ -0,0 +1,73 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef _REPLICA_EXCHANGE_SETTINGS_HPP_
+
+#define _REPLICA_EXCHANGE_SETTINGS_HPP_
+
+#include <cstddef>   // for size_t
+#include <vector>    // for vector
+
+#include "defaults.hpp"   // for _REPLICA_EXCHANGE_FREQUENCY_DEFAULT_
+
+namespace settings
+{
+    /**
+     * @class ReplicaExchangeSettings
+     *
+     * @brief class for storing settings for replica exchange md
+     *
+     */
+    class ReplicaExchangeSettings
+    {
+       public:
+        /**
+         * @brief per instance state of the ReplicaExchangeSettings
+         */
+        struct State
+        {
+            std::vector<double> _temperatures;
+
+            // clang-format off
+            size_t _exchangeFrequency = defaults::_REPLICA_EXCHANGE_FREQUENCY_DEFAULT_;
+            size_t _replicaIndex      = 0;
+            // clang-format on
+        };
+
+       private:
+        [[nodiscard]] static State &state();
+
+       public:
+        static void setTemperatures(const std::vector<double> &temperatures);
+        static void setExchangeFrequency(const size_t exchangeFrequency);
+        static void setReplicaIndex(const size_t replicaIndex);
+
+        [[nodiscard]] static std::vector<double> getTemperatures();
+        [[nodiscard]] static size_t              getNumberOfReplicas();
+        [[nodiscard]] static size_t              getExchangeFrequency();
+        [[nodiscard]] static size_t              getReplicaIndex();
+        [[nodiscard]] static double              getReplicaTemperature();
+        [[nodiscard]] static bool isReplicaExchangeActivated();
+    };
+}   // namespace settings
+
+#endif   // _REPLICA_EXCHANGE_SETTINGS_HPP_
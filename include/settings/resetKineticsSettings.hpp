@@ -36,13 +36,22 @@ namespace settings
      */
     class ResetKineticsSettings
     {
+       public:
+        /**
+         * @brief per instance state of the ResetKineticsSettings
+         */
+        struct State
+        {
+            size_t _nScale        = 0;
+            size_t _fScale        = 0;
+            size_t _nReset        = 0;
+            size_t _fReset        = 0;
+            size_t _nResetAngular = 0;
+            size_t _fResetAngular = 0;
+        };
+
        private:
-        static inline size_t _nScale        = 0;
-        static inline size_t _fScale        = 0;
-        static inline size_t _nReset        = 0;
-        static inline size_t _fReset        = 0;
-        static inline size_t _nResetAngular = 0;
-        static inline size_t _fResetAngular = 0;
+        [[nodiscard]] static State &state();
 
        public:
         ResetKineticsSettings()  = default;
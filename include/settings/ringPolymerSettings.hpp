@@ -36,9 +36,18 @@ namespace settings
      */
     class RingPolymerSettings
     {
+       public:
+        /**
+         * @brief per instance state of the RingPolymerSettings
+         */
+        struct State
+        {
+            bool   _numberOfBeadsSet = false;
+            size_t _numberOfBeads    = 0;
+        };
+
        private:
-        static inline bool   _numberOfBeadsSet = false;
-        static inline size_t _numberOfBeads    = 0;
+        [[nodiscard]] static State &state();
 
        public:
         static void setNumberOfBeads(const size_t numberOfBeads);
@@ -24,6 +24,8 @@
 
 #define _SETTINGS_HPP_
 
+#include <cstddef>       // for size_t
+#include <optional>      // for optional
 #include <string_view>   // for string_view
 
 #include "defaults.hpp"   // for _DIMENSIONALITY_DEFAULT_
@@ -68,17 +70,28 @@ namespace settings
      */
     class Settings
     {
-       private:
-        static inline JobType _jobtype;
-        static inline FPType  _floatingPointType = FPType::DOUBLE;
+       public:
+        /**
+         * @brief per instance state of the Settings
+         */
+        struct State
+        {
+            JobType _jobtype;
+            FPType  _floatingPointType = FPType::DOUBLE;
+
+            bool _useKokkos = false;
 
-        static inline bool _useKokkos = false;
+            bool _isRingPolymerMDActivated = false;
 
-        static inline bool _isRingPolymerMDActivated = false;
+            std::optional<size_t> _randomSeed;
 
-        // clang-format off
-        static inline size_t _dimensionality = defaults::_DIMENSIONALITY_DEFAULT_;
-        // clang-format on
+            // clang-format off
+            size_t _dimensionality = defaults::_DIMENSIONALITY_DEFAULT_;
+            // clang-format on
+        };
+
+       private:
+        [[nodiscard]] static State &state();
 
        public:
         Settings()  = default;
@@ -96,6 +109,7 @@ namespace settings
 
         static void setIsRingPolymerMDActivated(const bool isRingPolymerMD);
         static void setDimensionality(const size_t dimensionality);
+        static void setRandomSeed(const size_t randomSeed);
 
         /***************************
          * standard getter methods *
@@ -107,6 +121,7 @@ namespace settings
         [[nodiscard]] static std::string getFloatingPointPybindString();
 
         [[nodiscard]] static size_t getDimensionality();
+        [[nodiscard]] static size_t getRandomSeed();
 
         /******************************
          * standard is-active methods *
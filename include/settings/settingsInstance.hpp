@@ -0,0 +1,135 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef _SETTINGS_INSTANCE_HPP_
+
+#define _SETTINGS_INSTANCE_HPP_
+
+#include "constraintSettings.hpp"        // for ConstraintSettings
+#include "convergenceSettings.hpp"       // for ConvSettings
+#include "fileSettings.hpp"              // for FileSettings
+#include "forceFieldSettings.hpp"        // for ForceFieldSettings
+#include "hybridSettings.hpp"            // for HybridSettings
+#include "manostatSettings.hpp"          // for ManostatSettings
+#include "optimizerSettings.hpp"         // for OptimizerSettings
+#include "outputFileSettings.hpp"        // for OutputFileSettings
+#include "potentialSettings.hpp"         // for PotentialSettings
+#include "qmSettings.hpp"                // for QMSettings
+#include "replicaExchangeSettings.hpp"   // for ReplicaExchangeSettings
+#include "resetKineticsSettings.hpp"     // for ResetKineticsSettings
+#include "ringPolymerSettings.hpp"       // for RingPolymerSettings
+#include "settings.hpp"                  // for Settings
+#include "simulationBoxSettings.hpp"     // for SimulationBoxSettings
+#include "thermostatSettings.hpp"        // for ThermostatSettings
+#include "timingsSettings.hpp"           // for TimingsSettings
+
+namespace settings
+{
+    /**
+     * @class SettingsInstance
+     *
+     * @brief complete state of all settings classes of one simulation
+     *
+     * @details every engine owns its own instance. The static accessors of
+     * the settings classes operate on the instance bound to the calling
+     * thread via a SettingsScope, or on the process wide default instance
+     * if no instance is bound. Therefore settings have to be read outside
+     * of OpenMP parallel regions, as the worker threads are not bound.
+     */
+    class SettingsInstance
+    {
+       private:
+        static thread_local inline SettingsInstance *_active = nullptr;
+
+        Settings::State                _generalSettings{};
+        ConstraintSettings::State      _constraintSettings{};
+        ConvSettings::State            _convSettings{};
+        FileSettings::State            _fileSettings{};
+        ForceFieldSettings::State      _forceFieldSettings{};
+        HybridSettings::State          _hybridSettings{};
+        ManostatSettings::State        _manostatSettings{};
+        OptimizerSettings::State       _optimizerSettings{};
+        OutputFileSettings::State      _outputFileSettings{};
+        PotentialSettings::State       _potentialSettings{};
+        QMSettings::State              _qmSettings{};
+        ReplicaExchangeSettings::State _replicaExchangeSettings{};
+        ResetKineticsSettings::State   _resetKineticsSettings{};
+        RingPolymerSettings::State     _ringPolymerSettings{};
+        SimulationBoxSettings::State   _simulationBoxSettings{};
+        ThermostatSettings::State      _thermostatSettings{};
+        TimingsSettings::State         _timingsSettings{};
+
+        friend class SettingsScope;
+
+       public:
+        [[nodiscard]] static SettingsInstance &getActive();
+        [[nodiscard]] static SettingsInstance &getDefault();
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        // clang-format off
+        [[nodiscard]] Settings::State                &getGeneralSettings();
+        [[nodiscard]] ConstraintSettings::State      &getConstraintSettings();
+        [[nodiscard]] ConvSettings::State            &getConvSettings();
+        [[nodiscard]] FileSettings::State            &getFileSettings();
+        [[nodiscard]] ForceFieldSettings::State      &getForceFieldSettings();
+        [[nodiscard]] HybridSettings::State          &getHybridSettings();
+        [[nodiscard]] ManostatSettings::State        &getManostatSettings();
+        [[nodiscard]] OptimizerSettings::State       &getOptimizerSettings();
+        [[nodiscard]] OutputFileSettings::State      &getOutputFileSettings();
+        [[nodiscard]] PotentialSettings::State       &getPotentialSettings();
+        [[nodiscard]] QMSettings::State              &getQMSettings();
+        [[nodiscard]] ReplicaExchangeSettings::State &getReplicaExchangeSettings();
+        [[nodiscard]] ResetKineticsSettings::State   &getResetKineticsSettings();
+        [[nodiscard]] RingPolymerSettings::State     &getRingPolymerSettings();
+        [[nodiscard]] SimulationBoxSettings::State   &getSimulationBoxSettings();
+        [[nodiscard]] ThermostatSettings::State      &getThermostatSettings();
+        [[nodiscard]] TimingsSettings::State         &getTimingsSettings();
+        // clang-format on
+    };
+
+    /**
+     * @class SettingsScope
+     *
+     * @brief binds a settings instance to the calling thread
+     *
+     * @details the previously bound instance is restored on destruction,
+     * therefore scopes can be nested
+     */
+    class SettingsScope
+    {
+       private:
+        SettingsInstance *_previous;
+
+       public:
+        explicit SettingsScope(SettingsInstance &instance);
+        ~SettingsScope();
+
+        SettingsScope(const SettingsScope &)            = delete;
+        SettingsScope &operator=(const SettingsScope &) = delete;
+    };
+
+}   // namespace settings
+
+#endif   // _SETTINGS_INSTANCE_HPP_
@@ -24,6 +24,8 @@
 
 #define _SIMULATION_BOX_SETTINGS_HPP_
 
+#include <optional>   // for optional
+
 namespace settings
 {
     /**
@@ -34,11 +36,22 @@ namespace settings
      */
     class SimulationBoxSettings
     {
-       private:
-        static inline bool _isDensitySet = false;
-        static inline bool _isBoxSet     = false;
+       public:
+        /**
+         * @brief per instance state of the SimulationBoxSettings
+         */
+        struct State
+        {
+            bool _isDensitySet = false;
+            bool _isBoxSet     = false;
+
+            bool _initializeVelocities = false;
 
-        static inline bool _initializeVelocities = false;
+            std::optional<double> _hmrHydrogenMass;
+        };
+
+       private:
+        [[nodiscard]] static State &state();
 
        public:
         SimulationBoxSettings()  = delete;
@@ -51,6 +64,7 @@ namespace settings
         static void setDensitySet(const bool densitySet);
         static void setBoxSet(const bool boxSet);
         static void setInitializeVelocities(const bool initializeVelocities);
+        static void setHMRHydrogenMass(const double hydrogenMass);
 
         /********************
          * standard setters *
@@ -59,6 +73,9 @@ namespace settings
         [[nodiscard]] static bool getDensitySet();
         [[nodiscard]] static bool getBoxSet();
         [[nodiscard]] static bool getInitializeVelocities();
+        [[nodiscard]] static bool isHMRActivated();
+
+        [[nodiscard]] static double getHMRHydrogenMass();
     };
 }   // namespace settings
 
@@ -28,6 +28,7 @@
 #include <map>           // for map
 #include <string>        // for string
 #include <string_view>   // for string_view
+#include <utility>       // for pair
 
 #include "defaults.hpp"
 
@@ -59,41 +60,56 @@ namespace settings
      */
     class ThermostatSettings
     {
-       private:
-        static inline ThermostatType _thermostatType = ThermostatType::NONE;
-
-        static inline bool _isTemperatureSet      = false;
-        static inline bool _isStartTemperatureSet = false;
-        static inline bool _isEndTemperatureSet   = false;
-
-        // clang-format off
-        static inline size_t _nhChainLength            = defaults::_NH_CHAIN_LENGTH_DEFAULT_;
-        static inline size_t _temperatureRampSteps     = 0;
-        static inline size_t _temperatureRampFrequency = 1;
-        // clang-format on
-
-        static inline double _targetTemperature;
-        static inline double _actualTargetTemperature;   // for reset kinetics
-        static inline double _startTemperature;
-        static inline double _endTemperature;
-
-        // clang-format off
-        static inline double _relaxationTime = defaults::_BERENDSEN_THERMOSTAT_RELAX_TIME_;
-        static inline double _friction       = defaults::_LANGEVIN_THERMOSTAT_FRICTION_;
-        static inline double _nhCouplingFreq = defaults::_NH_COUPLING_FREQ_;
-        // clang-format on
+       public:
+        /**
+         * @brief per instance state of the ThermostatSettings
+         */
+        struct State
+        {
+            ThermostatType _thermostatType = ThermostatType::NONE;
+
+            bool _isTemperatureSet      = false;
+            bool _isStartTemperatureSet = false;
+            bool _isEndTemperatureSet   = false;
+
+            // clang-format off
+            size_t _nhChainLength            = defaults::_NH_CHAIN_LENGTH_DEFAULT_;
+            size_t _temperatureRampSteps     = 0;
+            size_t _temperatureRampFrequency = 1;
+            // clang-format on
+
+            double _targetTemperature;
+            double _actualTargetTemperature;   // for reset kinetics
+            double _startTemperature;
+            double _endTemperature;
+
+            // clang-format off
+            double _relaxationTime = defaults::_BERENDSEN_THERMOSTAT_RELAX_TIME_;
+            double _friction       = defaults::_LANGEVIN_THERMOSTAT_FRICTION_;
+            double _nhCouplingFreq = defaults::_NH_COUPLING_FREQ_;
+            // clang-format on
+
+            std::map<size_t, double> _chi;
+            std::map<size_t, double> _zeta;
+
+            std::string _randomState;
+        };
 
-        static inline std::map<size_t, double> _chi;
-        static inline std::map<size_t, double> _zeta;
+       private:
+        [[nodiscard]] static State &state();
 
        public:
         ThermostatSettings()  = default;
         ~ThermostatSettings() = default;
 
-        static auto addChi(const size_t index, const double chi)
-            -> decltype(_chi.try_emplace(index, chi));
-        static auto addZeta(const size_t index, const double zeta)
-            -> decltype(_zeta.try_emplace(index, zeta));
+        static std::pair<std::map<size_t, double>::iterator, bool> addChi(
+            const size_t index,
+            const double chi
+        );
+        static std::pair<std::map<size_t, double>::iterator, bool> addZeta(
+            const size_t index,
+            const double zeta
+        );
 
         /***************************
          * standard setter methods *
@@ -117,6 +133,7 @@ namespace settings
         static void setFriction(const double);
         static void setNoseHooverChainLength(const size_t);
         static void setNoseHooverCouplingFrequency(const double);
+        static void setRandomState(const std::string &);
 
         /***************************
          * standard getter methods *
@@ -142,6 +159,7 @@ namespace settings
 
         [[nodiscard]] static std::map<size_t, double> getChi();
         [[nodiscard]] static std::map<size_t, double> getZeta();
+        [[nodiscard]] static std::string              getRandomState();
     };
 }   // namespace settings
 
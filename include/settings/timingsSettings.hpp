@@ -36,12 +36,22 @@ namespace settings
      */
     class TimingsSettings
     {
-       private:
-        static inline double _timeStep;
-        static inline size_t _numberOfSteps;
-        static inline size_t _stepCount = 0;
+       public:
+        /**
+         * @brief per instance state of the TimingsSettings
+         */
+        struct State
+        {
+            double _timeStep;
+            size_t _numberOfSteps;
+            size_t _stepCount = 0;
+
+            bool _isTimeStepSet      = false;
+            bool _isHardwareCounters = false;
+        };
 
-        static inline bool _isTimeStepSet = false;
+       private:
+        [[nodiscard]] static State &state();
 
        public:
         TimingsSettings()  = default;
@@ -54,6 +64,7 @@ namespace settings
         static void setTimeStep(const double timeStep);
         static void setStepCount(const size_t stepCount);
         static void setNumberOfSteps(const size_t numberOfSteps);
+        static void setHardwareCounters(const bool isHardwareCounters);
 
         /********************
          * standard setters *
@@ -63,6 +74,7 @@ namespace settings
         [[nodiscard]] static size_t getStepCount();
         [[nodiscard]] static size_t getNumberOfSteps();
         [[nodiscard]] static bool   isTimeStepSet();
+        [[nodiscard]] static bool   isHardwareCounters();
     };
 }   // namespace settings
 
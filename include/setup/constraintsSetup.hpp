@@ -43,6 +43,7 @@ namespace setup
 
         size_t _shakeConstraints  = 0;
         size_t _mShakeConstraints = 0;
+        size_t _settleMolecules   = 0;
 
         size_t _shakeMaxIter  = 0;
         size_t _rattleMaxIter = 0;
@@ -55,7 +56,9 @@ namespace setup
 
         void setup();
 
+        void checkIntegrator();
         void setupMShake();
+        void setupSettle();
 
         void setupTolerances();
         void setupMaxIterations();
@@ -51,6 +51,10 @@ namespace setup
         void setupQMCenter();
         void setupQMOnlyList();
         void setupMMOnlyList();
+        void setupWriteInfo() const;
+
+        void checkQMRunner() const;
+        void checkRadii() const;
 
         std::vector<int> parseSelection(const std::string &, const std::string &);
         std::vector<int> parseSelectionNoPython(const std::string &, const std::string &);
@@ -49,10 +49,12 @@ namespace setup
         void isPressureSet() const;
         void setupBerendsenManostat();
         void setupStochasticRescalingManostat();
+        void setupMonteCarloManostat();
 
         void writeSetupInfo() const;
         void writeManostatSelection() const;
         void writeBerendsenSetup() const;
+        void writeMonteCarloSetup() const;
         void writeIsotropy() const;
 
         [[nodiscard]] pq::MDEngine &getEngine() const;
@@ -27,6 +27,7 @@
 #include <memory>     // for shared_ptr
 #include <optional>   // for optional
 
+#include "fire.hpp"   // for FIREParameters
 #include "typeAliases.hpp"
 
 namespace setup
@@ -54,6 +55,7 @@ namespace setup
         void setupMinMaxLR(pq::SharedLearningRate &);
 
         pq::SharedOptimizer    setupEmptyOptimizer();
+        opt::FIREParameters    setupFIRE();
         pq::SharedLearningRate setupLearningRateStrategy();
         pq::SharedEvaluator    setupEvaluator();
     };
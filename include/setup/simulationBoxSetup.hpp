@@ -53,6 +53,7 @@ namespace setup::simulationBox
 
         void setAtomMasses();
         void setAtomicNumbers();
+        void repartitionHydrogenMasses();
 
         void calculateMolMasses();
         void calculateTotalCharge();
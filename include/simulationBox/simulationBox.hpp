@@ -88,6 +88,10 @@ namespace simulationBox
         std::vector<Molecule>     _molecules;
         std::vector<MoleculeType> _moleculeTypes;
 
+        // cumulative number of atoms before each molecule
+        std::vector<size_t> _moleculeAtomOffsets;
+        size_t              _moleculeAtomOffsetsAtoms = 0;
+
         std::vector<size_t>      _externalGlobalVdwTypes;
         std::map<size_t, size_t> _externalToInternalGlobalVDWTypes;
 
@@ -112,6 +116,7 @@ namespace simulationBox
 
         void setPartialChargesOfMoleculesFromMoleculeTypes();
         void initPositions(const double displacement);
+        void initMoleculeAtomOffsets();
 
         [[nodiscard]] double    calculateTemperature();
         [[nodiscard]] double    calculateTotalForce();
@@ -160,6 +165,8 @@ namespace simulationBox
         void setupQMOnlyAtoms(const std::vector<int>& atomIndices);
         void setupMMOnlyAtoms(const std::vector<int>& atomIndices);
 
+        [[nodiscard]] pq::Vec3D calculateQMCenter() const;
+
         /************************
          * standard add methods *
          ************************/
@@ -194,6 +201,7 @@ namespace simulationBox
 
         [[nodiscard]] pq::SharedAtomVec&         getAtoms();
         [[nodiscard]] pq::SharedAtomVec&         getQMAtoms();
+        [[nodiscard]] pq::SharedAtomVec&         getQMCenterAtoms();
         [[nodiscard]] std::vector<Molecule>&     getMolecules();
         [[nodiscard]] std::vector<MoleculeType>& getMoleculeTypes();
 
@@ -24,8 +24,10 @@
 
 #define _LANGEVIN_THERMOSTAT_HPP_
 
-#include <random>   // for std::random_device, std::mt19937
+#include <cstddef>   // for size_t
+#include <string>    // for string
 
+#include "philox.hpp"   // for Philox
 #include "thermostat.hpp"
 #include "typeAliases.hpp"
 
@@ -35,8 +37,7 @@ namespace thermostat
     class LangevinThermostat : public Thermostat
     {
        private:
-        std::random_device _randomDevice{};
-        std::mt19937       _generator{_randomDevice()};
+        utilities::Philox _random;
 
         double _friction = 0.0;
         double _sigma    = 0.0;
@@ -49,9 +50,14 @@ namespace thermostat
         void calculateSigma(const double, const double);
 
         void applyLangevin(pq::SimBox &);
+        void applyLangevin(pq::Atom &, const size_t, const double) const;
+        void advanceRandom();
         void applyThermostat(pq::SimBox &, pq::PhysicalData &) override;
         void applyThermostatHalfStep(pq::SimBox &, pq::PhysicalData &) override;
 
+        [[nodiscard]] std::string getRandomState() const override;
+        void                      setRandomState(const std::string &) override;
+
         /***************************
          * standard setter methods *
          ***************************/
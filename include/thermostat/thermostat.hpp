@@ -25,6 +25,7 @@
 #define _THERMOSTAT_HPP_
 
 #include <cstddef>   // for size_t
+#include <string>    // for string
 
 #include "timer.hpp"   // for Timer
 #include "typeAliases.hpp"
@@ -63,6 +64,9 @@ namespace thermostat
         virtual void applyThermostatHalfStep(pq::SimBox &, pq::PhysicalData &) {
         };
 
+        [[nodiscard]] virtual std::string getRandomState() const;
+        virtual void                      setRandomState(const std::string &);
+
         /***************************
          * standard setter methods *
          ***************************/
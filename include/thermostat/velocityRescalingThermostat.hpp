@@ -25,6 +25,7 @@
 #define _VELOCITY_RESCALING_THERMOSTAT_HPP_
 
 #include <random>   // for std::random_device, std::mt19937
+#include <string>   // for string
 
 #include "thermostat.hpp"
 #include "typeAliases.hpp"
@@ -55,6 +56,9 @@ namespace thermostat
 
         void applyThermostat(pq::SimBox &, pq::PhysicalData &) override;
 
+        [[nodiscard]] std::string getRandomState() const override;
+        void                      setRandomState(const std::string &) override;
+
         void setTau(const double tau);
 
         [[nodiscard]] pq::ThermostatType getThermostatType() const override;
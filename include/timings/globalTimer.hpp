@@ -49,6 +49,7 @@ namespace timings
         void addTimer(const Timer &timer);
 
         [[nodiscard]] const std::vector<Timer> &getTimers() const;
+        [[nodiscard]] const Timer              &getSimulationTimer() const;
     };
 }   // namespace timings
 
@@ -0,0 +1,99 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef _HARDWARE_COUNTERS_HPP_
+
+#define _HARDWARE_COUNTERS_HPP_
+
+#include <array>     // for array
+#include <cstdint>   // for uint64_t
+#include <mutex>     // for mutex
+#include <string>    // for string
+#include <vector>    // for vector
+
+namespace timings
+{
+    /**
+     * @brief values of the hardware performance counters
+     */
+    struct CounterValues
+    {
+        uint64_t cycles       = 0;
+        uint64_t instructions = 0;
+        uint64_t cacheMisses  = 0;
+        uint64_t branchMisses = 0;
+
+        CounterValues &operator+=(const CounterValues &rhs);
+        CounterValues  operator-(const CounterValues &rhs) const;
+    };
+
+    /**
+     * @class HardwareCounters
+     *
+     * @brief group of Linux perf_event counters of the calling thread
+     *
+     * @details cycles, instructions, cache misses and branch misses are
+     * counted in user space for the thread which opened the group. All
+     * counters are read with a single read call. If the counters cannot be
+     * opened, e.g. in containers or due to the perf_event_paranoid setting,
+     * the group stays closed and the reason can be queried with
+     * getErrorMessage().
+     *
+     * Every opened group is registered, so that readAll() sums the counters
+     * of all threads - including the OpenMP worker threads, which open their
+     * groups in openTeamCounters().
+     */
+    class HardwareCounters
+    {
+       private:
+        static constexpr size_t _N_COUNTERS_ = 4;
+
+        std::array<int, _N_COUNTERS_> _fds;
+
+        static inline std::mutex                            _mutex;
+        static inline std::string                           _errorMessage;
+        static inline std::vector<const HardwareCounters *> _registry;
+
+        void close();
+
+       public:
+        HardwareCounters();
+        ~HardwareCounters();
+
+        HardwareCounters(const HardwareCounters &)            = delete;
+        HardwareCounters &operator=(const HardwareCounters &) = delete;
+
+        void open();
+
+        [[nodiscard]] bool          isOpen() const;
+        [[nodiscard]] CounterValues read() const;
+
+        [[nodiscard]] static HardwareCounters &getThreadCounters();
+        [[nodiscard]] static CounterValues     readAll();
+        [[nodiscard]] static std::string       getErrorMessage();
+
+        static void openTeamCounters();
+    };
+
+}   // namespace timings
+
+#endif   // _HARDWARE_COUNTERS_HPP_
@@ -24,15 +24,30 @@
 
 #define _TIMER_HPP_
 
-#include <chrono>   // IWYU pragma: keep for time_point, milliseconds, nanoseconds
+#include <chrono>    // IWYU pragma: keep for time_point, milliseconds, nanoseconds
 #include <cstddef>   // for size_t
 #include <string>    // for string
+#include <vector>    // for vector
 
-#include "timingsSection.hpp"   // for TimingsManager
+#include "timingsRegistry.hpp"   // for SectionName, sectionId
+#include "timingsSection.hpp"    // for TimingsSection
 #include "typeAliases.hpp"
 
 namespace timings
 {
+    /**
+     * @brief a single finished execution of a timings section
+     *
+     * @details times are given in s relative to the common epoch of the
+     * TimingsRegistry, the track is the id of the executing thread
+     */
+    struct TimingsEvent
+    {
+        size_t sectionId;
+        size_t trackId;
+        double start;
+        double duration;
+    };
 
     /**
      * @class Timer
@@ -42,7 +57,10 @@ namespace timings
      * @details
      *  stores internal simulation timings
      *  as well as all timings corresponding to
-     *  execution time
+     *  execution time. Sections are looked up by their interned id in
+     *  constant time. A section started while another one is running is
+     *  nested into the running section. If trace output is requested every
+     *  finished section is additionally recorded as TimingsEvent.
      *
      */
     class Timer
@@ -51,6 +69,14 @@ namespace timings
         std::string _name = "DefaultTimings";
 
         std::vector<TimingsSection> _timingDetails;
+        std::vector<size_t>         _sectionIndices;
+        std::vector<size_t>         _openSectionIds;
+        std::vector<TimingsEvent>   _events;
+
+        static constexpr size_t _NOT_FOUND_        = static_cast<size_t>(-1);
+        static constexpr size_t _MAX_TRACE_EVENTS_ = 200'000;
+
+        void updateSectionIndices();
 
        public:
         explicit Timer(const std::string_view);
@@ -62,14 +88,22 @@ namespace timings
         [[nodiscard]] double                      calculateElapsedTime() const;
         [[nodiscard]] double                      calculateLoopTime() const;
 
+        [[nodiscard]] size_t findTimingsSectionIndex(const size_t id) const;
         [[nodiscard]] size_t findTimingsSectionIndex(const std::string_view name
         ) const;
 
         void startTimingsSection();
+        void startTimingsSection(const size_t id);
         void startTimingsSection(const std::string_view name);
         void stopTimingsSection();
+        void stopTimingsSection(const size_t id);
         void stopTimingsSection(const std::string_view name);
 
+        template <SectionName Name>
+        void startTimingsSection();
+        template <SectionName Name>
+        void stopTimingsSection();
+
         void sortTimingsSections();
 
         /********************
@@ -87,8 +121,34 @@ namespace timings
 
         [[nodiscard]] std::string getTimerName() const;
         [[nodiscard]] Timer       getTimer() const;
+
+        [[nodiscard]] const std::vector<TimingsEvent> &getEvents() const;
+    };
+
+    /**
+     * @class ScopedTimingsSection
+     *
+     * @brief RAII guard timing a section of a timer for its lifetime
+     *
+     * @details guards created inside the scope of another guard of the same
+     * timer are nested into the enclosing section
+     */
+    class ScopedTimingsSection
+    {
+       private:
+        Timer &_timer;
+        size_t _id;
+
+       public:
+        ScopedTimingsSection(Timer &timer, const size_t id);
+        ~ScopedTimingsSection();
+
+        ScopedTimingsSection(const ScopedTimingsSection &)            = delete;
+        ScopedTimingsSection &operator=(const ScopedTimingsSection &) = delete;
     };
 
 }   // namespace timings
 
+#include "timer.tpp.hpp"   // DO NOT MOVE THIS LINE!
+
 #endif   // _TIMER_HPP_
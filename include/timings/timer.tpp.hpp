@@ -0,0 +1,55 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef _TIMER_TPP_
+
+#define _TIMER_TPP_
+
+#include "timer.hpp"
+
+namespace timings
+{
+    /**
+     * @brief starts a timings section with a name known at compile time
+     *
+     * @tparam Name
+     */
+    template <SectionName Name>
+    inline void Timer::startTimingsSection()
+    {
+        startTimingsSection(sectionId<Name>());
+    }
+
+    /**
+     * @brief stops a timings section with a name known at compile time
+     *
+     * @tparam Name
+     */
+    template <SectionName Name>
+    inline void Timer::stopTimingsSection()
+    {
+        stopTimingsSection(sectionId<Name>());
+    }
+
+}   // namespace timings
+
+#endif   // _TIMER_TPP_
@@ -0,0 +1,67 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef _TIMINGS_HISTOGRAM_HPP_
+
+#define _TIMINGS_HISTOGRAM_HPP_
+
+#include <cstddef>   // for size_t
+#include <vector>    // for vector
+
+namespace timings
+{
+    /**
+     * @class TimingsHistogram
+     *
+     * @brief logarithmic histogram of the durations of a timings section
+     *
+     * @details the durations are binned with a fixed number of bins per
+     * decade between 1 ns and 1000 s. This keeps the memory per section
+     * constant independent of the number of steps while percentiles are
+     * resolved to about 5 % of the duration.
+     */
+    class TimingsHistogram
+    {
+       private:
+        static constexpr double _MIN_TIME_        = 1.0e-9;
+        static constexpr size_t _BINS_PER_DECADE_ = 50;
+        static constexpr size_t _N_DECADES_       = 12;
+        static constexpr size_t _N_BINS_ = _BINS_PER_DECADE_ * _N_DECADES_;
+
+        size_t              _nSamples = 0;
+        std::vector<size_t> _counts;
+
+       public:
+        void addSample(const double time);
+
+        [[nodiscard]] double calculatePercentile(const double fraction) const;
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] size_t getNumberOfSamples() const;
+    };
+
+}   // namespace timings
+
+#endif   // _TIMINGS_HISTOGRAM_HPP_
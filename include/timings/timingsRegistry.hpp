@@ -0,0 +1,106 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef _TIMINGS_REGISTRY_HPP_
+
+#define _TIMINGS_REGISTRY_HPP_
+
+#include <algorithm>       // for copy_n
+#include <cstddef>         // for size_t
+#include <deque>           // for deque
+#include <mutex>           // for mutex
+#include <string>          // for string
+#include <string_view>     // for string_view
+#include <unordered_map>   // for unordered_map
+
+#include "typeAliases.hpp"
+
+namespace timings
+{
+    /**
+     * @class TimingsRegistry
+     *
+     * @brief static registry interning timings section names to ids
+     *
+     * @details every section name is mapped once to a dense id which is
+     * shared by all timers, so that timers can look up their sections by
+     * index instead of comparing strings. The registry also hands out a
+     * track id per thread and the common time origin of all trace events.
+     */
+    class TimingsRegistry
+    {
+       private:
+        static inline std::mutex                                   _mutex;
+        static inline std::deque<std::string>                      _names;
+        static inline std::unordered_map<std::string_view, size_t> _ids;
+
+        static inline size_t         _nTracks = 0;
+        static inline const pq::Time _epoch   = pq::Clock::now();
+
+       public:
+        [[nodiscard]] static size_t      intern(const std::string_view name);
+        [[nodiscard]] static std::string getName(const size_t id);
+        [[nodiscard]] static size_t      getNumberOfSections();
+        [[nodiscard]] static size_t      getTrackId();
+        [[nodiscard]] static pq::Time    getEpoch();
+    };
+
+    /**
+     * @brief compile time section name usable as template argument
+     *
+     * @tparam N size of the string literal including the terminating zero
+     */
+    template <size_t N>
+    struct SectionName
+    {
+        char name[N]{};
+
+        consteval SectionName(const char (&literal)[N])
+        {
+            std::copy_n(literal, N, name);
+        }
+
+        [[nodiscard]] constexpr std::string_view view() const
+        {
+            return {name, N - 1};
+        }
+    };
+
+    /**
+     * @brief get the id of a section name known at compile time
+     *
+     * @details the name is interned only on the first call, every further
+     * call returns the cached id
+     *
+     * @tparam Name
+     * @return size_t
+     */
+    template <SectionName Name>
+    [[nodiscard]] size_t sectionId()
+    {
+        static const auto id = TimingsRegistry::intern(Name.view());
+        return id;
+    }
+
+}   // namespace timings
+
+#endif   // _TIMINGS_REGISTRY_HPP_
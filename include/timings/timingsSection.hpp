@@ -24,9 +24,12 @@
 
 #define _TIMINGS_SECTION_HPP_
 
-#include <chrono>   // IWYU pragma: keep for time_point, milliseconds, nanoseconds
+#include <chrono>    // IWYU pragma: keep for time_point, milliseconds, nanoseconds
 #include <cstddef>   // for size_t
+#include <string>    // for string
 
+#include "hardwareCounters.hpp"   // for CounterValues
+#include "timingsHistogram.hpp"   // for TimingsHistogram
 #include "typeAliases.hpp"
 
 namespace timings
@@ -39,22 +42,41 @@ namespace timings
      * @details
      *  stores internal simulation timings
      *  as well as all timings corresponding to
-     *  execution time
+     *  execution time. Sections are identified by their interned id and
+     *  may be nested into a parent section of the same timer. If requested
+     *  the hardware counters of the executing thread are accumulated as
+     *  well.
      *
      */
     class TimingsSection
     {
        private:
         std::string _name;
-        size_t      _steps = 0;
+        size_t      _id;
+        size_t      _parentId = _NO_PARENT_;
+        size_t      _depth    = 0;
+        size_t      _steps    = 0;
 
         pq::Time     _start;
         pq::Time     _end;
         pq::Duration _totalTime    = pq::Duration::zero();
         pq::Duration _lastStepTime = pq::Duration::zero();
 
+        TimingsHistogram _histogram;
+
+        bool          _isCounting = false;
+        CounterValues _startCounters;
+        CounterValues _counters;
+
        public:
+        static constexpr size_t _NO_PARENT_ = static_cast<size_t>(-1);
+
         explicit TimingsSection(const std::string_view name);
+        explicit TimingsSection(
+            const size_t id,
+            const size_t parentId = _NO_PARENT_,
+            const size_t depth    = 0
+        );
 
         void beginTimer();
         void endTimer();
@@ -62,8 +84,20 @@ namespace timings
         [[nodiscard]] double calculateElapsedTime() const;
         [[nodiscard]] double calculateLoopTime() const;
         [[nodiscard]] double calculateAverageLoopTime() const;
+        [[nodiscard]] double calculatePercentileLoopTime(const double) const;
+
+        /***************************
+         * standard getter methods *
+         ***************************/
 
         [[nodiscard]] std::string getName() const;
+        [[nodiscard]] size_t      getId() const;
+        [[nodiscard]] size_t      getParentId() const;
+        [[nodiscard]] size_t      getDepth() const;
+        [[nodiscard]] size_t      getSteps() const;
+        [[nodiscard]] pq::Time    getStartTime() const;
+
+        [[nodiscard]] const CounterValues &getCounters() const;
     };
 
 }   // namespace timings
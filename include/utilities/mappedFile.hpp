@@ -0,0 +1,75 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _MAPPED_FILE_HPP_
+
+#define _MAPPED_FILE_HPP_
+
+#include <cstddef>       // for size_t
+#include <string>        // for string
+#include <string_view>   // for string_view
+
+namespace utilities
+{
+    /**
+     * @class MappedFile
+     *
+     * @brief read-only memory mapped file with line iteration
+     *
+     * @details The whole file is mapped into memory and lines are handed out
+     * as string_views into the mapping, so reading a file does not copy or
+     * allocate anything per line. The views are valid as long as the
+     * MappedFile object lives. If the file cannot be opened the object
+     * behaves like an empty file and isOpen() returns false.
+     */
+    class MappedFile
+    {
+       private:
+        void  *_mapping     = nullptr;
+        size_t _mappingSize = 0;
+        bool   _isOpen      = false;
+
+        std::string_view _data;
+        size_t           _position = 0;
+
+       public:
+        explicit MappedFile(const std::string &fileName);
+        ~MappedFile();
+
+        MappedFile(const MappedFile &)            = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        bool getLine(std::string_view &line);
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] bool             isOpen() const { return _isOpen; }
+        [[nodiscard]] bool             eof() const;
+        [[nodiscard]] std::string_view getData() const { return _data; }
+    };
+
+}   // namespace utilities
+
+#endif   // _MAPPED_FILE_HPP_
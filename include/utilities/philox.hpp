@@ -0,0 +1,212 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#ifndef _PHILOX_HPP_
+
+#define _PHILOX_HPP_
+
+#include <array>     // for array
+#include <cmath>     // for sqrt, log, cos, sin
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint32_t, uint64_t
+#include <numbers>   // for pi
+#include <string>    // for string
+
+namespace utilities
+{
+    /**
+     * @enum PhiloxStream
+     *
+     * @brief independent random number streams drawn from the same seed
+     *
+     */
+    enum class PhiloxStream : uint32_t
+    {
+        LANGEVIN,
+        VELOCITIES,
+        POSITIONS,
+        MANOSTAT
+    };
+
+    /**
+     * @class Philox
+     *
+     * @brief counter based Philox4x32-10 random number generator
+     *
+     * @details every draw is a pure function of the key (seed) and the
+     * counter (step, index, stream). Different atoms of the same step use
+     * different indices, therefore the random numbers do not depend on the
+     * order in which the atoms are processed nor on the number of threads.
+     * The only state is the seed and the step, which makes checkpointing
+     * trivial.
+     *
+     * @link https://doi.org/10.1145/2063384.2063405
+     *
+     */
+    class Philox
+    {
+       public:
+        using Block = std::array<uint32_t, 4>;
+        using Key   = std::array<uint32_t, 2>;
+
+       private:
+        uint64_t     _seed   = 0;
+        uint64_t     _step   = 0;
+        PhiloxStream _stream = PhiloxStream::LANGEVIN;
+
+        static constexpr uint32_t _M0_ = 0xD2511F53;
+        static constexpr uint32_t _M1_ = 0xCD9E8D57;
+        static constexpr uint32_t _W0_ = 0x9E3779B9;
+        static constexpr uint32_t _W1_ = 0xBB67AE85;
+
+        static constexpr size_t _N_ROUNDS_ = 10;
+
+       public:
+        Philox() = default;
+        explicit Philox(const uint64_t seed, const PhiloxStream stream);
+
+        [[nodiscard]] static Block generate(Block counter, Key key);
+
+        [[nodiscard]] Block                 random(const size_t index) const;
+        [[nodiscard]] std::array<double, 4> uniforms(const size_t index) const;
+        [[nodiscard]] std::array<double, 4> normals(const size_t index) const;
+
+        void advance() { ++_step; }
+        void setStep(const uint64_t step) { _step = step; }
+
+        [[nodiscard]] std::string getState() const;
+        void                      setState(const std::string &state);
+
+        /***************************
+         * standard getter methods *
+         ***************************/
+
+        [[nodiscard]] uint64_t getSeed() const { return _seed; }
+        [[nodiscard]] uint64_t getStep() const { return _step; }
+    };
+
+    /**
+     * @brief Philox4x32-10 block function
+     *
+     * @details defined inline, as it is called once per atom from the hot
+     * loops of the stochastic thermostats
+     *
+     * @param counter
+     * @param key
+     * @return Philox::Block four independent 32 bit random numbers
+     */
+    inline Philox::Block Philox::generate(Block counter, Key key)
+    {
+        for (size_t round = 0; round < _N_ROUNDS_; ++round)
+        {
+            const auto product0 = uint64_t(_M0_) * counter[0];
+            const auto product1 = uint64_t(_M1_) * counter[2];
+
+            const auto hi0 = uint32_t(product0 >> 32);
+            const auto lo0 = uint32_t(product0);
+            const auto hi1 = uint32_t(product1 >> 32);
+            const auto lo1 = uint32_t(product1);
+
+            counter = {
+                hi1 ^ counter[1] ^ key[0],
+                lo1,
+                hi0 ^ counter[3] ^ key[1],
+                lo0
+            };
+
+            key[0] += _W0_;
+            key[1] += _W1_;
+        }
+
+        return counter;
+    }
+
+    /**
+     * @brief four 32 bit random numbers for the given index of the current
+     * step
+     *
+     * @param index e.g. the atom index
+     * @return Philox::Block
+     */
+    inline Philox::Block Philox::random(const size_t index) const
+    {
+        const Block counter = {
+            uint32_t(_step),
+            uint32_t(_step >> 32),
+            uint32_t(index),
+            uint32_t(_stream)
+        };
+
+        const Key key = {uint32_t(_seed), uint32_t(_seed >> 32)};
+
+        return generate(counter, key);
+    }
+
+    /**
+     * @brief four uniformly distributed random numbers in (0, 1)
+     *
+     * @param index e.g. the atom index
+     * @return std::array<double, 4>
+     */
+    inline std::array<double, 4> Philox::uniforms(const size_t index) const
+    {
+        constexpr auto factor = 1.0 / 4294967296.0;   // 2^-32
+
+        const auto bits = random(index);
+
+        std::array<double, 4> result;
+
+        for (size_t i = 0; i < 4; ++i) result[i] = (bits[i] + 0.5) * factor;
+
+        return result;
+    }
+
+    /**
+     * @brief four standard normal distributed random numbers
+     *
+     * @details Box-Muller transformation of the four uniform numbers
+     *
+     * @param index e.g. the atom index
+     * @return std::array<double, 4>
+     */
+    inline std::array<double, 4> Philox::normals(const size_t index) const
+    {
+        const auto u = uniforms(index);
+
+        const auto radius1 = std::sqrt(-2.0 * std::log(u[0]));
+        const auto radius2 = std::sqrt(-2.0 * std::log(u[2]));
+
+        const auto angle1 = 2.0 * std::numbers::pi * u[1];
+        const auto angle2 = 2.0 * std::numbers::pi * u[3];
+
+        return {
+            radius1 * std::cos(angle1),
+            radius1 * std::sin(angle1),
+            radius2 * std::cos(angle2),
+            radius2 * std::sin(angle2)
+        };
+    }
+
+}   // namespace utilities
+
+#endif   // _PHILOX_HPP_
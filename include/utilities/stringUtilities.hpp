@@ -36,11 +36,16 @@
  */
 namespace utilities
 {
-    std::string removeComments(std::string &, const std::string_view &);
+    std::string      removeComments(std::string &, const std::string_view &);
+    std::string_view stripComments(std::string_view, std::string_view);
 
     pq::strings getLineCommands(const std::string &, const size_t);
 
-    pq::strings splitString(const std::string &);
+    pq::strings     splitString(std::string_view);
+    pq::stringViews splitStringView(std::string_view);
+
+    [[nodiscard]] double stringToDouble(std::string_view);
+    [[nodiscard]] size_t stringToSizeT(std::string_view);
 
     std::string toLowerCopy(std::string);
     std::string toLowerCopy(std::string_view);
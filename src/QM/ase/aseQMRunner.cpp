@@ -78,17 +78,17 @@ void ASEQMRunner::run(SimulationBox &simBox, PhysicalData &physicalData)
     std::jthread timeoutThread{[this](const std::stop_token stopToken)
                                { throwAfterTimeout(stopToken); }};
 
-    startTimingsSection("Build ASE Atoms");
+    startTimingsSection<"Build ASE Atoms">();
     buildAseAtoms(simBox);
-    stopTimingsSection("Build ASE Atoms");
+    stopTimingsSection<"Build ASE Atoms">();
 
-    startTimingsSection("Execute ASE QM");
+    startTimingsSection<"Execute ASE QM">();
     execute();
-    stopTimingsSection("Execute ASE QM");
+    stopTimingsSection<"Execute ASE QM">();
 
-    startTimingsSection("Collect ASE Data");
+    startTimingsSection<"Collect ASE Data">();
     collectData(simBox, physicalData);
-    stopTimingsSection("Collect ASE Data");
+    stopTimingsSection<"Collect ASE Data">();
 
     timeoutThread.request_stop();
 }
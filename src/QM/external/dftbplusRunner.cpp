@@ -76,7 +76,8 @@ void DFTBPlusRunner::writeCoordsFile(SimulationBox &box)
          i < numberOfAtoms;
          ++i)
     {
-        const auto &atom = box.getQMAtom(i);
+        const auto &atom     = box.getQMAtom(i);
+        const auto  position = getQMAtomPosition(box, i);
 
         const auto iter   = find(uniqueAtomNames, atom.getName());
         const auto atomId = distance(uniqueAtomNames.begin(), iter) + 1;
@@ -85,9 +86,9 @@ void DFTBPlusRunner::writeCoordsFile(SimulationBox &box)
             "{:5d} {:5d}\t{:16.12f}\t{:16.12f}\t{:16.12f}\n",
             i + 1,
             atomId,
-            atom.getPosition()[0],
-            atom.getPosition()[1],
-            atom.getPosition()[2]
+            position[0],
+            position[1],
+            position[2]
         );
     }
 
@@ -141,7 +142,7 @@ void DFTBPlusRunner::execute()
             std::format("DFTB+ script file \"{}\" does not exist.", scriptFile)
         );
 
-    const auto reuseCharges = _isFirstExecution ? 1 : 0;
+    const auto reuseCharges = (_isFirstExecution || _isQMRegionChanged) ? 1 : 0;
 
     const auto command = 
             std::format("{} 0 {} 0 0 0 {}", scriptFile, reuseCharges, FileSettings::getDFTBFileName());
@@ -24,6 +24,8 @@
 
 #include <algorithm>    // for __for_each_fn, for_each
 #include <chrono>       // for seconds
+#include <cstddef>      // for size_t
+#include <filesystem>   // for remove
 #include <format>       // for format
 #include <fstream>      // for ofstream
 #include <functional>   // for identity
@@ -53,6 +55,7 @@ using namespace constants;
 void ExternalQMRunner::run(SimulationBox &simBox, PhysicalData &physicalData)
 {
     writeCoordsFile(simBox);
+    writePointChargesFile();
 
     std::jthread timeoutThread{[this](const std::stop_token stopToken)
                                { throwAfterTimeout(stopToken); }};
@@ -65,6 +68,41 @@ void ExternalQMRunner::run(SimulationBox &simBox, PhysicalData &physicalData)
     readStressTensor(simBox.getBox(), physicalData);
 }
 
+/**
+ * @brief writes the MM point charges embedding the QM region
+ *
+ * @details each line contains the position and the charge of one point
+ * charge. If no point charges are set, a point charges file of a previous
+ * step is removed, so that the QM program runs without embedding.
+ */
+void ExternalQMRunner::writePointChargesFile() const
+{
+    const std::string fileName = "mm_pointcharges";
+
+    if (_pointCharges.empty())
+    {
+        std::filesystem::remove(fileName);
+        return;
+    }
+
+    std::ofstream pointChargesFile(fileName);
+
+    for (size_t i = 0; i < _pointCharges.size(); ++i)
+    {
+        const auto &position = _pointChargePositions[i];
+
+        pointChargesFile << std::format(
+            "{:16.12f}\t{:16.12f}\t{:16.12f}\t{:16.12f}\n",
+            position[0],
+            position[1],
+            position[2],
+            _pointCharges[i]
+        );
+    }
+
+    pointChargesFile.close();
+}
+
 /**
  * @brief reads the force file (including qm energy) and sets the forces of the
  * atoms
@@ -57,14 +57,15 @@ void PySCFRunner::writeCoordsFile(SimulationBox &box)
          i < numberOfAtoms;
          ++i)
     {
-        const auto &atom = box.getQMAtom(i);
+        const auto &atom     = box.getQMAtom(i);
+        const auto  position = getQMAtomPosition(box, i);
 
         coordsFile << std::format(
             "{:5s}\t{:16.12f}\t{:16.12f}\t{:16.12f}\n",
             atom.getName(),
-            atom.getPosition()[0],
-            atom.getPosition()[1],
-            atom.getPosition()[2]
+            position[0],
+            position[1],
+            position[2]
         );
     }
 
@@ -64,7 +64,7 @@ void TurbomoleRunner::writeCoordsFile(SimulationBox &simBox)
     for (size_t i = 0; i < nAtoms; ++i)
     {
         const auto &atom = simBox.getQMAtom(i);
-        const auto  pos  = atom.getPosition() * _ANGSTROM_TO_BOHR_;
+        const auto  pos  = getQMAtomPosition(simBox, i) * _ANGSTROM_TO_BOHR_;
 
         // turbomole does not support tabs in the coord file
         coordsFile << std::format(
@@ -95,7 +95,7 @@ void TurbomoleRunner::execute()
             scriptFile
         ));
 
-    const auto reuseCharges = _isFirstExecution ? 1 : 0;
+    const auto reuseCharges = (_isFirstExecution || _isQMRegionChanged) ? 1 : 0;
 
     const auto command = std::format("{} 0 {} 0 0 0", scriptFile, reuseCharges);
     ::system(command.c_str());
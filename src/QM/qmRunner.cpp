@@ -25,8 +25,10 @@
 #include <cmath>    // for ceil
 #include <thread>   // for sleep_for
 
+#include "atom.hpp"
 #include "exceptions.hpp"
 #include "qmSettings.hpp"
+#include "simulationBox.hpp"
 
 using QM::QMRunner;
 using namespace settings;
@@ -61,4 +63,110 @@ void QMRunner::throwAfterTimeout(const std::stop_token stopToken) const
     }
 
     throw QMRunnerException("QM calculation timeout");
-}
\ No newline at end of file
+}
+/**
+ * @brief set the MM point charges embedding the QM region
+ *
+ * @details the point charges are passed to the QM program in order to
+ * polarize the QM region (electrostatic embedding)
+ *
+ * @param positions
+ * @param charges
+ */
+void QMRunner::setPointCharges(
+    const pq::Vec3DVec        &positions,
+    const std::vector<double> &charges
+)
+{
+    _pointChargePositions = positions;
+    _pointCharges         = charges;
+}
+
+/**
+ * @brief remove all MM point charges
+ *
+ */
+void QMRunner::clearPointCharges()
+{
+    _pointChargePositions.clear();
+    _pointCharges.clear();
+}
+
+/**
+ * @brief set the positions of the QM atoms passed to the QM program
+ *
+ * @details the positions are given in the same order as the QM atoms of the
+ * simulation box, e.g. shifted to the periodic image of the QM region in
+ * QM/MM simulations, so that the QM region is not split at the box boundary.
+ *
+ * @param positions
+ */
+void QMRunner::setQMAtomPositions(const pq::Vec3DVec &positions)
+{
+    _qmAtomPositions = positions;
+}
+
+/**
+ * @brief get the position of a QM atom passed to the QM program
+ *
+ * @details if no QM atom positions were set, the position of the QM atom in
+ * the simulation box is used
+ *
+ * @param simBox
+ * @param index index of the QM atom
+ * @return pq::Vec3D
+ */
+pq::Vec3D QMRunner::getQMAtomPosition(pq::SimBox &simBox, const size_t index)
+    const
+{
+    if (_qmAtomPositions.empty())
+        return simBox.getQMAtom(index).getPosition();
+
+    return _qmAtomPositions[index];
+}
+
+/*******************************
+ *                             *
+ * standard getter and setters *
+ *                             *
+ *******************************/
+
+/**
+ * @brief check if the QM region changed since the last QM calculation
+ *
+ * @return bool
+ */
+bool QMRunner::isQMRegionChanged() const { return _isQMRegionChanged; }
+
+/**
+ * @brief get the positions of the MM point charges
+ *
+ * @return const pq::Vec3DVec&
+ */
+const pq::Vec3DVec &QMRunner::getPointChargePositions() const
+{
+    return _pointChargePositions;
+}
+
+/**
+ * @brief get the MM point charges
+ *
+ * @return const std::vector<double>&
+ */
+const std::vector<double> &QMRunner::getPointCharges() const
+{
+    return _pointCharges;
+}
+
+/**
+ * @brief set if the QM region changed since the last QM calculation
+ *
+ * @details if the atoms of the QM region change, the QM program has to be set
+ * up again and previous wave functions or charges can not be reused
+ *
+ * @param isQMRegionChanged
+ */
+void QMRunner::setQMRegionChanged(const bool isQMRegionChanged)
+{
+    _isQMRegionChanged = isQMRegionChanged;
+}
@@ -23,18 +23,23 @@
 #include "constraints.hpp"
 
 #include <algorithm>    // for ranges::for_each
+#include <array>        // for array
+#include <cmath>        // for sqrt
 #include <format>       // for format
 #include <functional>   // for identity
+#include <map>          // for map
 #include <string>       // for string
 #include <vector>       // for vector
 
-#include "exceptions.hpp"      // for ShakeException
-#include "mathUtilities.hpp"   // for kroneckerDelta
-#include "simulationBox.hpp"   // for SimulationBox
+#include "exceptions.hpp"        // for ShakeException
+#include "mathUtilities.hpp"     // for kroneckerDelta
+#include "simulationBox.hpp"     // for SimulationBox
+#include "timingsSettings.hpp"   // for TimingsSettings
 
 using namespace constraints;
 using namespace simulationBox;
 using namespace customException;
+using namespace settings;
 
 /**
  * @brief clone constraints
@@ -54,16 +59,191 @@ std::shared_ptr<Constraints> Constraints::clone() const
  */
 void Constraints::initMShake() { _mShake.initMShake(); }
 
+/**
+ * @brief init SETTLE for all rigid three-site molecules
+ *
+ * @details rigid three-site molecules are detected automatically from the
+ * M-Shake references and from the SHAKE bond constraint topology. They are
+ * then removed from the iterative M-Shake and SHAKE algorithms.
+ *
+ * @param simulationBox
+ */
+void Constraints::initSettle(SimulationBox &simulationBox)
+{
+    _settle = Settle();
+
+    if (_mShakeActivated)
+        _initSettleFromMShake(simulationBox);
+
+    if (_shakeActivated)
+        _initSettleFromShake();
+
+    _settle.calculateReferences(simulationBox);
+    _shakeClusters.update(_bondConstraints);
+}
+
+/**
+ * @brief init SETTLE from all three-site M-Shake references
+ *
+ * @param simulationBox
+ */
+void Constraints::_initSettleFromMShake(SimulationBox &simulationBox)
+{
+    std::map<size_t, std::pair<size_t, std::array<size_t, 3>>> settleTypes;
+
+    for (const auto &mShakeReference : _mShake.getMShakeReferences())
+    {
+        if (mShakeReference.getNumberOfAtoms() != 3)
+            continue;
+
+        const auto &atoms = mShakeReference.getAtoms();
+
+        const std::array<double, 3> masses = {
+            atoms[0].getMass(),
+            atoms[1].getMass(),
+            atoms[2].getMass()
+        };
+
+        const auto pos0 = atoms[0].getPosition();
+        const auto pos1 = atoms[1].getPosition();
+        const auto pos2 = atoms[2].getPosition();
+
+        const std::array<double, 3> squaredDistances = {
+            normSquared(pos0 - pos1),
+            normSquared(pos0 - pos2),
+            normSquared(pos1 - pos2)
+        };
+
+        const auto apex = Settle::findApex(masses, squaredDistances);
+
+        if (!apex.has_value())
+            continue;
+
+        const auto [a, b, c] = apex.value();
+
+        const auto params = Settle::calculateParameters(
+            masses[a],
+            masses[b],
+            std::sqrt(squaredDistances[a + b - 1]),
+            std::sqrt(squaredDistances[b + c - 1])
+        );
+
+        const auto moltype = mShakeReference.getMoleculeType().getMoltype();
+
+        settleTypes[moltype] = {_settle.addParameters(params), apex.value()};
+        _mShake.addSettleType(moltype);
+    }
+
+    for (auto &molecule : simulationBox.getMolecules())
+    {
+        const auto moltype = molecule.getMoltype();
+
+        if (!settleTypes.contains(moltype))
+            continue;
+
+        const auto &[paramIndex, apex] = settleTypes.at(moltype);
+
+        _settle.addMolecule(
+            &molecule.getAtom(apex[0]),
+            &molecule.getAtom(apex[1]),
+            &molecule.getAtom(apex[2]),
+            paramIndex
+        );
+    }
+}
+
+/**
+ * @brief init SETTLE from the SHAKE bond constraint topology
+ *
+ * @details a molecule is treated with SETTLE if it consists of exactly three
+ * atoms which are all pairwise connected by bond constraints
+ *
+ */
+void Constraints::_initSettleFromShake()
+{
+    std::map<Molecule *, std::vector<size_t>> intraMolecularBonds;
+
+    for (size_t i = 0; i < _bondConstraints.size(); ++i)
+    {
+        auto *molecule = _bondConstraints[i].getMolecule1();
+
+        if (molecule != _bondConstraints[i].getMolecule2())
+            continue;
+
+        if (molecule->getNumberOfAtoms() != 3)
+            continue;
+
+        intraMolecularBonds[molecule].push_back(i);
+    }
+
+    for (auto &[molecule, bondIndices] : intraMolecularBonds)
+    {
+        if (bondIndices.size() != 3)
+            continue;
+
+        std::array<double, 3> squaredDistances = {-1.0, -1.0, -1.0};
+
+        for (const auto bondIndex : bondIndices)
+        {
+            const auto &bond   = _bondConstraints[bondIndex];
+            const auto  index1 = bond.getAtomIndex1();
+            const auto  index2 = bond.getAtomIndex2();
+            const auto  length = bond.getTargetBondLength();
+
+            if (index1 == index2)
+                break;
+
+            squaredDistances[index1 + index2 - 1] = length * length;
+        }
+
+        if (std::ranges::any_of(squaredDistances, [](auto d) { return d < 0; }))
+            continue;
+
+        const std::array<double, 3> masses = {
+            molecule->getAtomMass(0),
+            molecule->getAtomMass(1),
+            molecule->getAtomMass(2)
+        };
+
+        const auto apex = Settle::findApex(masses, squaredDistances);
+
+        if (!apex.has_value())
+            continue;
+
+        const auto [a, b, c] = apex.value();
+
+        const auto params = Settle::calculateParameters(
+            masses[a],
+            masses[b],
+            std::sqrt(squaredDistances[a + b - 1]),
+            std::sqrt(squaredDistances[b + c - 1])
+        );
+
+        _settle.addMolecule(
+            &molecule->getAtom(a),
+            &molecule->getAtom(b),
+            &molecule->getAtom(c),
+            _settle.addParameters(params)
+        );
+
+        for (const auto bondIndex : bondIndices)
+            _shakeClusters.excludeBond(bondIndex);
+    }
+}
+
 /**
  * @brief calculates the reference bond data of all bond constraints
  *
+ * @details the reference data is also copied into the SoA layout of the
+ * independent shake clusters
+ *
  * @param simulationBox
  *
  */
 void Constraints::calculateConstraintBondRefs(const SimulationBox &simulationBox
 )
 {
-    startTimingsSection("Reference Bond Data");
+    startTimingsSection<"Reference Bond Data">();
 
     std::ranges::for_each(
         _bondConstraints,
@@ -71,11 +251,14 @@ void Constraints::calculateConstraintBondRefs(const SimulationBox &simulationBox
         { bondConstraint.calculateConstraintBondRef(simulationBox); }
     );
 
-    stopTimingsSection("Reference Bond Data");
+    _shakeClusters.update(_bondConstraints);
+    _settle.calculateReferences(simulationBox);
+
+    stopTimingsSection<"Reference Bond Data">();
 }
 
 /**
- * @brief applies both shake and mShake algorithm to all bond constraints
+ * @brief applies shake, mShake and SETTLE algorithm to all bond constraints
  *
  * @param simulationBox
  */
@@ -89,11 +272,17 @@ void Constraints::applyShake(SimulationBox &simulationBox)
 
     if (_mShakeActivated)
         _applyMShake(simulationBox);
+
+    if (_settle.isActive())
+        _applySettle(simulationBox);
 }
 
 /**
  * @brief applies the shake algorithm to all bond constraints
  *
+ * @details the bond constraints are processed in independent clusters, each
+ * of them is iterated only until it is converged
+ *
  * @param simulationBox
  *
  * @throws ShakeException if shake algorithm does not
@@ -101,41 +290,25 @@ void Constraints::applyShake(SimulationBox &simulationBox)
  */
 void Constraints::_applyShake(SimulationBox &simBox)
 {
-    startTimingsSection("Shake");
-
-    std::vector<bool> convergedVector;
-    bool              converged = false;
-
-    size_t iter = 0;
-
-    while (!converged && iter <= _shakeMaxIter)
-    {
-        convergedVector.clear();
-
-        auto applyShakeSingleBond =
-            [&simBox, &convergedVector, this](auto &bondConst) {
-                convergedVector.push_back(
-                    bondConst.applyShake(simBox, _shakeTolerance)
-                );
-            };
-
-        std::ranges::for_each(_bondConstraints, applyShakeSingleBond);
+    startTimingsSection<"Shake">();
 
-        converged = std::ranges::all_of(
-            convergedVector,
-            [](const bool isConverged) { return isConverged; }
-        );
+    if (!_shakeClusters.isInitialized())
+        _shakeClusters.update(_bondConstraints);
 
-        ++iter;
-    }
+    const auto nNotConverged = _shakeClusters.applyShake(
+        simBox,
+        _shakeTolerance,
+        _shakeMaxIter,
+        TimingsSettings::getTimeStep()
+    );
 
-    if (!converged)
+    if (nNotConverged > 0)
         throw ShakeException(std::format(
             "Shake algorithm did not converge for {} bonds.",
-            std::ranges::count(convergedVector, false)
+            nNotConverged
         ));
 
-    stopTimingsSection("Shake");
+    stopTimingsSection<"Shake">();
 }
 
 /**
@@ -146,9 +319,9 @@ void Constraints::_applyShake(SimulationBox &simBox)
  */
 void Constraints::_applyMShake(SimulationBox &simulationBox)
 {
-    startTimingsSection("MShake - Shake");
+    startTimingsSection<"MShake - Shake">();
     _mShake.applyMShake(_shakeTolerance, simulationBox);
-    stopTimingsSection("MShake - Shake");
+    stopTimingsSection<"MShake - Shake">();
 }
 
 /**
@@ -167,51 +340,55 @@ void Constraints::applyRattle(SimulationBox &simBox)
 
     if (_mShakeActivated)
         _applyMRattle(simBox);
+
+    if (_settle.isActive())
+        _applySettleRattle(simBox);
 }
 
 /**
- * @brief applies the rattle algorithm to all bond constraints
+ * @brief applies the analytic SETTLE algorithm to all rigid three-site
+ * molecules
  *
- * @throws ShakeException if rattle algorithm does not
- * converge
+ * @param simulationBox
+ *
+ * @throws ShakeException if a molecule is too distorted for SETTLE
  */
-void Constraints::_applyRattle()
+void Constraints::_applySettle(SimulationBox &simulationBox)
 {
-    startTimingsSection("Rattle");
-
-    std::vector<bool> convergedVector;
-    bool              converged = false;
+    startTimingsSection<"Settle - Shake">();
 
-    size_t iter = 0;
-
-    while (!converged && iter <= _rattleMaxIter)
-    {
-        convergedVector.clear();
+    const auto nDistorted =
+        _settle.applySettle(simulationBox, TimingsSettings::getTimeStep());
 
-        auto applyRattleForSingleBond = [&convergedVector,
-                                         this](auto &bondConstraint) {
-            convergedVector.push_back(
-                bondConstraint.applyRattle(_rattleTolerance)
-            );
-        };
+    if (nDistorted > 0)
+        throw ShakeException(std::format(
+            "SETTLE algorithm failed for {} severely distorted molecules.",
+            nDistorted
+        ));
 
-        std::ranges::for_each(_bondConstraints, applyRattleForSingleBond);
+    stopTimingsSection<"Settle - Shake">();
+}
 
-        converged = std::ranges::all_of(
-            convergedVector,
-            [](const bool isConverged) { return isConverged; }
-        );
+/**
+ * @brief applies the rattle algorithm to all bond constraints
+ *
+ * @throws ShakeException if rattle algorithm does not
+ * converge
+ */
+void Constraints::_applyRattle()
+{
+    startTimingsSection<"Rattle">();
 
-        ++iter;
-    }
+    const auto nNotConverged =
+        _shakeClusters.applyRattle(_rattleTolerance, _rattleMaxIter);
 
-    if (!converged)
+    if (nNotConverged > 0)
         throw ShakeException(std::format(
             "Rattle algorithm did not converge for {} bonds.",
-            std::ranges::count(convergedVector, false)
+            nNotConverged
         ));
 
-    stopTimingsSection("Rattle");
+    stopTimingsSection<"Rattle">();
 }
 
 /**
@@ -221,9 +398,21 @@ void Constraints::_applyRattle()
  */
 void Constraints::_applyMRattle(SimulationBox &simulationBox)
 {
-    startTimingsSection("MShake - Rattle");
+    startTimingsSection<"MShake - Rattle">();
     _mShake.applyMRattle(simulationBox);
-    stopTimingsSection("MShake - Rattle");
+    stopTimingsSection<"MShake - Rattle">();
+}
+
+/**
+ * @brief applies the analytic velocity SETTLE algorithm
+ *
+ * @param simulationBox
+ */
+void Constraints::_applySettleRattle(SimulationBox &simulationBox)
+{
+    startTimingsSection<"Settle - Rattle">();
+    _settle.applySettleRattle(simulationBox);
+    stopTimingsSection<"Settle - Rattle">();
 }
 
 /**
@@ -360,6 +549,7 @@ bool Constraints::isActive() const
 void Constraints::addBondConstraint(const BondConstraint &bondConstraint)
 {
     _bondConstraints.push_back(bondConstraint);
+    _shakeClusters.reset();
 }
 
 /**
@@ -432,6 +622,23 @@ size_t Constraints::getNumberOfBondConstraints() const
     return _bondConstraints.size();
 }
 
+/**
+ * @brief returns the independent shake clusters
+ *
+ * @return the independent shake clusters
+ */
+const ShakeClusters &Constraints::getShakeClusters() const
+{
+    return _shakeClusters;
+}
+
+/**
+ * @brief returns the SETTLE solver
+ *
+ * @return the SETTLE solver
+ */
+const Settle &Constraints::getSettle() const { return _settle; }
+
 /**
  * @brief returns the number of mShake constraints
  *
@@ -452,6 +659,16 @@ size_t Constraints::getNumberOfDistanceConstraints() const
     return _distanceConstraints.size();
 }
 
+/**
+ * @brief returns the number of molecules constrained via SETTLE
+ *
+ * @return the number of SETTLE molecules
+ */
+size_t Constraints::getNumberOfSettleMolecules() const
+{
+    return _settle.getNumberOfMolecules();
+}
+
 /**
  * @brief returns the maximum number of iterations for the shake algorithm
  *
@@ -28,9 +28,8 @@
 #include "distanceKernels.hpp"   // for distVecAndDist2
 #include "mShakeReference.hpp"   // for MShakeReference
 #include "mathUtilities.hpp"     // for dot
-#include "matrix.hpp"            // for Matrix
 #include "simulationBox.hpp"     // for SimulationBox
-#include "stlVector.hpp"         // for dot
+#include "staticMatrix.hpp"      // for StaticMatrix, StaticLUDecomposition
 #include "timingsSettings.hpp"   // for settings
 
 using namespace constraints;
@@ -48,6 +47,11 @@ void MShake::initMShake() { initMShakeReferences(); }
 /**
  * @brief init M - Shake references
  *
+ * @details the M - Shake matrix of the reference geometry is LU decomposed
+ * once and cached for the M - Rattle step
+ *
+ * @throw customException::MShakeException if a reference molecule has more
+ * atoms than supported by the static M - Shake matrices
  **/
 void MShake::initMShakeReferences()
 {
@@ -63,8 +67,16 @@ void MShake::initMShakeReferences()
         const auto nAtoms = mShakeReference.getNumberOfAtoms();
         const auto nBonds = nAtoms * (nAtoms - 1) / 2;
 
-        std::vector<double> rSquaredRefs;
-        Matrix<double>      mShakeMatrix(nBonds, nBonds);
+        if (nAtoms > _MSHAKE_MAX_ATOMS_)
+            throw customException::MShakeException(std::format(
+                "M-Shake reference with {} atoms exceeds the maximum number of "
+                "{} atoms per M-Shake molecule",
+                nAtoms,
+                _MSHAKE_MAX_ATOMS_
+            ));
+
+        MShakeVector rSquaredRefs{};
+        MShakeMatrix mShakeMatrix{};
 
         size_t bond_ij = 0;
 
@@ -80,7 +92,7 @@ void MShake::initMShakeReferences()
 
                 const auto [dxyz_ij, r2_ij] = distVecAndDist2(pos_i, pos_j);
 
-                rSquaredRefs.push_back(r2_ij);
+                rSquaredRefs[bond_ij] = r2_ij;
 
                 size_t bond_kl = 0;
                 for (size_t k = 0; k < nAtoms - 1; ++k)
@@ -106,11 +118,6 @@ void MShake::initMShakeReferences()
             }
         }
 
-        /*********************
-         * invert the matrix *
-         *********************/
-        const auto invMatrix = mShakeMatrix.inverse();
-
         /*******************************************************
          * add the calculated values to the respective vectors *
          * each molecule type has its own set of references    *
@@ -118,14 +125,16 @@ void MShake::initMShakeReferences()
          * size equal to the number of m-shake molecule types  *
          *******************************************************/
         _mShakeRSquaredRefs.push_back(rSquaredRefs);
-        _mShakeMatrices.push_back(mShakeMatrix);
-        _mShakeInvMatrices.push_back(invMatrix);
+        _mShakeLUs.emplace_back(mShakeMatrix, nBonds);
     }
 }
 
 /**
  * @brief applies the mShake algorithm to all bond constraints
  *
+ * @details all work arrays are fixed size and live on the stack, therefore
+ * no heap allocation is performed per step
+ *
  * @param simBox
  *
  */
@@ -137,33 +146,34 @@ void MShake::applyMShake(const double shakeTolerance, SimulationBox &simBox)
     const auto timeFactor  = 4.0 * dt * dt;
     const auto shakeFactor = 2.0 * dt * dt;
 
+    StaticVector<Vec3D, _MSHAKE_MAX_BONDS_> bondsUnconstrained;
+    StaticVector<Vec3D, _MSHAKE_MAX_BONDS_> bondsPrevious;
+    StaticVector<Vec3D, _MSHAKE_MAX_ATOMS_> posUnconstrained;
+
+    MShakeVector shakeVector;
+    MShakeMatrix mShakeMatrix;
+    MShakeLU     mShakeLU;
+
     for (size_t mol = 0; mol < molecules.size(); ++mol)
     {
         auto      &molecule = molecules[mol];
         const auto moltype  = molecule.getMoltype();
 
-        if (!isMShakeType(moltype))
+        if (!isMShakeType(moltype) || isSettleType(moltype))
             continue;
 
-        const auto mShakeIndex  = findMShakeReferenceIndex(moltype);
-        const auto mShakeR2Refs = _mShakeRSquaredRefs[mShakeIndex];
-        const auto nAtoms       = molecule.getNumberOfAtoms();
-        const auto nBonds       = _mShakeInvMatrices[mShakeIndex].rows();
-        auto      &atoms        = molecule.getAtoms();
-
-        std::vector<Vec3D>  bondsUnconstrained(nBonds);
-        std::vector<Vec3D>  bondsPrevious(nBonds);
-        std::vector<double> shakeVector(nBonds);
-        Matrix<double>      mShakeMatrix(nBonds, nBonds);
-
-        std::vector<Vec3D> posUnconstrained;
+        const auto  mShakeIndex  = findMShakeReferenceIndex(moltype);
+        const auto &mShakeR2Refs = _mShakeRSquaredRefs[mShakeIndex];
+        const auto  nAtoms       = molecule.getNumberOfAtoms();
+        const auto  nBonds       = _mShakeLUs[mShakeIndex].size();
+        auto       &atoms        = molecule.getAtoms();
 
         /******************************************************
          * initialize the unconstrained positions of all atoms *
          *******************************************************/
 
-        for (const auto &atom : atoms)
-            posUnconstrained.push_back(atom->getPosition());
+        for (size_t i = 0; i < nAtoms; ++i)
+            posUnconstrained[i] = atoms[i]->getPosition();
 
         /****************************************
          * initialize pre while loop iterations *
@@ -232,7 +242,7 @@ void MShake::applyMShake(const double shakeTolerance, SimulationBox &simBox)
 
                     for (size_t k = 0; k < nAtoms - 1; ++k)
                     {
-                        for (size_t l = 0; l < nAtoms - 1; ++l)
+                        for (size_t l = k + 1; l < nAtoms; ++l)
                         {
                             const auto mShakeElement = calcMatrixElement(
                                 {i, j, k, l},
@@ -255,10 +265,11 @@ void MShake::applyMShake(const double shakeTolerance, SimulationBox &simBox)
              * solve the linear system of equations                  *
              *        b = A * x                                      *
              * where b is the shakeVector, A is the mShakeMatrix and *
-             * x is the solutionVector                               *
+             * x is the solution, which overwrites the shakeVector   *
              *********************************************************/
 
-            const auto solutionVector = mShakeMatrix.solve(shakeVector);
+            mShakeLU.decompose(mShakeMatrix, nBonds);
+            mShakeLU.solve(shakeVector);
 
             index_ij = 0;
 
@@ -275,7 +286,7 @@ void MShake::applyMShake(const double shakeTolerance, SimulationBox &simBox)
                     const auto mass_j = atoms[j]->getMass();
 
                     const auto &bondPrev = bondsPrevious[index_ij];
-                    const auto &solution = solutionVector[index_ij];
+                    const auto &solution = shakeVector[index_ij];
 
                     auto posAdjustment  = solution * bondPrev;
                     posAdjustment      *= shakeFactor;
@@ -345,7 +356,9 @@ void MShake::applyMShake(const double shakeTolerance, SimulationBox &simBox)
 /**
  * @brief apply M - Rattle to correct velocities
  *
- * @param shakeTolerance
+ * @details the linear system is solved with the LU decomposition of the
+ * reference M - Shake matrix cached in initMShakeReferences
+ *
  * @param simulationBox
  *
  */
@@ -353,25 +366,23 @@ void MShake::applyMRattle(SimulationBox &simulationBox)
 {
     auto &molecules = simulationBox.getMolecules();
 
+    MShakeVector                            rattleVector;
+    StaticVector<Vec3D, _MSHAKE_MAX_BONDS_> bonds;
+
     for (size_t mol = 0; mol < molecules.size(); ++mol)
     {
         auto      &molecule = molecules[mol];
         const auto moltype  = molecule.getMoltype();
 
-        if (!isMShakeType(moltype))
+        if (!isMShakeType(moltype) || isSettleType(moltype))
             continue;
 
-        const auto mShakeIndex  = findMShakeReferenceIndex(moltype);
-        const auto mShakeR2Refs = _mShakeRSquaredRefs[mShakeIndex];
-        auto       mShakeMatrix = _mShakeInvMatrices[mShakeIndex];
-        const auto nAtoms       = molecule.getNumberOfAtoms();
-        const auto nBonds       = mShakeMatrix.rows();
+        const auto  mShakeIndex = findMShakeReferenceIndex(moltype);
+        const auto &mShakeLU    = _mShakeLUs[mShakeIndex];
+        const auto  nAtoms      = molecule.getNumberOfAtoms();
 
         auto &atoms = molecule.getAtoms();
 
-        std::vector<double> rattleVector(nBonds);
-        std::vector<Vec3D>  bonds(nBonds);
-
         size_t index_ij = 0;
         for (size_t i = 0; i < nAtoms - 1; ++i)
         {
@@ -394,6 +405,13 @@ void MShake::applyMRattle(SimulationBox &simulationBox)
             }
         }
 
+        /*******************************************************
+         * velocity constraints x = A^-1 * b via the cached LU *
+         * decomposition - overwrites the rattle vector        *
+         *******************************************************/
+
+        mShakeLU.solve(rattleVector);
+
         index_ij = 0;
         for (size_t i = 0; i < nAtoms - 1; ++i)
         {
@@ -403,8 +421,7 @@ void MShake::applyMRattle(SimulationBox &simulationBox)
             {
                 const auto mass_j = atoms[j]->getMass();
 
-                auto velConstraint = dot(mShakeMatrix(index_ij), rattleVector);
-
+                const auto velConstraint = rattleVector[index_ij];
                 const auto velAdjustment = velConstraint * bonds[index_ij];
 
                 atoms[i]->addVelocity(velAdjustment / mass_i);
@@ -441,6 +458,19 @@ bool MShake::isMShakeType(const size_t moltype) const
     return isMShake;
 }
 
+/**
+ * @brief check if molecule type is constrained via SETTLE instead of the
+ * iterative M - Shake algorithm
+ *
+ * @param moltype
+ *
+ * @return bool
+ */
+bool MShake::isSettleType(const size_t moltype) const
+{
+    return _settleMolTypes.contains(moltype);
+}
+
 /**
  * @brief find M - Shake reference by molecule type
  *
@@ -504,6 +534,16 @@ void MShake::addMShakeReference(const MShakeReference &mShakeReference)
     _mShakeReferences.push_back(mShakeReference);
 }
 
+/**
+ * @brief mark a M - Shake molecule type to be constrained via SETTLE
+ *
+ * @param moltype
+ */
+void MShake::addSettleType(const size_t moltype)
+{
+    _settleMolTypes.insert(moltype);
+}
+
 /**
  * @brief get M - Shake references
  *
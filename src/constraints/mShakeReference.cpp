@@ -78,6 +78,13 @@ size_t MShakeReference::getNumberOfAtoms() const { return _atoms.size(); }
  */
 std::vector<Atom> &MShakeReference::getAtoms() { return _atoms; }
 
+/**
+ * @brief get the atoms
+ *
+ * @return const std::vector<Atom>&
+ */
+const std::vector<Atom> &MShakeReference::getAtoms() const { return _atoms; }
+
 /**
  * @brief get the molecule type
  *
@@ -0,0 +1,435 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "settle.hpp"
+
+#include <algorithm>   // for max
+#include <cmath>       // for sqrt, fabs
+
+#include "atom.hpp"                          // for Atom
+#include "constants/conversionFactors.hpp"   // for _FS_TO_S_
+#include "simulationBox.hpp"                 // for SimulationBox
+#include "staticMatrix.hpp"                  // for StaticMatrix3x3, inverse
+
+using namespace constraints;
+using namespace simulationBox;
+using namespace linearAlgebra;
+using namespace constants;
+
+/**
+ * @brief calculates the SETTLE parameters of a rigid three-site molecule
+ *
+ * @param massA mass of the apex atom
+ * @param massB mass of each of the two base atoms
+ * @param distAB distance between the apex atom and a base atom
+ * @param distBC distance between the two base atoms
+ * @return SettleParameters
+ */
+SettleParameters Settle::calculateParameters(
+    const double massA,
+    const double massB,
+    const double distAB,
+    const double distBC
+)
+{
+    const auto totalMass = massA + 2.0 * massB;
+    const auto rc        = 0.5 * distBC;
+    const auto height    = std::sqrt(distAB * distAB - rc * rc);
+    const auto ra        = 2.0 * massB * height / totalMass;
+
+    return SettleParameters{
+        .massA  = massA,
+        .massB  = massB,
+        .distAB = distAB,
+        .distBC = distBC,
+        .wh     = massB / totalMass,
+        .ra     = ra,
+        .rb     = height - ra,
+        .rc     = rc,
+        .irc2   = 1.0 / distBC
+    };
+}
+
+/**
+ * @brief finds the apex atom of a rigid three-site molecule
+ *
+ * @details SETTLE requires an apex atom A and two base atoms B and C with
+ * equal masses and equal distances to A. The squared distances are given in
+ * the order (0,1), (0,2), (1,2).
+ *
+ * @param masses
+ * @param squaredDistances
+ * @return std::optional<std::array<size_t, 3>> the atom indices in the order
+ * A, B, C or nullopt if the molecule is not suited for SETTLE
+ */
+std::optional<std::array<size_t, 3>> Settle::findApex(
+    const std::array<double, 3> &masses,
+    const std::array<double, 3> &squaredDistances
+)
+{
+    constexpr double massTolerance     = 1.0e-8;
+    constexpr double distanceTolerance = 1.0e-6;
+
+    auto pairIndex = [](const size_t i, const size_t j)
+    { return i + j - 1; };
+
+    auto isClose = [](const double a, const double b, const double tolerance)
+    { return std::fabs(a - b) <= tolerance * std::max(a, b); };
+
+    for (size_t apex = 0; apex < 3; ++apex)
+    {
+        const auto b = (apex + 1) % 3;
+        const auto c = (apex + 2) % 3;
+
+        const auto distAB = squaredDistances[pairIndex(apex, b)];
+        const auto distAC = squaredDistances[pairIndex(apex, c)];
+
+        if (!isClose(masses[b], masses[c], massTolerance))
+            continue;
+
+        if (!isClose(distAB, distAC, distanceTolerance))
+            continue;
+
+        return std::array<size_t, 3>{apex, std::min(b, c), std::max(b, c)};
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief adds a parameter set if it is not already present
+ *
+ * @param parameters
+ * @return size_t index of the parameter set
+ */
+size_t Settle::addParameters(const SettleParameters &parameters)
+{
+    for (size_t i = 0; i < _parameters.size(); ++i)
+    {
+        const auto &param = _parameters[i];
+
+        if (param.massA == parameters.massA &&
+            param.massB == parameters.massB &&
+            param.distAB == parameters.distAB &&
+            param.distBC == parameters.distBC)
+            return i;
+    }
+
+    _parameters.push_back(parameters);
+
+    return _parameters.size() - 1;
+}
+
+/**
+ * @brief adds a rigid three-site molecule
+ *
+ * @param atomA apex atom
+ * @param atomB first base atom
+ * @param atomC second base atom
+ * @param paramIndex index of the parameter set
+ */
+void Settle::addMolecule(
+    Atom        *atomA,
+    Atom        *atomB,
+    Atom        *atomC,
+    const size_t paramIndex
+)
+{
+    _atomsA.push_back(atomA);
+    _atomsB.push_back(atomB);
+    _atomsC.push_back(atomC);
+    _paramIndices.push_back(paramIndex);
+
+    _refsAB.emplace_back(0.0, 0.0, 0.0);
+    _refsAC.emplace_back(0.0, 0.0, 0.0);
+}
+
+/**
+ * @brief calculates the reference bond vectors of all SETTLE molecules
+ *
+ * @details has to be called with constrained positions, i.e. the same
+ * positions used for the reference bond vectors of SHAKE
+ *
+ * @param simBox
+ */
+void Settle::calculateReferences(const SimulationBox &simBox)
+{
+    const auto nMolecules = getNumberOfMolecules();
+
+    // clang-format off
+    #pragma omp parallel for schedule(static)
+    // clang-format on
+    for (size_t m = 0; m < nMolecules; ++m)
+    {
+        const auto posA = _atomsA[m]->getPosition();
+
+        auto refAB = _atomsB[m]->getPosition() - posA;
+        auto refAC = _atomsC[m]->getPosition() - posA;
+
+        simBox.applyPBC(refAB);
+        simBox.applyPBC(refAC);
+
+        _refsAB[m] = refAB;
+        _refsAC[m] = refAC;
+    }
+}
+
+/**
+ * @brief applies the analytic SETTLE algorithm to all molecules
+ *
+ * @details the unconstrained positions of the current step are rotated and
+ * translated onto the rigid geometry, conserving the center of mass and the
+ * reference plane of the previous step. The velocities are corrected by the
+ * respective displacements.
+ *
+ * @param simBox
+ * @param timeStep in fs
+ * @return size_t number of severely distorted molecules
+ */
+size_t Settle::applySettle(const SimulationBox &simBox, const double timeStep)
+{
+    constexpr double almostZero = 1.0e-12;
+
+    const auto nMolecules = getNumberOfMolecules();
+    const auto invDt      = 1.0 / (timeStep * _FS_TO_S_);
+
+    size_t nDistorted = 0;
+
+    // clang-format off
+    #pragma omp parallel for schedule(static) reduction(+:nDistorted)
+    // clang-format on
+    for (size_t m = 0; m < nMolecules; ++m)
+    {
+        const auto &param = _parameters[_paramIndices[m]];
+
+        const auto &dist21 = _refsAB[m];
+        const auto &dist31 = _refsAC[m];
+
+        const auto posA = _atomsA[m]->getPosition();
+
+        auto doh2 = _atomsB[m]->getPosition() - posA;
+        auto doh3 = _atomsC[m]->getPosition() - posA;
+
+        simBox.applyPBC(doh2);
+        simBox.applyPBC(doh3);
+
+        /*********************************************
+         * positions relative to the center of mass *
+         *********************************************/
+
+        const auto a1  = -(doh2 + doh3) * param.wh;
+        const auto com = posA - a1;
+        const auto b1  = doh2 + a1;
+        const auto c1  = doh3 + a1;
+
+        /*********************************************************
+         * orthonormal frame with z perpendicular to the plane   *
+         * of the reference positions and x perpendicular to the *
+         * apex atom position                                    *
+         *********************************************************/
+
+        const auto aksZ = cross(dist21, dist31);
+        const auto aksX = cross(a1, aksZ);
+        const auto aksY = cross(aksZ, aksX);
+
+        const auto trnsX = aksX / norm(aksX);
+        const auto trnsY = aksY / norm(aksY);
+        const auto trnsZ = aksZ / norm(aksZ);
+
+        const auto b0dX = dot(trnsX, dist21);
+        const auto b0dY = dot(trnsY, dist21);
+        const auto c0dX = dot(trnsX, dist31);
+        const auto c0dY = dot(trnsY, dist31);
+
+        const auto a1dZ = dot(trnsZ, a1);
+        const auto b1dX = dot(trnsX, b1);
+        const auto b1dY = dot(trnsY, b1);
+        const auto b1dZ = dot(trnsZ, b1);
+        const auto c1dX = dot(trnsX, c1);
+        const auto c1dY = dot(trnsY, c1);
+        const auto c1dZ = dot(trnsZ, c1);
+
+        /*******************************
+         * rotation angles phi and psi *
+         *******************************/
+
+        const auto sinPhi = a1dZ / param.ra;
+        const auto tmpPhi = 1.0 - sinPhi * sinPhi;
+
+        nDistorted += tmpPhi <= almostZero ? 1 : 0;
+
+        const auto cosPhi = std::sqrt(std::max(tmpPhi, almostZero));
+        const auto sinPsi = (b1dZ - c1dZ) * param.irc2 / cosPhi;
+        const auto cosPsi = std::sqrt(std::max(1.0 - sinPsi * sinPsi, 0.0));
+
+        const auto a2dY = param.ra * cosPhi;
+        const auto b2dX = -param.rc * cosPsi;
+        const auto t1   = -param.rb * cosPhi;
+        const auto t2   = param.rc * sinPsi * sinPhi;
+        const auto b2dY = t1 - t2;
+        const auto c2dY = t1 + t2;
+
+        /********************
+         * rotation angle theta *
+         ********************/
+
+        const auto alpha = b2dX * (b0dX - c0dX) + b0dY * b2dY + c0dY * c2dY;
+        const auto beta  = b2dX * (c0dY - b0dY) + b0dX * b2dY + c0dX * c2dY;
+        const auto gamma = b0dX * b1dY - b1dX * b0dY + c0dX * c1dY - c1dX * c0dY;
+
+        const auto al2be2 = alpha * alpha + beta * beta;
+        const auto tmpThe = std::sqrt(std::max(al2be2 - gamma * gamma, 0.0));
+        const auto sinThe = (alpha * gamma - beta * tmpThe) / al2be2;
+        const auto cosThe = std::sqrt(std::max(1.0 - sinThe * sinThe, 0.0));
+
+        /*********************************************
+         * constrained positions in the local frame *
+         *********************************************/
+
+        const auto a3d = Vec3D(-a2dY * sinThe, a2dY * cosThe, a1dZ);
+
+        const auto b3d = Vec3D(
+            b2dX * cosThe - b2dY * sinThe,
+            b2dX * sinThe + b2dY * cosThe,
+            b1dZ
+        );
+
+        const auto c3d = Vec3D(
+            -b2dX * cosThe - c2dY * sinThe,
+            -b2dX * sinThe + c2dY * cosThe,
+            c1dZ
+        );
+
+        /*****************************************
+         * transform back into the global frame *
+         *****************************************/
+
+        const auto a3 = a3d[0] * trnsX + a3d[1] * trnsY + a3d[2] * trnsZ;
+        const auto b3 = b3d[0] * trnsX + b3d[1] * trnsY + b3d[2] * trnsZ;
+        const auto c3 = c3d[0] * trnsX + c3d[1] * trnsY + c3d[2] * trnsZ;
+
+        auto newPosA = com + a3;
+        auto newPosB = com + b3;
+        auto newPosC = com + c3;
+
+        simBox.applyPBC(newPosA);
+        simBox.applyPBC(newPosB);
+        simBox.applyPBC(newPosC);
+
+        _atomsA[m]->setPosition(newPosA);
+        _atomsB[m]->setPosition(newPosB);
+        _atomsC[m]->setPosition(newPosC);
+
+        _atomsA[m]->addVelocity((a3 - a1) * invDt);
+        _atomsB[m]->addVelocity((b3 - b1) * invDt);
+        _atomsC[m]->addVelocity((c3 - c1) * invDt);
+    }
+
+    return nDistorted;
+}
+
+/**
+ * @brief removes the velocity components along all three bonds of all SETTLE
+ * molecules
+ *
+ * @details the three coupled RATTLE equations of a rigid triangle are solved
+ * analytically via the inverse of the symmetric 3x3 constraint matrix
+ *
+ * @param simBox
+ */
+void Settle::applySettleRattle(const SimulationBox &simBox)
+{
+    const auto nMolecules = getNumberOfMolecules();
+
+    // clang-format off
+    #pragma omp parallel for schedule(static)
+    // clang-format on
+    for (size_t m = 0; m < nMolecules; ++m)
+    {
+        const auto &param = _parameters[_paramIndices[m]];
+
+        const auto invMassA = 1.0 / param.massA;
+        const auto invMassB = 1.0 / param.massB;
+
+        const auto posA = _atomsA[m]->getPosition();
+        const auto posB = _atomsB[m]->getPosition();
+        const auto posC = _atomsC[m]->getPosition();
+
+        auto eAB = posA - posB;
+        auto eBC = posB - posC;
+        auto eCA = posC - posA;
+
+        simBox.applyPBC(eAB);
+        simBox.applyPBC(eBC);
+        simBox.applyPBC(eCA);
+
+        eAB /= norm(eAB);
+        eBC /= norm(eBC);
+        eCA /= norm(eCA);
+
+        const auto velA = _atomsA[m]->getVelocity();
+        const auto velB = _atomsB[m]->getVelocity();
+        const auto velC = _atomsC[m]->getVelocity();
+
+        const auto cosABBC = dot(eAB, eBC);
+        const auto cosBCCA = dot(eBC, eCA);
+        const auto cosCAAB = dot(eCA, eAB);
+
+        const auto matrix = tensor3D(
+            Vec3D(invMassA + invMassB, -cosABBC * invMassB, -cosCAAB * invMassA),
+            Vec3D(-cosABBC * invMassB, 2.0 * invMassB, -cosBCCA * invMassB),
+            Vec3D(-cosCAAB * invMassA, -cosBCCA * invMassB, invMassA + invMassB)
+        );
+
+        const auto rhs = Vec3D(
+            -dot(eAB, velA - velB),
+            -dot(eBC, velB - velC),
+            -dot(eCA, velC - velA)
+        );
+
+        const auto lambda = inverse(matrix) * rhs;
+
+        _atomsA[m]->addVelocity((lambda[0] * eAB - lambda[2] * eCA) * invMassA);
+        _atomsB[m]->addVelocity((lambda[1] * eBC - lambda[0] * eAB) * invMassB);
+        _atomsC[m]->addVelocity((lambda[2] * eCA - lambda[1] * eBC) * invMassB);
+    }
+}
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief get the number of SETTLE molecules
+ *
+ * @return size_t
+ */
+size_t Settle::getNumberOfMolecules() const { return _atomsA.size(); }
+
+/**
+ * @brief get the number of distinct SETTLE parameter sets
+ *
+ * @return size_t
+ */
+size_t Settle::getNumberOfParameters() const { return _parameters.size(); }
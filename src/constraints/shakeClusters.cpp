@@ -0,0 +1,373 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "shakeClusters.hpp"
+
+#include <cmath>           // for fabs
+#include <unordered_map>   // for unordered_map
+
+#include "atom.hpp"             // for Atom
+#include "bondConstraint.hpp"   // for BondConstraint
+#include "molecule.hpp"         // for Molecule
+#include "simulationBox.hpp"    // for SimulationBox
+
+using namespace constraints;
+using namespace simulationBox;
+using namespace linearAlgebra;
+
+/**
+ * @brief find with path halving for the union-find clustering
+ *
+ * @param parents
+ * @param index
+ * @return size_t root of index
+ */
+size_t ShakeClusters::findRoot(std::vector<size_t> &parents, size_t index)
+{
+    while (parents[index] != index)
+    {
+        parents[index] = parents[parents[index]];
+        index          = parents[index];
+    }
+
+    return index;
+}
+/**
+ * @brief builds the independent clusters of the bond constraints
+ *
+ * @details two bond constraints belong to the same cluster if they are
+ * connected via a chain of bond constraints sharing atoms. The bonds are
+ * sorted by cluster while keeping their original relative order. Excluded
+ * bonds are not part of any cluster.
+ *
+ * @param bondConstraints
+ */
+void ShakeClusters::init(const pq::BondConstraintsVec &bondConstraints)
+{
+    const auto nBonds = bondConstraints.size();
+
+    _isExcluded.resize(nBonds, false);
+
+    std::unordered_map<const Atom *, size_t> atomToNode;
+    std::vector<size_t>                      parents;
+    std::vector<size_t>                      bondNodes(nBonds);
+
+    auto getNode = [&atomToNode, &parents](const Atom *atom)
+    {
+        const auto [iter, inserted] =
+            atomToNode.try_emplace(atom, parents.size());
+
+        if (inserted)
+            parents.push_back(parents.size());
+
+        return iter->second;
+    };
+
+    for (size_t i = 0; i < nBonds; ++i)
+    {
+        if (_isExcluded[i])
+            continue;
+
+        const auto &bond = bondConstraints[i];
+
+        const auto *atom1 =
+            &bond.getMolecule1()->getAtom(bond.getAtomIndex1());
+        const auto *atom2 =
+            &bond.getMolecule2()->getAtom(bond.getAtomIndex2());
+
+        const auto root1 = findRoot(parents, getNode(atom1));
+        const auto root2 = findRoot(parents, getNode(atom2));
+
+        parents[root2] = root1;
+        bondNodes[i]   = getNode(atom1);
+    }
+
+    std::unordered_map<size_t, size_t> rootToCluster;
+    std::vector<std::vector<size_t>>   clusters;
+
+    for (size_t i = 0; i < nBonds; ++i)
+    {
+        if (_isExcluded[i])
+            continue;
+
+        const auto root = findRoot(parents, bondNodes[i]);
+
+        const auto [iter, inserted] =
+            rootToCluster.try_emplace(root, clusters.size());
+
+        if (inserted)
+            clusters.emplace_back();
+
+        clusters[iter->second].push_back(i);
+    }
+
+    _bondOrder.clear();
+    _clusterOffsets.clear();
+
+    _bondOrder.reserve(nBonds);
+    _clusterOffsets.reserve(clusters.size() + 1);
+
+    _clusterOffsets.push_back(0);
+
+    for (const auto &cluster : clusters)
+    {
+        _bondOrder.insert(_bondOrder.end(), cluster.begin(), cluster.end());
+        _clusterOffsets.push_back(_bondOrder.size());
+    }
+
+    const auto nClusterBonds = _bondOrder.size();
+
+    _atoms1.resize(nClusterBonds);
+    _atoms2.resize(nClusterBonds);
+    _invMasses1.resize(nClusterBonds);
+    _invMasses2.resize(nClusterBonds);
+    _targetLengthsSquared.resize(nClusterBonds);
+    _refX.resize(nClusterBonds);
+    _refY.resize(nClusterBonds);
+    _refZ.resize(nClusterBonds);
+
+    _nBondConstraints = nBonds;
+    _isInitialized    = true;
+}
+
+/**
+ * @brief copies the current bond constraint data into the SoA arrays
+ *
+ * @details has to be called after the reference bond vectors of the bond
+ * constraints have been calculated
+ *
+ * @param bondConstraints
+ */
+void ShakeClusters::update(const pq::BondConstraintsVec &bondConstraints)
+{
+    if (!_isInitialized || _nBondConstraints != bondConstraints.size())
+        init(bondConstraints);
+
+    const auto nBonds = _bondOrder.size();
+
+    for (size_t k = 0; k < nBonds; ++k)
+    {
+        const auto &bond = bondConstraints[_bondOrder[k]];
+
+        _atoms1[k] = &bond.getMolecule1()->getAtom(bond.getAtomIndex1());
+        _atoms2[k] = &bond.getMolecule2()->getAtom(bond.getAtomIndex2());
+
+        _invMasses1[k] = 1 / _atoms1[k]->getMass();
+        _invMasses2[k] = 1 / _atoms2[k]->getMass();
+
+        const auto targetBondLength = bond.getTargetBondLength();
+        _targetLengthsSquared[k]    = targetBondLength * targetBondLength;
+
+        const auto ref = bond.getShakeDistanceRef();
+
+        _refX[k] = ref[0];
+        _refY[k] = ref[1];
+        _refZ[k] = ref[2];
+    }
+}
+
+/**
+ * @brief excludes a bond constraint from the clusters
+ *
+ * @param bondIndex index of the bond in the bond constraint vector
+ */
+void ShakeClusters::excludeBond(const size_t bondIndex)
+{
+    if (_isExcluded.size() <= bondIndex)
+        _isExcluded.resize(bondIndex + 1, false);
+
+    _isExcluded[bondIndex] = true;
+    _isInitialized         = false;
+}
+
+/**
+ * @brief iterates each cluster until all of its bonds are converged
+ *
+ * @param maxIter
+ * @param applyToBond returns true if the bond with the given SoA index is
+ * converged
+ * @return size_t number of bonds that did not converge
+ */
+template <typename Func>
+size_t ShakeClusters::iterateClusters(const size_t maxIter, Func &&applyToBond)
+{
+    const auto nClusters = getNumberOfClusters();
+
+    size_t nNotConverged = 0;
+
+    // clang-format off
+    #pragma omp parallel for schedule(dynamic, 64) reduction(+:nNotConverged)
+    // clang-format on
+    for (size_t cluster = 0; cluster < nClusters; ++cluster)
+    {
+        const auto begin = _clusterOffsets[cluster];
+        const auto end   = _clusterOffsets[cluster + 1];
+
+        size_t nNotConvergedCluster = 0;
+
+        for (size_t iter = 0; iter <= maxIter; ++iter)
+        {
+            nNotConvergedCluster = 0;
+
+            for (auto k = begin; k < end; ++k)
+                nNotConvergedCluster += applyToBond(k) ? 0 : 1;
+
+            if (nNotConvergedCluster == 0)
+                break;
+        }
+
+        nNotConverged += nNotConvergedCluster;
+    }
+
+    return nNotConverged;
+}
+
+/**
+ * @brief applies the shake algorithm to all clusters
+ *
+ * @param simBox
+ * @param tolerance
+ * @param maxIter
+ * @param timeStep
+ * @return size_t number of bonds that did not converge
+ */
+size_t ShakeClusters::applyShake(
+    const SimulationBox &simBox,
+    const double         tolerance,
+    const size_t         maxIter,
+    const double         timeStep
+)
+{
+    auto shakeBond = [this, &simBox, tolerance, timeStep](const size_t k)
+    {
+        auto dPosition = _atoms1[k]->getPosition() - _atoms2[k]->getPosition();
+        simBox.applyPBC(dPosition);
+
+        const auto targetSquared = _targetLengthsSquared[k];
+        const auto delta = 0.5 * (targetSquared - normSquared(dPosition));
+
+        if (std::fabs(delta / targetSquared) <= tolerance)
+            return true;
+
+        const auto invMass1 = _invMasses1[k];
+        const auto invMass2 = _invMasses2[k];
+
+        const auto ref        = Vec3D(_refX[k], _refY[k], _refZ[k]);
+        const auto sumInvMass = invMass1 + invMass2;
+
+        const auto shakeForce = delta / (sumInvMass) / normSquared(ref);
+        const auto dPos       = shakeForce * ref;
+
+        _atoms1[k]->addPosition(+invMass1 * dPos);
+        _atoms2[k]->addPosition(-invMass2 * dPos);
+
+        const auto dVelocity = dPos / timeStep;
+
+        _atoms1[k]->addVelocity(+invMass1 * dVelocity);
+        _atoms2[k]->addVelocity(-invMass2 * dVelocity);
+
+        return false;
+    };
+
+    return iterateClusters(maxIter, shakeBond);
+}
+
+/**
+ * @brief applies the rattle algorithm to all clusters
+ *
+ * @param tolerance
+ * @param maxIter
+ * @return size_t number of bonds that did not converge
+ */
+size_t ShakeClusters::applyRattle(const double tolerance, const size_t maxIter)
+{
+    auto rattleBond = [this, tolerance](const size_t k)
+    {
+        const auto dVelocity =
+            _atoms1[k]->getVelocity() - _atoms2[k]->getVelocity();
+
+        const auto invMass1 = _invMasses1[k];
+        const auto invMass2 = _invMasses2[k];
+
+        const auto ref        = Vec3D(_refX[k], _refY[k], _refZ[k]);
+        const auto sumInvMass = invMass1 + invMass2;
+
+        const auto scalarProduct = dot(dVelocity, ref);
+        const auto delta = -scalarProduct / (sumInvMass) / normSquared(ref);
+
+        if (std::fabs(delta) <= tolerance)
+            return true;
+
+        const auto dVel = delta * ref;
+
+        _atoms1[k]->addVelocity(+invMass1 * dVel);
+        _atoms2[k]->addVelocity(-invMass2 * dVel);
+
+        return false;
+    };
+
+    return iterateClusters(maxIter, rattleBond);
+}
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief get the number of independent clusters
+ *
+ * @return size_t
+ */
+size_t ShakeClusters::getNumberOfClusters() const
+{
+    return _clusterOffsets.empty() ? 0 : _clusterOffsets.size() - 1;
+}
+
+/**
+ * @brief get the number of bonds in all clusters
+ *
+ * @return size_t
+ */
+size_t ShakeClusters::getNumberOfBonds() const { return _bondOrder.size(); }
+
+/**
+ * @brief get the bond order, i.e. the index of the original bond constraint
+ * for each SoA entry
+ *
+ * @return const std::vector<size_t>&
+ */
+const std::vector<size_t> &ShakeClusters::getBondOrder() const
+{
+    return _bondOrder;
+}
+
+/**
+ * @brief get the offsets of the clusters in the SoA arrays
+ *
+ * @return const std::vector<size_t>&
+ */
+const std::vector<size_t> &ShakeClusters::getClusterOffsets() const
+{
+    return _clusterOffsets;
+}
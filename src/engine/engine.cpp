@@ -176,6 +176,13 @@ Virial &Engine::getVirial() { return *_virial; }
  */
 Potential &Engine::getPotential() { return *_potential; }
 
+/**
+ * @brief get the reference to the settings instance of the engine
+ *
+ * @return settings::SettingsInstance&
+ */
+settings::SettingsInstance &Engine::getSettings() { return _settings; }
+
 /**
  * @brief get the pointer to the force field
  *
@@ -266,6 +273,16 @@ TimingsOutput &Engine::getTimingsOutput()
     return _engineOutput.getTimingsOutput();
 }
 
+/**
+ * @brief get the TimingsTraceOutput
+ *
+ * @return TimingsTraceOutput&
+ */
+TimingsTraceOutput &Engine::getTimingsTraceOutput()
+{
+    return _engineOutput.getTimingsTraceOutput();
+}
+
 /**
  * @brief get the reference to the energy output
  *
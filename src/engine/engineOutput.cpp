@@ -22,12 +22,18 @@
 
 #include "engineOutput.hpp"
 
+#include "box.hpp"
 #include "boxOutput.hpp"
+#include "checkpointFileOutput.hpp"
 #include "energyOutput.hpp"
 #include "infoOutput.hpp"
+#include "integrator.hpp"
 #include "logOutput.hpp"
+#include "manostat.hpp"
 #include "momentumOutput.hpp"
+#include "observableOutput.hpp"
 #include "optOutput.hpp"
+#include "outputFileSettings.hpp"
 #include "ringPolymerEnergyOutput.hpp"
 #include "ringPolymerRestartFileOutput.hpp"
 #include "ringPolymerTrajectoryOutput.hpp"
@@ -36,6 +42,7 @@
 #include "stressOutput.hpp"
 #include "thermostat.hpp"
 #include "timingsOutput.hpp"
+#include "timingsTraceOutput.hpp"
 #include "trajectoryOutput.hpp"
 #include "virialOutput.hpp"
 
@@ -53,6 +60,8 @@ using namespace output;
 using namespace simulationBox;
 using namespace physicalData;
 using namespace thermostat;
+using namespace manostat;
+using namespace integrator;
 
 using std::make_unique;
 
@@ -77,6 +86,9 @@ EngineOutput::EngineOutput()
     _boxFileOutput       = make_unique<BoxFileOutput>("default.box");
     _optOutput           = make_unique<OptOutput>("default.opt");
 
+    _checkpointFileOutput = make_unique<CheckpointFileOutput>("default.chk");
+    _observableOutput     = make_unique<ObservableOutput>("default.obs");
+
     _rpmdRstFileOutput = make_unique<pq::RPMDRstFileOutput>("default.rpmd.rst");
     _rpmdXyzOutput     = make_unique<pq::RPMDTrajOutput>("default.rpmd.xyz");
     _rpmdVelOutput     = make_unique<pq::RPMDTrajOutput>("default.rpmd.vel");
@@ -84,7 +96,8 @@ EngineOutput::EngineOutput()
     _rpmdChargeOutput  = make_unique<pq::RPMDTrajOutput>("default.rpmd.chg");
     _rpmdEnergyOutput  = make_unique<pq::RPMDEnergyOutput>("default.rpmd.en");
 
-    _timingsOutput = make_unique<TimingsOutput>("default.timings");
+    _timingsOutput      = make_unique<TimingsOutput>("default.timings");
+    _timingsTraceOutput = make_unique<TimingsTraceOutput>("default.trace.json");
 }
 
 /**
@@ -98,9 +111,9 @@ void EngineOutput::writeEnergyFile(
     const PhysicalData &physicalData
 )
 {
-    startTimingsSection("EnergyOutput");
+    startTimingsSection<"EnergyOutput">();
     _energyOutput->write(step, physicalData);
-    stopTimingsSection("EnergyOutput");
+    stopTimingsSection<"EnergyOutput">();
 }
 
 /**
@@ -114,9 +127,9 @@ void EngineOutput::writeInstantEnergyFile(
     const PhysicalData &physicalData
 )
 {
-    startTimingsSection("InstantEnergyOutput");
+    startTimingsSection<"InstantEnergyOutput">();
     _instantEnergyOutput->write(step, physicalData);
-    stopTimingsSection("InstantEnergyOutput");
+    stopTimingsSection<"InstantEnergyOutput">();
 }
 
 /**
@@ -130,9 +143,9 @@ void EngineOutput::writeMomentumFile(
     const PhysicalData &physicalData
 )
 {
-    startTimingsSection("MomentumOutput");
+    startTimingsSection<"MomentumOutput">();
     _momentumOutput->write(step, physicalData);
-    stopTimingsSection("MomentumOutput");
+    stopTimingsSection<"MomentumOutput">();
 }
 
 /**
@@ -142,9 +155,9 @@ void EngineOutput::writeMomentumFile(
  */
 void EngineOutput::writeXyzFile(SimulationBox &simulationBox)
 {
-    startTimingsSection("TrajectoryOutput");
+    startTimingsSection<"TrajectoryOutput">();
     _xyzOutput->writeXyz(simulationBox);
-    stopTimingsSection("TrajectoryOutput");
+    stopTimingsSection<"TrajectoryOutput">();
 }
 
 /**
@@ -154,9 +167,9 @@ void EngineOutput::writeXyzFile(SimulationBox &simulationBox)
  */
 void EngineOutput::writeVelFile(SimulationBox &simulationBox)
 {
-    startTimingsSection("TrajectoryOutput");
+    startTimingsSection<"TrajectoryOutput">();
     _velOutput->writeVelocities(simulationBox);
-    stopTimingsSection("TrajectoryOutput");
+    stopTimingsSection<"TrajectoryOutput">();
 }
 
 /**
@@ -166,9 +179,9 @@ void EngineOutput::writeVelFile(SimulationBox &simulationBox)
  */
 void EngineOutput::writeForceFile(SimulationBox &simulationBox)
 {
-    startTimingsSection("TrajectoryOutput");
+    startTimingsSection<"TrajectoryOutput">();
     _forceOutput->writeForces(simulationBox);
-    stopTimingsSection("TrajectoryOutput");
+    stopTimingsSection<"TrajectoryOutput">();
 }
 
 /**
@@ -178,9 +191,9 @@ void EngineOutput::writeForceFile(SimulationBox &simulationBox)
  */
 void EngineOutput::writeChargeFile(SimulationBox &simulationBox)
 {
-    startTimingsSection("TrajectoryOutput");
+    startTimingsSection<"TrajectoryOutput">();
     _chargeOutput->writeCharges(simulationBox);
-    stopTimingsSection("TrajectoryOutput");
+    stopTimingsSection<"TrajectoryOutput">();
 }
 
 /**
@@ -194,9 +207,9 @@ void EngineOutput::writeInfoFile(
     const PhysicalData &physicalData
 )
 {
-    startTimingsSection("InfoOutput");
+    startTimingsSection<"InfoOutput">();
     _infoOutput->write(time, physicalData);
-    stopTimingsSection("InfoOutput");
+    stopTimingsSection<"InfoOutput">();
 }
 
 /**
@@ -211,9 +224,9 @@ void EngineOutput::writeRstFile(
     const size_t      step
 )
 {
-    startTimingsSection("RstFileOutput");
+    startTimingsSection<"RstFileOutput">();
     _rstFileOutput->write(simulationBox, thermostat, step);
-    stopTimingsSection("RstFileOutput");
+    stopTimingsSection<"RstFileOutput">();
 }
 
 /**
@@ -227,9 +240,34 @@ void EngineOutput::writeOptRstFile(
     const size_t   step
 )
 {
-    startTimingsSection("RstFileOutput");
+    startTimingsSection<"RstFileOutput">();
     _rstFileOutput->write(simulationBox, Thermostat(), step);
-    stopTimingsSection("RstFileOutput");
+    stopTimingsSection<"RstFileOutput">();
+}
+
+/**
+ * @brief wrapper for binary checkpoint file output function
+ *
+ * @param simulationBox
+ * @param thermostat
+ * @param manostat
+ * @param integrator
+ * @param step
+ */
+void EngineOutput::writeCheckpointFile(
+    SimulationBox    &simulationBox,
+    const Thermostat &thermostat,
+    const Manostat   &manostat,
+    const Integrator &integrator,
+    const size_t      step
+)
+{
+    startTimingsSection<"CheckpointFileOutput">();
+
+    _checkpointFileOutput
+        ->write(simulationBox, thermostat, manostat, integrator, step);
+
+    stopTimingsSection<"CheckpointFileOutput">();
 }
 
 /**
@@ -243,9 +281,9 @@ void EngineOutput::writeVirialFile(
     const PhysicalData &physicalData
 )
 {
-    startTimingsSection("VirialOutput");
+    startTimingsSection<"VirialOutput">();
     _virialOutput->write(step, physicalData);
-    stopTimingsSection("VirialOutput");
+    stopTimingsSection<"VirialOutput">();
 }
 
 /**
@@ -259,9 +297,9 @@ void EngineOutput::writeStressFile(
     const PhysicalData &physicalData
 )
 {
-    startTimingsSection("StressOutput");
+    startTimingsSection<"StressOutput">();
     _stressOutput->write(step, physicalData);
-    stopTimingsSection("StressOutput");
+    stopTimingsSection<"StressOutput">();
 }
 
 /**
@@ -272,9 +310,36 @@ void EngineOutput::writeStressFile(
  */
 void EngineOutput::writeBoxFile(const size_t step, const Box &simulationBox)
 {
-    startTimingsSection("BoxFileOutput");
+    startTimingsSection<"BoxFileOutput">();
     _boxFileOutput->write(step, simulationBox);
-    stopTimingsSection("BoxFileOutput");
+    stopTimingsSection<"BoxFileOutput">();
+}
+
+/**
+ * @brief wrapper for recording the observables into the binary observable
+ * file
+ *
+ * @param step
+ * @param physicalData
+ * @param averagePhysicalData
+ * @param box
+ */
+void EngineOutput::recordObservables(
+    const size_t        step,
+    const PhysicalData &physicalData,
+    const PhysicalData &averagePhysicalData,
+    const Box          &box
+)
+{
+    startTimingsSection<"ObservableOutput">();
+    _observableOutput->record(
+        step,
+        physicalData,
+        averagePhysicalData,
+        box.getBoxDimensions(),
+        box.getBoxAngles()
+    );
+    stopTimingsSection<"ObservableOutput">();
 }
 
 /**
@@ -288,9 +353,9 @@ void EngineOutput::writeOptFile(
     const pq::Optimizer &optimizer
 )
 {
-    startTimingsSection("OptOutput");
+    startTimingsSection<"OptOutput">();
     _optOutput->write(step, optimizer);
-    stopTimingsSection("OptOutput");
+    stopTimingsSection<"OptOutput">();
 }
 
 /**
@@ -304,9 +369,9 @@ void EngineOutput::writeRingPolymerRstFile(
     const size_t                step
 )
 {
-    startTimingsSection("RingPolymerRestartFileOutput");
+    startTimingsSection<"RingPolymerRestartFileOutput">();
     _rpmdRstFileOutput->write(beads, step);
-    stopTimingsSection("RingPolymerRestartFileOutput");
+    stopTimingsSection<"RingPolymerRestartFileOutput">();
 }
 
 /**
@@ -316,9 +381,9 @@ void EngineOutput::writeRingPolymerRstFile(
  */
 void EngineOutput::writeRingPolymerXyzFile(std::vector<SimulationBox> &beads)
 {
-    startTimingsSection("RingPolymerTrajectoryOutput");
+    startTimingsSection<"RingPolymerTrajectoryOutput">();
     _rpmdXyzOutput->writeXyz(beads);
-    stopTimingsSection("RingPolymerTrajectoryOutput");
+    stopTimingsSection<"RingPolymerTrajectoryOutput">();
 }
 
 /**
@@ -328,9 +393,9 @@ void EngineOutput::writeRingPolymerXyzFile(std::vector<SimulationBox> &beads)
  */
 void EngineOutput::writeRingPolymerVelFile(std::vector<SimulationBox> &beads)
 {
-    startTimingsSection("RingPolymerTrajectoryOutput");
+    startTimingsSection<"RingPolymerTrajectoryOutput">();
     _rpmdVelOutput->writeVelocities(beads);
-    stopTimingsSection("RingPolymerTrajectoryOutput");
+    stopTimingsSection<"RingPolymerTrajectoryOutput">();
 }
 
 /**
@@ -340,9 +405,9 @@ void EngineOutput::writeRingPolymerVelFile(std::vector<SimulationBox> &beads)
  */
 void EngineOutput::writeRingPolymerForceFile(std::vector<SimulationBox> &beads)
 {
-    startTimingsSection("RingPolymerTrajectoryOutput");
+    startTimingsSection<"RingPolymerTrajectoryOutput">();
     _rpmdForceOutput->writeForces(beads);
-    stopTimingsSection("RingPolymerTrajectoryOutput");
+    stopTimingsSection<"RingPolymerTrajectoryOutput">();
 }
 
 /**
@@ -352,9 +417,9 @@ void EngineOutput::writeRingPolymerForceFile(std::vector<SimulationBox> &beads)
  */
 void EngineOutput::writeRingPolymerChargeFile(std::vector<SimulationBox> &beads)
 {
-    startTimingsSection("RingPolymerTrajectoryOutput");
+    startTimingsSection<"RingPolymerTrajectoryOutput">();
     _rpmdChargeOutput->writeCharges(beads);
-    stopTimingsSection("RingPolymerTrajectoryOutput");
+    stopTimingsSection<"RingPolymerTrajectoryOutput">();
 }
 
 /**
@@ -368,22 +433,29 @@ void EngineOutput::writeRingPolymerEnergyFile(
     const std::vector<PhysicalData> &dataVector
 )
 {
-    startTimingsSection("RingPolymerEnergyOutput");
+    startTimingsSection<"RingPolymerEnergyOutput">();
     _rpmdEnergyOutput->write(step, dataVector);
-    stopTimingsSection("RingPolymerEnergyOutput");
+    stopTimingsSection<"RingPolymerEnergyOutput">();
 }
 
 /**
  * @brief wrapper for timings file output function
  *
  * @param timer
+ * @param nAtoms number of atoms of the simulation box
  */
-void EngineOutput::writeTimingsFile(timings::GlobalTimer &timer)
+void EngineOutput::writeTimingsFile(
+    timings::GlobalTimer &timer,
+    const size_t          nAtoms
+)
 {
     // NOTE:
     // here is no timer applied, since the timings file is written at the end of
     // the simulation
-    _timingsOutput->write(timer);
+    _timingsOutput->write(timer, nAtoms);
+
+    if (settings::OutputFileSettings::isTimingsTraceOutput())
+        _timingsTraceOutput->write(timer);
 }
 
 /***************************
@@ -493,6 +565,26 @@ StressOutput &EngineOutput::getStressOutput() { return *_stressOutput; }
  */
 BoxFileOutput &EngineOutput::getBoxFileOutput() { return *_boxFileOutput; }
 
+/**
+ * @brief getter for binary checkpoint file output
+ *
+ * @return CheckpointFileOutput
+ */
+CheckpointFileOutput &EngineOutput::getCheckpointFileOutput()
+{
+    return *_checkpointFileOutput;
+}
+
+/**
+ * @brief getter for binary observable file output
+ *
+ * @return ObservableOutput
+ */
+ObservableOutput &EngineOutput::getObservableOutput()
+{
+    return *_observableOutput;
+}
+
 /**
  * @brief getter for optimizer output
  *
@@ -565,4 +657,14 @@ RingPolymerEnergyOutput &EngineOutput::getRingPolymerEnergyOutput()
  *
  * @return TimingsOutput
  */
-TimingsOutput &EngineOutput::getTimingsOutput() { return *_timingsOutput; }
\ No newline at end of file
+TimingsOutput &EngineOutput::getTimingsOutput() { return *_timingsOutput; }
+
+/**
+ * @brief getter for timings trace output
+ *
+ * @return TimingsTraceOutput
+ */
+TimingsTraceOutput &EngineOutput::getTimingsTraceOutput()
+{
+    return *_timingsTraceOutput;
+}
\ No newline at end of file
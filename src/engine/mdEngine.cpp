@@ -22,16 +22,22 @@
 
 #include "mdEngine.hpp"
 
-#include "constants/conversionFactors.hpp"   // for _FS_TO_PS_
-#include "logOutput.hpp"                     // for LogOutput
-#include "outputFileSettings.hpp"            // for OutputFileSettings
-#include "progressbar.hpp"                   // for progressbar
-#include "qmmdEngine.hpp"                    // for QMMDEngine
-#include "referencesOutput.hpp"              // for ReferencesOutput
-#include "settings.hpp"                      // for Settings
-#include "stdoutOutput.hpp"                  // for StdoutOutput
-#include "timingsSettings.hpp"               // for TimingsSettings
-#include "vector3d.hpp"                      // for norm
+#include "baoab.hpp"                                 // for BAOAB
+#include "constants/conversionFactors.hpp"           // for _FS_TO_PS_
+#include "constants/internalConversionFactors.hpp"   // for _TEMPERATURE_FACTOR_
+#include "langevinThermostat.hpp"                    // for LangevinThermostat
+#include "logOutput.hpp"                             // for LogOutput
+#include "manostatSettings.hpp"                      // for ManostatType
+#include "outputFileSettings.hpp"                    // for OutputFileSettings
+#include "progressbar.hpp"                           // for progressbar
+#include "qmmdEngine.hpp"                            // for QMMDEngine
+#include "referencesOutput.hpp"                      // for ReferencesOutput
+#include "settings.hpp"                              // for Settings
+#include "settingsInstance.hpp"                      // for SettingsScope
+#include "stdoutOutput.hpp"                          // for StdoutOutput
+#include "thermostatSettings.hpp"                    // for ThermostatType
+#include "timingsSettings.hpp"                       // for TimingsSettings
+#include "vector3d.hpp"                              // for norm
 
 using namespace engine;
 using namespace output;
@@ -42,16 +48,15 @@ using namespace physicalData;
 /**
  * @brief Run the simulation for numberOfSteps steps.
  *
+ * @details the settings of the engine are bound to the calling thread for
+ * the whole run
  */
 void MDEngine::run()
 {
-    _physicalData->calculateKinetics(getSimulationBox());
+    const SettingsScope settingsScope(_settings);
 
-    _engineOutput.getLogOutput().writeInitialMomentum(
-        norm(_physicalData->getMomentum())
-    );
+    startRun();
 
-    _nSteps = TimingsSettings::getNumberOfSteps();
     progressbar bar(static_cast<int>(_nSteps), true, std::cout);
 
     for (; _step <= _nSteps; ++_step)
@@ -62,6 +67,47 @@ void MDEngine::run()
         writeOutput();
     }
 
+    finishRun();
+}
+
+/**
+ * @brief prepares the engine for the MD loop
+ *
+ * @details calculates the initial kinetics, sets the number of steps and
+ * starts the asynchronous output thread if requested. The settings of the
+ * engine have to be bound to the calling thread.
+ */
+void MDEngine::startRun()
+{
+    _physicalData->calculateKinetics(getSimulationBox());
+
+    _engineOutput.getLogOutput().writeInitialMomentum(
+        norm(_physicalData->getMomentum())
+    );
+
+    _nSteps = TimingsSettings::getNumberOfSteps();
+
+    _isFusedUpdate = canFuseUpdate();
+
+    if (OutputFileSettings::isAsyncOutput())
+        _outputThread = std::make_unique<OutputThread>(_engineOutput);
+}
+
+/**
+ * @brief finishes the MD loop
+ *
+ * @details flushes the pending output, collects all timers and writes the
+ * references and timings files. The settings of the engine have to be bound
+ * to the calling thread.
+ */
+void MDEngine::finishRun()
+{
+    if (_outputThread)
+        _outputThread->flush();
+
+    if (OutputFileSettings::isObservableOutput())
+        _engineOutput.getObservableOutput().flush();
+
     _timer.stopSimulationTimer();
 
     const auto elapsedTime = double(_timer.calculateElapsedTime()) * 1e-3;
@@ -69,6 +115,13 @@ void MDEngine::run()
     _engineOutput.setTimerName("Output");
     _timer.addTimer(_engineOutput.getTimer());
 
+    if (_outputThread)
+    {
+        _outputThread->setTimerName("Output Thread");
+        _timer.addTimer(_outputThread->getTimer());
+        _outputThread.reset();
+    }
+
     _thermostat->setTimerName("Thermostat");
     _timer.addTimer(_thermostat->getTimer());
 
@@ -116,7 +169,10 @@ void MDEngine::run()
 
     references::ReferencesOutput::writeReferencesFile();
 
-    _engineOutput.writeTimingsFile(_timer);
+    _engineOutput.writeTimingsFile(
+        _timer,
+        _simulationBox->getNumberOfAtoms()
+    );
 
     _engineOutput.getLogOutput().writeEndedNormally(elapsedTime);
     _engineOutput.getStdoutOutput().writeEndedNormally(elapsedTime);
@@ -138,9 +194,14 @@ void MDEngine::takeStepBeforeForces()
 /**
  * @brief MD Loop after force calculation.
  *
+ * @details the kinetics and the virial are only evaluated on steps where they
+ * are required, see isKineticsRequired and isVirialRequired
  */
 void MDEngine::takeStepAfterForces()
 {
+    const auto isKineticsStep = isKineticsRequired();
+    const auto isVirialStep   = isVirialRequired();
+
     _constraints->applyDistanceConstraints(
         *_simulationBox,
         *_physicalData,
@@ -149,22 +210,39 @@ void MDEngine::takeStepAfterForces()
 
     _constraints->calculateConstraintBondRefs(*_simulationBox);
 
-    _virial->intraMolecularVirialCorrection(*_simulationBox, *_physicalData);
+    if (isVirialStep)
+        _virial->intraMolecularVirialCorrection(
+            *_simulationBox,
+            *_physicalData
+        );
 
     _thermostat->applyThermostatOnForces(*_simulationBox);
 
-    _integrator->secondStep(*_simulationBox);
+    if (_isFusedUpdate)
+        applyFusedUpdate(isKineticsStep);
+    else
+    {
+        _integrator->secondStep(*_simulationBox);
 
-    _constraints->applyRattle(*_simulationBox);
+        _constraints->applyRattle(*_simulationBox);
 
-    _thermostat->applyThermostat(*_simulationBox, *_physicalData);
+        _thermostat->applyThermostat(*_simulationBox, *_physicalData);
 
-    _physicalData->calculateKinetics(*_simulationBox);
+        if (isKineticsStep)
+            _physicalData->calculateKinetics(*_simulationBox);
+    }
 
-    _manostat->applyManostat(*_simulationBox, *_physicalData);
+    if (isVirialStep || !_manostat->isVirialBased())
+        _manostat->applyManostat(*_simulationBox, *_physicalData);
 
     _resetKinetics.reset(_step, *_physicalData, *_simulationBox);
 
+    if (!isKineticsStep)
+        _physicalData->skipKinetics();
+
+    if (!isVirialStep)
+        _physicalData->skipVirial();
+
     _thermostat->applyTemperatureRamping();
 
     if (Settings::isQMActivated())
@@ -173,6 +251,143 @@ void MDEngine::takeStepAfterForces()
     }
 }
 
+/**
+ * @brief checks if the update after the force calculation can be fused
+ *
+ * @details The second half step of the integrator, the thermostat and the
+ * calculation of the kinetics can be fused into a single pass over the atoms
+ * if the velocity update of each atom only depends on the atom itself. This
+ * is the case for the velocity verlet like integrators without rattle and
+ * without a thermostat or with the Langevin thermostat. All other thermostats
+ * need the temperature of the whole system before updating the velocities.
+ *
+ * @return true if the fused update can be used
+ */
+bool MDEngine::canFuseUpdate() const
+{
+    using enum ThermostatType;
+
+    const auto isVelocityVerlet =
+        dynamic_cast<const pq::VelocityVerlet *>(_integrator.get()) ||
+        dynamic_cast<const pq::BAOAB *>(_integrator.get());
+
+    if (!isVelocityVerlet || _constraints->isShakeLikeActive())
+        return false;
+
+    const auto thermostatType = _thermostat->getThermostatType();
+
+    return thermostatType == NONE || thermostatType == LANGEVIN;
+}
+
+/**
+ * @brief fused update after the force calculation
+ *
+ * @details integrates the velocities, applies the Langevin thermostat if
+ * active and accumulates the temperature and the kinetics in a single pass
+ * over the atoms. The results are identical to the separate updates.
+ *
+ * @param calculateKinetics if false only the temperature is accumulated
+ */
+void MDEngine::applyFusedUpdate(const bool calculateKinetics)
+{
+    using thermostat::LangevinThermostat;
+
+    auto *langevin = dynamic_cast<LangevinThermostat *>(_thermostat.get());
+
+    const auto timeStep    = TimingsSettings::getTimeStep();
+    auto       temperature = 0.0;
+
+    auto updateAtom = [this, langevin, timeStep, &temperature](
+                          pq::Atom    &atom,
+                          const size_t index
+                      )
+    {
+        _integrator->integrateVelocities(&atom);
+
+        if (langevin)
+            langevin->applyLangevin(atom, index, timeStep);
+
+        temperature += atom.getMass() * normSquared(atom.getVelocity());
+    };
+
+    if (calculateKinetics)
+        _physicalData->calculateKinetics(*_simulationBox, updateAtom);
+    else
+    {
+        const auto &atoms = _simulationBox->getAtoms();
+
+        for (size_t i = 0; i < atoms.size(); ++i)
+            updateAtom(*atoms[i], i);
+    }
+
+    if (langevin)
+        langevin->advanceRandom();
+
+    const auto dof = double(_simulationBox->getDegreesOfFreedom());
+
+    _physicalData->setTemperature(temperature * _TEMPERATURE_FACTOR_ / dof);
+}
+
+/**
+ * @brief checks if the current step is an output step
+ *
+ * @return true if the step is a multiple of the output frequency
+ */
+bool MDEngine::isOutputStep() const
+{
+    return 0 == _step % OutputFileSettings::getOutputFrequency();
+}
+
+/**
+ * @brief checks if the kinetics have to be calculated in the current step
+ *
+ * @details the kinetic energy and momentum tensors and the angular momentum
+ * are needed in every step by a virial based manostat, on reset steps by the
+ * reset kinetics and on output steps
+ *
+ * @return true if the kinetics are required
+ */
+bool MDEngine::isKineticsRequired() const
+{
+    if (isManostatVirialBased())
+        return true;
+
+    return isOutputStep() || _resetKinetics.isResetStep(_step);
+}
+
+/**
+ * @brief checks if the virial has to be calculated in the current step
+ *
+ * @details the virial is needed in every step by a virial based manostat and
+ * otherwise only on output steps. If it is not required the shift forces and
+ * the virial corrections are skipped.
+ *
+ * @return true if the virial is required
+ */
+bool MDEngine::isVirialRequired() const
+{
+    if (isManostatVirialBased())
+        return true;
+
+    return isOutputStep();
+}
+
+/**
+ * @brief checks if a pressure coupling based on the virial is active
+ *
+ * @details the Monte Carlo manostat only needs energies, therefore the
+ * virial and the kinetics are not required in every step of its NPT runs
+ *
+ * @return true if the manostat needs the virial in every step
+ */
+bool MDEngine::isManostatVirialBased() const
+{
+    if (_manostat->getManostatType() == ManostatType::NONE)
+        return false;
+
+    return _manostat->isVirialBased();
+}
+
 /**
  * @brief Takes one step in the simulation.
  *
@@ -190,16 +405,21 @@ void MDEngine::takeStep()
  * @brief Writes output files.
  *
  * @details output files are written if the step is a multiple of the output
- * frequency.
+ * frequency. If the output thread is running, the frame is only captured
+ * here and written in the background. If the observable output is active,
+ * the energy, instant energy, momentum, virial, stress and box data is
+ * recorded into the binary observable file instead of the text files.
  *
  */
 void MDEngine::writeOutput()
 {
-    const auto outputFreq = OutputFileSettings::getOutputFrequency();
-    const auto step0      = TimingsSettings::getStepCount();
-    const auto effStep    = _step + step0;
+    const auto outputFreq   = OutputFileSettings::getOutputFrequency();
+    const auto step0        = TimingsSettings::getStepCount();
+    const auto effStep      = _step + step0;
+    const auto isOutput     = isOutputStep();
+    const auto isObsOutput  = OutputFileSettings::isObservableOutput();
 
-    if (0 == _step % outputFreq)
+    if (isOutput && !_outputThread)
     {
         _engineOutput.writeXyzFile(*_simulationBox);
         _engineOutput.writeVelFile(*_simulationBox);
@@ -207,17 +427,28 @@ void MDEngine::writeOutput()
         _engineOutput.writeChargeFile(*_simulationBox);
         _engineOutput.writeRstFile(*_simulationBox, *_thermostat, effStep);
 
-        _engineOutput.writeVirialFile(
-            effStep,
-            *_physicalData
-        );   // use physicalData instead of averagePhysicalData
+        _engineOutput.writeCheckpointFile(
+            *_simulationBox,
+            *_thermostat,
+            *_manostat,
+            *_integrator,
+            effStep
+        );
 
-        _engineOutput.writeStressFile(
-            effStep,
-            *_physicalData
-        );   // use physicalData instead of averagePhysicalData
+        if (!isObsOutput)
+        {
+            _engineOutput.writeVirialFile(
+                effStep,
+                *_physicalData
+            );   // use physicalData instead of averagePhysicalData
+
+            _engineOutput.writeStressFile(
+                effStep,
+                *_physicalData
+            );   // use physicalData instead of averagePhysicalData
 
-        _engineOutput.writeBoxFile(effStep, _simulationBox->getBox());
+            _engineOutput.writeBoxFile(effStep, _simulationBox->getBox());
+        }
     }
 
     // NOTE:
@@ -232,7 +463,7 @@ void MDEngine::writeOutput()
     _physicalData->setLoopTime(_timer.calculateLoopTime());
     _averagePhysicalData.updateAverages(*_physicalData);
 
-    if (0 == _step % outputFreq)
+    if (isOutput)
     {
         _averagePhysicalData.makeAverages(static_cast<double>(outputFreq));
 
@@ -240,10 +471,25 @@ void MDEngine::writeOutput()
         const auto effStepDouble = static_cast<double>(effStep);
         const auto simTime       = effStepDouble * dt * _FS_TO_PS_;
 
-        _engineOutput.writeEnergyFile(effStep, _averagePhysicalData);
-        _engineOutput.writeInstantEnergyFile(effStep, *_physicalData);
-        _engineOutput.writeInfoFile(simTime, _averagePhysicalData);
-        _engineOutput.writeMomentumFile(effStep, _averagePhysicalData);
+        if (_outputThread)
+            submitOutputFrame(effStep, simTime);
+        else if (isObsOutput)
+        {
+            _engineOutput.recordObservables(
+                effStep,
+                *_physicalData,
+                _averagePhysicalData,
+                _simulationBox->getBox()
+            );
+            _engineOutput.writeInfoFile(simTime, _averagePhysicalData);
+        }
+        else
+        {
+            _engineOutput.writeEnergyFile(effStep, _averagePhysicalData);
+            _engineOutput.writeInstantEnergyFile(effStep, *_physicalData);
+            _engineOutput.writeInfoFile(simTime, _averagePhysicalData);
+            _engineOutput.writeMomentumFile(effStep, _averagePhysicalData);
+        }
 
         _averagePhysicalData = PhysicalData();
     }
@@ -251,6 +497,35 @@ void MDEngine::writeOutput()
     _physicalData->reset();
 }
 
+/**
+ * @brief captures the current frame and hands it over to the output thread
+ *
+ * @details the simulation thread only pays for copying the frame, unless
+ * the output thread is still busy with both snapshot buffers
+ *
+ * @param effStep
+ * @param simTime
+ */
+void MDEngine::submitOutputFrame(const size_t effStep, const double simTime)
+{
+    _engineOutput.startTimingsSection<"FrameSnapshot">();
+
+    auto &snapshot = _outputThread->acquireSnapshot();
+
+    snapshot.setStep(effStep);
+    snapshot.setSimulationTime(simTime);
+    snapshot.captureSimulationBox(*_simulationBox);
+    snapshot.captureThermostat(*_thermostat);
+    snapshot.captureIntegrator(*_integrator);
+    snapshot.captureManostat(*_manostat);
+    snapshot.capturePhysicalData(*_physicalData);
+    snapshot.captureAveragePhysicalData(_averagePhysicalData);
+
+    _outputThread->submitSnapshot();
+
+    _engineOutput.stopTimingsSection<"FrameSnapshot">();
+}
+
 /**
  * @brief get the reference to the reset kinetics
  *
@@ -352,6 +627,26 @@ output::BoxFileOutput &MDEngine::getBoxFileOutput()
     return _engineOutput.getBoxFileOutput();
 }
 
+/**
+ * @brief get the reference to the binary checkpoint file output
+ *
+ * @return output::CheckpointFileOutput&
+ */
+output::CheckpointFileOutput &MDEngine::getCheckpointFileOutput()
+{
+    return _engineOutput.getCheckpointFileOutput();
+}
+
+/**
+ * @brief get the reference to the binary observable file output
+ *
+ * @return output::ObservableOutput&
+ */
+output::ObservableOutput &MDEngine::getObservableOutput()
+{
+    return _engineOutput.getObservableOutput();
+}
+
 /**
  * @brief get the reference to the ring polymer rst file output
  *
@@ -46,9 +46,21 @@ using namespace engine;
 /**
  * @brief calculate MM forces
  *
+ * @details the shift forces and the virial are only calculated if the virial
+ * is required in the current step. The Kokkos kernels always accumulate the
+ * shift forces, therefore the virial is always calculated in this case.
  */
 void MMMDEngine::calculateForces()
 {
+#ifdef WITH_KOKKOS
+    const auto isVirialStep = true;
+#else
+    const auto isVirialStep = isVirialRequired();
+#endif
+
+    _potential->setComputeShiftForces(isVirialStep);
+    _intraNonBonded->setComputeShiftForces(isVirialStep);
+
     _cellList->updateCellList(*_simulationBox);
 
 #ifdef WITH_KOKKOS
@@ -65,7 +77,8 @@ void MMMDEngine::calculateForces()
 
     _intraNonBonded->calculate(*_simulationBox, *_physicalData);
 
-    _virial->calculateVirial(*_simulationBox, *_physicalData);
+    if (isVirialStep)
+        _virial->calculateVirial(*_simulationBox, *_physicalData);
 
     _forceField->calculateBondedInteractions(*_simulationBox, *_physicalData);
 }
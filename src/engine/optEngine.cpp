@@ -29,6 +29,7 @@
 #include "outputFileSettings.hpp"
 #include "progressbar.hpp"
 #include "settings.hpp"
+#include "settingsInstance.hpp"
 #include "stdoutOutput.hpp"
 #include "timingsSettings.hpp"
 
@@ -38,9 +39,14 @@ using namespace physicalData;
 
 /**
  * @brief run the optimizer
+ *
+ * @details the settings of the engine are bound to the calling thread for
+ * the whole run
  */
 void OptEngine::run()
 {
+    const settings::SettingsScope settingsScope(_settings);
+
     _evaluator->evaluate();
     _optimizer->updateHistory();
 
@@ -109,7 +115,10 @@ void OptEngine::run()
     _physicalData->setTimerName("Physical Data");
     _timer.addTimer(_physicalData->getTimer());
 
-    _engineOutput.writeTimingsFile(_timer);
+    _engineOutput.writeTimingsFile(
+        _timer,
+        _simulationBox->getNumberOfAtoms()
+    );
 
     if (_converged)
     {
@@ -131,7 +140,8 @@ void OptEngine::takeStep()
 {
     _optimizer->update(_learningRateStrategy->getLearningRate(), _step);
 
-    _evaluator->evaluate();
+    if (!_optimizer->evaluatesInUpdate())
+        _evaluator->evaluate();
 
     _optimizer->updateHistory();
 
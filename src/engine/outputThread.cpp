@@ -0,0 +1,289 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "outputThread.hpp"
+
+#include "boxOutput.hpp"              // for BoxFileOutput
+#include "checkpointFileOutput.hpp"   // for CheckpointFileOutput
+#include "energyOutput.hpp"           // for EnergyOutput
+#include "engineOutput.hpp"           // for EngineOutput
+#include "infoOutput.hpp"             // for InfoOutput
+#include "momentumOutput.hpp"         // for MomentumOutput
+#include "observableOutput.hpp"       // for ObservableOutput
+#include "outputFileSettings.hpp"     // for OutputFileSettings
+#include "rstFileOutput.hpp"          // for RstFileOutput
+#include "settingsInstance.hpp"       // for SettingsInstance, SettingsScope
+#include "stressOutput.hpp"           // for StressOutput
+#include "trajectoryOutput.hpp"       // for TrajectoryOutput
+#include "virialOutput.hpp"           // for VirialOutput
+
+using namespace engine;
+using namespace output;
+using namespace settings;
+
+/**
+ * @brief Construct a new Output Thread object and start the writer thread
+ *
+ * @param engineOutput
+ */
+OutputThread::OutputThread(EngineOutput &engineOutput)
+    : timings::Timer("OutputThread"),
+      _engineOutput(engineOutput),
+      _settings(SettingsInstance::getActive())
+{
+    for (size_t i = 0; i < _N_BUFFERS_; ++i) _freeBuffers.push_back(i);
+
+    _thread = std::thread(&OutputThread::run, this);
+}
+
+/**
+ * @brief Destroy the Output Thread object
+ *
+ * @details all pending frames are written before the writer thread is
+ * joined
+ */
+OutputThread::~OutputThread()
+{
+    {
+        std::lock_guard lock(_mutex);
+        _stop = true;
+    }
+
+    _condition.notify_all();
+
+    if (_thread.joinable())
+        _thread.join();
+}
+
+/**
+ * @brief get a free snapshot buffer to capture the next frame
+ *
+ * @details blocks while both buffers are still pending (back-pressure)
+ *
+ * @return FrameSnapshot&
+ *
+ * @throws the exception of the writer thread if writing a previous frame
+ * failed
+ */
+FrameSnapshot &OutputThread::acquireSnapshot()
+{
+    std::unique_lock lock(_mutex);
+
+    _condition.wait(
+        lock,
+        [this] { return !_freeBuffers.empty() || _exception; }
+    );
+
+    rethrowException();
+
+    _acquiredBuffer = _freeBuffers.back();
+    _freeBuffers.pop_back();
+
+    return _snapshots[_acquiredBuffer];
+}
+
+/**
+ * @brief hands the acquired snapshot over to the writer thread
+ *
+ */
+void OutputThread::submitSnapshot()
+{
+    {
+        std::lock_guard lock(_mutex);
+        _pendingBuffers.push(_acquiredBuffer);
+        _acquiredBuffer = _N_BUFFERS_;
+    }
+
+    _condition.notify_all();
+}
+
+/**
+ * @brief blocks until all submitted frames are written
+ *
+ * @throws the exception of the writer thread if writing a frame failed
+ */
+void OutputThread::flush()
+{
+    std::unique_lock lock(_mutex);
+
+    _condition.wait(
+        lock,
+        [this] { return (_pendingBuffers.empty() && !_isBusy) || _exception; }
+    );
+
+    rethrowException();
+}
+
+/**
+ * @brief rethrows the exception of the writer thread
+ *
+ * @details the exception is only rethrown once, has to be called with the
+ * mutex locked
+ */
+void OutputThread::rethrowException()
+{
+    if (!_exception)
+        return;
+
+    auto exception = _exception;
+    _exception     = nullptr;
+
+    std::rethrow_exception(exception);
+}
+
+/**
+ * @brief main loop of the writer thread
+ *
+ * @details after an exception the writer thread discards all further frames
+ * until the exception has been rethrown on the simulation thread. The
+ * settings instance of the simulation thread is bound for the whole loop.
+ */
+void OutputThread::run()
+{
+    const SettingsScope settingsScope(_settings);
+
+    while (true)
+    {
+        size_t buffer      = 0;
+        bool   shouldWrite = false;
+
+        {
+            std::unique_lock lock(_mutex);
+
+            _condition.wait(
+                lock,
+                [this] { return !_pendingBuffers.empty() || _stop; }
+            );
+
+            if (_pendingBuffers.empty())
+                return;
+
+            buffer = _pendingBuffers.front();
+            _pendingBuffers.pop();
+            shouldWrite = !_exception;
+            _isBusy     = true;
+        }
+
+        if (shouldWrite)
+        {
+            try
+            {
+                writeFrame(_snapshots[buffer]);
+            }
+            catch (...)
+            {
+                std::lock_guard lock(_mutex);
+                _exception = std::current_exception();
+            }
+        }
+
+        {
+            std::lock_guard lock(_mutex);
+            _freeBuffers.push_back(buffer);
+            _isBusy = false;
+        }
+
+        _condition.notify_all();
+    }
+}
+
+/**
+ * @brief writes all output files of one frame
+ *
+ * @details the files are the same as written by MDEngine::writeOutput on the
+ * simulation thread. If the observable output is active, the energy,
+ * momentum, virial, stress and box data is only recorded.
+ *
+ * @param snapshot
+ */
+void OutputThread::writeFrame(const FrameSnapshot &snapshot)
+{
+    const auto  step         = snapshot.getStep();
+    const auto &physicalData = snapshot.getPhysicalData();
+    const auto &averageData  = snapshot.getAveragePhysicalData();
+
+    startTimingsSection<"TrajectoryOutput">();
+    _engineOutput.getXyzOutput().writeXyz(snapshot);
+    _engineOutput.getVelOutput().writeVelocities(snapshot);
+    _engineOutput.getForceOutput().writeForces(snapshot);
+    _engineOutput.getChargeOutput().writeCharges(snapshot);
+    stopTimingsSection<"TrajectoryOutput">();
+
+    startTimingsSection<"RstFileOutput">();
+    _engineOutput.getRstFileOutput().write(snapshot);
+    stopTimingsSection<"RstFileOutput">();
+
+    startTimingsSection<"CheckpointFileOutput">();
+    _engineOutput.getCheckpointFileOutput().write(snapshot);
+    stopTimingsSection<"CheckpointFileOutput">();
+
+    startTimingsSection<"InfoOutput">();
+    _engineOutput.getInfoOutput().write(
+        snapshot.getSimulationTime(),
+        averageData
+    );
+    stopTimingsSection<"InfoOutput">();
+
+    if (OutputFileSettings::isObservableOutput())
+    {
+        startTimingsSection<"ObservableOutput">();
+        _engineOutput.getObservableOutput().record(
+            step,
+            physicalData,
+            averageData,
+            snapshot.getBoxDimensions(),
+            snapshot.getBoxAngles()
+        );
+        stopTimingsSection<"ObservableOutput">();
+
+        return;
+    }
+
+    startTimingsSection<"VirialOutput">();
+    _engineOutput.getVirialOutput().write(step, physicalData);
+    stopTimingsSection<"VirialOutput">();
+
+    startTimingsSection<"StressOutput">();
+    _engineOutput.getStressOutput().write(step, physicalData);
+    stopTimingsSection<"StressOutput">();
+
+    startTimingsSection<"BoxFileOutput">();
+    _engineOutput.getBoxFileOutput().write(
+        step,
+        snapshot.getBoxDimensions(),
+        snapshot.getBoxAngles()
+    );
+    stopTimingsSection<"BoxFileOutput">();
+
+    startTimingsSection<"EnergyOutput">();
+    _engineOutput.getEnergyOutput().write(step, averageData);
+    stopTimingsSection<"EnergyOutput">();
+
+    startTimingsSection<"InstantEnergyOutput">();
+    _engineOutput.getInstantEnergyOutput().write(step, physicalData);
+    stopTimingsSection<"InstantEnergyOutput">();
+
+    startTimingsSection<"MomentumOutput">();
+    _engineOutput.getMomentumOutput().write(step, averageData);
+    stopTimingsSection<"MomentumOutput">();
+}
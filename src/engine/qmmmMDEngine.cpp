@@ -20,4 +20,416 @@
 <GPL_HEADER>
 ******************************************************************************/
 
-#include "qmmmMDEngine.hpp"
\ No newline at end of file
+#include "qmmmMDEngine.hpp"
+
+#include <algorithm>       // for ranges::any_of
+#include <cstddef>         // for size_t
+#include <unordered_map>   // for unordered_map
+
+#include "atom.hpp"              // for Atom
+#include "forceFieldClass.hpp"   // for ForceField
+#include "hybridSettings.hpp"    // for HybridSettings
+#include "intraNonBonded.hpp"    // for IntraNonBonded
+#include "molecule.hpp"          // for Molecule
+#include "physicalData.hpp"      // for PhysicalData
+#include "potential.hpp"         // for Potential, PairInteraction
+#include "qmRunner.hpp"          // for QMRunner
+#include "simulationBox.hpp"     // for SimulationBox
+#include "vector3d.hpp"          // for Vec3D, norm, normSquared
+
+using engine::QMMMMDEngine;
+using namespace settings;
+using namespace simulationBox;
+using namespace physicalData;
+using namespace linearAlgebra;
+
+/**
+ * @brief calculate QM/MM forces
+ *
+ * @details The MM forces are calculated for the whole system. Afterwards the
+ * QM region is selected around the current QM center and the QM runner is
+ * executed only for the atoms of the QM region, embedded in the point charges
+ * of the MM atoms within the layer radius. The MM coupling between the QM and
+ * the MM atoms, which is not part of the QM calculation, is added to the QM
+ * forces and the inter molecular MM energies replaced by the QM energy are
+ * removed (see calculateCouplingForces). The bonded and intra molecular MM
+ * energies of the QM molecules are removed weighted with their smoothing
+ * factor (see subtractIntraEnergies). MM atoms keep their MM forces, while
+ * the forces of the QM atoms are blended from QM and MM forces (see
+ * mixForces). The forces of the QM atoms are therefore no longer pairwise
+ * antisymmetric and the total energy of the system is not strictly conserved.
+ */
+void QMMMMDEngine::calculateForces()
+{
+    MMMDEngine::calculateForces();
+
+    _simulationBox->calculateCenterOfMassMolecules();
+    const auto qmCenter = _simulationBox->calculateQMCenter();
+
+    updateQMRegion(qmCenter);
+    updatePointCharges(qmCenter);
+    calculateCouplingForces(qmCenter);
+    subtractIntraEnergies();
+
+    if (_simulationBox->getQMAtoms().empty())
+        _physicalData->setQMEnergy(0.0);
+    else
+        _qmRunner->run(*_simulationBox, *_physicalData);
+
+    mixForces();
+}
+
+/**
+ * @brief select the atoms of the QM region
+ *
+ * @details A molecule is treated with QM if the distance of its center of mass
+ * to the QM center is smaller than the core radius. Molecules containing QM
+ * only atoms are always part of the QM region and molecules containing MM only
+ * atoms never. For each QM atom the smoothing factor of its molecule and its
+ * current MM force are stored. If the atoms of the QM region change, the QM
+ * runner is notified in order to set up the QM program again.
+ *
+ * The QM runner gets the positions of the QM atoms in the periodic image of
+ * the QM region, i.e. each QM molecule is shifted to the image of its center
+ * of mass closest to the QM center and its atoms to the image closest to the
+ * center of mass. Thereby the QM region is not split at the box boundary and
+ * has the same geometry as the point charges (see updatePointCharges).
+ *
+ * @param qmCenter
+ */
+void QMMMMDEngine::updateQMRegion(const Vec3D &qmCenter)
+{
+    const auto coreRadius = HybridSettings::getCoreRadius();
+
+    auto &qmAtoms = _simulationBox->getQMAtoms();
+
+    pq::Vec3DVec qmPositions;
+
+    qmAtoms.clear();
+    _smoothingFactors.clear();
+    _mmForcesQMAtoms.clear();
+    _couplingForces.clear();
+    _isQMMolecule.assign(_simulationBox->getNumberOfMolecules(), false);
+
+    auto isQMOnly = [](const auto &atom) { return atom->isQMOnly(); };
+    auto isMMOnly = [](const auto &atom) { return atom->isMMOnly(); };
+
+    for (size_t i = 0; i < _isQMMolecule.size(); ++i)
+    {
+        auto &molecule = _simulationBox->getMolecule(i);
+        auto &atoms    = molecule.getAtoms();
+
+        const auto centerOfMass = molecule.getCenterOfMass();
+
+        auto dPos = centerOfMass - qmCenter;
+        dPos     -= _simulationBox->calcShiftVector(dPos);
+
+        auto smoothingFactor = 1.0;
+
+        if (!std::ranges::any_of(atoms, isQMOnly))
+        {
+            if (std::ranges::any_of(atoms, isMMOnly))
+                continue;
+
+            const auto distance = norm(dPos);
+
+            if (distance >= coreRadius)
+                continue;
+
+            smoothingFactor = calculateSmoothingFactor(distance);
+        }
+
+        _isQMMolecule[i] = true;
+
+        for (const auto &atom : atoms)
+        {
+            auto dAtom = atom->getPosition() - centerOfMass;
+            dAtom     -= _simulationBox->calcShiftVector(dAtom);
+
+            qmAtoms.push_back(atom);
+            qmPositions.push_back(qmCenter + dPos + dAtom);
+            _smoothingFactors.push_back(smoothingFactor);
+            _mmForcesQMAtoms.push_back(atom->getForce());
+            _couplingForces.emplace_back(0.0, 0.0, 0.0);
+        }
+    }
+
+    _qmRunner->setQMAtomPositions(qmPositions);
+    _qmRunner->setQMRegionChanged(qmAtoms != _previousQMAtoms);
+    _previousQMAtoms = qmAtoms;
+}
+
+/**
+ * @brief collect the MM point charges embedding the QM region
+ *
+ * @details all atoms outside of the QM region within the layer radius around
+ * the QM center are passed as point charges to the QM runner. The positions
+ * are shifted to the periodic image closest to the QM center. If the layer
+ * radius is zero no point charges are used (mechanical embedding).
+ *
+ * @param qmCenter
+ */
+void QMMMMDEngine::updatePointCharges(const Vec3D &qmCenter)
+{
+    if (HybridSettings::getLayerRadius() <= 0.0)
+    {
+        _qmRunner->clearPointCharges();
+        return;
+    }
+
+    pq::Vec3DVec        positions;
+    std::vector<double> charges;
+
+    for (size_t i = 0; i < _isQMMolecule.size(); ++i)
+    {
+        if (_isQMMolecule[i])
+            continue;
+
+        for (const auto &atom : _simulationBox->getMolecule(i).getAtoms())
+        {
+            if (!isPointCharge(atom->getPosition(), qmCenter))
+                continue;
+
+            auto dPos = atom->getPosition() - qmCenter;
+            dPos     -= _simulationBox->calcShiftVector(dPos);
+
+            positions.push_back(qmCenter + dPos);
+            charges.push_back(atom->getPartialCharge());
+        }
+    }
+
+    _qmRunner->setPointCharges(positions, charges);
+}
+
+/**
+ * @brief check if an MM atom is passed as point charge to the QM runner
+ *
+ * @param position position of the MM atom
+ * @param qmCenter
+ * @return true if the minimum image of the atom is within the layer radius
+ */
+bool QMMMMDEngine::isPointCharge(const Vec3D &position, const Vec3D &qmCenter)
+    const
+{
+    const auto layerRadius = HybridSettings::getLayerRadius();
+
+    auto dPos = position - qmCenter;
+    dPos     -= _simulationBox->calcShiftVector(dPos);
+
+    return normSquared(dPos) < layerRadius * layerRadius;
+}
+
+/**
+ * @brief calculate the MM coupling forces of the QM atoms
+ *
+ * @details The QM runner sets the forces of the QM atoms to the pure QM
+ * forces, which contain the interaction within the QM region and, with
+ * point charges, the electrostatic interaction with the embedding. The
+ * remaining MM interactions between QM and MM atoms - the non-Coulomb part
+ * and the Coulomb part of MM atoms that are no point charges - are stored as
+ * coupling forces of the QM atoms.
+ *
+ * The QM energy replaces the MM energy of all inter molecular pairs within
+ * the QM region and the MM Coulomb energy between the QM atoms and the point
+ * charges, therefore these are subtracted from the MM energies. MM atoms
+ * keep their full MM forces, as the QM runners do not return the forces on
+ * the point charges.
+ *
+ * @param qmCenter
+ */
+void QMMMMDEngine::calculateCouplingForces(const Vec3D &qmCenter)
+{
+    const auto &box        = _simulationBox->getBox();
+    const auto  nMolecules = _isQMMolecule.size();
+    const auto  isEmbedded = HybridSettings::getLayerRadius() > 0.0;
+
+    auto coulombEnergy    = 0.0;
+    auto nonCoulombEnergy = 0.0;
+    auto qmIndex          = size_t(0);
+
+    for (size_t i = 0; i < nMolecules; ++i)
+    {
+        if (!_isQMMolecule[i])
+            continue;
+
+        auto      &qmMolecule = _simulationBox->getMolecule(i);
+        const auto nQMAtoms   = qmMolecule.getNumberOfAtoms();
+
+        for (size_t atom1 = 0; atom1 < nQMAtoms; ++atom1)
+        {
+            auto &couplingForce = _couplingForces[qmIndex++];
+
+            for (size_t j = 0; j < nMolecules; ++j)
+            {
+                // each QM-QM pair is only subtracted once
+                if (j == i || (_isQMMolecule[j] && j > i))
+                    continue;
+
+                auto      &molecule = _simulationBox->getMolecule(j);
+                const auto nAtoms   = molecule.getNumberOfAtoms();
+
+                for (size_t atom2 = 0; atom2 < nAtoms; ++atom2)
+                {
+                    const auto pair =
+                        _potential->calculateSingleInteractionParts(
+                            box,
+                            qmMolecule,
+                            molecule,
+                            atom1,
+                            atom2
+                        );
+
+                    if (_isQMMolecule[j])
+                    {
+                        coulombEnergy    += pair.coulombEnergy;
+                        nonCoulombEnergy += pair.nonCoulombEnergy;
+                        continue;
+                    }
+
+                    couplingForce += pair.nonCoulombForce;
+
+                    const auto position = molecule.getAtomPosition(atom2);
+
+                    if (isEmbedded && isPointCharge(position, qmCenter))
+                        coulombEnergy += pair.coulombEnergy;
+                    else
+                        couplingForce += pair.coulombForce;
+                }
+            }
+        }
+    }
+
+    const auto mmCoulombEnergy    = _physicalData->getCoulombEnergy();
+    const auto mmNonCoulombEnergy = _physicalData->getNonCoulombEnergy();
+
+    _physicalData->setCoulombEnergy(mmCoulombEnergy - coulombEnergy);
+    _physicalData->setNonCoulombEnergy(mmNonCoulombEnergy - nonCoulombEnergy);
+}
+
+/**
+ * @brief remove the bonded and intra molecular MM energies of the QM molecules
+ *
+ * @details The QM energy contains the interactions within each QM molecule.
+ * As the QM atoms experience the MM forces of these interactions only with a
+ * weight of 1 - S (see mixForces), the intra molecular non bonded and the
+ * bonded MM energies of each QM molecule are subtracted with the weight S of
+ * the molecule. Bonded terms connecting several molecules are weighted with
+ * the smallest smoothing factor of their molecules, i.e. terms between QM
+ * and MM molecules are kept.
+ */
+void QMMMMDEngine::subtractIntraEnergies()
+{
+    std::unordered_map<const Molecule *, double> smoothingFactors;
+
+    auto coulombEnergy    = 0.0;
+    auto nonCoulombEnergy = 0.0;
+    auto qmIndex          = size_t(0);
+
+    for (size_t i = 0; i < _isQMMolecule.size(); ++i)
+    {
+        if (!_isQMMolecule[i])
+            continue;
+
+        const auto &molecule        = _simulationBox->getMolecule(i);
+        const auto  smoothingFactor = _smoothingFactors[qmIndex];
+
+        qmIndex += molecule.getNumberOfAtoms();
+        smoothingFactors.emplace(&molecule, smoothingFactor);
+
+        const auto [coulomb, nonCoulomb] =
+            _intraNonBonded->calculateMoleculeEnergies(
+                *_simulationBox,
+                molecule
+            );
+
+        coulombEnergy    += smoothingFactor * coulomb;
+        nonCoulombEnergy += smoothingFactor * nonCoulomb;
+    }
+
+    auto weight = [&smoothingFactors](const Molecule *molecule)
+    {
+        const auto factor = smoothingFactors.find(molecule);
+
+        return factor == smoothingFactors.end() ? 0.0 : factor->second;
+    };
+
+    auto bondedData = PhysicalData();
+
+    _forceField->calculateWeightedBondedEnergies(
+        *_simulationBox,
+        bondedData,
+        weight
+    );
+
+    _physicalData->addIntraCoulombEnergy(-coulombEnergy);
+    _physicalData->addIntraNonCoulombEnergy(-nonCoulombEnergy);
+
+    _physicalData->addBondEnergy(-bondedData.getBondEnergy());
+    _physicalData->addAngleEnergy(-bondedData.getAngleEnergy());
+    _physicalData->addDihedralEnergy(-bondedData.getDihedralEnergy());
+    _physicalData->addImproperEnergy(-bondedData.getImproperEnergy());
+    _physicalData->addCoulombEnergy(-bondedData.getCoulombEnergy());
+    _physicalData->addNonCoulombEnergy(-bondedData.getNonCoulombEnergy());
+}
+
+/**
+ * @brief blend the QM and MM forces of the QM atoms
+ *
+ * @details F = S * (F_QM + F_coupling) + (1 - S) * F_MM with the smoothing
+ * factor S of the molecule of the QM atom, the current (QM) force F_QM of the
+ * atom, its MM coupling force F_coupling and its full MM force F_MM.
+ * Molecules within the inner radius of the smoothing region have S = 1 and
+ * experience the QM forces plus the MM coupling to the MM atoms.
+ */
+void QMMMMDEngine::mixForces()
+{
+    auto &qmAtoms = _simulationBox->getQMAtoms();
+
+    for (size_t i = 0; i < qmAtoms.size(); ++i)
+    {
+        const auto smoothingFactor = _smoothingFactors[i];
+
+        const auto qmForce = qmAtoms[i]->getForce() + _couplingForces[i];
+        const auto mmForce = _mmForcesQMAtoms[i];
+
+        qmAtoms[i]->setForce(
+            smoothingFactor * qmForce + (1.0 - smoothingFactor) * mmForce
+        );
+    }
+}
+
+/**
+ * @brief calculate the smoothing factor of a QM molecule
+ *
+ * @details The smoothing region reaches from the core radius minus the
+ * smoothing radius up to the core radius. Within the smoothing region the
+ * factor decays smoothly from 1 to 0 with the switching function
+ *
+ * S(r) = (rc² - r²)² (rc² + 2r² - 3rs²) / (rc² - rs²)³
+ *
+ * where rc is the core radius and rs the inner radius of the smoothing region.
+ *
+ * @param distance distance of the molecule to the QM center
+ *
+ * @return double
+ */
+double QMMMMDEngine::calculateSmoothingFactor(const double distance)
+{
+    const auto coreRadius      = HybridSettings::getCoreRadius();
+    const auto smoothingRadius = HybridSettings::getSmoothingRadius();
+    const auto innerRadius     = coreRadius - smoothingRadius;
+
+    if (distance <= innerRadius)
+        return 1.0;
+
+    if (distance >= coreRadius)
+        return 0.0;
+
+    const auto rc2 = coreRadius * coreRadius;
+    const auto rs2 = innerRadius * innerRadius;
+    const auto r2  = distance * distance;
+
+    const auto denominator = (rc2 - rs2) * (rc2 - rs2) * (rc2 - rs2);
+
+    return (rc2 - r2) * (rc2 - r2) * (rc2 + 2.0 * r2 - 3.0 * rs2) / denominator;
+}
\ No newline at end of file
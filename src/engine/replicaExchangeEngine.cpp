@@ -0,0 +1,511 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "replicaExchangeEngine.hpp"
+
+#include <algorithm>    // for max
+#include <cstddef>      // for ptrdiff_t
+#include <cmath>        // for exp, sqrt
+#include <filesystem>   // for path
+#include <format>       // for format
+#include <iostream>     // for cout
+#include <numeric>      // for iota
+#include <thread>       // for thread
+
+#include "atom.hpp"                          // for Atom
+#include "constants/conversionFactors.hpp"   // for Boltzmann constant
+#include "progressbar.hpp"                   // for progressbar
+#include "settingsInstance.hpp"              // for SettingsScope
+#include "thermostat.hpp"                    // for Thermostat
+#include "thermostatSettings.hpp"            // for ThermostatSettings
+#include "timingsSettings.hpp"               // for TimingsSettings
+
+#ifdef WITH_OPENMP
+#include <omp.h>   // for omp_get_max_threads, omp_set_num_threads
+#endif
+
+using namespace engine;
+using namespace settings;
+using namespace constants;
+
+/**
+ * @brief Construct a new Replica Exchange Engine object
+ *
+ * @details the random number generator is seeded from std::random_device
+ */
+ReplicaExchangeEngine::ReplicaExchangeEngine()
+    : _generator(std::random_device{}())
+{
+}
+
+/**
+ * @brief run all replicas concurrently
+ *
+ * @details every replica is propagated in its own thread with its own
+ * settings bound to the thread. The OpenMP threads are distributed evenly
+ * over the replicas. An exception thrown by any replica stops the exchanges
+ * and the remaining replicas at their next step and is rethrown after all
+ * threads have finished.
+ */
+void ReplicaExchangeEngine::run()
+{
+    const SettingsScope settingsScope(_settings);
+
+    _nSteps = TimingsSettings::getNumberOfSteps();
+
+    const auto nReplicas  = _replicas.size();
+    const auto nExchanges = _nSteps / _exchangeFrequency;
+
+    _replicaExchangeOutput.writeHeader(_temperatures);
+
+    progressbar bar(static_cast<int>(nExchanges), true, std::cout);
+    _progressbar = &bar;
+
+    ExchangeBarrier barrier(
+        static_cast<std::ptrdiff_t>(nReplicas),
+        ExchangeCompletion{this}
+    );
+
+    std::vector<std::exception_ptr> exceptions(nReplicas);
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(nReplicas);
+
+        for (size_t i = 0; i < nReplicas; ++i)
+            threads.emplace_back(
+                [this, i, &barrier, &exceptions]()
+                {
+                    try
+                    {
+                        runReplica(i, barrier);
+                    }
+                    catch (...)
+                    {
+                        exceptions[i] = std::current_exception();
+                        _isFailed     = true;
+                        barrier.arrive_and_drop();
+                    }
+                }
+            );
+    }
+
+    _progressbar = nullptr;
+
+    for (const auto &exception : exceptions)
+        if (exception)
+            std::rethrow_exception(exception);
+
+    if (_exchangeException)
+        std::rethrow_exception(_exchangeException);
+}
+
+/**
+ * @brief propagates a single replica in the calling thread
+ *
+ * @details the potential energy of the replica is stored before the barrier
+ * of each exchange step, i.e. after the forces of the step were calculated
+ * and before the physical data is reset by the output of the step. If
+ * another replica or the exchange failed, the replica leaves the exchange
+ * barrier and stops without finishing its run.
+ *
+ * @param replica
+ * @param barrier
+ */
+void ReplicaExchangeEngine::runReplica(
+    const size_t     replica,
+    ExchangeBarrier &barrier
+)
+{
+    auto &engine = *_replicas[replica];
+
+    const SettingsScope settingsScope(engine.getSettings());
+
+#ifdef WITH_OPENMP
+    const auto nReplicas = static_cast<int>(_replicas.size());
+    omp_set_num_threads(std::max(1, omp_get_max_threads() / nReplicas));
+#endif
+
+    engine.startRun();
+
+    for (auto step = engine.getStep(); step <= _nSteps; engine.setStep(++step))
+    {
+        if (_isFailed)
+        {
+            barrier.arrive_and_drop();
+            return;
+        }
+
+        engine.takeStep();
+
+        if (0 == step % _exchangeFrequency)
+        {
+            const auto &data = engine.getPhysicalData();
+
+            setPotentialEnergy(
+                replica,
+                data.getTotalEnergy() - data.getKineticEnergy()
+            );
+
+            barrier.arrive_and_wait();
+        }
+
+        engine.writeOutput();
+    }
+
+    engine.finishRun();
+}
+
+/**
+ * @brief attempts the temperature swaps of neighbouring temperatures
+ *
+ * @details the even pairs (0-1, 2-3, ...) and the odd pairs (1-2, 3-4, ...)
+ * are attempted alternately. This function is the completion step of the
+ * exchange barrier and is therefore called by exactly one thread while all
+ * replicas are waiting. Exceptions are stored and rethrown by run().
+ */
+void ReplicaExchangeEngine::attemptExchanges() noexcept
+{
+    if (_isFailed)
+        return;
+
+    try
+    {
+        const auto nTemperatures = _temperatures.size();
+
+        _exchangeStep = (_nExchanges + 1) * _exchangeFrequency;
+
+        for (auto t = _nExchanges % 2; t + 1 < nTemperatures; t += 2)
+        {
+            ++_nAttempts[t];
+
+            if (!isExchangeAccepted(t, _distribution(_generator)))
+                continue;
+
+            ++_nAccepted[t];
+
+            std::swap(_replicaOfTemperature[t], _replicaOfTemperature[t + 1]);
+
+            const auto replica1 = _replicaOfTemperature[t + 1];
+            const auto replica2 = _replicaOfTemperature[t];
+
+            const auto temperature1 = _temperatures[t];
+            const auto temperature2 = _temperatures[t + 1];
+
+            setReplicaTemperature(replica1, temperature1, temperature2);
+            setReplicaTemperature(replica2, temperature2, temperature1);
+        }
+
+        ++_nExchanges;
+
+        writeOutput();
+
+        if (_progressbar)
+            _progressbar->update();
+    }
+    catch (...)
+    {
+        _exchangeException = std::current_exception();
+        _isFailed          = true;
+    }
+}
+
+/**
+ * @brief Metropolis criterion for the swap of the replicas at the
+ * temperatures with index temperatureIndex and temperatureIndex + 1
+ *
+ * @details the swap is accepted with the probability
+ * min(1, exp[(beta_i - beta_j) * (U_i - U_j)]) where replica i is at the
+ * lower and replica j at the higher temperature
+ *
+ * @param temperatureIndex
+ * @param random uniform random number in [0, 1)
+ * @return true if the swap is accepted
+ */
+bool ReplicaExchangeEngine::isExchangeAccepted(
+    const size_t temperatureIndex,
+    const double random
+) const
+{
+    const auto replica1 = _replicaOfTemperature[temperatureIndex];
+    const auto replica2 = _replicaOfTemperature[temperatureIndex + 1];
+
+    const auto kB = _BOLTZMANN_CONSTANT_IN_KCAL_PER_MOL_;
+
+    const auto beta1 = 1.0 / (kB * _temperatures[temperatureIndex]);
+    const auto beta2 = 1.0 / (kB * _temperatures[temperatureIndex + 1]);
+
+    const auto energy1 = _potentialEnergies[replica1];
+    const auto energy2 = _potentialEnergies[replica2];
+
+    const auto delta = (beta1 - beta2) * (energy1 - energy2);
+
+    return delta >= 0.0 || random < std::exp(delta);
+}
+
+/**
+ * @brief moves a replica from one temperature to another
+ *
+ * @details the target temperature of the thermostat is changed and the
+ * velocities are rescaled by sqrt(newTemperature / oldTemperature). The
+ * kinetics are only recalculated if they were evaluated in the current step,
+ * otherwise the step stays excluded from the kinetic averages. The settings
+ * of the replica are bound, as this is called from the thread completing the
+ * exchange barrier.
+ *
+ * @param replica
+ * @param oldTemperature
+ * @param newTemperature
+ */
+void ReplicaExchangeEngine::setReplicaTemperature(
+    const size_t replica,
+    const double oldTemperature,
+    const double newTemperature
+)
+{
+    auto &engine = *_replicas[replica];
+
+    const SettingsScope settingsScope(engine.getSettings());
+
+    engine.getThermostat().setTargetTemperature(newTemperature);
+    ThermostatSettings::setActualTargetTemperature(newTemperature);
+
+    const auto scaleFactor = std::sqrt(newTemperature / oldTemperature);
+
+    auto &simBox = engine.getSimulationBox();
+
+    for (const auto &atom : simBox.getAtoms())
+        atom->scaleVelocity(scaleFactor);
+
+    auto &physicalData = engine.getPhysicalData();
+
+    if (!physicalData.isKineticsSkipped())
+        physicalData.calculateKinetics(simBox);
+}
+
+/**
+ * @brief writes the replica exchange output and the per temperature
+ * trajectories
+ *
+ */
+void ReplicaExchangeEngine::writeOutput()
+{
+    _replicaExchangeOutput.write(
+        _exchangeStep,
+        _replicaOfTemperature,
+        _nAttempts,
+        _nAccepted
+    );
+
+    for (size_t t = 0; t < _temperatureTrajOutputs.size(); ++t)
+    {
+        auto &engine = *_replicas[_replicaOfTemperature[t]];
+
+        const SettingsScope settingsScope(engine.getSettings());
+
+        _temperatureTrajOutputs[t].writeXyz(engine.getSimulationBox());
+    }
+}
+
+/**
+ * @brief adds a replica to the replica exchange
+ *
+ * @details the replicas have to be added in the order of their initial
+ * temperatures
+ *
+ * @param replica
+ */
+void ReplicaExchangeEngine::addReplica(std::unique_ptr<MDEngine> replica)
+{
+    _replicas.push_back(std::move(replica));
+    _potentialEnergies.resize(_replicas.size(), 0.0);
+}
+
+/**
+ * @brief opens the replica exchange file and one trajectory file per
+ * temperature
+ *
+ * @details the trajectory of temperature k is written to
+ * <replicaExchangeFileName without extension>.temperature_<k>.xyz
+ *
+ * @param replicaExchangeFileName
+ */
+void ReplicaExchangeEngine::setupOutputFiles(
+    const std::string &replicaExchangeFileName
+)
+{
+    _replicaExchangeOutput.setFilename(replicaExchangeFileName);
+
+    for (size_t t = 0; t < _temperatures.size(); ++t)
+    {
+        auto fileName = std::filesystem::path(replicaExchangeFileName);
+        fileName.replace_extension(std::format(".temperature_{}.xyz", t));
+
+        _temperatureTrajOutputs.emplace_back(fileName.string());
+        _temperatureTrajOutputs.back().setFilename(fileName.string());
+    }
+}
+
+/***************************
+ *                         *
+ * standard setter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief set the temperatures of the replica exchange in ascending order
+ *
+ * @details initially replica i is at temperature i
+ *
+ * @param temperatures
+ */
+void ReplicaExchangeEngine::setTemperatures(
+    const std::vector<double> &temperatures
+)
+{
+    const auto nTemperatures = temperatures.size();
+
+    _temperatures = temperatures;
+
+    _replicaOfTemperature.resize(nTemperatures);
+    std::iota(_replicaOfTemperature.begin(), _replicaOfTemperature.end(), 0);
+
+    _nAttempts.assign(nTemperatures - 1, 0);
+    _nAccepted.assign(nTemperatures - 1, 0);
+}
+
+/**
+ * @brief set the number of steps between two exchange attempts
+ *
+ * @param exchangeFrequency
+ */
+void ReplicaExchangeEngine::setExchangeFrequency(const size_t exchangeFrequency)
+{
+    _exchangeFrequency = exchangeFrequency;
+}
+
+/**
+ * @brief set the potential energy of a replica
+ *
+ * @param replica
+ * @param energy
+ */
+void ReplicaExchangeEngine::setPotentialEnergy(
+    const size_t replica,
+    const double energy
+)
+{
+    if (_potentialEnergies.size() <= replica)
+        _potentialEnergies.resize(replica + 1, 0.0);
+
+    _potentialEnergies[replica] = energy;
+}
+
+/**
+ * @brief set the seed of the random number generator
+ *
+ * @param seed
+ */
+void ReplicaExchangeEngine::setSeed(const size_t seed)
+{
+    _generator.seed(seed);
+}
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief get the number of replicas
+ *
+ * @return size_t
+ */
+size_t ReplicaExchangeEngine::getNumberOfReplicas() const
+{
+    return _replicas.size();
+}
+
+/**
+ * @brief get the number of exchange steps performed so far
+ *
+ * @return size_t
+ */
+size_t ReplicaExchangeEngine::getNumberOfExchanges() const
+{
+    return _nExchanges;
+}
+
+/**
+ * @brief get a replica
+ *
+ * @param replica
+ * @return MDEngine&
+ */
+MDEngine &ReplicaExchangeEngine::getReplica(const size_t replica)
+{
+    return *_replicas[replica];
+}
+
+/**
+ * @brief get the index of the replica at each temperature
+ *
+ * @return const std::vector<size_t>&
+ */
+const std::vector<size_t> &ReplicaExchangeEngine::getReplicaOfTemperature(
+) const
+{
+    return _replicaOfTemperature;
+}
+
+/**
+ * @brief get the number of exchange attempts per pair of neighbouring
+ * temperatures
+ *
+ * @return const std::vector<size_t>&
+ */
+const std::vector<size_t> &ReplicaExchangeEngine::getNumberOfAttempts() const
+{
+    return _nAttempts;
+}
+
+/**
+ * @brief get the number of accepted swaps per pair of neighbouring
+ * temperatures
+ *
+ * @return const std::vector<size_t>&
+ */
+const std::vector<size_t> &ReplicaExchangeEngine::getNumberOfAccepted() const
+{
+    return _nAccepted;
+}
+
+/**
+ * @brief get the replica exchange output
+ *
+ * @return output::ReplicaExchangeOutput&
+ */
+output::ReplicaExchangeOutput &ReplicaExchangeEngine::getReplicaExchangeOutput()
+{
+    return _replicaExchangeOutput;
+}
@@ -78,6 +78,14 @@ void RingPolymerEngine::writeOutput()
         _engineOutput.writeChargeFile(*_simulationBox);
         _engineOutput.writeRstFile(*_simulationBox, *_thermostat, effStep);
 
+        _engineOutput.writeCheckpointFile(
+            *_simulationBox,
+            *_thermostat,
+            *_manostat,
+            *_integrator,
+            effStep
+        );
+
         _engineOutput.writeRingPolymerRstFile(_ringPolymerBeads, effStep);
         _engineOutput.writeRingPolymerXyzFile(_ringPolymerBeads);
         _engineOutput.writeRingPolymerVelFile(_ringPolymerBeads);
@@ -56,11 +56,13 @@ AngleForceField::AngleForceField(
  * @brief calculate energy and forces for a single alpha
  *
  * @details if angle is a linker angle, correct coulomb and non-coulomb energy
- * and forces
+ * and forces. If computeForces is false only the energies are calculated.
  *
+ * @tparam computeForces
  * @param box
  * @param physicalData
  */
+template <bool computeForces>
 void AngleForceField::calculateEnergyAndForces(
     const SimulationBox    &box,
     PhysicalData           &physicalData,
@@ -92,22 +94,25 @@ void AngleForceField::calculateEnergyAndForces(
 
     physicalData.addAngleEnergy(-forceMagnitude * deltaAngle / 2.0);
 
-    const auto normalDistance = distance12 * distance13 * ::sin(alpha);
+    if constexpr (computeForces)
+    {
+        const auto normalDistance = distance12 * distance13 * ::sin(alpha);
 
-    auto normalPosition  = cross(dPosition13, dPosition12);
-    normalPosition      /= normalDistance;
+        auto normalPosition  = cross(dPosition13, dPosition12);
+        normalPosition      /= normalDistance;
 
-    auto force    = forceMagnitude / distance12Squared;
-    auto forcexyz = force * cross(dPosition12, normalPosition);
+        auto force    = forceMagnitude / distance12Squared;
+        auto forcexyz = force * cross(dPosition12, normalPosition);
 
-    _molecules[0]->addAtomForce(_atomIndices[0], -forcexyz);
-    _molecules[1]->addAtomForce(_atomIndices[1], forcexyz);
+        _molecules[0]->addAtomForce(_atomIndices[0], -forcexyz);
+        _molecules[1]->addAtomForce(_atomIndices[1], forcexyz);
 
-    force    = forceMagnitude / distance13Squared;
-    forcexyz = force * cross(normalPosition, dPosition13);
+        force    = forceMagnitude / distance13Squared;
+        forcexyz = force * cross(normalPosition, dPosition13);
 
-    _molecules[0]->addAtomForce(_atomIndices[0], -forcexyz);
-    _molecules[2]->addAtomForce(_atomIndices[2], forcexyz);
+        _molecules[0]->addAtomForce(_atomIndices[0], -forcexyz);
+        _molecules[2]->addAtomForce(_atomIndices[2], forcexyz);
+    }
 
     if (_isLinker)
     {
@@ -116,7 +121,7 @@ void AngleForceField::calculateEnergyAndForces(
 
         const auto distance23 = norm(dPosition23);
 
-        if (distance23 < CoulombPotential::getCoulombRadiusCutOff())
+        if (distance23 < coulombPotential.getCoulombRadiusCutOff())
         {
             forceMagnitude = correctLinker<AngleForceField>(
                 coulombPotential,
@@ -129,9 +134,12 @@ void AngleForceField::calculateEnergyAndForces(
                 distance23
             );
 
+            if constexpr (!computeForces)
+                return;
+
             forceMagnitude /= distance23;
 
-            forcexyz = forceMagnitude * dPosition23;
+            const auto forcexyz = forceMagnitude * dPosition23;
 
             physicalData.addVirial(tensorProduct(dPosition23, forcexyz));
 
@@ -141,6 +149,20 @@ void AngleForceField::calculateEnergyAndForces(
     }
 }
 
+template void AngleForceField::calculateEnergyAndForces<true>(
+    const SimulationBox &,
+    PhysicalData &,
+    const CoulombPotential &,
+    NonCoulombPotential &
+);
+
+template void AngleForceField::calculateEnergyAndForces<false>(
+    const SimulationBox &,
+    PhysicalData &,
+    const CoulombPotential &,
+    NonCoulombPotential &
+);
+
 /***************************
  *                         *
  * standard setter methods *
@@ -60,11 +60,13 @@ BondForceField::BondForceField(
  * @brief calculate energy and forces for a single bond
  *
  * @details if bond is a linker bond, correct coulomb and non-coulomb energy and
- * forces
+ * forces. If computeForces is false only the energies are calculated.
  *
+ * @tparam computeForces
  * @param box
  * @param physicalData
  */
+template <bool computeForces>
 void BondForceField::calculateEnergyAndForces(
     const SimulationBox    &box,
     PhysicalData           &physicalData,
@@ -85,7 +87,7 @@ void BondForceField::calculateEnergyAndForces(
 
     physicalData.addBondEnergy(-forceMagnitude * deltaDistance / 2.0);
 
-    if (_isLinker && distance < CoulombPotential::getCoulombRadiusCutOff())
+    if (_isLinker && distance < coulombPotential.getCoulombRadiusCutOff())
     {
         forceMagnitude += correctLinker<BondForceField>(
             coulombPotential,
@@ -99,6 +101,9 @@ void BondForceField::calculateEnergyAndForces(
         );
     }
 
+    if constexpr (!computeForces)
+        return;
+
     forceMagnitude /= distance;
 
     const auto force = forceMagnitude * dPosition;
@@ -109,6 +114,20 @@ void BondForceField::calculateEnergyAndForces(
     physicalData.addVirial(tensorProduct(dPosition, force));
 }
 
+template void BondForceField::calculateEnergyAndForces<true>(
+    const SimulationBox &,
+    PhysicalData &,
+    const CoulombPotential &,
+    NonCoulombPotential &
+);
+
+template void BondForceField::calculateEnergyAndForces<false>(
+    const SimulationBox &,
+    PhysicalData &,
+    const CoulombPotential &,
+    NonCoulombPotential &
+);
+
 /***************************
  *                         *
  * standard setter methods *
@@ -56,11 +56,14 @@ DihedralForceField::DihedralForceField(
  * @brief calculate energy and forces for a single dihedral
  *
  * @details if dihedral is a linker dihedral, correct coulomb and non-coulomb
- * energy and forces (only for non improper dihedrals)
+ * energy and forces (only for non improper dihedrals). If computeForces is
+ * false only the energies are calculated.
  *
+ * @tparam computeForces
  * @param box
  * @param physicalData
  */
+template <bool computeForces>
 void DihedralForceField::calculateEnergyAndForces(
     const SimulationBox    &box,
     PhysicalData           &physicalData,
@@ -102,34 +105,39 @@ void DihedralForceField::calculateEnergyAndForces(
     else
         physicalData.addDihedralEnergy(energy);
 
-    auto       forceMagnitude = distance23 / distance123Squared;
-    const auto forceVector12  = forceMagnitude * crossPosition123;
+    if constexpr (computeForces)
+    {
+        auto       forceMagnitude = distance23 / distance123Squared;
+        const auto forceVector12  = forceMagnitude * crossPosition123;
 
-    forceMagnitude           = distance23 / distance432Squared;
-    const auto forceVector43 = forceMagnitude * crossPosition432;
+        forceMagnitude           = distance23 / distance432Squared;
+        const auto forceVector43 = forceMagnitude * crossPosition432;
 
-    forceMagnitude             = dot(dPosition12, dPosition23);
-    forceMagnitude            /= (distance123Squared * distance23);
-    const auto forceVector123  = forceMagnitude * crossPosition123;
+        forceMagnitude             = dot(dPosition12, dPosition23);
+        forceMagnitude            /= (distance123Squared * distance23);
+        const auto forceVector123  = forceMagnitude * crossPosition123;
 
-    forceMagnitude             = dot(dPosition43, dPosition23);
-    forceMagnitude            /= (distance432Squared * distance23);
-    const auto forceVector432  = forceMagnitude * crossPosition432;
+        forceMagnitude             = dot(dPosition43, dPosition23);
+        forceMagnitude            /= (distance432Squared * distance23);
+        const auto forceVector432  = forceMagnitude * crossPosition432;
 
-    const auto sine = ::sin(_periodicity * phi + _phaseShift);
-    forceMagnitude  = _forceConstant * _periodicity * sine;
+        const auto sine = ::sin(_periodicity * phi + _phaseShift);
+        forceMagnitude  = _forceConstant * _periodicity * sine;
 
-    const auto diffForce123_432 = forceVector123 - forceVector432;
+        const auto diffForce123_432 = forceVector123 - forceVector432;
 
-    const auto force_0 = -forceMagnitude * forceVector12;
-    const auto force_1 = forceMagnitude * (forceVector12 + diffForce123_432);
-    const auto force_2 = +forceMagnitude * (-forceVector43 - diffForce123_432);
-    const auto force_3 = forceMagnitude * forceVector43;
+        const auto force_0 = -forceMagnitude * forceVector12;
+        const auto force_1 =
+            forceMagnitude * (forceVector12 + diffForce123_432);
+        const auto force_2 =
+            +forceMagnitude * (-forceVector43 - diffForce123_432);
+        const auto force_3 = forceMagnitude * forceVector43;
 
-    _molecules[0]->addAtomForce(_atomIndices[0], force_0);
-    _molecules[1]->addAtomForce(_atomIndices[1], force_1);
-    _molecules[2]->addAtomForce(_atomIndices[2], force_2);
-    _molecules[3]->addAtomForce(_atomIndices[3], force_3);
+        _molecules[0]->addAtomForce(_atomIndices[0], force_0);
+        _molecules[1]->addAtomForce(_atomIndices[1], force_1);
+        _molecules[2]->addAtomForce(_atomIndices[2], force_2);
+        _molecules[3]->addAtomForce(_atomIndices[3], force_3);
+    }
 
     if (_isLinker)
     {
@@ -138,9 +146,9 @@ void DihedralForceField::calculateEnergyAndForces(
 
         const auto distance14 = norm(dPosition14);
 
-        if (distance14 < CoulombPotential::getCoulombRadiusCutOff())
+        if (distance14 < coulombPotential.getCoulombRadiusCutOff())
         {
-            forceMagnitude = correctLinker<DihedralForceField>(
+            auto forceMagnitude = correctLinker<DihedralForceField>(
                 coulombPotential,
                 nonCoulombPotential,
                 physicalData,
@@ -151,6 +159,9 @@ void DihedralForceField::calculateEnergyAndForces(
                 distance14
             );
 
+            if constexpr (!computeForces)
+                return;
+
             forceMagnitude /= distance14;
 
             const auto forcexyz = forceMagnitude * dPosition14;
@@ -164,6 +175,22 @@ void DihedralForceField::calculateEnergyAndForces(
     }
 }
 
+template void DihedralForceField::calculateEnergyAndForces<true>(
+    const SimulationBox &,
+    PhysicalData &,
+    const bool,
+    const CoulombPotential &,
+    NonCoulombPotential &
+);
+
+template void DihedralForceField::calculateEnergyAndForces<false>(
+    const SimulationBox &,
+    PhysicalData &,
+    const bool,
+    const CoulombPotential &,
+    NonCoulombPotential &
+);
+
 /***************************
  *                         *
  * standard setter methods *
@@ -25,10 +25,11 @@
 #include <algorithm>
 #include <format>       // for format
 #include <functional>   // for identity
-#include <ranges>       // for find_if, std::ranges::find_if
+#include <ranges>       // for std::ranges::for_each
 #include <string>       // for string
 
 #include "exceptions.hpp"
+#include "physicalData.hpp"
 
 using namespace forceField;
 using namespace customException;
@@ -49,6 +50,8 @@ std::shared_ptr<ForceField> ForceField::clone() const
 /**
  * @brief find bond type by id
  *
+ * @details uses the id to index map which is filled in addBondType
+ *
  * @param id
  * @return const BondType&
  *
@@ -56,13 +59,10 @@ std::shared_ptr<ForceField> ForceField::clone() const
  */
 const BondType &ForceField::findBondTypeById(const size_t id) const
 {
-    auto isBondId = [id](const BondType &bondType)
-    { return bondType.getId() == id; };
-
-    const auto bondType = std::ranges::find_if(_bondTypes, isBondId);
+    const auto index = _bondTypeIndices.find(id);
 
-    if (bondType != _bondTypes.end())
-        return *bondType;
+    if (index != _bondTypeIndices.end())
+        return _bondTypes[index->second];
     else
         throw TopologyException(
             std::format("Bond type with id {} not found.", id)
@@ -72,6 +72,8 @@ const BondType &ForceField::findBondTypeById(const size_t id) const
 /**
  * @brief find angle type by id
  *
+ * @details uses the id to index map which is filled in addAngleType
+ *
  * @param id
  * @return const AngleType&
  *
@@ -79,13 +81,10 @@ const BondType &ForceField::findBondTypeById(const size_t id) const
  */
 const AngleType &ForceField::findAngleTypeById(const size_t id) const
 {
-    auto isAngleId = [id](const AngleType &angleType)
-    { return angleType.getId() == id; };
+    const auto index = _angleTypeIndices.find(id);
 
-    const auto angleType = std::ranges::find_if(_angleTypes, isAngleId);
-
-    if (angleType != _angleTypes.end())
-        return *angleType;
+    if (index != _angleTypeIndices.end())
+        return _angleTypes[index->second];
     else
         throw TopologyException(
             std::format("Angle type with id {} not found.", id)
@@ -95,6 +94,8 @@ const AngleType &ForceField::findAngleTypeById(const size_t id) const
 /**
  * @brief find dihedral type by id
  *
+ * @details uses the id to index map which is filled in addDihedralType
+ *
  * @param id
  * @return const DihedralType&
  *
@@ -102,14 +103,10 @@ const AngleType &ForceField::findAngleTypeById(const size_t id) const
  */
 const DihedralType &ForceField::findDihedralTypeById(const size_t id) const
 {
-    auto isDihedralId = [id](const DihedralType &dihedralType)
-    { return dihedralType.getId() == id; };
+    const auto index = _dihedralTypeIndices.find(id);
 
-    auto      &dihedrals    = _dihedralTypes;
-    const auto dihedralType = std::ranges::find_if(dihedrals, isDihedralId);
-
-    if (dihedralType != dihedrals.end())
-        return *dihedralType;
+    if (index != _dihedralTypeIndices.end())
+        return _dihedralTypes[index->second];
     else
         throw TopologyException(
             std::format("Dihedral type with id {} not found.", id)
@@ -119,6 +116,9 @@ const DihedralType &ForceField::findDihedralTypeById(const size_t id) const
 /**
  * @brief find improper dihedral type by id
  *
+ * @details uses the id to index map which is filled in
+ * addImproperDihedralType
+ *
  * @param id
  * @return const DihedralType&
  *
@@ -127,14 +127,10 @@ const DihedralType &ForceField::findDihedralTypeById(const size_t id) const
  */
 const DihedralType &ForceField::findImproperTypeById(const size_t id) const
 {
-    auto isImproperId = [id](const DihedralType &dihedralType)
-    { return dihedralType.getId() == id; };
+    const auto index = _improperTypeIndices.find(id);
 
-    auto      &impropers    = _improperDihedralTypes;
-    const auto dihedralType = std::ranges::find_if(impropers, isImproperId);
-
-    if (dihedralType != impropers.end())
-        return *dihedralType;
+    if (index != _improperTypeIndices.end())
+        return _improperDihedralTypes[index->second];
     else
         throw TopologyException(
             std::format("Improper dihedral type with id {} not found.", id)
@@ -144,6 +140,8 @@ const DihedralType &ForceField::findImproperTypeById(const size_t id) const
 /**
  * @brief find j-coupling type by id
  *
+ * @details uses the id to index map which is filled in addJCouplingType
+ *
  * @param id
  * @return const JCouplingType&
  *
@@ -152,14 +150,10 @@ const DihedralType &ForceField::findImproperTypeById(const size_t id) const
  */
 const JCouplingType &ForceField::findJCouplingTypeById(const size_t id) const
 {
-    auto isJCouplingId = [id](const JCouplingType &jCouplingType)
-    { return jCouplingType.getId() == id; };
+    const auto index = _jCouplingTypeIndices.find(id);
 
-    auto       jCouplings    = _jCouplingTypes;
-    const auto jCouplingType = std::ranges::find_if(jCouplings, isJCouplingId);
-
-    if (jCouplingType != _jCouplingTypes.end())
-        return *jCouplingType;
+    if (index != _jCouplingTypeIndices.end())
+        return _jCouplingTypes[index->second];
     else
         throw TopologyException(
             std::format("J-coupling type with id {} not found.", id)
@@ -173,18 +167,221 @@ const JCouplingType &ForceField::findJCouplingTypeById(const size_t id) const
  * 3) dihedrals
  * 4) improper dihedrals
  *
+ * @details all non linker terms are evaluated via the packed bonded terms,
+ * which are built on the first call. The linker terms are evaluated via the
+ * respective force field objects. If computeForces is false only the
+ * energies are calculated.
+ *
+ * @tparam computeForces
  * @param box
  * @param physicalData
  */
+template <bool computeForces>
 void ForceField::calculateBondedInteractions(
     const SimulationBox &box,
     PhysicalData        &physicalData
 )
 {
-    calculateBondInteractions(box, physicalData);
-    calculateAngleInteractions(box, physicalData);
-    calculateDihedralInteractions(box, physicalData);
-    calculateImproperDihedralInteractions(box, physicalData);
+    if (!_packedBondedTerms.isBuilt())
+        _packedBondedTerms.build(
+            _bonds,
+            _angles,
+            _dihedrals,
+            _improperDihedrals
+        );
+
+    _packedBondedTerms.calculate<computeForces>(box, physicalData);
+
+    calculateLinkerInteractions<computeForces>(box, physicalData);
+}
+
+template void ForceField::calculateBondedInteractions<true>(
+    const SimulationBox &,
+    PhysicalData &
+);
+
+template void ForceField::calculateBondedInteractions<false>(
+    const SimulationBox &,
+    PhysicalData &
+);
+
+/**
+ * @brief calculates all bonded interactions of linker terms, i.e. terms
+ * including the non-bonded correction between different molecules
+ *
+ * @tparam computeForces
+ * @param box
+ * @param physicalData
+ */
+template <bool computeForces>
+void ForceField::calculateLinkerInteractions(
+    const SimulationBox &box,
+    PhysicalData        &physicalData
+)
+{
+    auto &coulombPot    = *_coulombPotential;
+    auto &nonCoulombPot = *_nonCoulombPot;
+
+    for (const auto index : _packedBondedTerms.getLinkerBonds())
+        _bonds[index].calculateEnergyAndForces<computeForces>(
+            box,
+            physicalData,
+            coulombPot,
+            nonCoulombPot
+        );
+
+    for (const auto index : _packedBondedTerms.getLinkerAngles())
+        _angles[index].calculateEnergyAndForces<computeForces>(
+            box,
+            physicalData,
+            coulombPot,
+            nonCoulombPot
+        );
+
+    for (const auto index : _packedBondedTerms.getLinkerDihedrals())
+        _dihedrals[index].calculateEnergyAndForces<computeForces>(
+            box,
+            physicalData,
+            false,
+            coulombPot,
+            nonCoulombPot
+        );
+
+    for (const auto index : _packedBondedTerms.getLinkerImpropers())
+        _improperDihedrals[index].calculateEnergyAndForces<computeForces>(
+            box,
+            physicalData,
+            true,
+            coulombPot,
+            nonCoulombPot
+        );
+}
+
+/**
+ * @brief calculates the weighted energies of the bonded terms
+ *
+ * @details each bond, angle, dihedral and improper dihedral is weighted with
+ * the smallest weight of the molecules it connects. Terms with zero weight
+ * are skipped, all other terms are evaluated without any forces and their
+ * energies - including the non-bonded corrections of linker terms - are
+ * added to physicalData multiplied by their weight.
+ *
+ * @param box
+ * @param physicalData
+ * @param weight weight of a molecule
+ */
+void ForceField::calculateWeightedBondedEnergies(
+    const SimulationBox  &box,
+    PhysicalData         &physicalData,
+    const MoleculeWeight &weight
+)
+{
+    auto termWeight = [&weight](const auto &term)
+    {
+        auto minWeight = 1.0;
+
+        for (const auto *molecule : term.getMolecules())
+            minWeight = std::min(minWeight, weight(molecule));
+
+        return minWeight;
+    };
+
+    auto addTermEnergies = [&physicalData](
+                               const PhysicalData &termData,
+                               const double        termWeight
+                           )
+    {
+        physicalData.addBondEnergy(termWeight * termData.getBondEnergy());
+        physicalData.addAngleEnergy(termWeight * termData.getAngleEnergy());
+        physicalData.addDihedralEnergy(
+            termWeight * termData.getDihedralEnergy()
+        );
+        physicalData.addImproperEnergy(
+            termWeight * termData.getImproperEnergy()
+        );
+        physicalData.addCoulombEnergy(termWeight * termData.getCoulombEnergy());
+        physicalData.addNonCoulombEnergy(
+            termWeight * termData.getNonCoulombEnergy()
+        );
+    };
+
+    for (auto &bond : _bonds)
+    {
+        const auto bondWeight = termWeight(bond);
+
+        if (bondWeight <= 0.0)
+            continue;
+
+        auto termData = PhysicalData();
+
+        bond.calculateEnergyAndForces<false>(
+            box,
+            termData,
+            *_coulombPotential,
+            *_nonCoulombPot
+        );
+
+        addTermEnergies(termData, bondWeight);
+    }
+
+    for (auto &angle : _angles)
+    {
+        const auto angleWeight = termWeight(angle);
+
+        if (angleWeight <= 0.0)
+            continue;
+
+        auto termData = PhysicalData();
+
+        angle.calculateEnergyAndForces<false>(
+            box,
+            termData,
+            *_coulombPotential,
+            *_nonCoulombPot
+        );
+
+        addTermEnergies(termData, angleWeight);
+    }
+
+    for (auto &dihedral : _dihedrals)
+    {
+        const auto dihedralWeight = termWeight(dihedral);
+
+        if (dihedralWeight <= 0.0)
+            continue;
+
+        auto termData = PhysicalData();
+
+        dihedral.calculateEnergyAndForces<false>(
+            box,
+            termData,
+            false,
+            *_coulombPotential,
+            *_nonCoulombPot
+        );
+
+        addTermEnergies(termData, dihedralWeight);
+    }
+
+    for (auto &improper : _improperDihedrals)
+    {
+        const auto improperWeight = termWeight(improper);
+
+        if (improperWeight <= 0.0)
+            continue;
+
+        auto termData = PhysicalData();
+
+        improper.calculateEnergyAndForces<false>(
+            box,
+            termData,
+            true,
+            *_coulombPotential,
+            *_nonCoulombPot
+        );
+
+        addTermEnergies(termData, improperWeight);
+    }
 }
 
 /**
@@ -361,7 +558,11 @@ bool ForceField::isNonCoulombicActivated() const
  *
  * @param bond
  */
-void ForceField::addBond(const BondForceField &bond) { _bonds.push_back(bond); }
+void ForceField::addBond(const BondForceField &bond)
+{
+    _bonds.push_back(bond);
+    _packedBondedTerms.reset();
+}
 
 /**
  * @brief add angle to force field
@@ -371,6 +572,7 @@ void ForceField::addBond(const BondForceField &bond) { _bonds.push_back(bond); }
 void ForceField::addAngle(const AngleForceField &angle)
 {
     _angles.push_back(angle);
+    _packedBondedTerms.reset();
 }
 
 /**
@@ -381,6 +583,7 @@ void ForceField::addAngle(const AngleForceField &angle)
 void ForceField::addDihedral(const DihedralForceField &dihedral)
 {
     _dihedrals.push_back(dihedral);
+    _packedBondedTerms.reset();
 }
 
 /**
@@ -391,6 +594,7 @@ void ForceField::addDihedral(const DihedralForceField &dihedral)
 void ForceField::addImproperDihedral(const DihedralForceField &improperDihedral)
 {
     _improperDihedrals.push_back(improperDihedral);
+    _packedBondedTerms.reset();
 }
 
 /**
@@ -416,6 +620,9 @@ void ForceField::addJCoupling(const JCouplingForceField &jCoupling)
  */
 void ForceField::addBondType(const BondType &bondType)
 {
+    const auto index = _bondTypes.size();
+
+    _bondTypeIndices.try_emplace(bondType.getId(), index);
     _bondTypes.push_back(bondType);
 }
 
@@ -426,6 +633,9 @@ void ForceField::addBondType(const BondType &bondType)
  */
 void ForceField::addAngleType(const AngleType &angleType)
 {
+    const auto index = _angleTypes.size();
+
+    _angleTypeIndices.try_emplace(angleType.getId(), index);
     _angleTypes.push_back(angleType);
 }
 
@@ -436,6 +646,9 @@ void ForceField::addAngleType(const AngleType &angleType)
  */
 void ForceField::addDihedralType(const DihedralType &dihedralType)
 {
+    const auto index = _dihedralTypes.size();
+
+    _dihedralTypeIndices.try_emplace(dihedralType.getId(), index);
     _dihedralTypes.push_back(dihedralType);
 }
 
@@ -446,6 +659,9 @@ void ForceField::addDihedralType(const DihedralType &dihedralType)
  */
 void ForceField::addImproperDihedralType(const DihedralType &improperType)
 {
+    const auto index = _improperDihedralTypes.size();
+
+    _improperTypeIndices.try_emplace(improperType.getId(), index);
     _improperDihedralTypes.push_back(improperType);
 }
 
@@ -456,6 +672,9 @@ void ForceField::addImproperDihedralType(const DihedralType &improperType)
  */
 void ForceField::addJCouplingType(const JCouplingType &jCouplingType)
 {
+    const auto index = _jCouplingTypes.size();
+
+    _jCouplingTypeIndices.try_emplace(jCouplingType.getId(), index);
     _jCouplingTypes.push_back(jCouplingType);
 }
 
@@ -468,17 +687,29 @@ void ForceField::addJCouplingType(const JCouplingType &jCouplingType)
 /**
  * @brief clear bond types
  */
-void ForceField::clearBondTypes() { _bondTypes.clear(); }
+void ForceField::clearBondTypes()
+{
+    _bondTypes.clear();
+    _bondTypeIndices.clear();
+}
 
 /**
  * @brief clear angle types
  */
-void ForceField::clearAngleTypes() { _angleTypes.clear(); }
+void ForceField::clearAngleTypes()
+{
+    _angleTypes.clear();
+    _angleTypeIndices.clear();
+}
 
 /**
  * @brief clear dihedral types
  */
-void ForceField::clearDihedralTypes() { _dihedralTypes.clear(); }
+void ForceField::clearDihedralTypes()
+{
+    _dihedralTypes.clear();
+    _dihedralTypeIndices.clear();
+}
 
 /**
  * @brief clear improper dihedral types
@@ -486,12 +717,17 @@ void ForceField::clearDihedralTypes() { _dihedralTypes.clear(); }
 void ForceField::clearImproperDihedralTypes()
 {
     _improperDihedralTypes.clear();
+    _improperTypeIndices.clear();
 }
 
 /**
  * @brief clear j-coupling types
  */
-void ForceField::clearJCouplingTypes() { _jCouplingTypes.clear(); }
+void ForceField::clearJCouplingTypes()
+{
+    _jCouplingTypes.clear();
+    _jCouplingTypeIndices.clear();
+}
 
 /********************
  *                  *
@@ -532,34 +768,56 @@ void ForceField::setCoulombPotential(
 /**
  * @brief get bonds
  *
+ * @details invalidates the packed bonded terms as the returned terms can
+ * be modified
+ *
  * @return std::vector<BondForceField>&
  */
-std::vector<BondForceField> &ForceField::getBonds() { return _bonds; }
+std::vector<BondForceField> &ForceField::getBonds()
+{
+    _packedBondedTerms.reset();
+    return _bonds;
+}
 
 /**
  * @brief get angles
  *
+ * @details invalidates the packed bonded terms as the returned terms can
+ * be modified
+ *
  * @return std::vector<AngleForceField>&
  */
-std::vector<AngleForceField> &ForceField::getAngles() { return _angles; }
+std::vector<AngleForceField> &ForceField::getAngles()
+{
+    _packedBondedTerms.reset();
+    return _angles;
+}
 
 /**
  * @brief get dihedrals
  *
+ * @details invalidates the packed bonded terms as the returned terms can
+ * be modified
+ *
  * @return std::vector<DihedralForceField>&
  */
 std::vector<DihedralForceField> &ForceField::getDihedrals()
 {
+    _packedBondedTerms.reset();
     return _dihedrals;
 }
 
 /**
  * @brief get improper dihedrals
  *
+ * @details invalidates the packed bonded terms as the returned terms can
+ * be modified
+ *
  * @return std::vector<DihedralForceField>&
  */
 std::vector<DihedralForceField> &ForceField::getImproperDihedrals()
 {
+    _packedBondedTerms.reset();
     return _improperDihedrals;
 }
 
@@ -621,4 +879,14 @@ const std::vector<DihedralType> &ForceField::getImproperTypes() const
 const std::vector<JCouplingType> &ForceField::getJCouplTypes() const
 {
     return _jCouplingTypes;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief get the packed bonded terms
+ *
+ * @return const PackedBondedTerms&
+ */
+const PackedBondedTerms &ForceField::getPackedBondedTerms() const
+{
+    return _packedBondedTerms;
+}
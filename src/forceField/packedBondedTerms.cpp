@@ -0,0 +1,530 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "packedBondedTerms.hpp"
+
+#include <algorithm>   // for fill
+#include <cmath>       // for cos, sin, sqrt
+
+#include "atom.hpp"            // for Atom
+#include "molecule.hpp"        // for Molecule
+#include "physicalData.hpp"    // for PhysicalData
+#include "simulationBox.hpp"   // for SimulationBox
+#include "staticMatrix.hpp"    // for tensorProduct
+#include "vector3d.hpp"        // for Vec3D, norm, cross, dot, angle
+
+#ifdef WITH_OPENMP
+#include <omp.h>   // for omp_get_max_threads, omp_get_num_threads
+#endif
+
+using namespace forceField;
+using namespace simulationBox;
+using namespace physicalData;
+using namespace linearAlgebra;
+
+/**
+ * @brief adds an atom to the flat atom table if not already present
+ *
+ * @param molecule
+ * @param atomIndex index of the atom within the molecule
+ * @return size_t index of the atom in the flat atom table
+ */
+size_t PackedBondedTerms::addAtom(Molecule *molecule, const size_t atomIndex)
+{
+    auto *atom = &molecule->getAtom(atomIndex);
+
+    const auto [iter, inserted] =
+        _atomToIndex.try_emplace(atom, _atoms.size());
+
+    if (inserted)
+        _atoms.push_back(atom);
+
+    return iter->second;
+}
+
+/**
+ * @brief packs all non linker dihedrals of the given vector
+ *
+ * @param dihedrals
+ * @param linkers indices of the linker dihedrals
+ */
+void PackedBondedTerms::addDihedrals(
+    const std::vector<DihedralForceField> &dihedrals,
+    std::vector<size_t>                   &linkers
+)
+{
+    for (size_t i = 0; i < dihedrals.size(); ++i)
+    {
+        const auto &dihedral = dihedrals[i];
+
+        if (dihedral.isLinker())
+        {
+            linkers.push_back(i);
+            continue;
+        }
+
+        const auto &molecules   = dihedral.getMolecules();
+        const auto &atomIndices = dihedral.getAtomIndices();
+
+        _dihedralAtoms.push_back({
+            addAtom(molecules[0], atomIndices[0]),
+            addAtom(molecules[1], atomIndices[1]),
+            addAtom(molecules[2], atomIndices[2]),
+            addAtom(molecules[3], atomIndices[3]),
+        });
+
+        _dihedralForceConstants.push_back(dihedral.getForceConstant());
+        _dihedralPeriodicities.push_back(dihedral.getPeriodicity());
+        _dihedralPhaseShifts.push_back(dihedral.getPhaseShift());
+    }
+}
+
+/**
+ * @brief packs all bonded terms into the flat arrays
+ *
+ * @details has to be called after the force field parameters have been
+ * assigned to the bonded terms
+ *
+ * @param bonds
+ * @param angles
+ * @param dihedrals
+ * @param improperDihedrals
+ */
+void PackedBondedTerms::build(
+    const std::vector<BondForceField>     &bonds,
+    const std::vector<AngleForceField>    &angles,
+    const std::vector<DihedralForceField> &dihedrals,
+    const std::vector<DihedralForceField> &improperDihedrals
+)
+{
+    *this = PackedBondedTerms();
+
+    for (size_t i = 0; i < bonds.size(); ++i)
+    {
+        const auto &bond = bonds[i];
+
+        if (bond.isLinker())
+        {
+            _linkerBonds.push_back(i);
+            continue;
+        }
+
+        _bondAtoms.push_back({
+            addAtom(bond.getMolecule1(), bond.getAtomIndex1()),
+            addAtom(bond.getMolecule2(), bond.getAtomIndex2()),
+        });
+
+        _bondForceConstants.push_back(bond.getForceConstant());
+        _bondEquilLengths.push_back(bond.getEquilibriumBondLength());
+    }
+
+    for (size_t i = 0; i < angles.size(); ++i)
+    {
+        const auto &angle = angles[i];
+
+        if (angle.isLinker())
+        {
+            _linkerAngles.push_back(i);
+            continue;
+        }
+
+        const auto &molecules   = angle.getMolecules();
+        const auto &atomIndices = angle.getAtomIndices();
+
+        _angleAtoms.push_back({
+            addAtom(molecules[0], atomIndices[0]),
+            addAtom(molecules[1], atomIndices[1]),
+            addAtom(molecules[2], atomIndices[2]),
+        });
+
+        _angleForceConstants.push_back(angle.getForceConstant());
+        _angleEquilAngles.push_back(angle.getEquilibriumAngle());
+    }
+
+    addDihedrals(dihedrals, _linkerDihedrals);
+    _nProperDihedrals = _dihedralAtoms.size();
+    addDihedrals(improperDihedrals, _linkerImproperDihedrals);
+
+    _atomToIndex.clear();
+
+    _isBuilt = true;
+}
+
+/**
+ * @brief calculates energies, forces and virial of all packed bonded terms
+ *
+ * @details the math is identical to the calculateEnergyAndForces methods of
+ * BondForceField, AngleForceField and DihedralForceField (without linker
+ * corrections). If computeForces is false only the energies are calculated
+ * and the thread local buffers are neither cleared nor reduced.
+ *
+ * @tparam computeForces
+ * @param simBox
+ * @param physicalData
+ */
+template <bool computeForces>
+void PackedBondedTerms::calculate(
+    const SimulationBox &simBox,
+    PhysicalData        &physicalData
+)
+{
+    const auto nAtoms     = _atoms.size();
+    const auto nBonds     = getNumberOfBonds();
+    const auto nAngles    = getNumberOfAngles();
+    const auto nDihedrals = _dihedralAtoms.size();
+
+#ifdef WITH_OPENMP
+    const auto nThreads = size_t(omp_get_max_threads());
+#else
+    const auto nThreads = size_t(1);
+#endif
+
+    if (_threadForces.size() != nThreads)
+    {
+        _threadForces.assign(nThreads, std::vector<Vec3D>(nAtoms));
+        _threadVirials.assign(nThreads, tensor3D(0.0));
+    }
+
+    auto bondEnergy     = 0.0;
+    auto angleEnergy    = 0.0;
+    auto dihedralEnergy = 0.0;
+    auto improperEnergy = 0.0;
+
+    // the team might be smaller than the number of buffers (e.g. dynamic or
+    // nested teams) - only the buffers of the current team are up to date
+    auto nTeamThreads = size_t(1);
+
+    // clang-format off
+    #pragma omp parallel
+    // clang-format on
+    {
+#ifdef WITH_OPENMP
+        const auto thread     = size_t(omp_get_thread_num());
+        const auto nTeamLocal = size_t(omp_get_num_threads());
+#else
+        const auto thread     = size_t(0);
+        const auto nTeamLocal = size_t(1);
+#endif
+
+        if (thread == 0)
+            nTeamThreads = nTeamLocal;
+
+        auto &forces = _threadForces[thread];
+        auto &virial = _threadVirials[thread];
+
+        if constexpr (computeForces)
+        {
+            std::fill(forces.begin(), forces.end(), Vec3D(0.0, 0.0, 0.0));
+            virial = tensor3D(0.0);
+        }
+
+        auto position = [this](const size_t index)
+        { return _atoms[index]->getPosition(); };
+
+        /*********
+         * bonds *
+         *********/
+
+        // clang-format off
+        #pragma omp for schedule(static) reduction(+:bondEnergy) nowait
+        // clang-format on
+        for (size_t i = 0; i < nBonds; ++i)
+        {
+            const auto [atom1, atom2] = _bondAtoms[i];
+
+            auto dPosition = position(atom1) - position(atom2);
+            simBox.applyPBC(dPosition);
+
+            const auto distance      = norm(dPosition);
+            const auto deltaDistance = distance - _bondEquilLengths[i];
+
+            auto forceMagnitude = -_bondForceConstants[i] * deltaDistance;
+
+            bondEnergy += -forceMagnitude * deltaDistance / 2.0;
+
+            if constexpr (!computeForces)
+                continue;
+
+            forceMagnitude /= distance;
+
+            const auto force = forceMagnitude * dPosition;
+
+            forces[atom1] += force;
+            forces[atom2] -= force;
+
+            virial += tensorProduct(dPosition, force);
+        }
+
+        /**********
+         * angles *
+         **********/
+
+        // clang-format off
+        #pragma omp for schedule(static) reduction(+:angleEnergy) nowait
+        // clang-format on
+        for (size_t i = 0; i < nAngles; ++i)
+        {
+            const auto [atom1, atom2, atom3] = _angleAtoms[i];
+
+            const auto position1 = position(atom1);
+
+            auto dPosition12 = position1 - position(atom2);
+            auto dPosition13 = position1 - position(atom3);
+
+            simBox.applyPBC(dPosition12);
+            simBox.applyPBC(dPosition13);
+
+            const auto distance12Squared = normSquared(dPosition12);
+            const auto distance13Squared = normSquared(dPosition13);
+
+            const auto distance12 = ::sqrt(distance12Squared);
+            const auto distance13 = ::sqrt(distance13Squared);
+
+            const auto alpha      = angle(dPosition12, dPosition13);
+            const auto deltaAngle = alpha - _angleEquilAngles[i];
+
+            const auto forceMagnitude = -_angleForceConstants[i] * deltaAngle;
+
+            angleEnergy += -forceMagnitude * deltaAngle / 2.0;
+
+            if constexpr (!computeForces)
+                continue;
+
+            const auto normalDistance = distance12 * distance13 * ::sin(alpha);
+
+            auto normalPosition  = cross(dPosition13, dPosition12);
+            normalPosition      /= normalDistance;
+
+            auto force    = forceMagnitude / distance12Squared;
+            auto forcexyz = force * cross(dPosition12, normalPosition);
+
+            forces[atom1] -= forcexyz;
+            forces[atom2] += forcexyz;
+
+            force    = forceMagnitude / distance13Squared;
+            forcexyz = force * cross(normalPosition, dPosition13);
+
+            forces[atom1] -= forcexyz;
+            forces[atom3] += forcexyz;
+        }
+
+        /***********************************
+         * dihedrals and improper dihedrals *
+         ***********************************/
+
+        // clang-format off
+        #pragma omp for schedule(static) reduction(+:dihedralEnergy, improperEnergy)
+        // clang-format on
+        for (size_t i = 0; i < nDihedrals; ++i)
+        {
+            const auto [atom1, atom2, atom3, atom4] = _dihedralAtoms[i];
+
+            const auto position3 = position(atom3);
+
+            auto dPosition12 = position(atom1) - position(atom2);
+            auto dPosition23 = position(atom2) - position3;
+            auto dPosition43 = position(atom4) - position3;
+
+            simBox.applyPBC(dPosition12);
+            simBox.applyPBC(dPosition23);
+            simBox.applyPBC(dPosition43);
+
+            const auto crossPosition123 = cross(dPosition12, dPosition23);
+            const auto crossPosition432 = cross(dPosition43, dPosition23);
+
+            const auto distance123Squared = normSquared(crossPosition123);
+            const auto distance432Squared = normSquared(crossPosition432);
+
+            const auto distance23 = norm(dPosition23);
+
+            auto phi = angle(crossPosition123, crossPosition432);
+            phi      = dot(dPosition12, crossPosition432) > 0.0 ? -phi : phi;
+
+            const auto periodicity   = _dihedralPeriodicities[i];
+            const auto forceConstant = _dihedralForceConstants[i];
+            const auto phase         = periodicity * phi + _dihedralPhaseShifts[i];
+
+            const auto energy = forceConstant * (1.0 + ::cos(phase));
+
+            if (i < _nProperDihedrals)
+                dihedralEnergy += energy;
+            else
+                improperEnergy += energy;
+
+            if constexpr (!computeForces)
+                continue;
+
+            auto       forceMagnitude = distance23 / distance123Squared;
+            const auto forceVector12  = forceMagnitude * crossPosition123;
+
+            forceMagnitude           = distance23 / distance432Squared;
+            const auto forceVector43 = forceMagnitude * crossPosition432;
+
+            forceMagnitude             = dot(dPosition12, dPosition23);
+            forceMagnitude            /= (distance123Squared * distance23);
+            const auto forceVector123  = forceMagnitude * crossPosition123;
+
+            forceMagnitude             = dot(dPosition43, dPosition23);
+            forceMagnitude            /= (distance432Squared * distance23);
+            const auto forceVector432  = forceMagnitude * crossPosition432;
+
+            forceMagnitude = forceConstant * periodicity * ::sin(phase);
+
+            const auto diffForce123_432 = forceVector123 - forceVector432;
+
+            forces[atom1] += -forceMagnitude * forceVector12;
+            forces[atom2] += forceMagnitude * (forceVector12 + diffForce123_432);
+            forces[atom3] += forceMagnitude * (-forceVector43 - diffForce123_432);
+            forces[atom4] += forceMagnitude * forceVector43;
+        }
+
+        /*****************************************
+         * reduction of the thread local buffers *
+         *****************************************/
+
+        if constexpr (computeForces)
+        {
+            // clang-format off
+            #pragma omp for schedule(static)
+            // clang-format on
+            for (size_t atom = 0; atom < nAtoms; ++atom)
+            {
+                auto force = Vec3D(0.0, 0.0, 0.0);
+
+                for (size_t t = 0; t < nTeamLocal; ++t)
+                    force += _threadForces[t][atom];
+
+                _atoms[atom]->addForce(force);
+            }
+        }
+    }
+
+    if constexpr (computeForces)
+        for (size_t t = 0; t < nTeamThreads; ++t)
+            physicalData.addVirial(_threadVirials[t]);
+
+    physicalData.addBondEnergy(bondEnergy);
+    physicalData.addAngleEnergy(angleEnergy);
+    physicalData.addDihedralEnergy(dihedralEnergy);
+    physicalData.addImproperEnergy(improperEnergy);
+}
+
+template void PackedBondedTerms::calculate<true>(
+    const SimulationBox &,
+    PhysicalData &
+);
+
+template void PackedBondedTerms::calculate<false>(
+    const SimulationBox &,
+    PhysicalData &
+);
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief get the number of atoms participating in packed bonded terms
+ *
+ * @return size_t
+ */
+size_t PackedBondedTerms::getNumberOfAtoms() const { return _atoms.size(); }
+
+/**
+ * @brief get the number of packed bonds
+ *
+ * @return size_t
+ */
+size_t PackedBondedTerms::getNumberOfBonds() const { return _bondAtoms.size(); }
+
+/**
+ * @brief get the number of packed angles
+ *
+ * @return size_t
+ */
+size_t PackedBondedTerms::getNumberOfAngles() const
+{
+    return _angleAtoms.size();
+}
+
+/**
+ * @brief get the number of packed proper dihedrals
+ *
+ * @return size_t
+ */
+size_t PackedBondedTerms::getNumberOfDihedrals() const
+{
+    return _nProperDihedrals;
+}
+
+/**
+ * @brief get the number of packed improper dihedrals
+ *
+ * @return size_t
+ */
+size_t PackedBondedTerms::getNumberOfImproperDihedrals() const
+{
+    return _dihedralAtoms.size() - _nProperDihedrals;
+}
+
+/**
+ * @brief get the indices of the linker bonds
+ *
+ * @return const std::vector<size_t>&
+ */
+const std::vector<size_t> &PackedBondedTerms::getLinkerBonds() const
+{
+    return _linkerBonds;
+}
+
+/**
+ * @brief get the indices of the linker angles
+ *
+ * @return const std::vector<size_t>&
+ */
+const std::vector<size_t> &PackedBondedTerms::getLinkerAngles() const
+{
+    return _linkerAngles;
+}
+
+/**
+ * @brief get the indices of the linker dihedrals
+ *
+ * @return const std::vector<size_t>&
+ */
+const std::vector<size_t> &PackedBondedTerms::getLinkerDihedrals() const
+{
+    return _linkerDihedrals;
+}
+
+/**
+ * @brief get the indices of the linker improper dihedrals
+ *
+ * @return const std::vector<size_t>&
+ */
+const std::vector<size_t> &PackedBondedTerms::getLinkerImpropers() const
+{
+    return _linkerImproperDihedrals;
+}
@@ -31,6 +31,7 @@
 #include "mmmdEngine.hpp"   // for MMMDEngine
 #include "optEngine.hpp"    // for MMOptEngine
 #include "qmmdEngine.hpp"   // for QMMDEngine
+#include "qmmmMDEngine.hpp"            // for QMMMMDEngine
 #include "ringPolymerqmmdEngine.hpp"   // for RingPolymerQMMDEngine
 #include "settings.hpp"                // for Settings
 #include "stringUtilities.hpp"         // for toLowerCopy
@@ -69,6 +70,12 @@ GeneralInputParser::GeneralInputParser(Engine &engine) : InputFileParser(engine)
         bind_front(&GeneralInputParser::parseFloatingPointType, this),
         false
     );
+
+    addKeyword(
+        std::string("random_seed"),
+        bind_front(&GeneralInputParser::parseRandomSeed, this),
+        false
+    );
 }
 
 /**
@@ -89,6 +96,9 @@ void GeneralInputParser::parseJobType(
  * @details Possible options are:
  * 1) mm-md
  * 2) qm-md
+ * 3) qm-rpmd
+ * 4) qmmm-md
+ * 5) mm-opt
  *
  * @param lineElements
  * @param lineNumber
@@ -127,13 +137,19 @@ void GeneralInputParser::parseJobTypeForEngine(
         Settings::setJobtype(RING_POLYMER_QM_MD);
         engine.reset(new RingPolymerQMMDEngine());
     }
+    else if (jobtype == "qmmm_md")
+    {
+        Settings::setJobtype(QMMM_MD);
+        engine.reset(new QMMMMDEngine());
+    }
     else
         throw InputFileException(format(
             "Invalid jobtype \"{}\" in input file - possible values are:\n"
             "- mm-opt\n"
             "- mm-md\n"
             "- qm-md\n"
-            "- qm-rpmd\n",
+            "- qm-rpmd\n"
+            "- qmmm-md\n",
             lineElements[2]
         ));
 }
@@ -209,4 +225,31 @@ void GeneralInputParser::parseFloatingPointType(
             "Possible values are: float, double",
             lineElements[2]
         ));
-}
\ No newline at end of file
+}
+
+/**
+ * @brief parse the seed of the random number generators
+ *
+ * @param lineElements
+ * @param lineNumber
+ *
+ * @throw InputFileException if the seed is negative
+ */
+void GeneralInputParser::parseRandomSeed(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto randomSeed = std::stoll(lineElements[2]);
+
+    if (randomSeed < 0)
+        throw InputFileException(format(
+            "Invalid random seed \"{}\" in input file\n"
+            "The random seed must not be negative",
+            lineElements[2]
+        ));
+
+    Settings::setRandomSeed(size_t(randomSeed));
+}
@@ -26,6 +26,7 @@
 #include <format>       // for format
 #include <functional>   // for _Bind_front_t, bind_front
 
+#include "baoab.hpp"             // for BAOAB
 #include "exceptions.hpp"        // for InputFileException, customException
 #include "integrator.hpp"        // for VelocityVerlet, integrator
 #include "mdEngine.hpp"          // for Engine
@@ -66,11 +67,11 @@ IntegratorInputParser::IntegratorInputParser(Engine &engine)
  *
  * @details Possible options are:
  * 1) "v-verlet"  - velocity verlet integrator is used (default)
+ * 2) "baoab"     - BAOAB Langevin splitting integrator is used
  *
  * @param lineElements
  *
- * @throws InputFileException if integrator is not valid -
- * currently only velocity verlet is supported
+ * @throws InputFileException if integrator is not valid
  */
 void IntegratorInputParser::parseIntegrator(
     const std::vector<std::string> &lineElements,
@@ -93,6 +94,12 @@ void IntegratorInputParser::parseIntegrator(
         ReferencesOutput::addReferenceFile(_VELOCITY_VERLET_FILE_);
     }
 
+    else if (integrator == "baoab")
+    {
+        auto &mdEngine = dynamic_cast<MDEngine &>(_engine);
+        mdEngine.makeIntegrator(BAOAB());
+    }
+
     else
         throw InputFileException(std::format(
             "Invalid integrator \"{}\" at line {} in input file",
@@ -27,6 +27,7 @@
 #include <functional>    // for _Bind_front_t, bind_front
 #include <string_view>   // for string_view
 
+#include "defaults.hpp"           // for _MONTE_CARLO_MAX_VOLUME_CHANGE_
 #include "exceptions.hpp"         // for InputFileException, customException
 #include "manostatSettings.hpp"   // for ManostatSettings
 #include "references.hpp"         // for ReferencesOutput
@@ -47,7 +48,8 @@ using namespace utilities;
  * @details following keywords are added to the _keywordFuncMap,
  * _keywordRequiredMap and _keywordCountMap: 1) manostat <string> 2) pressure
  * <double> (only required if manostat is not none) 3) p_relaxation <double> 4)
- * compressibility <double>
+ * compressibility <double> 5) isotropy <string> 6) mc_freq <size_t> 7)
+ * mc_volume_change <double>
  *
  * @param engine
  */
@@ -83,6 +85,18 @@ ManostatInputParser::ManostatInputParser(Engine &engine)
         bind_front(&ManostatInputParser::parseIsotropy, this),
         false
     );
+
+    addKeyword(
+        std::string("mc_freq"),
+        bind_front(&ManostatInputParser::parseMonteCarloFrequency, this),
+        false
+    );
+
+    addKeyword(
+        std::string("mc_volume_change"),
+        bind_front(&ManostatInputParser::parseVolumeChange, this),
+        false
+    );
 }
 
 /**
@@ -92,11 +106,12 @@ ManostatInputParser::ManostatInputParser(Engine &engine)
  * 1) "none"                 - no manostat is used (default)
  * 2) "berendsen"            - berendsen manostat is used
  * 3) "stochastic_rescaling" - stochastic rescaling manostat is used
+ * 4) "monte_carlo"          - Monte Carlo manostat is used
  *
  * @param lineElements
  *
- * @throws InputFileException if manostat is not berendsen or
- * none
+ * @throws InputFileException if manostat is not berendsen,
+ * stochastic_rescaling, monte_carlo or none
  */
 void ManostatInputParser::parseManostat(
     const std::vector<std::string> &lineElements,
@@ -124,10 +139,17 @@ void ManostatInputParser::parseManostat(
         ReferencesOutput::addReferenceFile(_STOCHASTIC_RESCALING_FILE_);
     }
 
+    else if (manostat == "monte_carlo")
+    {
+        ManostatSettings::setManostatType(MONTE_CARLO);
+        ReferencesOutput::addReferenceFile(_MONTE_CARLO_FILE_);
+    }
+
     else
         throw InputFileException(std::format(
             "Invalid manostat \"{}\" at line {} in input file.\n"
-            "Possible options are: berendsen, stochastic_rescaling and none",
+            "Possible options are: berendsen, stochastic_rescaling, "
+            "monte_carlo and none",
             lineElements[2],
             lineNumber
         ));
@@ -262,4 +284,62 @@ void ManostatInputParser::parseIsotropy(
             lineElements[2],
             lineNumber
         ));
+}
+
+/**
+ * @brief Parse the frequency of the Monte Carlo volume moves
+ *
+ * @details default value is 25 steps
+ *
+ * @param lineElements
+ *
+ * @throw InputFileException if the frequency is not positive
+ */
+void ManostatInputParser::parseMonteCarloFrequency(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+    const auto frequency = stoi(lineElements[2]);
+
+    if (frequency <= 0)
+        throw InputFileException(std::format(
+            "Monte Carlo manostat frequency must be positive - in input file "
+            "in line {}",
+            lineNumber
+        ));
+
+    ManostatSettings::setMonteCarloFrequency(size_t(frequency));
+}
+
+/**
+ * @brief Parse the initial maximum volume change of the Monte Carlo volume
+ * moves relative to the box volume
+ *
+ * @details default value is 0.01
+ *
+ * @param lineElements
+ *
+ * @throw InputFileException if the volume change is not in (0, 0.5]
+ */
+void ManostatInputParser::parseVolumeChange(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+    const auto volumeChange = stod(lineElements[2]);
+
+    const auto maxVolumeChange = defaults::_MONTE_CARLO_MAX_VOLUME_CHANGE_;
+
+    if (volumeChange <= 0.0 || volumeChange > maxVolumeChange)
+        throw InputFileException(std::format(
+            "Monte Carlo volume change must be in (0, {}] - in input file in "
+            "line {}",
+            maxVolumeChange,
+            lineNumber
+        ));
+
+    ManostatSettings::setVolumeChange(volumeChange);
 }
\ No newline at end of file
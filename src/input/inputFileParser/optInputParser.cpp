@@ -43,6 +43,14 @@ using namespace engine;
  * - n-iterations <int>
  * - learning-rate-strategy <string>
  * - initial-learning-rate <double>
+ * - lbfgs-memory <int>
+ * - fire-timestep <double>
+ * - fire-max-timestep <double>
+ * - fire-n-min <int>
+ * - fire-timestep-increase <double>
+ * - fire-timestep-decrease <double>
+ * - fire-alpha-start <double>
+ * - fire-alpha-decrease <double>
  *
  * @param engine The engine
  */
@@ -89,6 +97,54 @@ OptInputParser::OptInputParser(Engine &engine) : InputFileParser(engine)
         bind_front(&OptInputParser::parseMaxLearningRate, this),
         false
     );
+
+    addKeyword(
+        "lbfgs-memory",
+        bind_front(&OptInputParser::parseLBFGSMemory, this),
+        false
+    );
+
+    addKeyword(
+        "fire-timestep",
+        bind_front(&OptInputParser::parseFireTimestep, this),
+        false
+    );
+
+    addKeyword(
+        "fire-max-timestep",
+        bind_front(&OptInputParser::parseFireMaxTimestep, this),
+        false
+    );
+
+    addKeyword(
+        "fire-n-min",
+        bind_front(&OptInputParser::parseFireNMin, this),
+        false
+    );
+
+    addKeyword(
+        "fire-timestep-increase",
+        bind_front(&OptInputParser::parseFireTimestepIncrease, this),
+        false
+    );
+
+    addKeyword(
+        "fire-timestep-decrease",
+        bind_front(&OptInputParser::parseFireTimestepDecrease, this),
+        false
+    );
+
+    addKeyword(
+        "fire-alpha-start",
+        bind_front(&OptInputParser::parseFireAlphaStart, this),
+        false
+    );
+
+    addKeyword(
+        "fire-alpha-decrease",
+        bind_front(&OptInputParser::parseFireAlphaDecrease, this),
+        false
+    );
 }
 
 /**
@@ -117,16 +173,237 @@ void OptInputParser::parseOptimizer(
     else if ("adam" == method)
         OptimizerSettings::setOptimizer(ADAM);
 
+    else if ("lbfgs" == method || "l_bfgs" == method)
+        OptimizerSettings::setOptimizer(LBFGS);
+
+    else if ("fire" == method)
+        OptimizerSettings::setOptimizer(FIRE);
+
     else
         throw InputFileException(std::format(
             "Unknown optimizer method \"{}\" in input file "
             "at line {}.\nPossible options are: steepest-descent, "
-            "adam",
+            "adam, lbfgs, fire",
             lineElements[2],
             lineNumber
         ));
 }
 
+/**
+ * @brief Parses the number of stored correction pairs of the L-BFGS optimizer
+ *
+ * @param lineElements The elements of the line
+ * @param lineNumber The line number
+ *
+ * @throws InputFileException if the memory is less than or equal to 0
+ */
+void OptInputParser::parseLBFGSMemory(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto memory = std::stoi(lineElements[2]);
+
+    if (memory <= 0)
+        throw InputFileException(std::format(
+            "L-BFGS memory must be greater than 0 in input file at line {}.",
+            lineNumber
+        ));
+
+    OptimizerSettings::setLBFGSMemory(size_t(memory));
+}
+
+/**
+ * @brief Parses the initial timestep of the FIRE optimizer
+ *
+ * @param lineElements The elements of the line
+ * @param lineNumber The line number
+ *
+ * @throws InputFileException if the timestep is less than or equal to 0.0
+ */
+void OptInputParser::parseFireTimestep(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto timestep = std::stod(lineElements[2]);
+
+    if (timestep <= 0.0)
+        throw InputFileException(std::format(
+            "FIRE timestep must be greater than 0.0 in input file at line {}.",
+            lineNumber
+        ));
+
+    OptimizerSettings::setFireTimestep(timestep);
+}
+
+/**
+ * @brief Parses the maximum timestep of the FIRE optimizer
+ *
+ * @param lineElements The elements of the line
+ * @param lineNumber The line number
+ *
+ * @throws InputFileException if the timestep is less than or equal to 0.0
+ */
+void OptInputParser::parseFireMaxTimestep(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto maxTimestep = std::stod(lineElements[2]);
+
+    if (maxTimestep <= 0.0)
+        throw InputFileException(std::format(
+            "FIRE maximum timestep must be greater than 0.0 in input file at "
+            "line {}.",
+            lineNumber
+        ));
+
+    OptimizerSettings::setFireMaxTimestep(maxTimestep);
+}
+
+/**
+ * @brief Parses the number of downhill steps of the FIRE optimizer before
+ * the timestep is increased
+ *
+ * @param lineElements The elements of the line
+ * @param lineNumber The line number
+ *
+ * @throws InputFileException if the number is negative
+ */
+void OptInputParser::parseFireNMin(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto nMin = std::stoi(lineElements[2]);
+
+    if (nMin < 0)
+        throw InputFileException(std::format(
+            "FIRE n-min must not be negative in input file at line {}.",
+            lineNumber
+        ));
+
+    OptimizerSettings::setFireNMin(size_t(nMin));
+}
+
+/**
+ * @brief Parses the timestep increase factor of the FIRE optimizer
+ *
+ * @param lineElements The elements of the line
+ * @param lineNumber The line number
+ *
+ * @throws InputFileException if the factor is less than or equal to 1.0
+ */
+void OptInputParser::parseFireTimestepIncrease(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto factor = std::stod(lineElements[2]);
+
+    if (factor <= 1.0)
+        throw InputFileException(std::format(
+            "FIRE timestep increase must be greater than 1.0 in input file at "
+            "line {}.",
+            lineNumber
+        ));
+
+    OptimizerSettings::setFireTimestepIncrease(factor);
+}
+
+/**
+ * @brief Parses the timestep decrease factor of the FIRE optimizer
+ *
+ * @param lineElements The elements of the line
+ * @param lineNumber The line number
+ *
+ * @throws InputFileException if the factor is not in (0.0, 1.0)
+ */
+void OptInputParser::parseFireTimestepDecrease(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto factor = std::stod(lineElements[2]);
+
+    if (factor <= 0.0 || factor >= 1.0)
+        throw InputFileException(std::format(
+            "FIRE timestep decrease must be between 0.0 and 1.0 in input file "
+            "at line {}.",
+            lineNumber
+        ));
+
+    OptimizerSettings::setFireTimestepDecrease(factor);
+}
+
+/**
+ * @brief Parses the initial mixing parameter of the FIRE optimizer
+ *
+ * @param lineElements The elements of the line
+ * @param lineNumber The line number
+ *
+ * @throws InputFileException if the parameter is not in (0.0, 1.0)
+ */
+void OptInputParser::parseFireAlphaStart(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto alpha = std::stod(lineElements[2]);
+
+    if (alpha <= 0.0 || alpha >= 1.0)
+        throw InputFileException(std::format(
+            "FIRE alpha start must be between 0.0 and 1.0 in input file at "
+            "line {}.",
+            lineNumber
+        ));
+
+    OptimizerSettings::setFireAlphaStart(alpha);
+}
+
+/**
+ * @brief Parses the decrease factor of the mixing parameter of the FIRE
+ * optimizer
+ *
+ * @param lineElements The elements of the line
+ * @param lineNumber The line number
+ *
+ * @throws InputFileException if the factor is not in (0.0, 1.0)
+ */
+void OptInputParser::parseFireAlphaDecrease(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto factor = std::stod(lineElements[2]);
+
+    if (factor <= 0.0 || factor >= 1.0)
+        throw InputFileException(std::format(
+            "FIRE alpha decrease must be between 0.0 and 1.0 in input file at "
+            "line {}.",
+            lineNumber
+        ));
+
+    OptimizerSettings::setFireAlphaDecrease(factor);
+}
+
 /**
  * @brief Parses the learning rate strategy
  *
@@ -27,11 +27,13 @@
 
 #include "exceptions.hpp"           // for InputFileException
 #include "outputFileSettings.hpp"   // for OutputFileSettings
+#include "stringUtilities.hpp"      // for toLowerCopy
 
 using namespace input;
 using namespace engine;
 using namespace customException;
 using namespace settings;
+using namespace utilities;
 
 /**
  * @brief Construct a new Input File Parser Output:: Input File Parser Output
@@ -63,6 +65,13 @@ using namespace settings;
  * 22) rpmd_force_file <string>
  * 23) rpmd_charge_file <string>
  * 24) rpmd_energy_file <string>
+ * 25) async_output <on/off>
+ * 26) checkpoint_file <string>
+ * 27) observable_output <on/off>
+ * 28) observable_file <string>
+ * 29) timings_trace <on/off>
+ * 30) timings_trace_file <string>
+ * 31) replica_exchange_file <string>
  *
  * @param engine
  */
@@ -78,6 +87,21 @@ OutputInputParser::OutputInputParser(Engine &engine) : InputFileParser(engine)
         bind_front(&OutputInputParser::parseFilePrefix, this),
         false
     );
+    addKeyword(
+        std::string("async_output"),
+        bind_front(&OutputInputParser::parseAsyncOutput, this),
+        false
+    );
+    addKeyword(
+        std::string("observable_output"),
+        bind_front(&OutputInputParser::parseObservableOutput, this),
+        false
+    );
+    addKeyword(
+        std::string("timings_trace"),
+        bind_front(&OutputInputParser::parseTimingsTrace, this),
+        false
+    );
     addKeyword(
         std::string("output_file"),
         bind_front(&OutputInputParser::parseLogFilename, this),
@@ -123,6 +147,16 @@ OutputInputParser::OutputInputParser(Engine &engine) : InputFileParser(engine)
         bind_front(&OutputInputParser::parseRestartFilename, this),
         false
     );
+    addKeyword(
+        std::string("checkpoint_file"),
+        bind_front(&OutputInputParser::parseCheckpointFilename, this),
+        false
+    );
+    addKeyword(
+        std::string("observable_file"),
+        bind_front(&OutputInputParser::parseObservableFilename, this),
+        false
+    );
     addKeyword(
         std::string("charge_file"),
         bind_front(&OutputInputParser::parseChargeFilename, this),
@@ -153,6 +187,11 @@ OutputInputParser::OutputInputParser(Engine &engine) : InputFileParser(engine)
         bind_front(&OutputInputParser::parseTimingsFilename, this),
         false
     );
+    addKeyword(
+        std::string("timings_trace_file"),
+        bind_front(&OutputInputParser::parseTimingsTraceFilename, this),
+        false
+    );
     addKeyword(
         std::string("opt_file"),
         bind_front(&OutputInputParser::parseOptFilename, this),
@@ -188,6 +227,11 @@ OutputInputParser::OutputInputParser(Engine &engine) : InputFileParser(engine)
         bind_front(&OutputInputParser::parseRPMDEnergyFilename, this),
         false
     );
+    addKeyword(
+        std::string("replica_exchange_file"),
+        bind_front(&OutputInputParser::parseReplicaExchangeFilename, this),
+        false
+    );
 }
 
 /**
@@ -234,6 +278,119 @@ void OutputInputParser::parseFilePrefix(
     OutputFileSettings::setFilePrefix(lineElements[2]);
 }
 
+/**
+ * @brief parse if the output files are written by a background thread
+ *
+ * @details Possible options are:
+ * 1) "on"  - output files are written asynchronously (default)
+ * 2) "off" - output files are written by the simulation thread
+ *
+ * @param lineElements
+ *
+ * @throws InputFileException if async_output keyword is not "on" or "off"
+ */
+void OutputInputParser::parseAsyncOutput(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto asyncOutput = toLowerCopy(lineElements[2]);
+
+    if (asyncOutput == "on")
+        OutputFileSettings::setAsyncOutput(true);
+
+    else if (asyncOutput == "off")
+        OutputFileSettings::setAsyncOutput(false);
+
+    else
+        throw InputFileException(std::format(
+            "Invalid async_output keyword \"{}\" "
+            "at line {} in input file\n"
+            "Possible keywords are \"on\" and \"off\"",
+            lineElements[2],
+            lineNumber
+        ));
+}
+
+/**
+ * @brief parse if the observables are recorded into the binary observable
+ * file
+ *
+ * @details Possible options are:
+ * 1) "on"  - energy, instant energy, momentum, virial, stress and box data
+ *            are recorded into the binary observable file
+ * 2) "off" - the data is written to the text files (default)
+ *
+ * @param lineElements
+ *
+ * @throws InputFileException if observable_output keyword is not "on" or
+ * "off"
+ */
+void OutputInputParser::parseObservableOutput(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto observableOutput = toLowerCopy(lineElements[2]);
+
+    if (observableOutput == "on")
+        OutputFileSettings::setObservableOutput(true);
+
+    else if (observableOutput == "off")
+        OutputFileSettings::setObservableOutput(false);
+
+    else
+        throw InputFileException(std::format(
+            "Invalid observable_output keyword \"{}\" "
+            "at line {} in input file\n"
+            "Possible keywords are \"on\" and \"off\"",
+            lineElements[2],
+            lineNumber
+        ));
+}
+
+/**
+ * @brief parse if the timings sections are recorded and written to the
+ * timings trace file
+ *
+ * @details Possible options are:
+ * 1) "on"  - every finished timings section is recorded and written as
+ *            Chrome/Perfetto trace file at the end of the simulation
+ * 2) "off" - only the accumulated timings are written (default)
+ *
+ * @param lineElements
+ *
+ * @throws InputFileException if timings_trace keyword is not "on" or "off"
+ */
+void OutputInputParser::parseTimingsTrace(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto timingsTrace = toLowerCopy(lineElements[2]);
+
+    if (timingsTrace == "on")
+        OutputFileSettings::setTimingsTraceOutput(true);
+
+    else if (timingsTrace == "off")
+        OutputFileSettings::setTimingsTraceOutput(false);
+
+    else
+        throw InputFileException(std::format(
+            "Invalid timings_trace keyword \"{}\" "
+            "at line {} in input file\n"
+            "Possible keywords are \"on\" and \"off\"",
+            lineElements[2],
+            lineNumber
+        ));
+}
+
 /**
  * @brief parse log filename of simulation and add it to output
  *
@@ -378,6 +535,38 @@ void OutputInputParser::parseRestartFilename(
     OutputFileSettings::setRestartFileName(lineElements[2]);
 }
 
+/**
+ * @brief parse binary checkpoint filename of simulation and add it to output
+ *
+ * @details default value is default.chk
+ *
+ * @param lineElements
+ */
+void OutputInputParser::parseCheckpointFilename(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+    OutputFileSettings::setCheckpointFileName(lineElements[2]);
+}
+
+/**
+ * @brief parse binary observable filename of simulation and add it to output
+ *
+ * @details default value is default.obs
+ *
+ * @param lineElements
+ */
+void OutputInputParser::parseObservableFilename(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+    OutputFileSettings::setObservableFileName(lineElements[2]);
+}
+
 /**
  * @brief parse charge filename of simulation and add it to output
  *
@@ -474,6 +663,22 @@ void OutputInputParser::parseTimingsFilename(
     OutputFileSettings::setTimingsFileName(lineElements[2]);
 }
 
+/**
+ * @brief parse timings trace filename of simulation and add it to output
+ *
+ * @details default value is default.trace.json
+ *
+ * @param lineElements
+ */
+void OutputInputParser::parseTimingsTraceFilename(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+    OutputFileSettings::setTimingsTraceFileName(lineElements[2]);
+}
+
 /**
  * @brief parse optimization filename of simulation and add it to output
  *
@@ -584,4 +789,20 @@ void OutputInputParser::parseRPMDEnergyFilename(
 {
     checkCommand(lineElements, lineNumber);
     OutputFileSettings::setRingPolymerEnergyFileName(lineElements[2]);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief parse replica exchange filename of simulation and add it to output
+ *
+ * @details default value is default.rex
+ *
+ * @param lineElements
+ */
+void OutputInputParser::parseReplicaExchangeFilename(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+    OutputFileSettings::setReplicaExchangeFileName(lineElements[2]);
+}
@@ -0,0 +1,145 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "replicaExchangeInputParser.hpp"
+
+#include <algorithm>    // for ranges::sort, ranges::adjacent_find
+#include <format>       // for format
+#include <functional>   // for _Bind_front_t, bind_front
+#include <string>       // for stod, stoi
+#include <vector>       // for vector
+
+#include "exceptions.hpp"                // for InputFileException
+#include "replicaExchangeSettings.hpp"   // for ReplicaExchangeSettings
+
+using namespace input;
+using namespace engine;
+using namespace customException;
+using namespace settings;
+
+/**
+ * @brief Construct a new ReplicaExchangeInputParser::
+ * ReplicaExchangeInputParser object
+ *
+ * @details following keywords are added to the _keywordFuncMap,
+ * _keywordRequiredMap and _keywordCountMap: 1) replica_temperatures
+ * <double> <double> ... 2) replica_exchange_freq <size_t>
+ *
+ * @param engine
+ */
+ReplicaExchangeInputParser::ReplicaExchangeInputParser(Engine &engine)
+    : InputFileParser(engine)
+{
+    addKeyword(
+        std::string("replica_temperatures"),
+        bind_front(&ReplicaExchangeInputParser::parseTemperatures, this),
+        false
+    );
+
+    addKeyword(
+        std::string("replica_exchange_freq"),
+        bind_front(&ReplicaExchangeInputParser::parseExchangeFrequency, this),
+        false
+    );
+}
+
+/**
+ * @brief parse the temperatures of the replicas for replica exchange md
+ *
+ * @details the temperatures are sorted in ascending order, the position of a
+ * temperature in this order is the index of the replica started at this
+ * temperature
+ *
+ * @param lineElements
+ * @param lineNumber
+ *
+ * @throws InputFileException if less than two temperatures are given
+ * @throws InputFileException if a temperature is not positive
+ * @throws InputFileException if a temperature is given twice
+ */
+void ReplicaExchangeInputParser::parseTemperatures(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommandArray(lineElements, lineNumber);
+
+    if (lineElements.size() < 4)
+        throw InputFileException(std::format(
+            "At least two replica temperatures are required - in input file "
+            "in line {}",
+            lineNumber
+        ));
+
+    std::vector<double> temperatures;
+
+    for (size_t i = 2; i < lineElements.size(); ++i)
+    {
+        const auto temperature = std::stod(lineElements[i]);
+
+        if (temperature <= 0.0)
+            throw InputFileException(std::format(
+                "Replica temperatures must be positive - in input file in "
+                "line {}",
+                lineNumber
+            ));
+
+        temperatures.push_back(temperature);
+    }
+
+    std::ranges::sort(temperatures);
+
+    if (std::ranges::adjacent_find(temperatures) != temperatures.end())
+        throw InputFileException(std::format(
+            "Replica temperatures must be unique - in input file in line {}",
+            lineNumber
+        ));
+
+    ReplicaExchangeSettings::setTemperatures(temperatures);
+}
+
+/**
+ * @brief parse the number of steps between two replica exchange attempts
+ *
+ * @param lineElements
+ * @param lineNumber
+ *
+ * @throws InputFileException if the frequency is not positive
+ */
+void ReplicaExchangeInputParser::parseExchangeFrequency(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto exchangeFrequency = std::stoi(lineElements[2]);
+
+    if (exchangeFrequency <= 0)
+        throw InputFileException(std::format(
+            "Replica exchange frequency must be positive - in input file in "
+            "line {}",
+            lineNumber
+        ));
+
+    ReplicaExchangeSettings::setExchangeFrequency(size_t(exchangeFrequency));
+}
@@ -45,7 +45,7 @@ using namespace utilities;
  *
  * @details following keywords are added to the _keywordFuncMap,
  * _keywordRequiredMap and _keywordCountMap: 1) rcoulomb <double> 2) density
- * <double>
+ * <double> 3) init_velocities <bool> 4) hmr_mass <double>
  *
  * @param engine
  */
@@ -67,6 +67,11 @@ SimulationBoxInputParser::SimulationBoxInputParser(Engine &engine)
         bind_front(&SimulationBoxInputParser::parseInitializeVelocities, this),
         false
     );
+    addKeyword(
+        std::string("hmr_mass"),
+        bind_front(&SimulationBoxInputParser::parseHMRHydrogenMass, this),
+        false
+    );
 }
 
 /**
@@ -160,4 +165,35 @@ void SimulationBoxInputParser::parseInitializeVelocities(
             lineElements[2],
             lineNumber
         ));
-}
\ No newline at end of file
+}
+
+/**
+ * @brief parse the target hydrogen mass of the hydrogen mass repartitioning
+ *
+ * @details the mass is given in amu - if the keyword is not given, the
+ * masses are not repartitioned
+ *
+ * @param lineElements
+ * @param lineNumber
+ *
+ * @throw InputFileException if the mass is not positive
+ */
+void SimulationBoxInputParser::parseHMRHydrogenMass(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto hydrogenMass = stod(lineElements[2]);
+
+    if (hydrogenMass <= 0.0)
+        throw InputFileException(std::format(
+            "Hydrogen mass for hydrogen mass repartitioning must be positive - "
+            "\"{}\" at line {} in input file",
+            lineElements[2],
+            lineNumber
+        ));
+
+    SimulationBoxSettings::setHMRHydrogenMass(hydrogenMass);
+}
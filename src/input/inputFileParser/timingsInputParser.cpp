@@ -22,23 +22,26 @@
 
 #include "timingsInputParser.hpp"
 
+#include <format>        // for format
 #include <functional>    // for _Bind_front_t, bind_front
 #include <string_view>   // for string_view
 
 #include "exceptions.hpp"        // for InputFileException
+#include "stringUtilities.hpp"   // for toLowerCopy
 #include "timingsSettings.hpp"   // for TimingsSettings
 
 using namespace input;
 using namespace engine;
 using namespace customException;
 using namespace settings;
+using namespace utilities;
 
 /**
  * @brief Construct a new Input File Parser Timings object
  *
  * @details following keywords are added to the _keywordFuncMap,
  * _keywordRequiredMap and _keywordCountMap: 1) timestep <double> (required) 2)
- * nstep <size_t> (required)
+ * nstep <size_t> (required) 3) hardware_counters <on/off>
  *
  * @param engine
  */
@@ -55,6 +58,12 @@ TimingsInputParser::TimingsInputParser(Engine &engine) : InputFileParser(engine)
         bind_front(&TimingsInputParser::parseNumberOfSteps, this),
         true
     );
+
+    addKeyword(
+        std::string("hardware_counters"),
+        bind_front(&TimingsInputParser::parseHardwareCounters, this),
+        false
+    );
 }
 
 /**
@@ -91,4 +100,43 @@ void TimingsInputParser::parseNumberOfSteps(
         throw InputFileException("Number of steps cannot be negative");
 
     TimingsSettings::setNumberOfSteps(size_t(numberOfSteps));
-}
\ No newline at end of file
+}
+
+/**
+ * @brief parse if hardware performance counters are recorded for the
+ * timings sections
+ *
+ * @details Possible options are:
+ * 1) "on"  - cycles, instructions, cache misses and branch misses are
+ *            counted via perf_event_open if available
+ * 2) "off" - only the wall time is measured (default)
+ *
+ * @param lineElements
+ *
+ * @throws InputFileException if hardware_counters keyword is not "on" or
+ * "off"
+ */
+void TimingsInputParser::parseHardwareCounters(
+    const std::vector<std::string> &lineElements,
+    const size_t                    lineNumber
+)
+{
+    checkCommand(lineElements, lineNumber);
+
+    const auto hardwareCounters = toLowerCopy(lineElements[2]);
+
+    if (hardwareCounters == "on")
+        TimingsSettings::setHardwareCounters(true);
+
+    else if (hardwareCounters == "off")
+        TimingsSettings::setHardwareCounters(false);
+
+    else
+        throw InputFileException(std::format(
+            "Invalid hardware_counters keyword \"{}\" "
+            "at line {} in input file\n"
+            "Possible keywords are \"on\" and \"off\"",
+            lineElements[2],
+            lineNumber
+        ));
+}
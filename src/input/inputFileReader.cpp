@@ -45,6 +45,7 @@
 #include "nonCoulombInputParser.hpp"         // for InputFileParserNonCoulomb
 #include "optInputParser.hpp"                // for OptInputParser
 #include "outputInputParser.hpp"             // for InputFileParserOutput
+#include "replicaExchangeInputParser.hpp"    // for ReplicaExchangeInputParser
 #include "resetKineticsInputParser.hpp"      // for InputFileParserResetKinetics
 #include "ringPolymerInputParser.hpp"        // for InputFileParserRingPolymer
 #include "simulationBoxInputParser.hpp"      // for InputFileParserSimulationBox
@@ -91,6 +92,7 @@ InputFileReader::InputFileReader(
     _parsers.push_back(make_unique<VirialInputParser>(_engine));
     _parsers.push_back(make_unique<HybridInputParser>(_engine));
     _parsers.push_back(make_unique<RingPolymerInputParser>(_engine));
+    _parsers.push_back(make_unique<ReplicaExchangeInputParser>(_engine));
 
     _parsers.push_back(make_unique<ConvInputParser>(_engine));
     _parsers.push_back(make_unique<OptInputParser>(_engine));
@@ -33,7 +33,7 @@
 #include "forceFieldClass.hpp"   // for ForceField
 #include "moleculeType.hpp"      // for Molecule
 #include "simulationBox.hpp"     // for SimulationBox
-#include "stringUtilities.hpp"   // for removeComments, splitString
+#include "stringUtilities.hpp"   // for stripComments, splitString
 
 using namespace input::molDescriptor;
 using namespace settings;
@@ -45,16 +45,15 @@ using namespace customException;
 /**
  * @brief constructor
  *
- * @details opens moldescritor file pointer
+ * @details maps the moldescriptor file into memory
  *
  * @param engine
- *
- * @throw InputFileException if file not found
  */
-MoldescriptorReader::MoldescriptorReader(Engine &engine) : _engine(engine)
+MoldescriptorReader::MoldescriptorReader(Engine &engine)
+    : _fileName(FileSettings::getMolDescriptorFileName()),
+      _fp(_fileName),
+      _engine(engine)
 {
-    _fileName = FileSettings::getMolDescriptorFileName();
-    _fp.open(_fileName);
 }
 
 /**
@@ -88,14 +87,13 @@ void input::molDescriptor::readMolDescriptor(Engine &engine)
  */
 void MoldescriptorReader::read()
 {
-    std::string line;
+    std::string_view line;
 
     _lineNumber = 0;
 
-    while (getline(_fp, line))
+    while (_fp.getLine(line))
     {
-        line              = removeComments(line, "#");
-        auto lineElements = splitString(line);
+        auto lineElements = splitString(stripComments(line, "#"));
 
         ++_lineNumber;
 
@@ -161,20 +159,18 @@ void MoldescriptorReader::processMolecule(std::vector<std::string> &lineElements
     molecule.setCharge(stod(lineElements[2]));
     molecule.setMoltype(simBox.getMoleculeTypes().size() + 1);
 
-    std::string line;
-    size_t      atomCount = 0;
+    std::string_view line;
+    size_t           atomCount = 0;
 
     while (atomCount < molecule.getNumberOfAtoms())
     {
-        if (_fp.eof())
+        if (!_fp.getLine(line))
             throw MolDescriptorException(
                 "Error reading of moldescriptor stopped before last molecule "
                 "was finished"
             );
 
-        getline(_fp, line);
-        line         = removeComments(line, "#");
-        lineElements = splitString(line);
+        lineElements = splitString(stripComments(line, "#"));
 
         ++_lineNumber;
 
@@ -35,7 +35,7 @@
 #include "improperDihedralSection.hpp"   // for ImproperDihedralSection
 #include "jCouplingSection.hpp"          // for JCouplingSection
 #include "nonCoulombicsSection.hpp"      // for NonCoulombicsSection
-#include "stringUtilities.hpp"   // for removeComments, splitString, toLowerCopy
+#include "stringUtilities.hpp"   // for stripComments, splitString, toLowerCopy
 #include "typesSection.hpp"      // for TypesSection
 
 using namespace input::parameterFile;
@@ -129,13 +129,12 @@ void ParameterFileReader::read()
             "Parameter file needed for requested simulation setup"
         );
 
-    std::string line;
-    int         lineNumber = 1;
+    std::string_view line;
+    int              lineNumber = 1;
 
-    while (getline(_fp, line))
+    while (_fp.getLine(line))
     {
-        line              = removeComments(line, "#");
-        auto lineElements = splitString(line);
+        auto lineElements = splitString(stripComments(line, "#"));
 
         if (lineElements.empty())
         {
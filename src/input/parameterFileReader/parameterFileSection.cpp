@@ -22,10 +22,10 @@
 
 #include "parameterFileSection.hpp"
 
-#include <fstream>   // for getline
+#include <string_view>   // for string_view
 
 #include "exceptions.hpp"        // for ParameterFileException
-#include "stringUtilities.hpp"   // for removeComments, splitString, toLowerCopy
+#include "stringUtilities.hpp"   // for stripComments, splitString, toLowerCopy
 
 using namespace input::parameterFile;
 using namespace utilities;
@@ -49,13 +49,12 @@ void ParameterFileSection::process(
 {
     processHeader(lineElements, engine);
 
-    std::string line;
-    auto        endedNormal = false;
+    std::string_view line;
+    auto             endedNormal = false;
 
-    while (getline(*_fp, line))
+    while (_fp->getLine(line))
     {
-        line         = removeComments(line, "#");
-        lineElements = splitString(line);
+        lineElements = splitString(stripComments(line, "#"));
 
         if (lineElements.empty())
         {
@@ -109,7 +108,7 @@ void ParameterFileSection::setLineNumber(const int lineNumber)
  *
  * @param fp
  */
-void ParameterFileSection::setFp(std::ifstream *fp) { _fp = fp; }
+void ParameterFileSection::setFp(utilities::MappedFile *fp) { _fp = fp; }
 
 /**
  * @brief get line number of section
@@ -22,12 +22,13 @@
 
 #include "atomSection.hpp"
 
-#include <cstddef>    // for size_t
-#include <format>     // for format
-#include <iostream>   // for operator<<, basic_ostream::operator<<
-#include <memory>     // for unique_ptr, make_unique
-#include <string>     // for string, stod, stoul, getline, char_traits
-#include <vector>     // for vector
+#include <cstddef>       // for size_t
+#include <format>        // for format
+#include <iostream>      // for operator<<, basic_ostream::operator<<
+#include <memory>        // for unique_ptr, make_unique
+#include <string>        // for string
+#include <string_view>   // for string_view
+#include <vector>        // for vector
 
 #include "atom.hpp"              // for Atom
 #include "engine.hpp"            // for Engine
@@ -36,7 +37,7 @@
 #include "moleculeType.hpp"      // for MoleculeType
 #include "settings.hpp"          // for Settings
 #include "simulationBox.hpp"     // for SimulationBox
-#include "stringUtilities.hpp"   // for removeComments, splitString
+#include "stringUtilities.hpp"   // for stripComments, stringToDouble
 
 using namespace input::restartFile;
 using namespace simulationBox;
@@ -47,13 +48,32 @@ using namespace utilities;
 
 using std::make_unique;
 
+/**
+ * @brief processes the atom section of the rst file
+ *
+ * @details converts the line elements to views and calls processViews
+ *
+ * @param lineElements all elements of the line
+ * @param engine
+ */
+void AtomSection::process(
+    std::vector<std::string> &lineElements,
+    Engine                   &engine
+)
+{
+    auto lineViews = pq::stringViews(lineElements.begin(), lineElements.end());
+
+    processViews(lineViews, engine);
+}
+
 /**
  * @brief processes the atom section of the rst file
  *
  * @details this function reads one molecule from the restart file and ends if
  * number of atoms in the molecule is reached. Then the RestartFileReader
  * continues with the next section (possibly the atom section again for the next
- * molecule)
+ * molecule). The line elements are views into the mapped restart file, so no
+ * strings are allocated per atom.
  *
  * @param lineElements all elements of the line
  * @param engine
@@ -62,9 +82,9 @@ using std::make_unique;
  * @throws RstFileException if the number of atoms in the
  * molecule is not correct
  */
-void AtomSection::process(
-    std::vector<std::string> &lineElements,
-    Engine                   &engine
+void AtomSection::processViews(
+    std::vector<std::string_view> &lineElements,
+    Engine                        &engine
 )
 {
     auto &simBox = engine.getSimulationBox();
@@ -75,7 +95,7 @@ void AtomSection::process(
      * find molecule by molecule type *
      *********************************/
 
-    size_t moltype = stoul(lineElements[2]);
+    size_t moltype = stringToSizeT(lineElements[2]);
 
     if (0 == moltype)
     {
@@ -142,7 +162,7 @@ void AtomSection::process(
 
         checkNumberOfLineArguments(lineElements);
 
-        moltype = stoul(lineElements[2]);
+        moltype = stringToSizeT(lineElements[2]);
 
         ++_lineNumber;
     }
@@ -166,9 +186,9 @@ void AtomSection::process(
  * @param molecule
  */
 void AtomSection::processAtomLine(
-    std::vector<std::string> &lineElements,
-    SimulationBox            &simBox,
-    Molecule                 &molecule
+    std::vector<std::string_view> &lineElements,
+    SimulationBox                 &simBox,
+    Molecule                      &molecule
 ) const
 {
     auto atom = std::make_shared<Atom>();
@@ -193,8 +213,8 @@ void AtomSection::processAtomLine(
  * @param simBox
  */
 void AtomSection::processQMAtomLine(
-    std::vector<std::string> &lineElements,
-    SimulationBox            &simBox
+    std::vector<std::string_view> &lineElements,
+    SimulationBox                 &simBox
 )
 {
     auto       atom     = std::make_shared<Atom>();
@@ -230,23 +250,20 @@ void AtomSection::processQMAtomLine(
  * file does not exist
  */
 void AtomSection::checkAtomLine(
-    std::vector<std::string> &lineElements,
-    const Molecule           &molecule
+    std::vector<std::string_view> &lineElements,
+    const Molecule                &molecule
 )
 {
     ++_lineNumber;
 
-    if (std::string line; !getline(*_fp, line))
+    if (std::string_view line; !_fp->getLine(line))
         throw RstFileException(std::format(
             "Error in line {}: Molecule must have {} atoms",
             _lineNumber,
             molecule.getNumberOfAtoms()
         ));
     else
-    {
-        line         = removeComments(line, "#");
-        lineElements = splitString(line);
-    }
+        lineElements = splitStringView(stripComments(line, "#"));
 }
 
 /**
@@ -256,57 +273,57 @@ void AtomSection::checkAtomLine(
  * @param atom
  */
 void AtomSection::setAtomPropertyVectors(
-    std::vector<std::string> &lineElements,
-    std::shared_ptr<Atom>    &atom
+    std::vector<std::string_view> &lineElements,
+    std::shared_ptr<Atom>         &atom
 ) const
 {
-    const auto x = stod(lineElements[3]);
-    const auto y = stod(lineElements[4]);
-    const auto z = stod(lineElements[5]);
+    const auto x = stringToDouble(lineElements[3]);
+    const auto y = stringToDouble(lineElements[4]);
+    const auto z = stringToDouble(lineElements[5]);
 
     atom->setPosition({x, y, z});
 
     if (lineElements.size() > 6)
     {
-        const auto vx = stod(lineElements[6]);
-        const auto vy = stod(lineElements[7]);
-        const auto vz = stod(lineElements[8]);
+        const auto vx = stringToDouble(lineElements[6]);
+        const auto vy = stringToDouble(lineElements[7]);
+        const auto vz = stringToDouble(lineElements[8]);
 
         atom->setVelocity({vx, vy, vz});
     }
 
     if (lineElements.size() > 9)
     {
-        const auto fx = stod(lineElements[9]);
-        const auto fy = stod(lineElements[10]);
-        const auto fz = stod(lineElements[11]);
+        const auto fx = stringToDouble(lineElements[9]);
+        const auto fy = stringToDouble(lineElements[10]);
+        const auto fz = stringToDouble(lineElements[11]);
 
         atom->setForce({fx, fy, fz});
     }
 
     if (lineElements.size() > 12)
     {
-        const auto oldX = stod(lineElements[12]);
-        const auto oldY = stod(lineElements[13]);
-        const auto oldZ = stod(lineElements[14]);
+        const auto oldX = stringToDouble(lineElements[12]);
+        const auto oldY = stringToDouble(lineElements[13]);
+        const auto oldZ = stringToDouble(lineElements[14]);
 
         atom->setPositionOld({oldX, oldY, oldZ});
     }
 
     if (lineElements.size() > 15)
     {
-        const auto oldVx = stod(lineElements[15]);
-        const auto oldVy = stod(lineElements[16]);
-        const auto oldVz = stod(lineElements[17]);
+        const auto oldVx = stringToDouble(lineElements[15]);
+        const auto oldVy = stringToDouble(lineElements[16]);
+        const auto oldVz = stringToDouble(lineElements[17]);
 
         atom->setVelocityOld({oldVx, oldVy, oldVz});
     }
 
     if (lineElements.size() > 18)
     {
-        const auto oldFx = stod(lineElements[18]);
-        const auto oldFy = stod(lineElements[19]);
-        const auto oldFz = stod(lineElements[20]);
+        const auto oldFx = stringToDouble(lineElements[18]);
+        const auto oldFy = stringToDouble(lineElements[19]);
+        const auto oldFz = stringToDouble(lineElements[20]);
 
         atom->setForceOld({oldFx, oldFy, oldFz});
     }
@@ -322,7 +339,7 @@ void AtomSection::setAtomPropertyVectors(
  * the line is not 12 or 21
  */
 void AtomSection::checkNumberOfLineArguments(
-    std::vector<std::string> &lineElements
+    std::vector<std::string_view> &lineElements
 ) const
 {
     const auto lineSize = lineElements.size();
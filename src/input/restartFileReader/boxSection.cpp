@@ -58,10 +58,6 @@ using namespace engine;
  *
  * @throws RstFileException if the number of elements in the
  * line is not 4 or 7
- * @throws RstFileException if the box dimensions are not
- * positive
- * @throws RstFileException if the box angles are not positive
- * or larger than 90°
  */
 void BoxSection::process(
     std::vector<std::string> &lineElements,
@@ -80,29 +76,52 @@ void BoxSection::process(
         stod(lineElements[3])
     };
 
-    auto checkPositive = [](const double dimension) { return dimension < 0.0; };
-
-    if (std::ranges::any_of(boxDimensions, checkPositive))
-        throw RstFileException("All box dimensions must be positive");
-
     auto boxAngles = Vec3D{90.0, 90.0, 90.0};
 
     if (7 == lineElements.size())
-    {
         boxAngles = Vec3D{
             stod(lineElements[4]),
             stod(lineElements[5]),
             stod(lineElements[6])
         };
 
-        auto checkAngles = [](const double angle)
-        { return angle < 0.0 || angle > 180.0; };
+    setBox(boxDimensions, boxAngles, engine);
+}
 
-        if (std::ranges::any_of(boxAngles, checkAngles))
-            throw RstFileException(
-                "Box angles must be positive and smaller than 180°"
-            );
-    }
+/**
+ * @brief sets the box of the simulation box in the engine
+ *
+ * @details if the box angles are all 90° an orthorhombic box is set,
+ * otherwise a triclinic box. This function is also used by the checkpoint
+ * file reader.
+ *
+ * @param boxDimensions
+ * @param boxAngles
+ * @param engine
+ *
+ * @throws RstFileException if the box dimensions are not
+ * positive
+ * @throws RstFileException if the box angles are not positive
+ * or larger than 180°
+ */
+void BoxSection::setBox(
+    const Vec3D &boxDimensions,
+    const Vec3D &boxAngles,
+    Engine      &engine
+)
+{
+    auto checkPositive = [](const double dimension) { return dimension < 0.0; };
+
+    if (std::ranges::any_of(boxDimensions, checkPositive))
+        throw RstFileException("All box dimensions must be positive");
+
+    auto checkAngles = [](const double angle)
+    { return angle < 0.0 || angle > 180.0; };
+
+    if (std::ranges::any_of(boxAngles, checkAngles))
+        throw RstFileException(
+            "Box angles must be positive and smaller than 180°"
+        );
 
     if (!compare(boxAngles, Vec3D{90.0, 90.0, 90.0}, 1e-5))
     {
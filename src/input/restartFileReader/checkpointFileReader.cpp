@@ -0,0 +1,402 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "checkpointFileReader.hpp"
+
+#include <algorithm>   // for any_of
+#include <cstdint>     // for uint32_t, uint64_t
+#include <cstring>     // for memcpy, memcmp
+#include <format>      // for format
+#include <fstream>     // for ifstream
+#include <ios>         // for ios
+#include <memory>      // for make_shared
+
+#include "atom.hpp"                   // for Atom
+#include "boxSection.hpp"             // for BoxSection
+#include "checkpointFileOutput.hpp"   // for CheckpointFileOutput
+#include "engine.hpp"                 // for Engine
+#include "exceptions.hpp"             // for RstFileException
+#include "manostatSettings.hpp"       // for ManostatSettings
+#include "molecule.hpp"               // for Molecule
+#include "moleculeType.hpp"           // for MoleculeType
+#include "settings.hpp"               // for Settings
+#include "simulationBox.hpp"          // for SimulationBox
+#include "thermostatSettings.hpp"     // for ThermostatSettings
+#include "timingsSettings.hpp"        // for TimingsSettings
+#include "vector3d.hpp"               // for Vec3D
+
+using namespace input::restartFile;
+using namespace simulationBox;
+using namespace engine;
+using namespace customException;
+using namespace settings;
+using namespace linearAlgebra;
+
+using output::CheckpointFileOutput;
+
+/**
+ * @brief Construct a new Checkpoint File Reader object
+ *
+ * @param filename
+ * @param engine
+ */
+CheckpointFileReader::CheckpointFileReader(
+    const std::string &filename,
+    Engine            &engine
+)
+    : _fileName(filename), _engine(engine)
+{
+}
+
+/**
+ * @brief reads a trivially copyable value from the file buffer
+ *
+ * @tparam T
+ * @return T
+ *
+ * @throws RstFileException if the end of the file is reached
+ */
+template <typename T>
+T CheckpointFileReader::readValue()
+{
+    if (_offset + sizeof(T) > _data.size())
+        throw RstFileException(
+            std::format("Checkpoint file {} is truncated", _fileName)
+        );
+
+    T value;
+    std::memcpy(&value, _data.data() + _offset, sizeof(T));
+    _offset += sizeof(T);
+
+    return value;
+}
+
+/**
+ * @brief reads an array of trivially copyable values with a single copy
+ *
+ * @tparam T
+ * @param size number of values
+ * @return std::vector<T>
+ *
+ * @throws RstFileException if the end of the file is reached
+ */
+template <typename T>
+std::vector<T> CheckpointFileReader::readArray(const size_t size)
+{
+    if (size > (_data.size() - _offset) / sizeof(T))
+        throw RstFileException(
+            std::format("Checkpoint file {} is truncated", _fileName)
+        );
+
+    std::vector<T> values(size);
+
+    if (size > 0)
+        std::memcpy(values.data(), _data.data() + _offset, size * sizeof(T));
+
+    _offset += size * sizeof(T);
+
+    return values;
+}
+
+/**
+ * @brief reads a string with its length as prefix from the file buffer
+ *
+ * @return std::string
+ *
+ * @throws RstFileException if the end of the file is reached
+ */
+std::string CheckpointFileReader::readString()
+{
+    const auto length = size_t(readValue<uint64_t>());
+
+    if (length > _data.size() - _offset)
+        throw RstFileException(
+            std::format("Checkpoint file {} is truncated", _fileName)
+        );
+
+    auto string = _data.substr(_offset, length);
+    _offset    += length;
+
+    return string;
+}
+
+/**
+ * @brief checks if a file starts with the magic string of a checkpoint file
+ *
+ * @param filename
+ * @return true if the file is a binary checkpoint file
+ */
+bool CheckpointFileReader::isCheckpointFile(const std::string &filename)
+{
+    std::ifstream fp(filename, std::ios::binary);
+
+    std::string magic(CheckpointFileOutput::_MAGIC_.size(), '\0');
+    fp.read(magic.data(), std::streamsize(magic.size()));
+
+    return fp.good() && magic == CheckpointFileOutput::_MAGIC_;
+}
+
+/**
+ * @brief reads the checkpoint file and sets up the simulation box, the step
+ * count and the thermostat and manostat state
+ *
+ * @throws RstFileException if the file cannot be read
+ * @throws RstFileException if the payload contains trailing data
+ */
+void CheckpointFileReader::read()
+{
+    std::ifstream fp(_fileName, std::ios::binary | std::ios::ate);
+
+    if (!fp.is_open())
+        throw RstFileException(
+            std::format("Could not open checkpoint file {}", _fileName)
+        );
+
+    const auto fileSize = size_t(fp.tellg());
+
+    _data.resize(fileSize);
+    _offset = 0;
+
+    fp.seekg(0);
+    fp.read(_data.data(), std::streamsize(fileSize));
+
+    if (fp.fail())
+        throw RstFileException(
+            std::format("Could not read checkpoint file {}", _fileName)
+        );
+
+    readHeader();
+
+    TimingsSettings::setStepCount(size_t(readValue<uint64_t>()));
+
+    const auto box           = readArray<double>(6);
+    const auto boxDimensions = Vec3D{box[0], box[1], box[2]};
+    const auto boxAngles     = Vec3D{box[3], box[4], box[5]};
+
+    BoxSection::setBox(boxDimensions, boxAngles, _engine);
+
+    const auto nChain = size_t(readValue<uint64_t>());
+    const auto chi    = readArray<double>(nChain);
+    const auto zeta   = readArray<double>(nChain);
+
+    // same entries as in the text restart file, i.e. 1-based indices
+    for (size_t i = 0; i + 1 < nChain; ++i)
+    {
+        ThermostatSettings::addChi(i + 1, chi[i]);
+        ThermostatSettings::addZeta(i + 1, zeta[i]);
+    }
+
+    ThermostatSettings::setRandomState(readString());
+    ManostatSettings::setRandomState(readString());
+
+    readAtoms();
+
+    if (_offset != _data.size())
+        throw RstFileException(std::format(
+            "Checkpoint file {} contains {} bytes of unexpected data",
+            _fileName,
+            _data.size() - _offset
+        ));
+}
+
+/**
+ * @brief validates the header of the checkpoint file
+ *
+ * @throws RstFileException if the file is too small, the magic string, the
+ * endianness, the version, the payload size or the checksum do not match
+ */
+void CheckpointFileReader::readHeader()
+{
+    const auto headerSize = CheckpointFileOutput::_HEADER_SIZE_;
+    const auto magic      = CheckpointFileOutput::_MAGIC_;
+
+    if (_data.size() < headerSize)
+        throw RstFileException(
+            std::format("Checkpoint file {} is truncated", _fileName)
+        );
+
+    if (std::string_view(_data.data(), magic.size()) != magic)
+        throw RstFileException(
+            std::format("File {} is not a PQ checkpoint file", _fileName)
+        );
+
+    _offset = magic.size();
+
+    const auto version     = readValue<uint32_t>();
+    const auto endianness  = readValue<uint32_t>();
+    const auto payloadSize = readValue<uint64_t>();
+    const auto checksum    = readValue<uint64_t>();
+
+    if (endianness != CheckpointFileOutput::_ENDIANNESS_)
+        throw RstFileException(std::format(
+            "Checkpoint file {} was written on a machine with different "
+            "byte order",
+            _fileName
+        ));
+
+    if (version > CheckpointFileOutput::_VERSION_)
+        throw RstFileException(std::format(
+            "Checkpoint file {} has version {} but only versions up to {} "
+            "are supported",
+            _fileName,
+            version,
+            CheckpointFileOutput::_VERSION_
+        ));
+
+    if (payloadSize != _data.size() - headerSize)
+        throw RstFileException(std::format(
+            "Checkpoint file {} is truncated - expected {} bytes but found {}",
+            _fileName,
+            payloadSize,
+            _data.size() - headerSize
+        ));
+
+    const auto payload = std::string_view(_data).substr(headerSize);
+
+    if (checksum != CheckpointFileOutput::calculateChecksum(payload))
+        throw RstFileException(std::format(
+            "Checksum mismatch in checkpoint file {} - the file is corrupted",
+            _fileName
+        ));
+}
+
+/**
+ * @brief reads all atoms and adds them molecule by molecule to the
+ * simulation box
+ *
+ * @details molecules are built in the same way as by the atom section of
+ * the text restart file, i.e. atoms with molecule type 0 are single QM atoms
+ *
+ * @throws RstFileException if an atom name index is out of range
+ * @throws RstFileException if a molecule is incomplete
+ */
+void CheckpointFileReader::readAtoms()
+{
+    auto &simBox = _engine.getSimulationBox();
+
+    const auto nAtoms = size_t(readValue<uint64_t>());
+    const auto nNames = size_t(readValue<uint64_t>());
+
+    std::vector<std::string> names;
+    names.reserve(nNames);
+
+    for (size_t i = 0; i < nNames; ++i) names.push_back(readString());
+
+    const auto nameIndices = readArray<uint32_t>(nAtoms);
+    const auto moltypes    = readArray<uint64_t>(nAtoms);
+    const auto positions   = readArray<double>(3 * nAtoms);
+    const auto velocities  = readArray<double>(3 * nAtoms);
+    const auto forces      = readArray<double>(3 * nAtoms);
+
+    auto makeAtom = [&](const size_t i)
+    {
+        if (nameIndices[i] >= names.size())
+            throw RstFileException(std::format(
+                "Error in checkpoint file {}: atom {} has no valid name",
+                _fileName,
+                i + 1
+            ));
+
+        const auto *position = &positions[3 * i];
+        const auto *velocity = &velocities[3 * i];
+        const auto *force    = &forces[3 * i];
+
+        auto atom = std::make_shared<Atom>();
+
+        atom->setAtomTypeName(names[nameIndices[i]]);
+        atom->setPosition({position[0], position[1], position[2]});
+        atom->setVelocity({velocity[0], velocity[1], velocity[2]});
+        atom->setForce({force[0], force[1], force[2]});
+
+        return atom;
+    };
+
+    size_t atomIndex = 0;
+
+    while (atomIndex < nAtoms)
+    {
+        const auto moltype = size_t(moltypes[atomIndex]);
+
+        if (0 == moltype)
+        {
+            auto       atom     = makeAtom(atomIndex);
+            const auto molecule = std::make_unique<Molecule>(0);
+
+            molecule->setName("QM");
+            molecule->setNumberOfAtoms(1);
+
+            atom->setName(atom->getAtomTypeName());
+            atom->setQMOnly(true);
+            molecule->setQMOnly(true);
+
+            molecule->addAtom(atom);
+
+            simBox.addAtom(atom);
+            simBox.addQMAtom(atom);
+            simBox.addMolecule(*molecule);
+
+            ++atomIndex;
+            continue;
+        }
+
+        const auto &moleculeType   = simBox.findMoleculeType(moltype);
+        const auto  nMoleculeAtoms = moleculeType.getNumberOfAtoms();
+
+        const auto begin = moltypes.begin() + long(atomIndex);
+        const auto end   = begin + long(nMoleculeAtoms);
+
+        auto isOtherType = [moltype](const auto type)
+        { return type != moltype; };
+
+        if (atomIndex + nMoleculeAtoms > nAtoms ||
+            std::any_of(begin, end, isOtherType))
+            throw RstFileException(std::format(
+                "Error in checkpoint file {}: molecule starting at atom {} "
+                "must have {} atoms",
+                _fileName,
+                atomIndex + 1,
+                nMoleculeAtoms
+            ));
+
+        auto molecule = std::make_unique<Molecule>(moltype);
+
+        molecule->setNumberOfAtoms(nMoleculeAtoms);
+        molecule->setName(moleculeType.getName());
+        molecule->setCharge(moleculeType.getCharge());
+
+        for (size_t i = 0; i < nMoleculeAtoms; ++i)
+        {
+            auto atom = makeAtom(atomIndex + i);
+
+            simBox.addAtom(atom);
+            molecule->addAtom(atom);
+
+            if (Settings::isQMOnly())
+                simBox.addQMAtom(atom);
+        }
+
+        simBox.addMolecule(*molecule);
+
+        atomIndex += nMoleculeAtoms;
+    }
+}
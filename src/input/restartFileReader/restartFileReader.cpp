@@ -22,15 +22,16 @@
 
 #include "restartFileReader.hpp"
 
-#include <fstream>   // for basic_istream, ifstream
-#include <string>    // for basic_string, string
+#include <string>        // for basic_string, string
+#include <string_view>   // for string_view
 
-#include "boxSection.hpp"          // for BoxSection
-#include "engine.hpp"              // for Engine
-#include "fileSettings.hpp"        // for FileSettings
-#include "noseHooverSection.hpp"   // for NoseHooverSection
-#include "stepCountSection.hpp"    // for StepCountSection
-#include "stringUtilities.hpp"     // for removeComments, splitString
+#include "boxSection.hpp"             // for BoxSection
+#include "checkpointFileReader.hpp"   // for CheckpointFileReader
+#include "engine.hpp"                 // for Engine
+#include "fileSettings.hpp"           // for FileSettings
+#include "noseHooverSection.hpp"      // for NoseHooverSection
+#include "stepCountSection.hpp"       // for StepCountSection
+#include "stringUtilities.hpp"        // for stripComments, splitStringView
 
 using namespace input::restartFile;
 using namespace engine;
@@ -42,7 +43,7 @@ using namespace settings;
  *
  * @details The constructor initializes the sections of the .rst file and pushes
  * them into a vector. It also sets the filename and the engine object and with
- * the filename it opens the file in the ifstream object _fp.
+ * the filename it maps the file into memory in the MappedFile object _fp.
  *
  *
  * @param filename
@@ -66,11 +67,13 @@ RestartFileReader::RestartFileReader(
  * @return RestartFileSection*
  */
 RestartFileSection *RestartFileReader::determineSection(
-    std::vector<std::string> &lineElements
+    std::vector<std::string_view> &lineElements
 )
 {
+    const auto keyword = toLowerAndReplaceDashesCopy(lineElements[0]);
+
     for (const auto &section : _sections)
-        if (section->keyword() == toLowerAndReplaceDashesCopy(lineElements[0]))
+        if (section->keyword() == keyword)
             return section.get();
 
     return _atomSection.get();
@@ -80,17 +83,19 @@ RestartFileSection *RestartFileReader::determineSection(
  * @brief Reads a restart file and calls the process function of the
  * corresponding section
  *
+ * @details the lines are tokenized as views into the mapped file, so the
+ * atom section does not allocate any strings per atom
+ *
  * @throw customException::InputFileException if file not found
  */
 void RestartFileReader::read()
 {
-    std::string line;
-    int         lineNumber = 1;
+    std::string_view line;
+    int              lineNumber = 1;
 
-    while (getline(_fp, line))
+    while (_fp.getLine(line))
     {
-        line              = removeComments(line, "#");
-        auto lineElements = splitString(line);
+        auto lineElements = splitStringView(stripComments(line, "#"));
 
         if (lineElements.empty())
         {
@@ -101,7 +106,7 @@ void RestartFileReader::read()
         auto *section        = determineSection(lineElements);
         section->_lineNumber = lineNumber;
         section->_fp         = &_fp;
-        section->process(lineElements, _engine);
+        section->processViews(lineElements, _engine);
         lineNumber = section->_lineNumber;
         ++lineNumber;
     }
@@ -111,6 +116,9 @@ void RestartFileReader::read()
  * @brief wrapper function to construct a RestartFileReader object and call the
  * read function
  *
+ * @details binary checkpoint files are detected by their magic string and
+ * read with the CheckpointFileReader instead
+ *
  * @param engine
  */
 void input::restartFile::readRestartFile(Engine &engine)
@@ -120,6 +128,14 @@ void input::restartFile::readRestartFile(Engine &engine)
     engine.getStdoutOutput().writeRead("Start File", filename);
     engine.getLogOutput().writeRead("Start File", filename);
 
+    if (CheckpointFileReader::isCheckpointFile(filename))
+    {
+        CheckpointFileReader checkpointFileReader(filename, engine);
+        checkpointFileReader.read();
+
+        return;
+    }
+
     RestartFileReader rstFileReader(filename, engine);
     rstFileReader.read();
 }
\ No newline at end of file
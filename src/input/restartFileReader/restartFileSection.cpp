@@ -20,4 +20,30 @@
 <GPL_HEADER>
 ******************************************************************************/
 
-#include "restartFileSection.hpp"
\ No newline at end of file
+#include "restartFileSection.hpp"
+
+#include <string>        // for string
+#include <string_view>   // for string_view
+#include <vector>        // for vector
+using namespace input::restartFile;
+using namespace engine;
+
+/**
+ * @brief processes a line given as views into the restart file
+ *
+ * @details the default implementation copies the views into strings and
+ * calls process. Sections which are hit for every atom override this to
+ * avoid the copies.
+ *
+ * @param lineElements
+ * @param engine
+ */
+void RestartFileSection::processViews(
+    std::vector<std::string_view> &lineElements,
+    Engine                        &engine
+)
+{
+    auto elements = pq::strings(lineElements.begin(), lineElements.end());
+
+    process(elements, engine);
+}
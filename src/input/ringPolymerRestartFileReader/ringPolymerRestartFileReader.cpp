@@ -24,7 +24,6 @@
 
 #include <cstddef>       // for size_t
 #include <format>        // for format
-#include <fstream>       // IWYU pragma: keep
 #include <memory>        // for __shared_ptr_access, shared_ptr
 #include <string_view>   // for string_view
 #include <vector>        // for vector
@@ -35,7 +34,7 @@
 #include "ringPolymerEngine.hpp"     // for RingPolymerEngine
 #include "ringPolymerSettings.hpp"   // for RingPolymerSettings
 #include "simulationBox.hpp"         // for SimulationBox
-#include "stringUtilities.hpp"       // for removeComments, splitString
+#include "stringUtilities.hpp"       // for stripComments, stringToDouble
 
 using input::ringPolymer::RingPolymerRestartFileReader;
 using namespace engine;
@@ -59,12 +58,15 @@ RingPolymerRestartFileReader::RingPolymerRestartFileReader(
 /**
  * @brief Reads a .rpmd.rst file sets the ring polymer beads in the engine
  *
+ * @details the file is memory mapped and the numbers are parsed directly from
+ * views into the mapping
+ *
  */
 void RingPolymerRestartFileReader::read()
 {
-    std::string              line;
-    std::vector<std::string> lineElements;
-    int                      lineNumber = 0;
+    std::string_view              line;
+    std::vector<std::string_view> lineElements;
+    int                           lineNumber = 0;
 
     const auto numberOfBeads = RingPolymerSettings::getNumberOfBeads();
 
@@ -73,13 +75,12 @@ void RingPolymerRestartFileReader::read()
         for (auto &atom : _engine.getRingPolymerBeads()[i].getAtoms())
         {
             do {
-                if (!getline(_fp, line))
+                if (!_fp.getLine(line))
                     throw RingPolymerRestartFileException(
                         "Error reading ring polymer restart file"
                     );
 
-                line         = removeComments(line, "#");
-                lineElements = splitString(line);
+                lineElements = splitStringView(stripComments(line, "#"));
                 ++lineNumber;
 
             } while (lineElements.empty());
@@ -92,21 +93,21 @@ void RingPolymerRestartFileReader::read()
                 ));
 
             atom->setPosition(
-                {stod(lineElements[3]),
-                 stod(lineElements[4]),
-                 stod(lineElements[5])}
+                {stringToDouble(lineElements[3]),
+                 stringToDouble(lineElements[4]),
+                 stringToDouble(lineElements[5])}
             );
 
             atom->setVelocity(
-                {stod(lineElements[6]),
-                 stod(lineElements[7]),
-                 stod(lineElements[8])}
+                {stringToDouble(lineElements[6]),
+                 stringToDouble(lineElements[7]),
+                 stringToDouble(lineElements[8])}
             );
 
             atom->setForce(
-                {stod(lineElements[9]),
-                 stod(lineElements[10]),
-                 stod(lineElements[11])}
+                {stringToDouble(lineElements[9]),
+                 stringToDouble(lineElements[10]),
+                 stringToDouble(lineElements[11])}
             );
         }
     }
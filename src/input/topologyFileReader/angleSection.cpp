@@ -22,10 +22,11 @@
 
 #include "angleSection.hpp"
 
-#include <cstddef>   // for size_t
-#include <format>    // for format
-#include <string>    // for stoul, string, operator==, char_traits
-#include <vector>    // for vector
+#include <cstddef>       // for size_t
+#include <format>        // for format
+#include <string>        // for stoul, string, operator==, char_traits
+#include <string_view>   // for string_view
+#include <vector>        // for vector
 
 #include "angleForceField.hpp"   // for AngleForceField
 #include "engine.hpp"            // for Engine
@@ -40,7 +41,55 @@ using namespace customException;
 using namespace engine;
 
 /**
- * @brief processes the angle section of the topology file
+ * @brief processes one line of the angle section of the topology file
+ *
+ * @param lineElements
+ * @param engine
+ */
+void AngleSection::processSection(
+    std::vector<std::string> &lineElements,
+    Engine                   &engine
+)
+{
+    auto &simBox = engine.getSimulationBox();
+
+    const auto angleForceField = parseAngle(lineElements, simBox, _lineNumber);
+
+    engine.getForceField().addAngle(angleForceField);
+}
+
+/**
+ * @brief processes all lines of the angle section in parallel
+ *
+ * @details the lines are parsed in parallel and the angles are added to
+ * the force field afterwards in the order of the topology file
+ *
+ * @param lines
+ * @param lineNumbers
+ * @param engine
+ */
+void AngleSection::processLines(
+    const std::vector<std::string_view> &lines,
+    const std::vector<int>              &lineNumbers,
+    Engine                              &engine
+)
+{
+    auto &simBox = engine.getSimulationBox();
+
+    simBox.initMoleculeAtomOffsets();
+
+    auto parseLine = [this, &simBox](auto &lineElements, const int lineNumber)
+    { return parseAngle(lineElements, simBox, lineNumber); };
+
+    auto parsed = parseLines<AngleForceField>(lines, lineNumbers, parseLine);
+
+    auto &ff = engine.getForceField();
+
+    for (const auto &angleForceField : parsed) ff.addAngle(angleForceField);
+}
+
+/**
+ * @brief parses one line of the angle section of the topology file
  *
  * @details one line consists of 4 or 5 elements:
  * 1. atom index 1
@@ -49,8 +98,10 @@ using namespace engine;
  * 4. angle type
  * 5. linker marked with a '*' (optional)
  *
- * @param line
- * @param engine
+ * @param lineElements
+ * @param simBox
+ * @param lineNumber line number for error messages
+ * @return AngleForceField
  *
  * @throws TopologyException if number of elements in line is
  * not 4 or 5
@@ -58,16 +109,17 @@ using namespace engine;
  * (=same atoms)
  * @throws TopologyException if fifth element is not a '*'
  */
-void AngleSection::processSection(
+AngleForceField AngleSection::parseAngle(
     std::vector<std::string> &lineElements,
-    Engine                   &engine
-)
+    SimulationBox            &simBox,
+    const int                 lineNumber
+) const
 {
     if (lineElements.size() != 4 && lineElements.size() != 5)
         throw TopologyException(std::format(
             "Wrong number of arguments in topology file angle section at line "
             "{} - number of elements has to be 4 or 5!",
-            _lineNumber
+            lineNumber
         ));
 
     auto atom1     = stoul(lineElements[0]);
@@ -85,7 +137,7 @@ void AngleSection::processSection(
             throw TopologyException(std::format(
                 "Fifth entry in topology file in angle section has to be a "
                 "\'*\' or empty at line {}!",
-                _lineNumber
+                lineNumber
             ));
     }
 
@@ -93,11 +145,9 @@ void AngleSection::processSection(
         throw TopologyException(std::format(
             "Topology file angle section at line {} - atoms cannot be the "
             "same!",
-            _lineNumber
+            lineNumber
         ));
 
-    auto &simBox = engine.getSimulationBox();
-
     const auto [molecule1, atomIdx1] = simBox.findMoleculeByAtomIndex(atom1);
     const auto [molecule2, atomIdx2] = simBox.findMoleculeByAtomIndex(atom2);
     const auto [molecule3, atomIdx3] = simBox.findMoleculeByAtomIndex(atom3);
@@ -108,7 +158,7 @@ void AngleSection::processSection(
     auto angleForceField = AngleForceField(mols, atomIndices, angleType);
     angleForceField.setIsLinker(isLinker);
 
-    engine.getForceField().addAngle(angleForceField);
+    return angleForceField;
 }
 
 /**
@@ -22,9 +22,10 @@
 
 #include "bondSection.hpp"
 
-#include <format>   // for format
-#include <string>   // for stoul, string, operator==, char_traits
-#include <vector>   // for vector
+#include <format>        // for format
+#include <string>        // for stoul, string, operator==, char_traits
+#include <string_view>   // for string_view
+#include <vector>        // for vector
 
 #include "bondForceField.hpp"    // for BondForceField
 #include "engine.hpp"            // for Engine
@@ -39,7 +40,55 @@ using namespace customException;
 using namespace engine;
 
 /**
- * @brief processes the bond section of the topology file
+ * @brief processes one line of the bond section of the topology file
+ *
+ * @param lineElements
+ * @param engine
+ */
+void BondSection::processSection(
+    std::vector<std::string> &lineElements,
+    Engine                   &engine
+)
+{
+    auto &simBox = engine.getSimulationBox();
+
+    const auto bondFF = parseBond(lineElements, simBox, _lineNumber);
+
+    engine.getForceField().addBond(bondFF);
+}
+
+/**
+ * @brief processes all lines of the bond section in parallel
+ *
+ * @details the lines are parsed in parallel and the bonds are added to
+ * the force field afterwards in the order of the topology file
+ *
+ * @param lines
+ * @param lineNumbers
+ * @param engine
+ */
+void BondSection::processLines(
+    const std::vector<std::string_view> &lines,
+    const std::vector<int>              &lineNumbers,
+    Engine                              &engine
+)
+{
+    auto &simBox = engine.getSimulationBox();
+
+    simBox.initMoleculeAtomOffsets();
+
+    auto parseLine = [this, &simBox](auto &lineElements, const int lineNumber)
+    { return parseBond(lineElements, simBox, lineNumber); };
+
+    auto parsed = parseLines<BondForceField>(lines, lineNumbers, parseLine);
+
+    auto &ff = engine.getForceField();
+
+    for (const auto &bondFF : parsed) ff.addBond(bondFF);
+}
+
+/**
+ * @brief parses one line of the bond section of the topology file
  *
  * @details one line consists of 3 or 4 elements:
  * 1. atom index 1
@@ -47,8 +96,10 @@ using namespace engine;
  * 3. bond type
  * 4. linker marked with a '*'
  *
- * @param line
- * @param engine
+ * @param lineElements
+ * @param simBox
+ * @param lineNumber line number for error messages
+ * @return BondForceField
  *
  * @throws TopologyException if number of elements in line is
  * not 3 or 4
@@ -56,16 +107,17 @@ using namespace engine;
  * (=same atoms)
  * @throws TopologyException if forth element is not a '*'
  */
-void BondSection::processSection(
+BondForceField BondSection::parseBond(
     std::vector<std::string> &lineElements,
-    Engine                   &engine
-)
+    SimulationBox            &simBox,
+    const int                 lineNumber
+) const
 {
     if (lineElements.size() != 3 && lineElements.size() != 4)
         throw TopologyException(std::format(
             "Wrong number of arguments in topology file bond section at line "
             "{} - number of elements has to be 3 or 4!",
-            _lineNumber
+            lineNumber
         ));
 
     const auto atom1    = stoul(lineElements[0]);
@@ -82,7 +134,7 @@ void BondSection::processSection(
             throw TopologyException(std::format(
                 "Forth entry in topology file in bond section has to be a "
                 "\'*\' or empty at line {}!",
-                _lineNumber
+                lineNumber
             ));
     }
 
@@ -90,18 +142,16 @@ void BondSection::processSection(
         throw TopologyException(std::format(
             "Topology file shake section at line {} - atoms cannot be the "
             "same!",
-            _lineNumber
+            lineNumber
         ));
 
-    auto &simBox = engine.getSimulationBox();
-
     const auto [mol1, atomIdx1] = simBox.findMoleculeByAtomIndex(atom1);
     const auto [mol2, atomIdx2] = simBox.findMoleculeByAtomIndex(atom2);
 
     auto bondFF = BondForceField(mol1, mol2, atomIdx1, atomIdx2, bondType);
     bondFF.setIsLinker(isLinker);
 
-    engine.getForceField().addBond(bondFF);
+    return bondFF;
 }
 
 /**
@@ -22,10 +22,11 @@
 
 #include "dihedralSection.hpp"
 
-#include <algorithm>   // for sort, unique
-#include <format>      // for format
-#include <string>      // for string, allocator
-#include <vector>      // for vector
+#include <algorithm>     // for sort, unique
+#include <format>        // for format
+#include <string>        // for string, allocator
+#include <string_view>   // for string_view
+#include <vector>        // for vector
 
 #include "dihedralForceField.hpp"   // for BondForceField
 #include "engine.hpp"               // for Engine
@@ -38,7 +39,55 @@ using namespace customException;
 using namespace engine;
 
 /**
- * @brief processes the dihedral section of the topology file
+ * @brief processes one line of the dihedral section of the topology file
+ *
+ * @param lineElements
+ * @param engine
+ */
+void DihedralSection::processSection(
+    std::vector<std::string> &lineElements,
+    Engine                   &engine
+)
+{
+    auto &simBox = engine.getSimulationBox();
+
+    const auto dihedralFF = parseDihedral(lineElements, simBox, _lineNumber);
+
+    engine.getForceField().addDihedral(dihedralFF);
+}
+
+/**
+ * @brief processes all lines of the dihedral section in parallel
+ *
+ * @details the lines are parsed in parallel and the dihedrals are added to
+ * the force field afterwards in the order of the topology file
+ *
+ * @param lines
+ * @param lineNumbers
+ * @param engine
+ */
+void DihedralSection::processLines(
+    const std::vector<std::string_view> &lines,
+    const std::vector<int>              &lineNumbers,
+    Engine                              &engine
+)
+{
+    auto &simBox = engine.getSimulationBox();
+
+    simBox.initMoleculeAtomOffsets();
+
+    auto parseLine = [this, &simBox](auto &lineElements, const int lineNumber)
+    { return parseDihedral(lineElements, simBox, lineNumber); };
+
+    auto parsed = parseLines<DihedralForceField>(lines, lineNumbers, parseLine);
+
+    auto &ff = engine.getForceField();
+
+    for (const auto &dihedralFF : parsed) ff.addDihedral(dihedralFF);
+}
+
+/**
+ * @brief parses one line of the dihedral section of the topology file
  *
  * @details one line consists of 5 or 6 elements:
  * 1. atom index 1
@@ -48,8 +97,10 @@ using namespace engine;
  * 5. dihedral type
  * 6. linker marked with a '*' (optional)
  *
- * @param line
- * @param engine
+ * @param lineElements
+ * @param simBox
+ * @param lineNumber line number for error messages
+ * @return DihedralForceField
  *
  * @throws TopologyException if number of elements in line is
  * not 5 or 6
@@ -57,16 +108,17 @@ using namespace engine;
  * (=same atoms)
  * @throws TopologyException if sixth element is not a '*'
  */
-void DihedralSection::processSection(
+DihedralForceField DihedralSection::parseDihedral(
     std::vector<std::string> &lineElements,
-    Engine                   &engine
-)
+    SimulationBox            &simBox,
+    const int                 lineNumber
+) const
 {
     if (lineElements.size() != 5 && lineElements.size() != 6)
         throw TopologyException(std::format(
             "Wrong number of arguments in topology file dihedral section at "
             "line {} - number of elements has to be 5 or 6!",
-            _lineNumber
+            lineNumber
         ));
 
     auto atom1        = stoul(lineElements[0]);
@@ -85,7 +137,7 @@ void DihedralSection::processSection(
             throw TopologyException(std::format(
                 "Sixth entry in topology file in dihedral section has to be a "
                 "\'*\' or empty at line {}!",
-                _lineNumber
+                lineNumber
             ));
     }
 
@@ -98,11 +150,9 @@ void DihedralSection::processSection(
         throw TopologyException(std::format(
             "Topology file dihedral section at line {} - atoms cannot be the "
             "same!",
-            _lineNumber
+            lineNumber
         ));
 
-    auto &simBox = engine.getSimulationBox();
-
     const auto [mol1, idx1] = simBox.findMoleculeByAtomIndex(atom1);
     const auto [mol2, idx2] = simBox.findMoleculeByAtomIndex(atom2);
     const auto [mol3, idx3] = simBox.findMoleculeByAtomIndex(atom3);
@@ -114,7 +164,7 @@ void DihedralSection::processSection(
     auto dihedralFF = DihedralForceField(mols, atomIdxs, dihedralType);
     dihedralFF.setIsLinker(isLinker);
 
-    engine.getForceField().addDihedral(dihedralFF);
+    return dihedralFF;
 }
 
 /**
@@ -22,22 +22,74 @@
 
 #include "improperDihedralSection.hpp"
 
-#include <algorithm>   // for sort, unique
-#include <format>      // for format
-#include <string>      // for string, allocator
-#include <vector>      // for vector
+#include <algorithm>     // for sort, unique
+#include <format>        // for format
+#include <string>        // for string, allocator
+#include <string_view>   // for string_view
+#include <vector>        // for vector
 
 #include "dihedralForceField.hpp"   // for BondForceField
 #include "engine.hpp"               // for Engine
 #include "exceptions.hpp"           // for TopologyException
 
 using namespace input::topology;
+using namespace simulationBox;
 using namespace forceField;
 using namespace customException;
 using namespace engine;
 
 /**
- * @brief processes the improper section of the topology file
+ * @brief processes one line of the improper dihedral section of the topology
+ * file
+ *
+ * @param lineElements
+ * @param engine
+ */
+void ImproperDihedralSection::processSection(
+    std::vector<std::string> &lineElements,
+    Engine                   &engine
+)
+{
+    auto &simBox = engine.getSimulationBox();
+
+    const auto improperFF =
+        parseImproperDihedral(lineElements, simBox, _lineNumber);
+
+    engine.getForceField().addImproperDihedral(improperFF);
+}
+
+/**
+ * @brief processes all lines of the improper dihedral section in parallel
+ *
+ * @details the lines are parsed in parallel and the improper dihedrals are
+ * added to the force field afterwards in the order of the topology file
+ *
+ * @param lines
+ * @param lineNumbers
+ * @param engine
+ */
+void ImproperDihedralSection::processLines(
+    const std::vector<std::string_view> &lines,
+    const std::vector<int>              &lineNumbers,
+    Engine                              &engine
+)
+{
+    auto &simBox = engine.getSimulationBox();
+
+    simBox.initMoleculeAtomOffsets();
+
+    auto parseLine = [this, &simBox](auto &lineElements, const int lineNumber)
+    { return parseImproperDihedral(lineElements, simBox, lineNumber); };
+
+    auto parsed = parseLines<DihedralForceField>(lines, lineNumbers, parseLine);
+
+    auto &ff = engine.getForceField();
+
+    for (const auto &improperFF : parsed) ff.addImproperDihedral(improperFF);
+}
+
+/**
+ * @brief parses one line of the improper section of the topology file
  *
  * @details one line consists of 5 elements (cannot be linker!):
  * 1. atom index 1
@@ -46,25 +98,28 @@ using namespace engine;
  * 4. atom index 4
  * 5. improper dihedral type
  *
- * @param line
- * @param engine
+ * @param lineElements
+ * @param simBox
+ * @param lineNumber line number for error messages
+ * @return DihedralForceField
  *
  * @throws TopologyException if number of elements in line is
  * not 5
  * @throws TopologyException if atom indices are the same
  * (=same atoms)
  */
-void ImproperDihedralSection::processSection(
+DihedralForceField ImproperDihedralSection::parseImproperDihedral(
     std::vector<std::string> &lineElements,
-    Engine                   &engine
-)
+    SimulationBox            &simBox,
+    const int                 lineNumber
+) const
 {
     if (lineElements.size() != 5)
         throw TopologyException(std::format(
             "Wrong number of arguments in topology file improper dihedral "
             "section at "
             "line {} - number of elements has to be 5!",
-            _lineNumber
+            lineNumber
         ));
 
     auto atom1                = stoul(lineElements[0]);
@@ -82,11 +137,9 @@ void ImproperDihedralSection::processSection(
         throw TopologyException(std::format(
             "Topology file improper dihedral section at line {} - atoms cannot "
             "be the same!",
-            _lineNumber
+            lineNumber
         ));
 
-    auto &simBox = engine.getSimulationBox();
-
     const auto [mol1, idx1] = simBox.findMoleculeByAtomIndex(atom1);
     const auto [mol2, idx2] = simBox.findMoleculeByAtomIndex(atom2);
     const auto [mol3, idx3] = simBox.findMoleculeByAtomIndex(atom3);
@@ -97,7 +150,7 @@ void ImproperDihedralSection::processSection(
 
     auto improperFF = DihedralForceField(mols, atomIdxs, improperDihedralType);
 
-    engine.getForceField().addImproperDihedral(improperFF);
+    return improperFF;
 }
 
 /**
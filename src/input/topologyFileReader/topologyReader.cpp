@@ -22,8 +22,9 @@
 
 #include "topologyReader.hpp"
 
-#include <string>   // for string, basic_string, operator==, operator!=
-#include <vector>   // for vector
+#include <string>        // for string, basic_string, operator==
+#include <string_view>   // for string_view
+#include <vector>        // for vector
 
 #include "angleSection.hpp"                 // for AngleSection
 #include "bondSection.hpp"                  // for BondSection
@@ -37,7 +38,7 @@
 #include "improperDihedralSection.hpp"   // for ImproperDihedralSection
 #include "jCouplingSection.hpp"          // for JCouplingSection
 #include "shakeSection.hpp"              // for ShakeSection
-#include "stringUtilities.hpp"   // for removeComments, splitString, toLowerCopy
+#include "stringUtilities.hpp"   // for stripComments, splitString, toLowerCopy
 
 using namespace input::topology;
 using namespace engine;
@@ -48,7 +49,7 @@ using namespace utilities;
 /**
  * @brief constructor
  *
- * @details Sets filename and engine - also initializes the file pointer _fp.
+ * @details Sets filename and engine - also maps the file into memory in _fp.
  * Then all possible topology sections are added to _topologySections.
  *
  * @param filename
@@ -78,7 +79,7 @@ TopologyReader::TopologyReader(const std::string &filename, Engine &engine)
  */
 void TopologyReader::read()
 {
-    std::string              line;
+    std::string_view         line;
     std::vector<std::string> lineElements;
     int                      lineNumber = 1;
 
@@ -87,10 +88,9 @@ void TopologyReader::read()
             "Topology file needed for requested simulation setup"
         );
 
-    while (getline(_fp, line))
+    while (_fp.getLine(line))
     {
-        line         = removeComments(line, "#");
-        lineElements = splitString(line);
+        lineElements = splitString(stripComments(line, "#"));
 
         if (lineElements.empty())
         {
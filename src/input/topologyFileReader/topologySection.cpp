@@ -22,9 +22,12 @@
 
 #include "topologySection.hpp"
 
-#include <fstream>   // for getline
+#include <cstddef>       // for size_t
+#include <string>        // for string
+#include <string_view>   // for string_view
+#include <vector>        // for vector
 
-#include "stringUtilities.hpp"   // for removeComments, splitString, toLowerCopy
+#include "stringUtilities.hpp"   // for stripComments, splitString, toLowerCopy
 
 using namespace input::topology;
 using namespace utilities;
@@ -33,48 +36,82 @@ using namespace engine;
 /**
  * @brief general process function for topology sections
  *
- * @details Reads the topology file line by line and calls the processSection
- * function for each line until the "end" keyword is found. At the end of the
- * section the endedNormally function is called, which checks if the "end"
- * keyword was found.
+ * @details Collects all lines of the section until the "end" keyword is found
+ * and hands them to processLines. At the end of the section the endedNormally
+ * function is called, which checks if the "end" keyword was found.
  *
- * @param line
+ * @param lineElements
  * @param engine
  */
 void TopologySection::process(
-    std::vector<std::string> &lineElements,
-    Engine                   &engine
+    [[maybe_unused]] std::vector<std::string> &lineElements,
+    Engine                                    &engine
 )
 {
-    std::string line;
-    auto        endedNormal = false;
+    constexpr auto whitespace = " \t\n\v\f\r";
 
-    while (getline(*_fp, line))
+    std::string_view line;
+    pq::stringViews  lines;
+    std::vector<int> lineNumbers;
+    auto             endedNormal = false;
+
+    while (_fp->getLine(line))
     {
-        line         = removeComments(line, "#");
-        lineElements = splitString(line);
+        const auto content = stripComments(line, "#");
+        const auto begin   = content.find_first_not_of(whitespace);
 
-        if (lineElements.empty())
+        if (std::string_view::npos == begin)
         {
             ++_lineNumber;
             continue;
         }
 
-        if (toLowerCopy(lineElements[0]) == "end")
+        const auto end = content.find_first_of(whitespace, begin);
+
+        if (toLowerCopy(content.substr(begin, end - begin)) == "end")
         {
             ++_lineNumber;
             endedNormal = true;
             break;
         }
 
-        processSection(lineElements, engine);
+        lines.push_back(content);
+        lineNumbers.push_back(_lineNumber);
 
         ++_lineNumber;
     }
 
+    const auto lineNumber = _lineNumber;
+
+    processLines(lines, lineNumbers, engine);
+
+    _lineNumber = lineNumber;
+
     endedNormally(endedNormal);
 }
 
+/**
+ * @brief processes all lines of a section one by one with processSection
+ *
+ * @param lines lines of the section without comments
+ * @param lineNumbers line number of each line
+ * @param engine
+ */
+void TopologySection::processLines(
+    const std::vector<std::string_view> &lines,
+    const std::vector<int>              &lineNumbers,
+    Engine                              &engine
+)
+{
+    for (size_t i = 0; i < lines.size(); ++i)
+    {
+        auto lineElements = splitString(lines[i]);
+
+        _lineNumber = lineNumbers[i];
+        processSection(lineElements, engine);
+    }
+}
+
 /**
  * @brief set line number
  *
@@ -90,7 +127,7 @@ void TopologySection::setLineNumber(const int lineNumber)
  *
  * @param fp
  */
-void TopologySection::setFp(std::ifstream *fp) { _fp = fp; }
+void TopologySection::setFp(utilities::MappedFile *fp) { _fp = fp; }
 
 /**
  * @brief get line number
@@ -0,0 +1,182 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "baoab.hpp"
+
+#include <algorithm>   // for for_each
+#include <cmath>       // for exp, sqrt
+#include <cstddef>     // for size_t
+
+#include "atom.hpp"                                  // for Atom
+#include "constants/conversionFactors.hpp"           // for _FS_TO_S_
+#include "constants/internalConversionFactors.hpp"   // for _V_VERLET_VELOCITY_FACTOR_
+#include "constants/natureConstants.hpp"             // for _BOLTZMANN_CONSTANT_
+#include "simulationBox.hpp"                         // for SimulationBox
+#include "thermostatSettings.hpp"                    // for ThermostatSettings
+#include "timingsSettings.hpp"                       // for TimingsSettings
+#include "vector3d.hpp"                              // for Vec3D
+
+using namespace integrator;
+using namespace simulationBox;
+using namespace settings;
+using namespace constants;
+using namespace linearAlgebra;
+using namespace utilities;
+
+BAOAB::BAOAB() : Integrator("BAOAB"){};
+
+/**
+ * @brief applies the B, A, O and A parts of the BAOAB splitting
+ *
+ * @details all four parts only act on the velocity and position of a single
+ * atom, therefore they are fused into one parallel loop over the atoms. The
+ * random numbers of an atom only depend on the seed, the step and the atom
+ * index, which makes the result independent of the number of threads.
+ *
+ * @param simBox
+ */
+void BAOAB::firstStep(SimulationBox &simBox)
+{
+    startTimingsSection<"BAOAB - First Step">();
+
+    const auto &atoms  = simBox.getAtoms();
+    const auto  nAtoms = atoms.size();
+
+    const auto timeStep    = TimingsSettings::getTimeStep();
+    const auto temperature = ThermostatSettings::getActualTargetTemperature();
+
+    const auto kickFactor  = timeStep * _V_VERLET_VELOCITY_FACTOR_;
+    const auto driftFactor = 0.5 * timeStep * _FS_TO_S_;
+
+    const auto damping  = std::exp(-_friction * timeStep * _FS_TO_S_);
+    const auto variance = (1.0 - damping * damping) * _BOLTZMANN_CONSTANT_ *
+                          temperature / _AMU_TO_KG_;
+    const auto noise = std::sqrt(variance) / _VELOCITY_UNIT_TO_SI_;
+
+    // clang-format off
+    #pragma omp parallel for schedule(static)
+    // clang-format on
+    for (size_t i = 0; i < nAtoms; ++i)
+    {
+        auto      &atom = atoms[i];
+        const auto mass = atom->getMass();
+
+        auto velocity = atom->getVelocity();
+        auto position = atom->getPosition();
+
+        velocity += kickFactor * atom->getForce() / mass;
+        position += driftFactor * velocity;
+
+        const auto  random       = _random.normals(i);
+        const Vec3D randomFactor = {random[0], random[1], random[2]};
+
+        velocity  = damping * velocity;
+        velocity += noise / std::sqrt(mass) * randomFactor;
+        position += driftFactor * velocity;
+
+        simBox.applyPBC(position);
+
+        atom->setVelocity(velocity);
+        atom->setPosition(position);
+    }
+
+    _random.advance();
+
+    const auto box = simBox.getBoxPtr();
+
+    auto calculateCOM = [&box](auto &molecule)
+    {
+        molecule.calculateCenterOfMass(*box);
+        molecule.setAtomForcesToZero();
+    };
+
+    std::ranges::for_each(simBox.getMolecules(), calculateCOM);
+
+    stopTimingsSection<"BAOAB - First Step">();
+}
+
+/**
+ * @brief applies the final B part of the BAOAB splitting
+ *
+ * @param simBox
+ */
+void BAOAB::secondStep(SimulationBox &simBox)
+{
+    startTimingsSection<"BAOAB - Second Step">();
+
+    std::ranges::for_each(
+        simBox.getAtoms(),
+        [this](auto atom) { integrateVelocities(atom.get()); }
+    );
+
+    stopTimingsSection<"BAOAB - Second Step">();
+}
+
+/********************************
+ * standard getters and setters *
+ ********************************/
+
+/**
+ * @brief get the state of the random number generator of the O part
+ *
+ * @return std::string
+ */
+std::string BAOAB::getRandomState() const { return _random.getState(); }
+
+/**
+ * @brief set the state of the random number generator of the O part
+ *
+ * @param state as returned by getRandomState
+ */
+void BAOAB::setRandomState(const std::string &state)
+{
+    _random.setState(state);
+}
+
+/**
+ * @brief set the friction of the O part in 1/s
+ *
+ * @param friction
+ */
+void BAOAB::setFriction(const double friction) { _friction = friction; }
+
+/**
+ * @brief set the random number generator of the O part
+ *
+ * @param random
+ */
+void BAOAB::setRandom(const Philox &random) { _random = random; }
+
+/**
+ * @brief get the friction of the O part in 1/s
+ *
+ * @return double
+ */
+double BAOAB::getFriction() const { return _friction; }
+
+/**
+ * @brief get the random number generator of the O part
+ *
+ * @return const Philox&
+ */
+const Philox &BAOAB::getRandom() const { return _random; }
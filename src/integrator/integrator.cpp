@@ -95,4 +95,20 @@ void Integrator::integratePositions(Atom *atom, const SimulationBox &simBox)
 std::string_view Integrator::getIntegratorType() const
 {
     return _integratorType;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief get the state of the random number generator
+ *
+ * @details deterministic integrators have no state
+ *
+ * @return std::string
+ */
+std::string Integrator::getRandomState() const { return ""; }
+
+/**
+ * @brief set the state of the random number generator
+ *
+ * @details deterministic integrators ignore the state
+ */
+void Integrator::setRandomState(const std::string &) {}
@@ -60,7 +60,7 @@ void KokkosVelocityVerlet::firstStep(
     simulationBox::KokkosSimulationBox &kokkosSimBox
 )
 {
-    startTimingsSection("Velocity Verlet - first step");
+    startTimingsSection<"Velocity Verlet - first step">();
 
     kokkosSimBox.transferPositionsFromSimulationBox(simBox);
     kokkosSimBox.transferForcesFromSimulationBox(simBox);
@@ -111,7 +111,7 @@ void KokkosVelocityVerlet::firstStep(
     kokkosSimBox.transferVelocitiesToSimulationBox(simBox);
     kokkosSimBox.transferPositionsToSimulationBox(simBox);
 
-    stopTimingsSection("Velocity Verlet - first step");
+    stopTimingsSection<"Velocity Verlet - first step">();
 }
 
 /**
@@ -125,7 +125,7 @@ void KokkosVelocityVerlet::secondStep(
     simulationBox::KokkosSimulationBox &kokkosSimBox
 )
 {
-    startTimingsSection("Velocity Verlet - second step");
+    startTimingsSection<"Velocity Verlet - second step">();
 
     kokkosSimBox.transferForcesFromSimulationBox(simBox);
     kokkosSimBox.transferVelocitiesFromSimulationBox(simBox);
@@ -153,5 +153,5 @@ void KokkosVelocityVerlet::secondStep(
 
     kokkosSimBox.transferVelocitiesToSimulationBox(simBox);
 
-    stopTimingsSection("Velocity Verlet - second step");
+    stopTimingsSection<"Velocity Verlet - second step">();
 }
\ No newline at end of file
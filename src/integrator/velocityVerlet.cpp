@@ -36,7 +36,7 @@ VelocityVerlet::VelocityVerlet() : Integrator("VelocityVerlet"){};
  */
 void VelocityVerlet::firstStep(SimulationBox &simBox)
 {
-    startTimingsSection("Velocity Verlet - First Step");
+    startTimingsSection<"Velocity Verlet - First Step">();
 
     auto integrate = [this, &simBox](auto &atom)
     {
@@ -56,7 +56,7 @@ void VelocityVerlet::firstStep(SimulationBox &simBox)
 
     std::ranges::for_each(simBox.getMolecules(), calculateCOM);
 
-    stopTimingsSection("Velocity Verlet - First Step");
+    stopTimingsSection<"Velocity Verlet - First Step">();
 }
 
 /**
@@ -66,12 +66,12 @@ void VelocityVerlet::firstStep(SimulationBox &simBox)
  */
 void VelocityVerlet::secondStep(SimulationBox &simBox)
 {
-    startTimingsSection("Velocity Verlet - Second Step");
+    startTimingsSection<"Velocity Verlet - Second Step">();
 
     std::ranges::for_each(
         simBox.getAtoms(),
         [this](auto atom) { integrateVelocities(atom.get()); }
     );
 
-    stopTimingsSection("Velocity Verlet - Second Step");
+    stopTimingsSection<"Velocity Verlet - Second Step">();
 }
\ No newline at end of file
@@ -27,8 +27,10 @@
 #include <functional>   // for identity
 #include <ranges>       // for std::ranges::find_if
 #include <string>       // for string
+#include <utility>      // for pair
 
 #include "exceptions.hpp"
+#include "molecule.hpp"
 #include "simulationBox.hpp"
 
 using namespace intraNonBonded;
@@ -93,34 +95,92 @@ void IntraNonBonded::fillIntraNonBondedMaps(SimulationBox &box)
     };
 
     std::ranges::for_each(box.getMolecules(), fillSingleMap);
+
+    _pairList.reset();
 }
 
 /**
- * @brief calculate the intra non bonded interactions for each intraNonBondedMap
+ * @brief calculate the intra non bonded interactions of all intraNonBondedMaps
+ *
+ * @details the flattened pair list is compiled from the intraNonBondedMaps on
+ * the first call, as the non-Coulomb pairs are not fully set up before (e.g.
+ * guff.dat is read after the intra non bonded setup). Without any
+ * intraNonBondedMaps the potentials might not be set and nothing is done.
+ * If computeForces is false only the energies are calculated. The shift
+ * forces are only stored if _computeShiftForces is true.
  *
+ * @tparam computeForces
  * @param box
  * @param physicalData
  */
+template <bool computeForces>
 void IntraNonBonded::calculate(
     const SimulationBox &box,
     PhysicalData        &physicalData
 )
 {
-    startTimingsSection("IntraNonBonded");
+    if (_intraNonBondedMaps.empty())
+        return;
 
-    auto calculateSingleContr = [this, &box, &physicalData](auto &intraMap)
-    {
-        intraMap.calculate(
-            _coulombPotential.get(),
-            _nonCoulombPot.get(),
+    startTimingsSection<"IntraNonBonded">();
+
+    if (!_pairList.isBuilt())
+        _pairList.build(_intraNonBondedMaps, *_nonCoulombPot);
+
+    const auto &coulombPot = *_coulombPotential;
+
+    if (computeForces && !_computeShiftForces)
+        _pairList.calculate<computeForces, false>(
+            coulombPot,
             box,
             physicalData
         );
-    };
+    else
+        _pairList.calculate<computeForces>(coulombPot, box, physicalData);
+
+    stopTimingsSection<"IntraNonBonded">();
+}
 
-    std::ranges::for_each(_intraNonBondedMaps, calculateSingleContr);
+template void IntraNonBonded::calculate<true>(
+    const SimulationBox &,
+    PhysicalData &
+);
 
-    stopTimingsSection("IntraNonBonded");
+template void IntraNonBonded::calculate<false>(
+    const SimulationBox &,
+    PhysicalData &
+);
+
+/**
+ * @brief calculate the intra non bonded energies of a single molecule
+ *
+ * @details only the energies are calculated, the forces of the atoms are not
+ * changed. Molecules without an IntraNonBondedMap have no intra non bonded
+ * energies.
+ *
+ * @param box
+ * @param molecule
+ * @return std::pair<double, double> - the coulomb and non-coulomb energy
+ */
+std::pair<double, double> IntraNonBonded::calculateMoleculeEnergies(
+    const SimulationBox &box,
+    const Molecule      &molecule
+)
+{
+    auto isMolecule = [&molecule](const auto &intraNonBondedMap)
+    { return intraNonBondedMap.getMolecule() == &molecule; };
+
+    const auto it = find_if(_intraNonBondedMaps, isMolecule);
+
+    if (it == _intraNonBondedMaps.end())
+        return {0.0, 0.0};
+
+    if (!_pairList.isBuilt())
+        _pairList.build(_intraNonBondedMaps, *_nonCoulombPot);
+
+    const auto index = size_t(it - _intraNonBondedMaps.begin());
+
+    return _pairList.calculateMoleculeEnergies(*_coulombPotential, box, index);
 }
 
 /*************************
@@ -149,6 +209,7 @@ void IntraNonBonded::addIntraNonBondedContainer(
 void IntraNonBonded::addIntraNonBondedMap(const IntraNonBondedMap &interaction)
 {
     _intraNonBondedMaps.push_back(interaction);
+    _pairList.reset();
 }
 
 /*****************************
@@ -204,6 +265,16 @@ void IntraNonBonded::setCoulombPotential(
     _coulombPotential = pot;
 }
 
+/**
+ * @brief set if the shift forces are accumulated in calculate
+ *
+ * @param computeShiftForces
+ */
+void IntraNonBonded::setComputeShiftForces(const bool computeShiftForces)
+{
+    _computeShiftForces = computeShiftForces;
+}
+
 /***************************
  *                         *
  * standard getter methods *
@@ -239,4 +310,14 @@ std::vector<IntraNonBondedContainer> IntraNonBonded::
 std::vector<IntraNonBondedMap> IntraNonBonded::getIntraNonBondedMaps() const
 {
     return _intraNonBondedMaps;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief get the flattened intra non bonded pair list
+ *
+ * @return const IntraNonBondedPairList&
+ */
+const IntraNonBondedPairList &IntraNonBonded::getPairList() const
+{
+    return _pairList;
+}
@@ -138,7 +138,7 @@ std::pair<double, double> IntraNonBondedMap::calculateSingleInteraction(
     dPos                += txyz;
     const auto distance  = norm(dPos);
 
-    if (distance < CoulombPotential::getCoulombRadiusCutOff())
+    if (distance < coulPot->getCoulombRadiusCutOff())
     {
         const auto charge1 = _molecule->getPartialCharge(size_t(atomIdx1));
         const auto charge2 = _molecule->getPartialCharge(atomIdx2);
@@ -0,0 +1,322 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "intraNonBondedPairList.hpp"
+
+#include <cmath>           // for sqrt
+#include <cstdlib>         // for abs
+#include <unordered_map>   // for unordered_map
+
+#include "atom.hpp"                      // for Atom
+#include "box.hpp"                       // for Box
+#include "coulombPotential.hpp"          // for CoulombPotential
+#include "intraNonBondedContainer.hpp"   // for IntraNonBondedContainer
+#include "molecule.hpp"                  // for Molecule
+#include "nonCoulombPair.hpp"            // for NonCoulombPair
+#include "nonCoulombPotential.hpp"       // for NonCoulombPotential
+#include "physicalData.hpp"              // for PhysicalData
+#include "potential.hpp"                 // for Potential
+#include "potentialSettings.hpp"         // for PotentialSettings
+#include "simulationBox.hpp"             // for SimulationBox
+
+using namespace intraNonBonded;
+using namespace potential;
+using namespace physicalData;
+using namespace simulationBox;
+using namespace linearAlgebra;
+using namespace settings;
+
+/**
+ * @brief compiles the flattened pair list from the IntraNonBondedMaps
+ *
+ * @details negative atom indices in the IntraNonBondedContainer mark 1-4
+ * interactions, which are decoded here into the respective scaling factors.
+ * The non-Coulomb pair of each atom pair is resolved once and stored as
+ * index into a list of unique non-Coulomb pairs.
+ *
+ * @param intraNonBondedMaps
+ * @param nonCoulombPot
+ */
+void IntraNonBondedPairList::build(
+    const std::vector<IntraNonBondedMap> &intraNonBondedMaps,
+    NonCoulombPotential                  &nonCoulombPot
+)
+{
+    _moleculeOffsets.clear();
+    _atoms1.clear();
+    _atoms2.clear();
+    _coulombScales.clear();
+    _nonCoulombScales.clear();
+    _nonCoulPairIndices.clear();
+    _nonCoulPairs.clear();
+
+    std::unordered_map<const NonCoulombPair *, size_t> nonCoulPairToIndex;
+
+    const auto scale14Coulomb = PotentialSettings::getScale14Coulomb();
+    const auto scale14VDW     = PotentialSettings::getScale14VDW();
+
+    _moleculeOffsets.push_back(0);
+
+    for (const auto &intraNonBondedMap : intraNonBondedMaps)
+    {
+        auto      *molecule    = intraNonBondedMap.getMolecule();
+        const auto atomIndices = intraNonBondedMap.getAtomIndices();
+        const auto moltype     = molecule->getMoltype();
+
+        for (size_t atomIdx1 = 0; atomIdx1 < atomIndices.size(); ++atomIdx1)
+            for (const auto atomIndex2AsInt : atomIndices[atomIdx1])
+            {
+                const auto atomIdx2 = size_t(::abs(atomIndex2AsInt));
+                const bool scale    = atomIndex2AsInt < 0;
+
+                auto &atom1 = molecule->getAtom(atomIdx1);
+                auto &atom2 = molecule->getAtom(atomIdx2);
+
+                const auto combinedIdx = {
+                    moltype,
+                    moltype,
+                    atom1.getAtomType(),
+                    atom2.getAtomType(),
+                    atom1.getInternalGlobalVDWType(),
+                    atom2.getInternalGlobalVDWType()
+                };
+
+                const auto nonCoulPair =
+                    nonCoulombPot.getNonCoulPair(combinedIdx);
+
+                const auto [iter, inserted] = nonCoulPairToIndex.try_emplace(
+                    nonCoulPair.get(),
+                    _nonCoulPairs.size()
+                );
+
+                if (inserted)
+                    _nonCoulPairs.push_back(nonCoulPair);
+
+                _atoms1.push_back(&atom1);
+                _atoms2.push_back(&atom2);
+                _coulombScales.push_back(scale ? scale14Coulomb : 1.0);
+                _nonCoulombScales.push_back(scale ? scale14VDW : 1.0);
+                _nonCoulPairIndices.push_back(iter->second);
+            }
+
+        _moleculeOffsets.push_back(_atoms1.size());
+    }
+
+    _isBuilt = true;
+}
+
+/**
+ * @brief calculates the intra molecular non-bonded interactions of all pairs
+ *
+ * @details the molecules are processed in parallel. As each pair only
+ * contains atoms of its own molecule, the force accumulation is free of
+ * conflicts. If computeForces is false only the energies are calculated.
+ * If computeShiftForces is false no shift forces are stored.
+ *
+ * @tparam computeForces
+ * @tparam computeShiftForces
+ * @param coulombPot
+ * @param simBox
+ * @param physicalData
+ */
+template <bool computeForces, bool computeShiftForces>
+void IntraNonBondedPairList::calculate(
+    const CoulombPotential &coulombPot,
+    const SimulationBox    &simBox,
+    PhysicalData           &physicalData
+) const
+{
+    const auto &box        = simBox.getBox();
+    const auto  nMolecules = getNumberOfMolecules();
+
+    auto coulombEnergy    = 0.0;
+    auto nonCoulombEnergy = 0.0;
+
+    // clang-format off
+    #pragma omp parallel for schedule(dynamic, 16) reduction(+:coulombEnergy, nonCoulombEnergy)
+    // clang-format on
+    for (size_t mol = 0; mol < nMolecules; ++mol)
+    {
+        const auto [coulE, nonCoulE] =
+            calculateMolecule<computeForces, computeShiftForces>(
+                coulombPot,
+                box,
+                mol
+            );
+
+        coulombEnergy    += coulE;
+        nonCoulombEnergy += nonCoulE;
+    }
+
+    physicalData.addIntraCoulombEnergy(coulombEnergy);
+    physicalData.addIntraNonCoulombEnergy(nonCoulombEnergy);
+}
+
+/**
+ * @brief calculates the intra molecular non-bonded energies of a single
+ * molecule without any forces
+ *
+ * @param coulombPot
+ * @param simBox
+ * @param molecule index of the molecule in the pair list, i.e. of its
+ * IntraNonBondedMap
+ * @return std::pair<double, double> - the coulomb and non-coulomb energy
+ */
+std::pair<double, double> IntraNonBondedPairList::calculateMoleculeEnergies(
+    const CoulombPotential &coulombPot,
+    const SimulationBox    &simBox,
+    const size_t            molecule
+) const
+{
+    const auto &box = simBox.getBox();
+
+    return calculateMolecule<false, false>(coulombPot, box, molecule);
+}
+
+/**
+ * @brief calculates the intra molecular non-bonded interactions of the pairs
+ * of a single molecule
+ *
+ * @tparam computeForces
+ * @tparam computeShiftForces
+ * @param coulombPot
+ * @param box
+ * @param molecule index of the molecule in the pair list
+ * @return std::pair<double, double> - the coulomb and non-coulomb energy
+ */
+template <bool computeForces, bool computeShiftForces>
+std::pair<double, double> IntraNonBondedPairList::calculateMolecule(
+    const CoulombPotential &coulombPot,
+    const Box              &box,
+    const size_t            molecule
+) const
+{
+    const auto rcCutOff = coulombPot.getCoulombRadiusCutOff();
+
+    const auto begin = _moleculeOffsets[molecule];
+    const auto end   = _moleculeOffsets[molecule + 1];
+
+    auto coulombEnergy    = 0.0;
+    auto nonCoulombEnergy = 0.0;
+
+    for (auto pair = begin; pair < end; ++pair)
+    {
+        auto *atom1 = _atoms1[pair];
+        auto *atom2 = _atoms2[pair];
+
+        auto       dPos  = atom1->getPosition() - atom2->getPosition();
+        const auto txyz  = -box.calcShiftVector(dPos);
+        dPos            += txyz;
+
+        const auto distance = norm(dPos);
+
+        if (distance >= rcCutOff)
+            continue;
+
+        const auto chargeProduct =
+            atom1->getPartialCharge() * atom2->getPartialCharge();
+
+        const auto &nonCoulPair = *_nonCoulPairs[_nonCoulPairIndices[pair]];
+
+        auto [coulE, nonCoulE, force] = Potential::calculatePairInteraction(
+            coulombPot,
+            nonCoulPair,
+            distance,
+            chargeProduct,
+            _coulombScales[pair],
+            _nonCoulombScales[pair]
+        );
+
+        coulombEnergy    += coulE;
+        nonCoulombEnergy += nonCoulE;
+
+        if constexpr (!computeForces)
+            continue;
+
+        force /= distance;
+
+        const auto forcexyz = force * dPos;
+
+        atom1->addForce(forcexyz);
+        atom2->addForce(-forcexyz);
+
+        if constexpr (computeShiftForces)
+            atom1->addShiftForce(forcexyz * txyz);
+    }
+
+    return {coulombEnergy, nonCoulombEnergy};
+}
+
+template void IntraNonBondedPairList::calculate<true>(
+    const CoulombPotential &,
+    const SimulationBox &,
+    PhysicalData &
+) const;
+
+template void IntraNonBondedPairList::calculate<true, false>(
+    const CoulombPotential &,
+    const SimulationBox &,
+    PhysicalData &
+) const;
+
+template void IntraNonBondedPairList::calculate<false>(
+    const CoulombPotential &,
+    const SimulationBox &,
+    PhysicalData &
+) const;
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief get the number of pairs in the list
+ *
+ * @return size_t
+ */
+size_t IntraNonBondedPairList::getNumberOfPairs() const
+{
+    return _atoms1.size();
+}
+
+/**
+ * @brief get the number of molecules in the list
+ *
+ * @return size_t
+ */
+size_t IntraNonBondedPairList::getNumberOfMolecules() const
+{
+    return _moleculeOffsets.empty() ? 0 : _moleculeOffsets.size() - 1;
+}
+
+/**
+ * @brief get the number of unique non-Coulomb pairs
+ *
+ * @return size_t
+ */
+size_t IntraNonBondedPairList::getNumberOfNonCoulPairs() const
+{
+    return _nonCoulPairs.size();
+}
@@ -86,7 +86,7 @@ void BerendsenManostat::applyManostat(
     PhysicalData  &physicalData
 )
 {
-    startTimingsSection("Berendsen");
+    startTimingsSection<"Berendsen">();
 
     calculatePressure(simBox, physicalData);
 
@@ -104,7 +104,7 @@ void BerendsenManostat::applyManostat(
 
     std::ranges::for_each(simBox.getMolecules(), scaleMolecule);
 
-    stopTimingsSection("Berendsen");
+    stopTimingsSection<"Berendsen">();
 }
 
 /**
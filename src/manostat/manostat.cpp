@@ -93,13 +93,40 @@ void Manostat::rotateMu(tensor3D &mu) const
  */
 void Manostat::applyManostat(SimulationBox &box, PhysicalData &data)
 {
-    startTimingsSection("Calc Pressure");
+    startTimingsSection<"Calc Pressure">();
 
     calculatePressure(box, data);
 
-    stopTimingsSection("Calc Pressure");
+    stopTimingsSection<"Calc Pressure">();
 }
 
+/**
+ * @brief check if the manostat needs the virial
+ *
+ * @details the pressure coupling of the base manostat and of all manostats
+ * derived from it is based on the pressure tensor, therefore the virial and
+ * the kinetic energy tensor are needed whenever the manostat is applied
+ *
+ * @return true
+ */
+bool Manostat::isVirialBased() const { return true; }
+
+/**
+ * @brief get the state of the random number generator
+ *
+ * @details the base manostat is deterministic and has no state
+ *
+ * @return std::string
+ */
+std::string Manostat::getRandomState() const { return ""; }
+
+/**
+ * @brief set the state of the random number generator
+ *
+ * @details the base manostat is deterministic and ignores the state
+ */
+void Manostat::setRandomState(const std::string &) {}
+
 /**
  * @brief get the manostat type
  *
@@ -20,4 +20,406 @@
 <GPL_HEADER>
 ******************************************************************************/
 
-#include "monteCarloManostat.hpp"
\ No newline at end of file
+#include "monteCarloManostat.hpp"
+
+#include <algorithm>   // for min
+#include <cmath>       // for cbrt, exp, log, sqrt
+#include <cstdint>     // for uint64_t
+#include <format>      // for format
+#include <sstream>     // for istringstream
+
+#include "celllist.hpp"                      // for CellList
+#include "constants/conversionFactors.hpp"   // for _BOLTZMANN_CONSTANT_IN_KCAL_PER_MOL_
+#include "constants/internalConversionFactors.hpp"   // for _PRESSURE_FACTOR_
+#include "defaults.hpp"               // for _MONTE_CARLO_MAX_VOLUME_CHANGE_
+#include "physicalData.hpp"           // for PhysicalData
+#include "potential.hpp"              // for Potential
+#include "potentialSettings.hpp"      // for PotentialSettings
+#include "settings.hpp"               // for Settings
+#include "simulationBox.hpp"          // for SimulationBox
+#include "staticMatrix.hpp"           // for diagonalMatrix
+#include "thermostatSettings.hpp"     // for ThermostatSettings
+#include "vector3d.hpp"               // for Vec3D
+
+using namespace manostat;
+using namespace settings;
+using namespace simulationBox;
+using namespace physicalData;
+using namespace linearAlgebra;
+using namespace constants;
+using namespace utilities;
+
+/**
+ * @brief Construct a new Monte Carlo Manostat:: Monte Carlo Manostat object
+ *
+ * @param targetPressure
+ * @param frequency number of steps between two volume moves
+ * @param volumeChange initial maximum volume change relative to the volume
+ * @param isotropy
+ */
+MonteCarloManostat::MonteCarloManostat(
+    const double   targetPressure,
+    const size_t   frequency,
+    const double   volumeChange,
+    const Isotropy isotropy
+)
+    : Manostat(targetPressure),
+      _random(Settings::getRandomSeed(), PhiloxStream::MANOSTAT),
+      _isotropy(isotropy),
+      _frequency(frequency),
+      _volumeChange(volumeChange)
+{
+}
+
+/**
+ * @brief apply Monte Carlo manostat for NPT ensemble
+ *
+ * @details the pressure is only calculated for the output, it is discarded
+ * on steps without a virial evaluation. Every _frequency steps a volume move
+ * is attempted.
+ *
+ * @param simBox
+ * @param physicalData
+ */
+void MonteCarloManostat::applyManostat(
+    SimulationBox &simBox,
+    PhysicalData  &physicalData
+)
+{
+    startTimingsSection<"Monte Carlo">();
+
+    calculatePressure(simBox, physicalData);
+
+    if (++_nSteps % _frequency == 0)
+        attemptVolumeMove(simBox, physicalData);
+
+    physicalData.setVolume(simBox.getVolume());
+    physicalData.setDensity(simBox.getDensity());
+
+    stopTimingsSection<"Monte Carlo">();
+}
+
+/**
+ * @brief attempt a single Monte Carlo volume move
+ *
+ * @details the volume change is drawn uniformly from
+ * [-_volumeChange * V, _volumeChange * V]. The box and the centers of mass of
+ * all molecules are scaled, while the molecules themselves stay rigid. The
+ * intra molecular and bonded energies are therefore unchanged and only the
+ * inter molecular energy is re-evaluated via the energy-only path of the
+ * potential. The inter molecular energy of the old configuration is taken
+ * from the force calculation of the current step, i.e. the Coulomb and non
+ * Coulomb energies without their intra molecular parts. The move is
+ * accepted with probability
+ *
+ * min(1, exp(-beta * (dU + P dV) + N_mol * ln(V_new / V_old)))
+ *
+ * otherwise the box, its density and the positions are restored. Moves leading to a box
+ * smaller than twice the Coulomb radius cut off are rejected.
+ *
+ * @param simBox
+ * @param physicalData
+ * @return true if the move was accepted
+ */
+bool MonteCarloManostat::attemptVolumeMove(
+    SimulationBox &simBox,
+    PhysicalData  &physicalData
+)
+{
+    const auto random = _random.uniforms(0);
+    _random.advance();
+
+    const auto oldVolume = simBox.getVolume();
+    const auto deltaV    = (2.0 * random[0] - 1.0) * _volumeChange * oldVolume;
+    const auto newVolume = oldVolume + deltaV;
+
+    const auto mu = calculateMu(newVolume / oldVolume, random[1]);
+
+    const auto oldBoxDimensions = simBox.getBoxDimensions();
+
+    auto &atoms = simBox.getAtoms();
+
+    std::vector<Vec3D> oldPositions;
+    oldPositions.reserve(atoms.size());
+
+    for (const auto &atom : atoms) oldPositions.push_back(atom->getPosition());
+
+    simBox.scaleBox(mu);
+
+    for (auto &molecule : simBox.getMolecules())
+        molecule.scale(mu, simBox.getBox());
+
+    ++_nAttempts;
+
+    const auto cutOff     = PotentialSettings::getCoulombRadiusCutOff();
+    auto       isAccepted = simBox.getMinimalBoxDimension() >= 2.0 * cutOff;
+
+    const auto intraCoulomb    = physicalData.getIntraCoulombEnergy();
+    const auto intraNonCoulomb = physicalData.getIntraNonCoulombEnergy();
+
+    auto newData = PhysicalData();
+
+    if (isAccepted)
+    {
+        calculateInterEnergy(simBox, newData);
+
+        const auto oldEnergy =
+            physicalData.getCoulombEnergy() - intraCoulomb +
+            physicalData.getNonCoulombEnergy() - intraNonCoulomb;
+        const auto newEnergy =
+            newData.getCoulombEnergy() + newData.getNonCoulombEnergy();
+
+        const auto kb = _BOLTZMANN_CONSTANT_IN_KCAL_PER_MOL_;
+        const auto kT = kb * ThermostatSettings::getActualTargetTemperature();
+
+        const auto nMolecules = double(simBox.getNumberOfMolecules());
+        const auto pV         = _targetPressure * deltaV / _PRESSURE_FACTOR_;
+
+        auto work  = newEnergy - oldEnergy + pV;
+        work      -= nMolecules * kT * std::log(newVolume / oldVolume);
+
+        isAccepted = work <= 0.0 || random[2] < std::exp(-work / kT);
+    }
+
+    if (isAccepted)
+    {
+        ++_nAccepted;
+
+        const auto coulomb    = newData.getCoulombEnergy() + intraCoulomb;
+        const auto nonCoulomb = newData.getNonCoulombEnergy() + intraNonCoulomb;
+
+        physicalData.setCoulombEnergy(coulomb);
+        physicalData.setNonCoulombEnergy(nonCoulomb);
+    }
+    else
+    {
+        simBox.setBoxDimensions(oldBoxDimensions);
+        simBox.setVolume(oldVolume);
+        simBox.calculateDensity();
+
+        for (size_t i = 0; i < atoms.size(); ++i)
+            atoms[i]->setPosition(oldPositions[i]);
+    }
+
+    if (_nAttempts % _N_TUNING_ATTEMPTS_ == 0)
+        tuneVolumeChange();
+
+    return isAccepted;
+}
+
+/**
+ * @brief calculate the scaling tensor of a volume move
+ *
+ * @details isotropic moves scale all axes, semi-isotropic moves scale either
+ * the two isotropic axes or the anisotropic axis (chosen with equal
+ * probability) and anisotropic moves scale a single randomly chosen axis.
+ *
+ * @param volumeRatio V_new / V_old
+ * @param random uniform random number in (0, 1) to choose the axes
+ * @return tensor3D
+ */
+tensor3D MonteCarloManostat::calculateMu(
+    const double volumeRatio,
+    const double random
+) const
+{
+    auto mu = Vec3D(1.0);
+
+    switch (_isotropy)
+    {
+        using enum Isotropy;
+
+        case SEMI_ISOTROPIC:
+            if (random < 0.5)
+            {
+                mu[_2DIsotropicAxes[0]] = std::sqrt(volumeRatio);
+                mu[_2DIsotropicAxes[1]] = std::sqrt(volumeRatio);
+            }
+            else
+                mu[_2DAnisotropicAxis] = volumeRatio;
+            break;
+
+        case ANISOTROPIC:
+            mu[std::min(size_t(3.0 * random), size_t(2))] = volumeRatio;
+            break;
+
+        case ISOTROPIC:   // fall through
+        default: mu = Vec3D(std::cbrt(volumeRatio));
+    }
+
+    return diagonalMatrix(mu);
+}
+
+/**
+ * @brief calculate the inter molecular Coulomb and non-Coulomb energy
+ *
+ * @param simBox
+ * @param physicalData
+ */
+void MonteCarloManostat::calculateInterEnergy(
+    SimulationBox &simBox,
+    PhysicalData  &physicalData
+) const
+{
+    _cellList->updateCellList(simBox);
+
+    _potential->calculateEnergy(simBox, physicalData, *_cellList);
+}
+
+/**
+ * @brief adapt the maximum volume change to the acceptance ratio
+ *
+ * @details after every _N_TUNING_ATTEMPTS_ attempts the maximum volume change
+ * is decreased if less than 25% and increased if more than 75% of these
+ * attempts were accepted
+ */
+void MonteCarloManostat::tuneVolumeChange()
+{
+    const auto nAccepted = _nAccepted - _nAcceptedTuning;
+    const auto ratio     = double(nAccepted) / double(_N_TUNING_ATTEMPTS_);
+
+    if (ratio < 0.25)
+        _volumeChange /= 1.1;
+
+    else if (ratio > 0.75)
+        _volumeChange = std::min(
+            _volumeChange * 1.1,
+            defaults::_MONTE_CARLO_MAX_VOLUME_CHANGE_
+        );
+
+    _nAcceptedTuning = _nAccepted;
+}
+
+/**
+ * @brief the Monte Carlo manostat is energy based
+ *
+ * @return false
+ */
+bool MonteCarloManostat::isVirialBased() const { return false; }
+
+/**
+ * @brief get the state of the random number generator
+ *
+ * @details the maximum volume change is appended, as it is adapted during
+ * the simulation
+ *
+ * @return std::string
+ */
+std::string MonteCarloManostat::getRandomState() const
+{
+    return std::format("{} {}", _random.getState(), _volumeChange);
+}
+
+/**
+ * @brief set the state of the random number generator
+ *
+ * @details if the state cannot be parsed the current state is kept
+ *
+ * @param state as returned by getRandomState
+ */
+void MonteCarloManostat::setRandomState(const std::string &state)
+{
+    std::istringstream stream(state);
+
+    uint64_t seed         = 0;
+    uint64_t step         = 0;
+    double   volumeChange = 0.0;
+
+    if (!(stream >> seed >> step >> volumeChange) || volumeChange <= 0.0)
+        return;
+
+    _random.setState(std::format("{} {}", seed, step));
+    _volumeChange = volumeChange;
+}
+
+/**
+ * @brief get the manostat type
+ *
+ * @return ManostatType
+ */
+ManostatType MonteCarloManostat::getManostatType() const
+{
+    return ManostatType::MONTE_CARLO;
+}
+
+/**
+ * @brief get the isotropy of the manostat
+ *
+ * @return Isotropy
+ */
+Isotropy MonteCarloManostat::getIsotropy() const { return _isotropy; }
+
+/***************************
+ *                         *
+ * standard setter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief set the potential used for the energy evaluation
+ *
+ * @param potential
+ */
+void MonteCarloManostat::setPotential(const pq::SharedPotential &potential)
+{
+    _potential = potential;
+}
+
+/**
+ * @brief set the cell list used for the energy evaluation
+ *
+ * @param cellList
+ */
+void MonteCarloManostat::setCellList(const pq::SharedCellList &cellList)
+{
+    _cellList = cellList;
+}
+
+/**
+ * @brief set the axes of the semi-isotropic volume moves
+ *
+ * @param anisotropicAxis
+ * @param isotropicAxes
+ */
+void MonteCarloManostat::set2DAxes(
+    const size_t               anisotropicAxis,
+    const std::vector<size_t> &isotropicAxes
+)
+{
+    _2DAnisotropicAxis = anisotropicAxis;
+    _2DIsotropicAxes   = isotropicAxes;
+}
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief get the frequency of the volume moves
+ *
+ * @return size_t
+ */
+size_t MonteCarloManostat::getFrequency() const { return _frequency; }
+
+/**
+ * @brief get the current maximum volume change relative to the volume
+ *
+ * @return double
+ */
+double MonteCarloManostat::getVolumeChange() const { return _volumeChange; }
+
+/**
+ * @brief get the number of attempted volume moves
+ *
+ * @return size_t
+ */
+size_t MonteCarloManostat::getNumberOfAttempts() const { return _nAttempts; }
+
+/**
+ * @brief get the number of accepted volume moves
+ *
+ * @return size_t
+ */
+size_t MonteCarloManostat::getNumberOfAccepted() const { return _nAccepted; }
\ No newline at end of file
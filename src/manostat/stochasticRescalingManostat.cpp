@@ -25,6 +25,7 @@
 #include <algorithm>    // for __for_each_fn
 #include <cmath>        // for exp, pow, sqrt
 #include <functional>   // for identity
+#include <sstream>      // for istringstream, ostringstream
 
 #include "constants/conversionFactors.hpp"   // for _BOLTZMANN_CONSTANT_IN_KCAL_PER_MOL_
 #include "constants/internalConversionFactors.hpp"   // for _PRESSURE_FACTOR_
@@ -109,7 +110,7 @@ void StochasticRescalingManostat::applyManostat(
     physicalData::PhysicalData   &physicalData
 )
 {
-    startTimingsSection("Stochastic Rescaling");
+    startTimingsSection<"Stochastic Rescaling">();
 
     calculatePressure(simBox, physicalData);
 
@@ -131,7 +132,7 @@ void StochasticRescalingManostat::applyManostat(
     std::ranges::for_each(simBox.getMolecules(), scalePositions);
     std::ranges::for_each(simBox.getAtoms(), scaleVelocities);
 
-    stopTimingsSection("Stochastic Rescaling");
+    stopTimingsSection<"Stochastic Rescaling">();
 }
 
 /**
@@ -281,6 +282,30 @@ double StochasticRescalingManostat::getCompressibility() const
     return _compressibility;
 }
 
+/**
+ * @brief get the state of the random number generator
+ *
+ * @return std::string
+ */
+std::string StochasticRescalingManostat::getRandomState() const
+{
+    std::ostringstream stream;
+    stream << _generator;
+
+    return stream.str();
+}
+
+/**
+ * @brief set the state of the random number generator
+ *
+ * @param state as returned by getRandomState
+ */
+void StochasticRescalingManostat::setRandomState(const std::string &state)
+{
+    std::istringstream stream(state);
+    stream >> _generator;
+}
+
 /**
  * @brief get the manostat type
  *
@@ -22,14 +22,14 @@
 
 #include "maxwellBoltzmann.hpp"
 
-#include <algorithm>    // for __for_each_fn
-#include <cmath>        // for sqrt
-#include <functional>   // for identity
+#include <cmath>     // for sqrt
+#include <cstddef>   // for size_t
 
 #include "constants/conversionFactors.hpp"           // for _AMU_TO_KG_
 #include "constants/internalConversionFactors.hpp"   // for _VELOCITY_UNIT_TO_SI_
 #include "constants/natureConstants.hpp"             // for _BOLTZMANN_CONSTANT_
 #include "resetKinetics.hpp"                         // for ResetKinetics
+#include "settings.hpp"                              // for Settings
 #include "simulationBox.hpp"                         // for SimulationBox
 #include "thermostatSettings.hpp"                    // for ThermostatSettings
 
@@ -44,6 +44,16 @@ using namespace simulationBox;
 using namespace constants;
 using namespace settings;
 using namespace resetKinetics;
+using namespace utilities;
+
+/**
+ * @brief Construct a new Maxwell Boltzmann object
+ *
+ */
+MaxwellBoltzmann::MaxwellBoltzmann()
+    : _random(Settings::getRandomSeed(), PhiloxStream::VELOCITIES)
+{
+}
 
 /**
  * @brief generate boltzmann distributed velocities for all atoms in the
@@ -56,26 +66,35 @@ using namespace resetKinetics;
  */
 void MaxwellBoltzmann::initializeVelocities(SimulationBox &simBox)
 {
-    auto generateVelocities = [this](auto &atom)
-    {
-        const auto mass = atom->getMass() * _AMU_TO_KG_;
-        const auto kb   = _BOLTZMANN_CONSTANT_;
-        const auto temp = ThermostatSettings::getActualTargetTemperature();
-
-        const auto stddev = ::sqrt(kb * temp / mass) / _VELOCITY_UNIT_TO_SI_;
+    const auto temp = ThermostatSettings::getActualTargetTemperature();
 
-        std::normal_distribution<double> distribution{0.0, stddev};
-
-        atom->setVelocity(
-            {distribution(_generator),
-             distribution(_generator),
-             distribution(_generator)}
-        );
+    auto generateVelocities = [this, &simBox, temp]()
+    {
+        const auto &atoms  = simBox.getAtoms();
+        const auto  nAtoms = atoms.size();
+        const auto  kb     = _BOLTZMANN_CONSTANT_;
+
+        // clang-format off
+        #pragma omp parallel for schedule(static)
+        // clang-format on
+        for (size_t i = 0; i < nAtoms; ++i)
+        {
+            const auto mass     = atoms[i]->getMass() * _AMU_TO_KG_;
+            const auto variance = kb * temp / mass;
+            const auto stddev   = ::sqrt(variance) / _VELOCITY_UNIT_TO_SI_;
+            const auto random   = _random.normals(i);
+
+            atoms[i]->setVelocity(
+                {stddev * random[0], stddev * random[1], stddev * random[2]}
+            );
+        }
+
+        _random.advance();
     };
 
 #ifdef WITH_MPI
     if (mpi::MPI::isRoot())
-        std::ranges::for_each(simBox.getAtoms(), generateVelocities);
+        generateVelocities();
 
     auto velocities = simBox.flattenVelocities();
 
@@ -89,7 +108,7 @@ void MaxwellBoltzmann::initializeVelocities(SimulationBox &simBox)
 
     simBox.deFlattenVelocities(velocities);
 #else
-    std::ranges::for_each(simBox.getAtoms(), generateVelocities);
+    generateVelocities();
 #endif
 
     auto resetKinetics = ResetKinetics();
@@ -76,3 +76,26 @@ void MMEvaluator::evaluate()
 
     // _constraints.applyRattle(_simulationBox);
 }
+
+/**
+ * @brief update only the energies
+ *
+ * @details the energy-only path of the potential, the intra non-bonded
+ * interactions and the bonded interactions is used, i.e. no forces, shift
+ * forces or virial contributions are stored. The old forces and the old
+ * physical data are kept.
+ *
+ */
+void MMEvaluator::evaluateEnergy()
+{
+    _cellList->updateCellList(*_simulationBox);
+
+    _potential->calculateEnergy(*_simulationBox, *_physicalData, *_cellList);
+
+    _intraNonBonded->calculate<false>(*_simulationBox, *_physicalData);
+
+    _forceField->calculateBondedInteractions<false>(
+        *_simulationBox,
+        *_physicalData
+    );
+}
@@ -0,0 +1,163 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "fire.hpp"
+
+#include <algorithm>   // for max, min
+#include <cmath>       // for sqrt
+
+#include "simulationBox.hpp"   // for SimulationBox
+#include "vector3d.hpp"        // for dot, norm
+
+using namespace opt;
+using namespace linearAlgebra;
+
+/**
+ * @brief Constructor
+ *
+ * @param nEpochs
+ */
+FIRE::FIRE(const size_t nEpochs) : FIRE(nEpochs, FIREParameters()) {}
+
+/**
+ * @brief Constructor
+ *
+ * @param nEpochs
+ * @param parameters
+ */
+FIRE::FIRE(const size_t nEpochs, const FIREParameters &parameters)
+    : Optimizer(nEpochs),
+      _parameters(parameters),
+      _timestep(parameters.timestep),
+      _alpha(parameters.alphaStart)
+{
+}
+
+/**
+ * @brief clone the optimizer
+ *
+ * @return pq::SharedOptimizer
+ */
+pq::SharedOptimizer FIRE::clone() const
+{
+    return std::make_shared<FIRE>(*this);
+}
+
+/**
+ * @brief get the maximum history length
+ *
+ * @return size_t
+ */
+size_t FIRE::maxHistoryLength() const { return _maxHistoryLength; }
+
+/**
+ * @brief update the optimizer
+ *
+ * @details The learning rate is not used, as FIRE adapts its own timestep.
+ * The velocities of the atoms are set to zero in the first epoch, as they
+ * might contain the velocities of a previous MD run. As the power of zero
+ * velocities vanishes, the first epoch is a plain MD step and does not
+ * decrease the timestep. The displacement of each atom is limited to the
+ * maximum step of the parameters.
+ */
+void FIRE::update(const double, const size_t)
+{
+    const auto &atoms       = _simulationBox->getAtoms();
+    const auto  isFirstStep = _isFirstStep;
+
+    if (isFirstStep)
+    {
+        for (const auto &atom : atoms) atom->setVelocity({0.0, 0.0, 0.0});
+
+        _isFirstStep = false;
+    }
+
+    auto power         = 0.0;
+    auto velocityNorm2 = 0.0;
+    auto forceNorm2    = 0.0;
+
+    for (const auto &atom : atoms)
+    {
+        const auto force    = atom->getForce();
+        const auto velocity = atom->getVelocity();
+
+        power         += dot(force, velocity);
+        velocityNorm2 += dot(velocity, velocity);
+        forceNorm2    += dot(force, force);
+    }
+
+    if (power > 0.0)
+    {
+        const auto scale = forceNorm2 > 0.0
+                               ? _alpha * std::sqrt(velocityNorm2 / forceNorm2)
+                               : 0.0;
+
+        for (const auto &atom : atoms)
+            atom->setVelocity(
+                (1.0 - _alpha) * atom->getVelocity() + scale * atom->getForce()
+            );
+
+        if (_nPositive > _parameters.nMin)
+        {
+            _timestep *= _parameters.timestepIncrease;
+            _timestep  = std::min(_timestep, _parameters.maxTimestep);
+            _alpha    *= _parameters.alphaDecrease;
+        }
+
+        ++_nPositive;
+    }
+    else if (!isFirstStep)
+    {
+        for (const auto &atom : atoms) atom->setVelocity({0.0, 0.0, 0.0});
+
+        _timestep  *= _parameters.timestepDecrease;
+        _alpha      = _parameters.alphaStart;
+        _nPositive  = 0;
+    }
+
+    auto maxDisplacement = 0.0;
+
+    for (const auto &atom : atoms)
+    {
+        atom->addVelocity(_timestep * atom->getForce());
+
+        const auto displacement = norm(_timestep * atom->getVelocity());
+        maxDisplacement         = std::max(maxDisplacement, displacement);
+    }
+
+    auto stepScale = _timestep;
+
+    if (maxDisplacement > _parameters.maxStep)
+        stepScale *= _parameters.maxStep / maxDisplacement;
+
+    for (const auto &atom : atoms)
+    {
+        const auto pos = atom->getPosition();
+
+        auto pos_new = pos + stepScale * atom->getVelocity();
+        _simulationBox->applyPBC(pos_new);
+
+        atom->setPositionOld(pos);
+        atom->setPosition(pos_new);
+    }
+}
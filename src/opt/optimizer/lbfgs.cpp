@@ -0,0 +1,368 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "lbfgs.hpp"
+
+#include <algorithm>   // for max, min
+#include <tuple>       // for ignore
+
+#include "evaluator.hpp"       // for Evaluator
+#include "physicalData.hpp"    // for PhysicalData
+#include "simulationBox.hpp"   // for SimulationBox
+#include "vector3d.hpp"        // for norm
+
+using namespace opt;
+using namespace linearAlgebra;
+
+namespace
+{
+    /**
+     * @brief dot product of two flat vectors
+     *
+     * @param first
+     * @param second
+     * @param offset1 offset into first
+     * @param offset2 offset into second
+     * @param size number of elements
+     * @return double
+     */
+    double dot(
+        const std::vector<double> &first,
+        const std::vector<double> &second,
+        const size_t               offset1,
+        const size_t               offset2,
+        const size_t               size
+    )
+    {
+        auto result = 0.0;
+
+        for (size_t i = 0; i < size; ++i)
+            result += first[offset1 + i] * second[offset2 + i];
+
+        return result;
+    }
+}   // namespace
+
+/**
+ * @brief Constructor
+ *
+ * @param nEpochs
+ * @param nAtoms
+ */
+LBFGS::LBFGS(const size_t nEpochs, const size_t nAtoms)
+    : LBFGS(nEpochs, defaults::_LBFGS_MEMORY_DEFAULT_, nAtoms)
+{
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param nEpochs
+ * @param memory number of stored correction pairs
+ * @param nAtoms
+ */
+LBFGS::LBFGS(const size_t nEpochs, const size_t memory, const size_t nAtoms)
+    : Optimizer(nEpochs), _memory(std::max(memory, size_t(1)))
+{
+    const auto size = 3 * nAtoms;
+
+    _sHistory.resize(_memory * size, 0.0);
+    _yHistory.resize(_memory * size, 0.0);
+    _rho.resize(_memory, 0.0);
+    _alpha.resize(_memory, 0.0);
+
+    _direction.resize(size, 0.0);
+    _gradient.resize(size, 0.0);
+    _gradientNew.resize(size, 0.0);
+    _positions.resize(size, 0.0);
+}
+
+/**
+ * @brief clone the optimizer
+ *
+ * @return pq::SharedOptimizer
+ */
+pq::SharedOptimizer LBFGS::clone() const
+{
+    return std::make_shared<LBFGS>(*this);
+}
+
+/**
+ * @brief get the maximum history length
+ *
+ * @return size_t
+ */
+size_t LBFGS::maxHistoryLength() const { return _maxHistoryLength; }
+
+/**
+ * @brief the line search evaluates the accepted point itself
+ *
+ * @return true
+ */
+bool LBFGS::evaluatesInUpdate() const { return true; }
+
+/**
+ * @brief update the optimizer
+ *
+ * @details The learning rate is only used as initial step length of the
+ * first epoch, where no curvature information is available and the search
+ * direction is the steepest descent direction. All following epochs start
+ * the line search with the full quasi-Newton step. The step is always
+ * limited such that no atom moves further than _maxStep. If the line search
+ * fails to decrease the energy, the atoms are moved back to the starting
+ * point, which is evaluated again to restore its energy and forces, and the
+ * stored corrections are discarded, so that the next epoch starts with a
+ * steepest descent step.
+ *
+ * @param learningRate
+ */
+void LBFGS::update(const double learningRate, const size_t)
+{
+    const auto &atoms  = _simulationBox->getAtoms();
+    const auto  nAtoms = atoms.size();
+
+    gatherGradient(_gradient);
+
+    calculateDirection();
+
+    auto slope = dot(_gradient, _direction, 0, 0, 3 * nAtoms);
+
+    if (slope >= 0.0)
+    {
+        resetHistory();
+        calculateDirection();
+        slope = dot(_gradient, _direction, 0, 0, 3 * nAtoms);
+    }
+
+    auto stepLength      = _nStored == 0 ? learningRate : 1.0;
+    auto maxDisplacement = 0.0;
+
+    for (size_t i = 0; i < nAtoms; ++i)
+    {
+        const auto pos = atoms[i]->getPosition();
+
+        _positions[3 * i]     = pos[0];
+        _positions[3 * i + 1] = pos[1];
+        _positions[3 * i + 2] = pos[2];
+
+        atoms[i]->setPositionOld(pos);
+
+        const auto direction = Vec3D(
+            _direction[3 * i],
+            _direction[3 * i + 1],
+            _direction[3 * i + 2]
+        );
+
+        maxDisplacement = std::max(maxDisplacement, norm(direction));
+    }
+
+    maxDisplacement *= stepLength;
+
+    if (maxDisplacement > _maxStep)
+        stepLength *= _maxStep / maxDisplacement;
+
+    const auto energy0 = getEnergy();
+
+    auto isAccepted = false;
+
+    for (size_t iter = 0; iter < _maxLineSearchIter; ++iter)
+    {
+        moveAtoms(stepLength);
+
+        const auto energy = evaluateEnergy();
+
+        if (energy <= energy0 + _armijo * stepLength * slope)
+        {
+            isAccepted = true;
+            break;
+        }
+
+        if (iter + 1 < _maxLineSearchIter)
+            stepLength *= _backtrackFactor;
+    }
+
+    if (isAccepted)
+        storeCorrection(stepLength);
+    else
+    {
+        moveAtoms(0.0);
+        std::ignore = evaluateEnergy();
+        resetHistory();
+    }
+}
+
+/**
+ * @brief gathers the gradient, i.e. the negative forces, of all atoms
+ *
+ * @param gradient
+ */
+void LBFGS::gatherGradient(std::vector<double> &gradient) const
+{
+    const auto &atoms = _simulationBox->getAtoms();
+
+    for (size_t i = 0; i < atoms.size(); ++i)
+    {
+        const auto force = atoms[i]->getForce();
+
+        gradient[3 * i]     = -force[0];
+        gradient[3 * i + 1] = -force[1];
+        gradient[3 * i + 2] = -force[2];
+    }
+}
+
+/**
+ * @brief calculates the search direction with the two-loop recursion
+ *
+ * @details the initial inverse Hessian is the identity scaled by
+ * s^T y / y^T y of the most recent correction pair
+ */
+void LBFGS::calculateDirection()
+{
+    const auto size = _gradient.size();
+
+    for (size_t i = 0; i < size; ++i) _direction[i] = -_gradient[i];
+
+    if (_nStored == 0)
+        return;
+
+    for (size_t k = 0; k < _nStored; ++k)
+    {
+        const auto index  = (_head + _memory - 1 - k) % _memory;
+        const auto offset = index * size;
+
+        const auto alpha =
+            _rho[index] * dot(_sHistory, _direction, offset, 0, size);
+
+        _alpha[index] = alpha;
+
+        for (size_t i = 0; i < size; ++i)
+            _direction[i] -= alpha * _yHistory[offset + i];
+    }
+
+    const auto newest = (_head + _memory - 1) % _memory;
+    const auto offset = newest * size;
+    const auto yy     = dot(_yHistory, _yHistory, offset, offset, size);
+    const auto gamma  = 1.0 / (_rho[newest] * yy);
+
+    for (size_t i = 0; i < size; ++i) _direction[i] *= gamma;
+
+    for (size_t k = _nStored; k > 0; --k)
+    {
+        const auto index  = (_head + _memory - k) % _memory;
+        const auto offset = index * size;
+
+        const auto beta =
+            _rho[index] * dot(_yHistory, _direction, offset, 0, size);
+
+        for (size_t i = 0; i < size; ++i)
+            _direction[i] += (_alpha[index] - beta) * _sHistory[offset + i];
+    }
+}
+
+/**
+ * @brief stores the correction pair of the accepted step
+ *
+ * @details the pair is skipped if it violates the curvature condition
+ * s^T y > 0, as the inverse Hessian would not stay positive definite
+ *
+ * @param stepLength
+ */
+void LBFGS::storeCorrection(const double stepLength)
+{
+    const auto size   = _gradient.size();
+    const auto offset = _head * size;
+
+    gatherGradient(_gradientNew);
+
+    auto sy = 0.0;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        const auto s = stepLength * _direction[i];
+        const auto y = _gradientNew[i] - _gradient[i];
+
+        _sHistory[offset + i] = s;
+        _yHistory[offset + i] = y;
+
+        sy += s * y;
+    }
+
+    if (sy <= 1.0e-12)
+        return;
+
+    _rho[_head] = 1.0 / sy;
+    _head       = (_head + 1) % _memory;
+    _nStored    = std::min(_nStored + 1, _memory);
+}
+
+/**
+ * @brief moves all atoms from the stored positions along the search
+ * direction
+ *
+ * @param stepLength
+ */
+void LBFGS::moveAtoms(const double stepLength)
+{
+    const auto &atoms = _simulationBox->getAtoms();
+
+    for (size_t i = 0; i < atoms.size(); ++i)
+    {
+        auto position = Vec3D(
+            _positions[3 * i] + stepLength * _direction[3 * i],
+            _positions[3 * i + 1] + stepLength * _direction[3 * i + 1],
+            _positions[3 * i + 2] + stepLength * _direction[3 * i + 2]
+        );
+
+        _simulationBox->applyPBC(position);
+
+        atoms[i]->setPosition(position);
+    }
+}
+
+/**
+ * @brief discards all stored correction pairs
+ *
+ */
+void LBFGS::resetHistory()
+{
+    _nStored = 0;
+    _head    = 0;
+}
+
+/**
+ * @brief evaluates the energy and forces at the current positions
+ *
+ * @details the physical data is reset before, as the bonded energies are
+ * accumulated by the evaluator
+ *
+ * @return double total energy
+ */
+double LBFGS::evaluateEnergy()
+{
+    _physicalData->reset();
+    _evaluator->evaluate();
+
+    ++_nEvaluations;
+
+    return _physicalData->getTotalEnergy();
+}
@@ -71,6 +71,16 @@ void Optimizer::updateHistory()
     }
 }
 
+/**
+ * @brief whether the optimizer evaluates the new positions itself in update
+ *
+ * @details optimizers with a line search evaluate the accepted positions
+ * already during the update, so the OptEngine must not evaluate them again
+ *
+ * @return false by default
+ */
+bool Optimizer::evaluatesInUpdate() const { return false; }
+
 /**
  * @brief check if the optimizer has converged
  *
@@ -106,6 +116,16 @@ void Optimizer::setConvergence(const Convergence convergence)
     _convergence = convergence;
 }
 
+/**
+ * @brief set evaluator shared pointer
+ *
+ * @param evaluator
+ */
+void Optimizer::setEvaluator(const pq::SharedEvaluator evaluator)
+{
+    _evaluator = evaluator;
+}
+
 /**
  * @brief set simulation box shared pointer
  *
@@ -22,17 +22,17 @@
 
 #include "boxOutput.hpp"
 
-#include <cstddef>   // for size_t
-#include <format>    // for format
-#include <ostream>   // for ofstream, basic_ostream, operator<<
-#include <string>    // for operator<<
-#include <vector>    // for vector
+#include <cstddef>       // for size_t
+#include <ostream>       // for ofstream, flush
+#include <string_view>   // for string_view
 
-#include "box.hpp"        // for SimulationBox
-#include "vector3d.hpp"   // for Vec3D
+#include "box.hpp"               // for SimulationBox
+#include "observableTable.hpp"   // for ObservableTable
+#include "vector3d.hpp"          // for Vec3D
 
 using output::BoxFileOutput;
 using namespace simulationBox;
+using namespace linearAlgebra;
 
 /**
  * @brief Write the lattice parameters a, b, c, alpha, beta, gamma to file
@@ -41,21 +41,56 @@ using namespace simulationBox;
  */
 void BoxFileOutput::write(const size_t step, const Box &box)
 {
-    _fp << std::format("{:<5}\t", step);
-
-    _fp << std::format(
-        "{:15.8f}\t{:15.8f}\t{:15.8f}\t",
-        box.getBoxDimensions()[0],
-        box.getBoxDimensions()[1],
-        box.getBoxDimensions()[2]
-    );
-
-    _fp << std::format(
-        "{:15.8f}\t{:15.8f}\t{:15.8f}\n",
-        box.getBoxAngles()[0],
-        box.getBoxAngles()[1],
-        box.getBoxAngles()[2]
-    );
+    write(step, box.getBoxDimensions(), box.getBoxAngles());
+}
 
+/**
+ * @brief visits the lattice parameters a, b, c, alpha, beta, gamma
+ *
+ * @param boxDimensions
+ * @param boxAngles
+ * @param visit
+ */
+void BoxFileOutput::visitObservables(
+    const Vec3D             &boxDimensions,
+    const Vec3D             &boxAngles,
+    const ObservableVisitor &visit
+)
+{
+    constexpr auto format = ObservableFormat{ObservableNotation::FIXED, 15, 8};
+
+    visit("a", format, boxDimensions[0]);
+    visit("b", format, boxDimensions[1]);
+    visit("c", format, boxDimensions[2]);
+    visit("alpha", format, boxAngles[0]);
+    visit("beta", format, boxAngles[1]);
+    visit("gamma", format, boxAngles[2]);
+}
+
+/**
+ * @brief Write the lattice parameters a, b, c, alpha, beta, gamma to file
+ *
+ * @param step
+ * @param boxDimensions
+ * @param boxAngles
+ */
+void BoxFileOutput::write(
+    const size_t step,
+    const Vec3D &boxDimensions,
+    const Vec3D &boxAngles
+)
+{
+    auto appendValue =
+        [this](std::string_view, const ObservableFormat &format, double value)
+    {
+        _buffer.append('\t');
+        ObservableTable::appendValue(_buffer, format, value);
+    };
+
+    _buffer.appendInteger(step, 5, true);
+    visitObservables(boxDimensions, boxAngles, appendValue);
+    _buffer.append('\n');
+
+    _buffer.writeTo(_fp);
     _fp << std::flush;
-}
\ No newline at end of file
+}
@@ -0,0 +1,234 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "checkpointFileOutput.hpp"
+
+#include <cstring>      // for memcpy
+#include <filesystem>   // for rename
+#include <fstream>      // for ofstream
+#include <ios>          // for ios
+
+#include "exceptions.hpp"      // for InputFileException
+#include "frameSnapshot.hpp"   // for FrameSnapshot
+#include "integrator.hpp"      // for Integrator
+#include "manostat.hpp"        // for Manostat
+#include "simulationBox.hpp"   // for SimulationBox
+#include "thermostat.hpp"      // for Thermostat
+
+using namespace output;
+using namespace simulationBox;
+using namespace thermostat;
+using namespace manostat;
+using namespace integrator;
+using namespace customException;
+
+/**
+ * @brief appends the raw bytes of a trivially copyable value to the payload
+ *
+ * @tparam T
+ * @param value
+ */
+template <typename T>
+void CheckpointFileOutput::appendValue(const T value)
+{
+    const auto offset = _payload.size();
+
+    _payload.resize(offset + sizeof(T));
+    std::memcpy(_payload.data() + offset, &value, sizeof(T));
+}
+
+/**
+ * @brief appends a string with its length as prefix to the payload
+ *
+ * @param string
+ */
+void CheckpointFileOutput::appendString(const std::string_view string)
+{
+    appendValue<uint64_t>(string.size());
+    _payload.append(string);
+}
+
+/**
+ * @brief Write the checkpoint file
+ *
+ * @param simBox
+ * @param thermostat
+ * @param manostat
+ * @param integrator
+ * @param step
+ */
+void CheckpointFileOutput::write(
+    SimulationBox    &simBox,
+    const Thermostat &thermostat,
+    const Manostat   &manostat,
+    const Integrator &integrator,
+    const size_t      step
+)
+{
+    FrameSnapshot snapshot;
+    snapshot.captureSimulationBox(simBox);
+    snapshot.captureThermostat(thermostat);
+    snapshot.captureIntegrator(integrator);
+    snapshot.captureManostat(manostat);
+    snapshot.setStep(step);
+
+    write(snapshot);
+}
+
+/**
+ * @brief Write the checkpoint file from a frame snapshot
+ *
+ * @details the payload is assembled in memory, the header and payload are
+ * written to "<filename>.tmp" with a single write each and the temporary
+ * file is renamed to the checkpoint file afterwards.
+ *
+ * @param snapshot
+ *
+ * @throw InputFileException if the temporary file cannot be written
+ */
+void CheckpointFileOutput::write(const FrameSnapshot &snapshot)
+{
+    const auto nAtoms = snapshot.getNumberOfAtoms();
+
+    buildNameTable(snapshot);
+
+    _payload.clear();
+    _payload.reserve(nAtoms * (9 * sizeof(double) + 12) + 1024);
+
+    appendValue<uint64_t>(snapshot.getStep());
+
+    for (const auto dimension : snapshot.getBoxDimensions())
+        appendValue(dimension);
+
+    for (const auto angle : snapshot.getBoxAngles()) appendValue(angle);
+
+    const auto &chi  = snapshot.getChi();
+    const auto &zeta = snapshot.getZeta();
+
+    appendValue<uint64_t>(snapshot.isNoseHoover() ? chi.size() : 0);
+
+    if (snapshot.isNoseHoover())
+    {
+        for (const auto value : chi) appendValue(value);
+        for (const auto value : zeta) appendValue(value);
+    }
+
+    appendString(snapshot.getThermostatRandomState());
+    appendString(snapshot.getManostatRandomState());
+
+    appendValue<uint64_t>(nAtoms);
+    appendValue<uint64_t>(_names.size());
+
+    for (const auto &name : _names) appendString(name);
+
+    for (const auto index : _nameIndices) appendValue(index);
+
+    for (size_t i = 0; i < nAtoms; ++i)
+        appendValue<uint64_t>(snapshot.getMoleculeType(i));
+
+    for (size_t i = 0; i < nAtoms; ++i)
+        for (const auto value : snapshot.getPosition(i)) appendValue(value);
+
+    for (size_t i = 0; i < nAtoms; ++i)
+        for (const auto value : snapshot.getVelocity(i)) appendValue(value);
+
+    for (size_t i = 0; i < nAtoms; ++i)
+        for (const auto value : snapshot.getForce(i)) appendValue(value);
+
+    const uint64_t payloadSize = _payload.size();
+    const uint64_t checksum    = calculateChecksum(_payload);
+
+    std::string header(_MAGIC_);
+    header.resize(_HEADER_SIZE_);
+
+    auto *headerData = header.data() + _MAGIC_.size();
+
+    std::memcpy(headerData, &_VERSION_, sizeof(_VERSION_));
+    std::memcpy(headerData + 4, &_ENDIANNESS_, sizeof(_ENDIANNESS_));
+    std::memcpy(headerData + 8, &payloadSize, sizeof(payloadSize));
+    std::memcpy(headerData + 16, &checksum, sizeof(checksum));
+
+    const auto tmpFileName = _fileName + ".tmp";
+
+    std::ofstream fp(tmpFileName, std::ios::binary | std::ios::trunc);
+
+    fp.write(header.data(), std::streamsize(header.size()));
+    fp.write(_payload.data(), std::streamsize(_payload.size()));
+    fp.close();
+
+    if (fp.fail())
+        throw InputFileException(
+            "Could not write checkpoint file - filename = " + tmpFileName
+        );
+
+    _fp.close();
+
+    std::filesystem::rename(tmpFileName, _fileName);
+}
+
+/**
+ * @brief builds the table of unique atom names and the index of each atom
+ * into this table
+ *
+ * @param snapshot
+ */
+void CheckpointFileOutput::buildNameTable(const FrameSnapshot &snapshot)
+{
+    const auto nAtoms = snapshot.getNumberOfAtoms();
+
+    _names.clear();
+    _nameTable.clear();
+    _nameIndices.resize(nAtoms);
+
+    for (size_t i = 0; i < nAtoms; ++i)
+    {
+        const auto &name = snapshot.getAtomName(i);
+
+        const auto [iter, inserted] =
+            _nameTable.try_emplace(name, uint32_t(_names.size()));
+
+        if (inserted)
+            _names.push_back(name);
+
+        _nameIndices[i] = iter->second;
+    }
+}
+
+/**
+ * @brief calculates the 64 bit FNV-1a checksum of the given data
+ *
+ * @param data
+ * @return uint64_t
+ */
+uint64_t CheckpointFileOutput::calculateChecksum(const std::string_view data)
+{
+    uint64_t checksum = 0xcbf29ce484222325ULL;
+
+    for (const auto character : data)
+    {
+        checksum ^= static_cast<unsigned char>(character);
+        checksum *= 0x100000001b3ULL;
+    }
+
+    return checksum;
+}
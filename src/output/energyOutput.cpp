@@ -22,13 +22,13 @@
 
 #include "energyOutput.hpp"
 
-#include <format>    // for format
-#include <ostream>   // for basic_ostream, ofstream
-#include <string>    // for operator<<
+#include <ostream>       // for flush
+#include <string_view>   // for string_view
 
 #include "constraintSettings.hpp"   // for ConstraintSettings
 #include "forceFieldSettings.hpp"   // for ForceFieldSettings
 #include "manostatSettings.hpp"     // for ManostatSettings
+#include "observableTable.hpp"      // for ObservableTable
 #include "physicalData.hpp"         // for PhysicalData
 #include "settings.hpp"             // for Settings
 #include "stlVector.hpp"            // for mean, max
@@ -40,7 +40,7 @@ using namespace physicalData;
 using namespace settings;
 
 /**
- * @brief Write the energy output
+ * @brief visits all observables of the energy output in file order
  *
  * @details
  * - Coulomb and Non-Coulomb energies contain the intra and inter energies.
@@ -52,59 +52,97 @@ using namespace settings;
  * - nose hoover momentum and friction energies are only available if nose
  * hoover thermostat is active.
  *
- * @param step
  * @param data
+ * @param visit
  */
-void EnergyOutput::write(const size_t step, const PhysicalData &data)
+void EnergyOutput::visitObservables(
+    const PhysicalData      &data,
+    const ObservableVisitor &visit
+)
 {
-    _fp << std::format("{:10d}\t", step);
-    _fp << std::format("{:20.12f}\t", data.getTemperature());
-    _fp << std::format("{:20.12f}\t", data.getPressure());
-    _fp << std::format("{:20.12f}\t", data.getTotalEnergy());
+    constexpr auto fixed = ObservableFormat{ObservableNotation::FIXED, 20, 12};
+
+    visit("temperature", fixed, data.getTemperature());
+    visit("pressure", fixed, data.getPressure());
+    visit("total_energy", fixed, data.getTotalEnergy());
 
     if (Settings::isQMActivated())
     {
-        _fp << std::format("{:20.12f}\t", data.getQMEnergy());
-        _fp << std::format("{:20.12f}\t", data.getNumberOfQMAtoms());
+        visit("qm_energy", fixed, data.getQMEnergy());
+        visit("n_qm_atoms", fixed, data.getNumberOfQMAtoms());
     }
 
-    _fp << std::format("{:20.12f}\t", data.getKineticEnergy());
-    _fp << std::format("{:20.12f}\t", data.getIntraEnergy());
+    visit("kinetic_energy", fixed, data.getKineticEnergy());
+    visit("intra_energy", fixed, data.getIntraEnergy());
 
     if (Settings::isMMActivated())
     {
-        _fp << std::format("{:20.12f}\t", data.getCoulombEnergy());
-        _fp << std::format("{:20.12f}\t", data.getNonCoulombEnergy());
+        visit("coulomb_energy", fixed, data.getCoulombEnergy());
+        visit("non_coulomb_energy", fixed, data.getNonCoulombEnergy());
     }
 
     if (ForceFieldSettings::isActive())
     {
-        _fp << std::format("{:20.12f}\t", data.getBondEnergy());
-        _fp << std::format("{:20.12f}\t", data.getAngleEnergy());
-        _fp << std::format("{:20.12f}\t", data.getDihedralEnergy());
-        _fp << std::format("{:20.12f}\t", data.getImproperEnergy());
+        visit("bond_energy", fixed, data.getBondEnergy());
+        visit("angle_energy", fixed, data.getAngleEnergy());
+        visit("dihedral_energy", fixed, data.getDihedralEnergy());
+        visit("improper_energy", fixed, data.getImproperEnergy());
     }
 
     if (ManostatSettings::getManostatType() != ManostatType::NONE)
     {
-        _fp << std::format("{:20.12f}\t", data.getVolume());
-        _fp << std::format("{:20.12f}\t", data.getDensity());
+        visit("volume", fixed, data.getVolume());
+        visit("density", fixed, data.getDensity());
     }
 
     if (ThermostatSettings::getThermostatType() == ThermostatType::NOSE_HOOVER)
     {
-        _fp << std::format("{:20.12f}\t", data.getNoseHooverMomentumEnergy());
-        _fp << std::format("{:20.12f}\t", data.getNoseHooverFrictionEnergy());
+        const auto momentumEnergy = data.getNoseHooverMomentumEnergy();
+        const auto frictionEnergy = data.getNoseHooverFrictionEnergy();
+
+        visit("nose_hoover_momentum_energy", fixed, momentumEnergy);
+        visit("nose_hoover_friction_energy", fixed, frictionEnergy);
     }
 
     if (ConstraintSettings::isDistanceConstraintsActivated())
     {
-        _fp << std::format("{:20.12f}\t", data.getLowerDistanceConstraints());
-        _fp << std::format("{:20.12f}\t", data.getUpperDistanceConstraints());
+        const auto lower = data.getLowerDistanceConstraints();
+        const auto upper = data.getUpperDistanceConstraints();
+
+        visit("lower_distance_constraints", fixed, lower);
+        visit("upper_distance_constraints", fixed, upper);
     }
 
-    _fp << std::format("{:20.5e}\t", norm(data.getMomentum()));
-    _fp << std::format("{:12.5f}\n", data.getLoopTime());
+    constexpr auto momentumFormat =
+        ObservableFormat{ObservableNotation::SCIENTIFIC, 20, 5};
+    constexpr auto loopTimeFormat =
+        ObservableFormat{ObservableNotation::FIXED, 12, 5};
+
+    visit("momentum", momentumFormat, norm(data.getMomentum()));
+    visit("loop_time", loopTimeFormat, data.getLoopTime());
+}
+
+/**
+ * @brief Write the energy output
+ *
+ * @details the columns are described in visitObservables
+ *
+ * @param step
+ * @param data
+ */
+void EnergyOutput::write(const size_t step, const PhysicalData &data)
+{
+    auto appendValue =
+        [this](std::string_view, const ObservableFormat &format, double value)
+    {
+        _buffer.append('\t');
+        ObservableTable::appendValue(_buffer, format, value);
+    };
+
+    _buffer.appendInteger(step, 10);
+    visitObservables(data, appendValue);
+    _buffer.append('\n');
 
+    _buffer.writeTo(_fp);
     _fp << std::flush;
 }
@@ -0,0 +1,395 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "frameSnapshot.hpp"
+
+#include <utility>   // for move
+
+#include "integrator.hpp"             // for Integrator
+#include "manostat.hpp"               // for Manostat
+#include "molecule.hpp"               // for Molecule
+#include "noseHooverThermostat.hpp"   // for NoseHooverThermostat
+#include "simulationBox.hpp"          // for SimulationBox
+#include "thermostat.hpp"             // for Thermostat
+#include "thermostatSettings.hpp"     // for ThermostatType
+
+using namespace output;
+using namespace simulationBox;
+using namespace thermostat;
+using namespace integrator;
+using namespace manostat;
+using namespace physicalData;
+using namespace settings;
+using namespace linearAlgebra;
+
+/**
+ * @brief captures the atom names, molecule types and atom indices
+ *
+ * @details the topology does not change during a simulation, therefore it is
+ * only captured if the number of atoms changed
+ *
+ * @param simBox
+ */
+void FrameSnapshot::captureTopology(SimulationBox &simBox)
+{
+    size_t nAtoms = 0;
+
+    for (const auto &molecule : simBox.getMolecules())
+        nAtoms += molecule.getNumberOfAtoms();
+
+    if (_atomNames.size() == nAtoms)
+        return;
+
+    _atomNames.clear();
+    _moleculeTypes.clear();
+    _atomIndices.clear();
+
+    _atomNames.reserve(nAtoms);
+    _moleculeTypes.reserve(nAtoms);
+    _atomIndices.reserve(nAtoms);
+
+    for (const auto &molecule : simBox.getMolecules())
+    {
+        const auto nAtomsMolecule = molecule.getNumberOfAtoms();
+
+        for (size_t i = 0; i < nAtomsMolecule; ++i)
+        {
+            _atomNames.push_back(molecule.getAtomName(i));
+            _moleculeTypes.push_back(molecule.getMoltype());
+            _atomIndices.push_back(i);
+        }
+    }
+
+    _positions.resize(nAtoms);
+    _velocities.resize(nAtoms);
+    _forces.resize(nAtoms);
+    _partialCharges.resize(nAtoms);
+}
+
+/**
+ * @brief captures the box and the positions, velocities, forces and partial
+ * charges of all atoms
+ *
+ * @param simBox
+ */
+void FrameSnapshot::captureSimulationBox(SimulationBox &simBox)
+{
+    captureTopology(simBox);
+
+    _boxDimensions = simBox.getBoxDimensions();
+    _boxAngles     = simBox.getBoxAngles();
+    _totalForce    = simBox.calculateTotalForce();
+
+    size_t index = 0;
+
+    for (const auto &molecule : simBox.getMolecules())
+    {
+        const auto nAtomsMolecule = molecule.getNumberOfAtoms();
+
+        for (size_t i = 0; i < nAtomsMolecule; ++i, ++index)
+        {
+            _positions[index]      = molecule.getAtomPosition(i);
+            _velocities[index]     = molecule.getAtomVelocity(i);
+            _forces[index]         = molecule.getAtomForce(i);
+            _partialCharges[index] = molecule.getPartialCharge(i);
+        }
+    }
+}
+
+/**
+ * @brief captures the Nose-Hoover chain and the random number generator
+ * state of the thermostat
+ *
+ * @param thermostat
+ */
+void FrameSnapshot::captureThermostat(const Thermostat &thermostat)
+{
+    const auto type = thermostat.getThermostatType();
+
+    _thermostatRandomState = thermostat.getRandomState();
+
+    _isNoseHoover = type == ThermostatType::NOSE_HOOVER;
+
+    if (!_isNoseHoover)
+        return;
+
+    const auto &nh = dynamic_cast<const NoseHooverThermostat &>(thermostat);
+
+    _chi  = nh.getChi();
+    _zeta = nh.getZeta();
+}
+
+/**
+ * @brief captures the random number generator state of the integrator
+ *
+ * @details the stochastic part of the BAOAB integrator replaces the
+ * Langevin thermostat, therefore its state is stored in place of the
+ * thermostat state. Deterministic integrators leave the thermostat state
+ * untouched.
+ *
+ * @param integrator
+ */
+void FrameSnapshot::captureIntegrator(const Integrator &integrator)
+{
+    if (auto state = integrator.getRandomState(); !state.empty())
+        _thermostatRandomState = std::move(state);
+}
+
+/**
+ * @brief captures the random number generator state of the manostat
+ *
+ * @param manostat
+ */
+void FrameSnapshot::captureManostat(const Manostat &manostat)
+{
+    _manostatRandomState = manostat.getRandomState();
+}
+
+/**
+ * @brief captures the instantaneous physical data
+ *
+ * @param physicalData
+ */
+void FrameSnapshot::capturePhysicalData(const PhysicalData &physicalData)
+{
+    _physicalData = physicalData;
+}
+
+/**
+ * @brief captures the averaged physical data
+ *
+ * @param physicalData
+ */
+void FrameSnapshot::captureAveragePhysicalData(const PhysicalData &physicalData)
+{
+    _averagePhysicalData = physicalData;
+}
+
+/***************************
+ *                         *
+ * standard setter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief set the step of the frame
+ *
+ * @param step
+ */
+void FrameSnapshot::setStep(const size_t step) { _step = step; }
+
+/**
+ * @brief set the simulation time of the frame
+ *
+ * @param simulationTime
+ */
+void FrameSnapshot::setSimulationTime(const double simulationTime)
+{
+    _simulationTime = simulationTime;
+}
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief get the step of the frame
+ *
+ * @return size_t
+ */
+size_t FrameSnapshot::getStep() const { return _step; }
+
+/**
+ * @brief get the simulation time of the frame
+ *
+ * @return double
+ */
+double FrameSnapshot::getSimulationTime() const { return _simulationTime; }
+
+/**
+ * @brief get the number of atoms
+ *
+ * @return size_t
+ */
+size_t FrameSnapshot::getNumberOfAtoms() const { return _positions.size(); }
+
+/**
+ * @brief get the box dimensions
+ *
+ * @return const Vec3D&
+ */
+const Vec3D &FrameSnapshot::getBoxDimensions() const { return _boxDimensions; }
+
+/**
+ * @brief get the box angles
+ *
+ * @return const Vec3D&
+ */
+const Vec3D &FrameSnapshot::getBoxAngles() const { return _boxAngles; }
+
+/**
+ * @brief get the norm of the total force
+ *
+ * @return double
+ */
+double FrameSnapshot::getTotalForce() const { return _totalForce; }
+
+/**
+ * @brief get the name of an atom
+ *
+ * @param index
+ * @return const std::string&
+ */
+const std::string &FrameSnapshot::getAtomName(const size_t index) const
+{
+    return _atomNames[index];
+}
+
+/**
+ * @brief get the molecule type of the molecule of an atom
+ *
+ * @param index
+ * @return size_t
+ */
+size_t FrameSnapshot::getMoleculeType(const size_t index) const
+{
+    return _moleculeTypes[index];
+}
+
+/**
+ * @brief get the index of an atom within its molecule
+ *
+ * @param index
+ * @return size_t
+ */
+size_t FrameSnapshot::getAtomIndex(const size_t index) const
+{
+    return _atomIndices[index];
+}
+
+/**
+ * @brief get the position of an atom
+ *
+ * @param index
+ * @return const Vec3D&
+ */
+const Vec3D &FrameSnapshot::getPosition(const size_t index) const
+{
+    return _positions[index];
+}
+
+/**
+ * @brief get the velocity of an atom
+ *
+ * @param index
+ * @return const Vec3D&
+ */
+const Vec3D &FrameSnapshot::getVelocity(const size_t index) const
+{
+    return _velocities[index];
+}
+
+/**
+ * @brief get the force of an atom
+ *
+ * @param index
+ * @return const Vec3D&
+ */
+const Vec3D &FrameSnapshot::getForce(const size_t index) const
+{
+    return _forces[index];
+}
+
+/**
+ * @brief get the partial charge of an atom
+ *
+ * @param index
+ * @return double
+ */
+double FrameSnapshot::getPartialCharge(const size_t index) const
+{
+    return _partialCharges[index];
+}
+
+/**
+ * @brief check if the Nose-Hoover chain was captured
+ *
+ * @return bool
+ */
+bool FrameSnapshot::isNoseHoover() const { return _isNoseHoover; }
+
+/**
+ * @brief get the chi values of the Nose-Hoover chain
+ *
+ * @return const std::vector<double>&
+ */
+const std::vector<double> &FrameSnapshot::getChi() const { return _chi; }
+
+/**
+ * @brief get the zeta values of the Nose-Hoover chain
+ *
+ * @return const std::vector<double>&
+ */
+const std::vector<double> &FrameSnapshot::getZeta() const { return _zeta; }
+
+/**
+ * @brief get the random number generator state of the thermostat
+ *
+ * @return const std::string& empty for deterministic thermostats
+ */
+const std::string &FrameSnapshot::getThermostatRandomState() const
+{
+    return _thermostatRandomState;
+}
+
+/**
+ * @brief get the random number generator state of the manostat
+ *
+ * @return const std::string& empty for deterministic manostats
+ */
+const std::string &FrameSnapshot::getManostatRandomState() const
+{
+    return _manostatRandomState;
+}
+
+/**
+ * @brief get the instantaneous physical data
+ *
+ * @return const PhysicalData&
+ */
+const PhysicalData &FrameSnapshot::getPhysicalData() const
+{
+    return _physicalData;
+}
+
+/**
+ * @brief get the averaged physical data
+ *
+ * @return const PhysicalData&
+ */
+const PhysicalData &FrameSnapshot::getAveragePhysicalData() const
+{
+    return _averagePhysicalData;
+}
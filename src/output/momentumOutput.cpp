@@ -22,18 +22,19 @@
 
 #include "momentumOutput.hpp"
 
-#include <format>    // for format
-#include <fstream>   // for basic_ostream, ofstream
-#include <string>    // for operator<<
+#include <fstream>       // for ofstream
+#include <ostream>       // for flush
+#include <string_view>   // for string_view
 
-#include "physicalData.hpp"   // for PhysicalData
-#include "vector3d.hpp"       // for Vec3D, norm
+#include "observableTable.hpp"   // for ObservableTable
+#include "physicalData.hpp"      // for PhysicalData
+#include "vector3d.hpp"          // for Vec3D, norm
 
 using output::MomentumOutput;
 using namespace physicalData;
 
 /**
- * @brief Write the momentum output
+ * @brief visits all observables of the momentum output in file order
  *
  * @details The momentum output is written in the following format:
  * - step
@@ -46,20 +47,51 @@ using namespace physicalData;
  * - angular momentum y
  * - angular momentum z
  *
+ * @param data
+ * @param visit
+ */
+void MomentumOutput::visitObservables(
+    const PhysicalData      &data,
+    const ObservableVisitor &visit
+)
+{
+    constexpr auto format =
+        ObservableFormat{ObservableNotation::SCIENTIFIC, 20, 5};
+
+    const auto momentum        = data.getMomentum();
+    const auto angularMomentum = data.getAngularMomentum();
+
+    visit("momentum", format, norm(momentum));
+    visit("momentum_x", format, momentum[0]);
+    visit("momentum_y", format, momentum[1]);
+    visit("momentum_z", format, momentum[2]);
+    visit("angular_momentum", format, norm(angularMomentum));
+    visit("angular_momentum_x", format, angularMomentum[0]);
+    visit("angular_momentum_y", format, angularMomentum[1]);
+    visit("angular_momentum_z", format, angularMomentum[2]);
+}
+
+/**
+ * @brief Write the momentum output
+ *
+ * @details the columns are described in visitObservables
+ *
  * @param step
  * @param data
  */
 void MomentumOutput::write(const size_t step, const PhysicalData &data)
 {
-    _fp << std::format("{:10d}\t", step);
-    _fp << std::format("{:20.5e}\t", norm(data.getMomentum()));
-    _fp << std::format("{:20.5e}\t", data.getMomentum()[0]);
-    _fp << std::format("{:20.5e}\t", data.getMomentum()[1]);
-    _fp << std::format("{:20.5e}\t", data.getMomentum()[2]);
-    _fp << std::format("{:20.5e}\t", norm(data.getAngularMomentum()));
-    _fp << std::format("{:20.5e}\t", data.getAngularMomentum()[0]);
-    _fp << std::format("{:20.5e}\t", data.getAngularMomentum()[1]);
-    _fp << std::format("{:20.5e}\n", data.getAngularMomentum()[2]);
+    auto appendValue =
+        [this](std::string_view, const ObservableFormat &format, double value)
+    {
+        _buffer.append('\t');
+        ObservableTable::appendValue(_buffer, format, value);
+    };
+
+    _buffer.appendInteger(step, 10);
+    visitObservables(data, appendValue);
+    _buffer.append('\n');
 
+    _buffer.writeTo(_fp);
     _fp << std::flush;
-}
\ No newline at end of file
+}
@@ -0,0 +1,310 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "observableFileReader.hpp"
+
+#include <cstdint>   // for uint32_t, uint64_t
+#include <cstring>   // for memcpy
+#include <format>    // for format
+#include <fstream>   // for ofstream
+
+#include "checkpointFileOutput.hpp"   // for CheckpointFileOutput
+#include "exceptions.hpp"             // for InputFileException
+#include "mappedFile.hpp"             // for MappedFile
+#include "observableOutput.hpp"       // for ObservableOutput
+#include "outputBuffer.hpp"           // for OutputBuffer
+
+using namespace output;
+using namespace customException;
+
+/**
+ * @brief Construct a new Observable File Reader object
+ *
+ * @param fileName
+ */
+ObservableFileReader::ObservableFileReader(const std::string &fileName)
+    : _fileName(fileName)
+{
+}
+
+/**
+ * @brief reads a trivially copyable value from the file buffer
+ *
+ * @tparam T
+ * @return T
+ *
+ * @throws InputFileException if the end of the file is reached
+ */
+template <typename T>
+T ObservableFileReader::readValue()
+{
+    if (_offset + sizeof(T) > _data.size())
+        throw InputFileException(
+            std::format("Observable file {} is truncated", _fileName)
+        );
+
+    T value;
+    std::memcpy(&value, _data.data() + _offset, sizeof(T));
+    _offset += sizeof(T);
+
+    return value;
+}
+
+/**
+ * @brief reads a string with its length as prefix from the file buffer
+ *
+ * @return std::string
+ *
+ * @throws InputFileException if the end of the file is reached
+ */
+std::string ObservableFileReader::readString()
+{
+    const auto length = size_t(readValue<uint64_t>());
+
+    if (length > _data.size() - _offset)
+        throw InputFileException(
+            std::format("Observable file {} is truncated", _fileName)
+        );
+
+    auto string = std::string(_data.substr(_offset, length));
+    _offset    += length;
+
+    return string;
+}
+
+/**
+ * @brief reads the whole observable file
+ *
+ * @throws InputFileException if the file cannot be opened
+ */
+void ObservableFileReader::read()
+{
+    const utilities::MappedFile file(_fileName);
+
+    if (!file.isOpen())
+        throw InputFileException(
+            std::format("Could not open observable file {}", _fileName)
+        );
+
+    _data        = file.getData();
+    _offset      = 0;
+    _isTruncated = false;
+    _tables.clear();
+
+    readHeader();
+
+    while (_offset < _data.size() && readBlock())
+    {
+    }
+
+    _data = {};
+}
+
+/**
+ * @brief reads the header with the layout of all tables
+ *
+ * @throws InputFileException if the magic string, the version or the
+ * endianness marker do not match
+ */
+void ObservableFileReader::readHeader()
+{
+    const auto magic = ObservableOutput::_MAGIC_;
+
+    if (!_data.starts_with(magic))
+        throw InputFileException(
+            std::format("File {} is not an observable file", _fileName)
+        );
+
+    _offset = magic.size();
+
+    const auto version    = readValue<uint32_t>();
+    const auto endianness = readValue<uint32_t>();
+
+    if (version != ObservableOutput::_VERSION_)
+        throw InputFileException(std::format(
+            "Observable file {} has unsupported version {}",
+            _fileName,
+            version
+        ));
+
+    if (endianness != ObservableOutput::_ENDIANNESS_)
+        throw InputFileException(std::format(
+            "Observable file {} was written with a different byte order",
+            _fileName
+        ));
+
+    const auto nTables = readValue<uint64_t>();
+
+    for (uint64_t i = 0; i < nTables; ++i)
+    {
+        const auto name      = readString();
+        const auto extension = readString();
+        const auto stepWidth = readValue<uint32_t>();
+        const auto isLeft    = readValue<uint32_t>() != 0;
+        const auto nColumns  = readValue<uint64_t>();
+
+        auto &table = _tables.emplace_back(name, extension, stepWidth, isLeft);
+
+        for (uint64_t j = 0; j < nColumns; ++j)
+        {
+            const auto columnName = readString();
+
+            ObservableFormat format;
+            format.notation  = readValue<ObservableNotation>();
+            format.width     = readValue<uint32_t>();
+            format.precision = readValue<uint32_t>();
+
+            table.addColumn(columnName, format);
+        }
+    }
+}
+
+/**
+ * @brief reads one columnar block and appends its rows to the table
+ *
+ * @return true if the block was read completely
+ * @return false if the block is incomplete
+ *
+ * @throws InputFileException if the table index is invalid
+ * @throws InputFileException if the checksum of the block does not match
+ */
+bool ObservableFileReader::readBlock()
+{
+    const auto remaining = _data.size() - _offset;
+
+    if (remaining < 2 * sizeof(uint64_t))
+    {
+        _isTruncated = true;
+        return false;
+    }
+
+    const auto tableIndex = size_t(readValue<uint64_t>());
+    const auto nRows      = size_t(readValue<uint64_t>());
+
+    if (tableIndex >= _tables.size())
+        throw InputFileException(std::format(
+            "Observable file {} contains a block of unknown table {}",
+            _fileName,
+            tableIndex
+        ));
+
+    auto &table = _tables[tableIndex];
+
+    const auto rowSize   = (table.getNumberOfColumns() + 1) * sizeof(double);
+    const auto available = _data.size() - _offset;
+
+    if (available < sizeof(uint64_t) ||
+        nRows > (available - sizeof(uint64_t)) / rowSize)
+    {
+        _isTruncated = true;
+        return false;
+    }
+
+    const auto dataSize = nRows * rowSize;
+    const auto data     = _data.substr(_offset, dataSize);
+
+    uint64_t checksum;
+    std::memcpy(&checksum, _data.data() + _offset + dataSize, sizeof(checksum));
+
+    if (CheckpointFileOutput::calculateChecksum(data) != checksum)
+        throw InputFileException(
+            std::format("Checksum mismatch in observable file {}", _fileName)
+        );
+
+    for (size_t row = 0; row < nRows; ++row)
+        table.appendStep(readValue<uint64_t>());
+
+    for (size_t column = 0; column < table.getNumberOfColumns(); ++column)
+        for (size_t row = 0; row < nRows; ++row)
+            table.appendColumnValue(column, readValue<double>());
+
+    _offset += sizeof(uint64_t);
+
+    return true;
+}
+
+/**
+ * @brief writes a table in the format of the corresponding text file
+ *
+ * @param tableIndex
+ * @param stream
+ */
+void ObservableFileReader::writeTextFile(
+    const size_t  tableIndex,
+    std::ostream &stream
+) const
+{
+    const auto &table = _tables[tableIndex];
+
+    OutputBuffer buffer;
+
+    for (size_t row = 0; row < table.getNumberOfRows(); ++row)
+    {
+        table.formatRow(buffer, row);
+
+        if (buffer.size() > _FLUSH_SIZE_)
+            buffer.writeTo(stream);
+    }
+
+    buffer.writeTo(stream);
+}
+
+/**
+ * @brief writes all tables to "<prefix>.<extension>"
+ *
+ * @param prefix
+ *
+ * @throws InputFileException if a text file cannot be written
+ */
+void ObservableFileReader::convert(const std::string &prefix) const
+{
+    for (size_t i = 0; i < _tables.size(); ++i)
+    {
+        const auto fileName = prefix + "." + _tables[i].getExtension();
+
+        std::ofstream file(fileName);
+        writeTextFile(i, file);
+        file.close();
+
+        if (file.fail())
+            throw InputFileException(
+                std::format("Could not write file {}", fileName)
+            );
+    }
+}
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief get the tables read from the file
+ *
+ * @return const std::vector<ObservableTable>&
+ */
+const std::vector<ObservableTable> &ObservableFileReader::getTables() const
+{
+    return _tables;
+}
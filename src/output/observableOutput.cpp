@@ -0,0 +1,290 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "observableOutput.hpp"
+
+#include <cstring>   // for memcpy
+#include <ostream>   // for flush
+
+#include "boxOutput.hpp"              // for BoxFileOutput
+#include "checkpointFileOutput.hpp"   // for CheckpointFileOutput
+#include "energyOutput.hpp"           // for EnergyOutput
+#include "exceptions.hpp"             // for InputFileException
+#include "momentumOutput.hpp"         // for MomentumOutput
+#include "physicalData.hpp"           // for PhysicalData
+#include "stressOutput.hpp"           // for StressOutput
+#include "vector3d.hpp"               // for Vec3D
+#include "virialOutput.hpp"           // for VirialOutput
+
+using namespace output;
+using namespace physicalData;
+using namespace linearAlgebra;
+using namespace customException;
+
+/**
+ * @brief appends the raw bytes of a trivially copyable value to the payload
+ *
+ * @tparam T
+ * @param value
+ */
+template <typename T>
+void ObservableOutput::appendValue(const T value)
+{
+    const auto offset = _payload.size();
+
+    _payload.resize(offset + sizeof(T));
+    std::memcpy(_payload.data() + offset, &value, sizeof(T));
+}
+
+/**
+ * @brief appends a string with its length as prefix to the payload
+ *
+ * @param string
+ */
+void ObservableOutput::appendString(const std::string_view string)
+{
+    appendValue<uint64_t>(string.size());
+    _payload.append(string);
+}
+
+/**
+ * @brief records the observables of one output step
+ *
+ * @details the averaged physical data is recorded for the energy and
+ * momentum tables and the instantaneous physical data for the instant
+ * energy, virial and stress tables - exactly as for the text files. The
+ * columns of the energy tables depend on the settings of the simulation,
+ * therefore the layout of the tables is determined from the first frame.
+ * The tables are flushed to the file as soon as they hold _blockSize rows.
+ *
+ * @param step
+ * @param physicalData
+ * @param averagePhysicalData
+ * @param boxDimensions
+ * @param boxAngles
+ */
+void ObservableOutput::record(
+    const size_t        step,
+    const PhysicalData &physicalData,
+    const PhysicalData &averagePhysicalData,
+    const Vec3D        &boxDimensions,
+    const Vec3D        &boxAngles
+)
+{
+    const auto isFirstFrame = _tables.empty();
+
+    if (isFirstFrame)
+        initTables();
+
+    size_t tableIndex = 0;
+
+    auto collect = [this, &tableIndex, isFirstFrame](
+                       const std::string_view  name,
+                       const ObservableFormat &format,
+                       const double            value
+                   )
+    {
+        if (isFirstFrame)
+            _tables[tableIndex].addColumn(name, format);
+
+        _values.push_back(value);
+    };
+
+    auto appendRow = [this, &tableIndex, step]()
+    {
+        _tables[tableIndex++].appendRow(step, _values);
+        _values.clear();
+    };
+
+    EnergyOutput::visitObservables(averagePhysicalData, collect);
+    appendRow();
+
+    EnergyOutput::visitObservables(physicalData, collect);
+    appendRow();
+
+    MomentumOutput::visitObservables(averagePhysicalData, collect);
+    appendRow();
+
+    VirialOutput::visitObservables(physicalData, collect);
+    appendRow();
+
+    StressOutput::visitObservables(physicalData, collect);
+    appendRow();
+
+    BoxFileOutput::visitObservables(boxDimensions, boxAngles, collect);
+    appendRow();
+
+    if (isFirstFrame)
+        for (auto &table : _tables) table.reserve(_blockSize);
+
+    if (_tables.front().getNumberOfRows() >= _blockSize)
+        flush();
+}
+
+/**
+ * @brief writes all recorded rows to the file
+ *
+ * @details the header is written together with the first block
+ *
+ * @throw InputFileException if the file cannot be written
+ */
+void ObservableOutput::flush()
+{
+    if (_tables.empty())
+        return;
+
+    if (!_isHeaderWritten)
+        writeHeader();
+
+    for (size_t i = 0; i < _tables.size(); ++i)
+        if (_tables[i].getNumberOfRows() > 0)
+            writeBlock(i);
+
+    _fp << std::flush;
+
+    if (_fp.fail())
+        throw InputFileException(
+            "Could not write observable file - filename = " + _fileName
+        );
+
+    for (auto &table : _tables) table.clearRows();
+}
+
+/**
+ * @brief creates the tables in the order in which they are recorded
+ *
+ */
+void ObservableOutput::initTables()
+{
+    _tables.emplace_back("energy", "en", 10, false);
+    _tables.emplace_back("instant_energy", "instant_en", 10, false);
+    _tables.emplace_back("momentum", "mom", 10, false);
+    _tables.emplace_back("virial", "vir", 10, false);
+    _tables.emplace_back("stress", "stress", 10, false);
+    _tables.emplace_back("box", "box", 5, true);
+}
+
+/**
+ * @brief writes the self-describing header of the file
+ *
+ */
+void ObservableOutput::writeHeader()
+{
+    _payload.assign(_MAGIC_);
+
+    appendValue(_VERSION_);
+    appendValue(_ENDIANNESS_);
+    appendValue<uint64_t>(_tables.size());
+
+    for (const auto &table : _tables)
+    {
+        appendString(table.getName());
+        appendString(table.getExtension());
+        appendValue<uint32_t>(table.getStepWidth());
+        appendValue<uint32_t>(table.isStepLeftAligned() ? 1 : 0);
+        appendValue<uint64_t>(table.getNumberOfColumns());
+
+        for (const auto &column : table.getColumns())
+        {
+            appendString(column.name);
+            appendValue(column.format.notation);
+            appendValue(column.format.width);
+            appendValue(column.format.precision);
+        }
+    }
+
+    _fp.write(_payload.data(), std::streamsize(_payload.size()));
+    _isHeaderWritten = true;
+}
+
+/**
+ * @brief writes all rows of a table as one columnar block
+ *
+ * @param tableIndex
+ */
+void ObservableOutput::writeBlock(const size_t tableIndex)
+{
+    const auto &table = _tables[tableIndex];
+    const auto  nRows = table.getNumberOfRows();
+
+    _payload.clear();
+
+    appendValue<uint64_t>(tableIndex);
+    appendValue<uint64_t>(nRows);
+
+    const auto dataOffset = _payload.size();
+
+    for (const auto step : table.getSteps()) appendValue(step);
+
+    for (size_t i = 0; i < table.getNumberOfColumns(); ++i)
+    {
+        const auto &values = table.getValues(i);
+        const auto  offset = _payload.size();
+        const auto  size   = values.size() * sizeof(double);
+
+        _payload.resize(offset + size);
+        std::memcpy(_payload.data() + offset, values.data(), size);
+    }
+
+    const auto data = std::string_view(_payload).substr(dataOffset);
+    appendValue(CheckpointFileOutput::calculateChecksum(data));
+
+    _fp.write(_payload.data(), std::streamsize(_payload.size()));
+}
+
+/***************************
+ *                         *
+ * standard setter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief set the number of rows after which the tables are flushed
+ *
+ * @param blockSize
+ *
+ * @throw InputFileException if the block size is zero
+ */
+void ObservableOutput::setBlockSize(const size_t blockSize)
+{
+    if (0 == blockSize)
+        throw InputFileException("Observable block size must be positive");
+
+    _blockSize = blockSize;
+}
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief get the observable tables
+ *
+ * @return const std::vector<ObservableTable>&
+ */
+const std::vector<ObservableTable> &ObservableOutput::getTables() const
+{
+    return _tables;
+}
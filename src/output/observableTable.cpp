@@ -0,0 +1,239 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "observableTable.hpp"
+
+#include <format>   // for format
+
+#include "exceptions.hpp"     // for InputFileException
+#include "outputBuffer.hpp"   // for OutputBuffer
+
+using namespace output;
+using namespace customException;
+
+/**
+ * @brief Construct a new Observable Table object
+ *
+ * @param name
+ * @param extension file extension of the corresponding text file
+ * @param stepWidth
+ * @param isStepLeftAligned
+ */
+ObservableTable::ObservableTable(
+    const std::string_view name,
+    const std::string_view extension,
+    const uint32_t         stepWidth,
+    const bool             isStepLeftAligned
+)
+    : _name(name),
+      _extension(extension),
+      _stepWidth(stepWidth),
+      _isStepLeftAligned(isStepLeftAligned)
+{
+}
+
+/**
+ * @brief adds a column to the table
+ *
+ * @details columns have to be added before any row is appended
+ *
+ * @param name
+ * @param format
+ */
+void ObservableTable::addColumn(
+    const std::string_view  name,
+    const ObservableFormat &format
+)
+{
+    _columns.emplace_back(std::string(name), format);
+    _values.emplace_back();
+}
+
+/**
+ * @brief reserves memory for the given number of rows in all columns
+ *
+ * @param nRows
+ */
+void ObservableTable::reserve(const size_t nRows)
+{
+    _steps.reserve(nRows);
+
+    for (auto &values : _values) values.reserve(nRows);
+}
+
+/**
+ * @brief removes all rows while keeping the capacity of the columns
+ *
+ */
+void ObservableTable::clearRows()
+{
+    _steps.clear();
+
+    for (auto &values : _values) values.clear();
+}
+
+/**
+ * @brief appends a row with one value per column
+ *
+ * @param step
+ * @param values
+ *
+ * @throw InputFileException if the number of values does not match the number
+ * of columns
+ */
+void ObservableTable::appendRow(
+    const uint64_t                step,
+    const std::span<const double> values
+)
+{
+    if (values.size() != _values.size())
+        throw InputFileException(std::format(
+            "Row of observable table {} has {} values but {} columns",
+            _name,
+            values.size(),
+            _values.size()
+        ));
+
+    _steps.push_back(step);
+
+    for (size_t i = 0; i < _values.size(); ++i) _values[i].push_back(values[i]);
+}
+
+/**
+ * @brief appends a single value to a column
+ *
+ * @param column
+ * @param value
+ */
+void ObservableTable::appendColumnValue(const size_t column, const double value)
+{
+    _values[column].push_back(value);
+}
+
+/**
+ * @brief appends a step without any values
+ *
+ * @param step
+ */
+void ObservableTable::appendStep(const uint64_t step)
+{
+    _steps.push_back(step);
+}
+
+/**
+ * @brief formats a row as line of the corresponding text file
+ *
+ * @param buffer
+ * @param row
+ */
+void ObservableTable::formatRow(OutputBuffer &buffer, const size_t row) const
+{
+    buffer.appendInteger(_steps[row], _stepWidth, _isStepLeftAligned);
+
+    for (size_t i = 0; i < _columns.size(); ++i)
+    {
+        buffer.append('\t');
+        appendValue(buffer, _columns[i].format, _values[i][row]);
+    }
+
+    buffer.append('\n');
+}
+
+/**
+ * @brief appends a value with the given format to the buffer
+ *
+ * @param buffer
+ * @param format
+ * @param value
+ */
+void ObservableTable::appendValue(
+    OutputBuffer           &buffer,
+    const ObservableFormat &format,
+    const double            value
+)
+{
+    const auto precision = static_cast<int>(format.precision);
+
+    if (format.notation == ObservableNotation::SCIENTIFIC)
+        buffer.appendScientific(value, format.width, precision);
+    else
+        buffer.appendFixed(value, format.width, precision);
+}
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief get the file extension of the corresponding text file
+ *
+ * @return const std::string&
+ */
+const std::string &ObservableTable::getExtension() const { return _extension; }
+
+/**
+ * @brief check if the step is left aligned in the text file
+ *
+ * @return bool
+ */
+bool ObservableTable::isStepLeftAligned() const { return _isStepLeftAligned; }
+
+/**
+ * @brief get the number of columns
+ *
+ * @return size_t
+ */
+size_t ObservableTable::getNumberOfColumns() const { return _columns.size(); }
+
+/**
+ * @brief get the columns
+ *
+ * @return const std::vector<ObservableColumn>&
+ */
+const std::vector<ObservableColumn> &ObservableTable::getColumns() const
+{
+    return _columns;
+}
+
+/**
+ * @brief get the steps of all rows
+ *
+ * @return const std::vector<uint64_t>&
+ */
+const std::vector<uint64_t> &ObservableTable::getSteps() const
+{
+    return _steps;
+}
+
+/**
+ * @brief get the values of a column
+ *
+ * @param column
+ * @return const std::vector<double>&
+ */
+const std::vector<double> &ObservableTable::getValues(const size_t column) const
+{
+    return _values[column];
+}
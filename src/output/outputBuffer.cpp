@@ -0,0 +1,231 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "outputBuffer.hpp"
+
+#include <array>      // for array
+#include <charconv>   // for to_chars, chars_format
+
+#include "vector3d.hpp"   // for Vec3D
+
+using namespace output;
+using namespace linearAlgebra;
+
+/**
+ * @brief clears the buffer while keeping its capacity
+ *
+ */
+void OutputBuffer::clear() { _buffer.clear(); }
+
+/**
+ * @brief reserves memory for the buffer
+ *
+ * @param size
+ */
+void OutputBuffer::reserve(const size_t size) { _buffer.reserve(size); }
+
+/**
+ * @brief writes the buffer with a single write call and clears it
+ *
+ * @param stream
+ */
+void OutputBuffer::writeTo(std::ostream &stream)
+{
+    const auto size = static_cast<std::streamsize>(_buffer.size());
+
+    stream.write(_buffer.data(), size);
+    _buffer.clear();
+}
+
+/**
+ * @brief appends a single character
+ *
+ * @param character
+ */
+void OutputBuffer::append(const char character) { _buffer += character; }
+
+/**
+ * @brief appends a string without padding
+ *
+ * @param string
+ */
+void OutputBuffer::append(const std::string_view string) { _buffer += string; }
+
+/**
+ * @brief appends a string padded with spaces to the given width
+ *
+ * @param string
+ * @param width
+ * @param leftAligned
+ */
+void OutputBuffer::appendPadded(
+    const std::string_view string,
+    const size_t           width,
+    const bool             leftAligned
+)
+{
+    const auto padding = string.size() < width ? width - string.size() : 0;
+
+    if (leftAligned)
+    {
+        _buffer += string;
+        _buffer.append(padding, ' ');
+    }
+    else
+    {
+        _buffer.append(padding, ' ');
+        _buffer += string;
+    }
+}
+
+/**
+ * @brief appends a left aligned string - equivalent to "{:<width}"
+ *
+ * @param string
+ * @param width
+ */
+void OutputBuffer::appendLeft(const std::string_view string, const size_t width)
+{
+    appendPadded(string, width, true);
+}
+
+/**
+ * @brief appends a right aligned string - equivalent to "{:>width}"
+ *
+ * @param string
+ * @param width
+ */
+void OutputBuffer::appendRight(
+    const std::string_view string,
+    const size_t           width
+)
+{
+    appendPadded(string, width, false);
+}
+
+/**
+ * @brief appends a number in fixed notation - equivalent to
+ * "{:width.precisionf}"
+ *
+ * @param value
+ * @param width
+ * @param precision
+ */
+void OutputBuffer::appendFixed(
+    const double value,
+    const size_t width,
+    const int    precision
+)
+{
+    std::array<char, _MAX_NUMBER_LENGTH_> chars;
+
+    const auto first = chars.data();
+    const auto last  = first + chars.size();
+
+    const auto result =
+        std::to_chars(first, last, value, std::chars_format::fixed, precision);
+
+    appendPadded(std::string_view(first, result.ptr), width, false);
+}
+
+/**
+ * @brief appends a number in scientific notation - equivalent to
+ * "{:width.precisione}"
+ *
+ * @param value
+ * @param width
+ * @param precision
+ */
+void OutputBuffer::appendScientific(
+    const double value,
+    const size_t width,
+    const int    precision
+)
+{
+    std::array<char, _MAX_NUMBER_LENGTH_> chars;
+
+    const auto first  = chars.data();
+    const auto last   = first + chars.size();
+    const auto format = std::chars_format::scientific;
+
+    const auto result = std::to_chars(first, last, value, format, precision);
+
+    appendPadded(std::string_view(first, result.ptr), width, false);
+}
+
+/**
+ * @brief appends a number like the default formatting of std::ostream
+ *
+ * @details std::ostream uses the %g conversion with a precision of 6
+ *
+ * @param value
+ */
+void OutputBuffer::appendGeneral(const double value)
+{
+    std::array<char, _MAX_NUMBER_LENGTH_> chars;
+
+    const auto first = chars.data();
+    const auto last  = first + chars.size();
+
+    const auto result =
+        std::to_chars(first, last, value, std::chars_format::general, 6);
+
+    _buffer.append(first, result.ptr);
+}
+
+/**
+ * @brief appends a vector like operator<< of Vec3D
+ *
+ * @param vector
+ */
+void OutputBuffer::appendGeneral(const Vec3D &vector)
+{
+    appendGeneral(vector[0]);
+    _buffer += ' ';
+    appendGeneral(vector[1]);
+    _buffer += ' ';
+    appendGeneral(vector[2]);
+}
+
+/**
+ * @brief appends an unsigned integer - equivalent to "{:widthd}" or
+ * "{:<width}" if left aligned
+ *
+ * @param value
+ * @param width
+ * @param leftAligned
+ */
+void OutputBuffer::appendInteger(
+    const size_t value,
+    const size_t width,
+    const bool   leftAligned
+)
+{
+    std::array<char, 32> chars;
+
+    const auto first  = chars.data();
+    const auto last   = first + chars.size();
+    const auto result = std::to_chars(first, last, value);
+
+    appendPadded(std::string_view(first, result.ptr), width, leftAligned);
+}
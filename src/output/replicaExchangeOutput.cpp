@@ -0,0 +1,94 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "replicaExchangeOutput.hpp"
+
+#include <ostream>   // for flush
+
+using output::ReplicaExchangeOutput;
+
+/**
+ * @brief write the header of the replica exchange output
+ *
+ * @details the header is a comment line with the temperatures of the
+ * replica exchange run in ascending order
+ *
+ * @param temperatures
+ */
+void ReplicaExchangeOutput::writeHeader(const std::vector<double> &temperatures)
+{
+    _buffer.append("# temperatures");
+
+    for (const auto temperature : temperatures)
+    {
+        _buffer.append('\t');
+        _buffer.appendFixed(temperature, 12, 5);
+    }
+
+    _buffer.append('\n');
+
+    _buffer.writeTo(_fp);
+    _fp << std::flush;
+}
+
+/**
+ * @brief write the state of the replica exchange after an exchange attempt
+ *
+ * @details The replica exchange output is written in the following format:
+ * - step
+ * - for each temperature: index of the replica at this temperature
+ * - for each pair of neighbouring temperatures: acceptance ratio
+ *
+ * @param step
+ * @param replicaOfTemperature
+ * @param nAttempts number of attempts per pair of neighbouring temperatures
+ * @param nAccepted number of accepted swaps per pair
+ */
+void ReplicaExchangeOutput::write(
+    const size_t               step,
+    const std::vector<size_t> &replicaOfTemperature,
+    const std::vector<size_t> &nAttempts,
+    const std::vector<size_t> &nAccepted
+)
+{
+    _buffer.appendInteger(step, 10);
+
+    for (const auto replica : replicaOfTemperature)
+    {
+        _buffer.append('\t');
+        _buffer.appendInteger(replica, 5);
+    }
+
+    for (size_t i = 0; i < nAttempts.size(); ++i)
+    {
+        const auto ratio =
+            nAttempts[i] == 0 ? 0.0 : double(nAccepted[i]) / nAttempts[i];
+
+        _buffer.append('\t');
+        _buffer.appendFixed(ratio, 8, 5);
+    }
+
+    _buffer.append('\n');
+
+    _buffer.writeTo(_fp);
+    _fp << std::flush;
+}
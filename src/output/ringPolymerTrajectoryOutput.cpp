@@ -24,23 +24,68 @@
 
 #include <algorithm>    // for __for_each_fn, for_each
 #include <cstddef>      // for size_t
-#include <format>       // for format
 #include <functional>   // for identity
-#include <ostream>      // for basic_ostream, ofstream, operator<<
-#include <sstream>      // for ostringstream
-#include <string>       // for operator<<, char_traits
+#include <ostream>      // for flush
 
 #include "molecule.hpp"              // for Molecule
 #include "ringPolymerSettings.hpp"   // for RingPolymerSettings
 #include "simulationBox.hpp"         // for SimulationBox
-#include "vector3d.hpp"              // for Vec3D, operator<<
+#include "vector3d.hpp"              // for Vec3D
 
 using output::RingPolymerTrajectoryOutput;
 using namespace settings;
 using namespace simulationBox;
 
 /**
- * @brief write the header of the beads trajectory file
+ * @brief caches the right aligned atom names of the beads
+ *
+ * @details the atom names are the same for all beads, therefore they are
+ * only updated if the number of atoms changed
+ *
+ * @param simBox
+ */
+void RingPolymerTrajectoryOutput::updateAtomNames(SimulationBox &simBox)
+{
+    size_t nAtoms = 0;
+
+    for (const auto &molecule : simBox.getMolecules())
+        nAtoms += molecule.getNumberOfAtoms();
+
+    if (_paddedAtomNames.size() == nAtoms)
+        return;
+
+    _paddedAtomNames.clear();
+    _paddedAtomNames.reserve(nAtoms);
+
+    OutputBuffer name;
+
+    for (const auto &molecule : simBox.getMolecules())
+        for (size_t j = 0; j < molecule.getNumberOfAtoms(); ++j)
+        {
+            name.appendRight(molecule.getAtomName(j), 5);
+            _paddedAtomNames.push_back(name.str());
+            name.clear();
+        }
+}
+
+/**
+ * @brief writes the atom name followed by the bead index into the buffer
+ *
+ * @param atomIndex index of the atom within a bead
+ * @param bead
+ */
+void RingPolymerTrajectoryOutput::writeAtomName(
+    const size_t atomIndex,
+    const size_t bead
+)
+{
+    _buffer.append(_paddedAtomNames[atomIndex]);
+    _buffer.appendInteger(bead + 1, 0);
+    _buffer.append('\t');
+}
+
+/**
+ * @brief write the header of the beads trajectory file into the buffer
  *
  * @details number of atoms is multiplied by the number of beads - box
  * dimensions and angles are the same for all beads
@@ -51,8 +96,12 @@ void RingPolymerTrajectoryOutput::writeHeader(const SimulationBox &simBox)
 {
     const auto nBeads = RingPolymerSettings::getNumberOfBeads();
 
-    _fp << simBox.getNumberOfAtoms() * nBeads << "  ";
-    _fp << simBox.getBoxDimensions() << "  " << simBox.getBoxAngles() << '\n';
+    _buffer.appendInteger(simBox.getNumberOfAtoms() * nBeads, 0);
+    _buffer.append("  ");
+    _buffer.appendGeneral(simBox.getBoxDimensions());
+    _buffer.append("  ");
+    _buffer.appendGeneral(simBox.getBoxAngles());
+    _buffer.append('\n');
 }
 
 /**
@@ -62,34 +111,39 @@ void RingPolymerTrajectoryOutput::writeHeader(const SimulationBox &simBox)
  */
 void RingPolymerTrajectoryOutput::writeXyz(std::vector<SimulationBox> &beads)
 {
-    std::ostringstream buffer;
+    updateAtomNames(beads[0]);
 
     writeHeader(beads[0]);
-    buffer << '\n';
+    _buffer.append('\n');
 
     const auto nBeads = RingPolymerSettings::getNumberOfBeads();
 
     for (size_t i = 0; i < nBeads; ++i)
+    {
+        size_t atomIndex = 0;
+
         for (const auto &molecule : beads[i].getMolecules())
         {
             const auto nAtoms = molecule.getNumberOfAtoms();
-            for (size_t j = 0; j < nAtoms; ++j)
+
+            for (size_t j = 0; j < nAtoms; ++j, ++atomIndex)
             {
-                const auto atomName = molecule.getAtomName(j);
-                const auto x        = molecule.getAtomPosition(j)[0];
-                const auto y        = molecule.getAtomPosition(j)[1];
-                const auto z        = molecule.getAtomPosition(j)[2];
+                const auto &position = molecule.getAtomPosition(j);
 
-                buffer << std::format("{:>5}{}\t", atomName, i + 1);
+                writeAtomName(atomIndex, i);
 
-                buffer << std::format("{:15.8f}\t", x);
-                buffer << std::format("{:15.8f}\t", y);
-                buffer << std::format("{:15.8f}\n", z);
+                _buffer.appendFixed(position[0], 15, 8);
+                _buffer.append('\t');
+                _buffer.appendFixed(position[1], 15, 8);
+                _buffer.append('\t');
+                _buffer.appendFixed(position[2], 15, 8);
+                _buffer.append('\n');
             }
         }
+    }
 
     // Write the buffer to the file
-    _fp << buffer.str();
+    _buffer.writeTo(_fp);
     _fp << std::flush;
 }
 
@@ -102,35 +156,39 @@ void RingPolymerTrajectoryOutput::writeVelocities(
     std::vector<SimulationBox> &beads
 )
 {
-    std::ostringstream buffer;
+    updateAtomNames(beads[0]);
 
     writeHeader(beads[0]);
-    buffer << '\n';
+    _buffer.append('\n');
 
     const auto nBeads = RingPolymerSettings::getNumberOfBeads();
 
     for (size_t i = 0; i < nBeads; ++i)
+    {
+        size_t atomIndex = 0;
+
         for (const auto &molecule : beads[i].getMolecules())
         {
             const auto nAtoms = molecule.getNumberOfAtoms();
 
-            for (size_t j = 0; j < nAtoms; ++j)
+            for (size_t j = 0; j < nAtoms; ++j, ++atomIndex)
             {
-                const auto atomName = molecule.getAtomName(j);
-                const auto vx       = molecule.getAtomVelocity(j)[0];
-                const auto vy       = molecule.getAtomVelocity(j)[1];
-                const auto vz       = molecule.getAtomVelocity(j)[2];
+                const auto &velocity = molecule.getAtomVelocity(j);
 
-                buffer << std::format("{:>5}{}\t", atomName, i + 1);
+                writeAtomName(atomIndex, i);
 
-                buffer << std::format("{:20.8e}\t", vx);
-                buffer << std::format("{:20.8e}\t", vy);
-                buffer << std::format("{:20.8e}\n", vz);
+                _buffer.appendScientific(velocity[0], 20, 8);
+                _buffer.append('\t');
+                _buffer.appendScientific(velocity[1], 20, 8);
+                _buffer.append('\t');
+                _buffer.appendScientific(velocity[2], 20, 8);
+                _buffer.append('\n');
             }
         }
+    }
 
     // Write the buffer to the file
-    _fp << buffer.str();
+    _buffer.writeTo(_fp);
     _fp << std::flush;
 }
 
@@ -141,7 +199,7 @@ void RingPolymerTrajectoryOutput::writeVelocities(
  */
 void RingPolymerTrajectoryOutput::writeForces(std::vector<SimulationBox> &beads)
 {
-    std::ostringstream buffer;
+    updateAtomNames(beads[0]);
 
     writeHeader(beads[0]);
 
@@ -151,34 +209,36 @@ void RingPolymerTrajectoryOutput::writeForces(std::vector<SimulationBox> &beads)
         [&totalForce](auto &bead) { totalForce += bead.calculateTotalForce(); }
     );
 
-    buffer << std::format(
-        "# Total force = {:.5e} kcal/mol/Angstrom\n",
-        totalForce
-    );
+    _buffer.append("# Total force = ");
+    _buffer.appendScientific(totalForce, 0, 5);
+    _buffer.append(" kcal/mol/Angstrom\n");
 
     for (size_t i = 0; i < RingPolymerSettings::getNumberOfBeads(); ++i)
+    {
+        size_t atomIndex = 0;
+
         for (const auto &molecule : beads[i].getMolecules())
         {
             const auto nAtoms = molecule.getNumberOfAtoms();
 
-            for (size_t j = 0; j < nAtoms; ++j)
+            for (size_t j = 0; j < nAtoms; ++j, ++atomIndex)
             {
-                const auto atomName = molecule.getAtomName(j);
-                const auto fx       = molecule.getAtomForce(j)[0];
-                const auto fy       = molecule.getAtomForce(j)[1];
-                const auto fz       = molecule.getAtomForce(j)[2];
+                const auto &force = molecule.getAtomForce(j);
 
-                buffer
-                    << std::format("{:>5}{}\t", molecule.getAtomName(j), i + 1);
+                writeAtomName(atomIndex, i);
 
-                buffer << std::format("{:15.8f}\t", fx);
-                buffer << std::format("{:15.8f}\t", fy);
-                buffer << std::format("{:15.8f}\n", fz);
+                _buffer.appendFixed(force[0], 15, 8);
+                _buffer.append('\t');
+                _buffer.appendFixed(force[1], 15, 8);
+                _buffer.append('\t');
+                _buffer.appendFixed(force[2], 15, 8);
+                _buffer.append('\n');
             }
         }
+    }
 
     // Write the buffer to the file
-    _fp << buffer.str();
+    _buffer.writeTo(_fp);
     _fp << std::flush;
 }
 
@@ -190,28 +250,30 @@ void RingPolymerTrajectoryOutput::writeForces(std::vector<SimulationBox> &beads)
 void RingPolymerTrajectoryOutput::writeCharges(std::vector<SimulationBox> &beads
 )
 {
-    std::ostringstream buffer;
+    updateAtomNames(beads[0]);
 
     writeHeader(beads[0]);
-    buffer << '\n';
+    _buffer.append('\n');
 
     for (size_t i = 0; i < RingPolymerSettings::getNumberOfBeads(); ++i)
+    {
+        size_t atomIndex = 0;
+
         for (const auto &molecule : beads[i].getMolecules())
         {
             const auto nAtoms = molecule.getNumberOfAtoms();
 
-            for (size_t j = 0; j < nAtoms; ++j)
+            for (size_t j = 0; j < nAtoms; ++j, ++atomIndex)
             {
-                const auto atomName = molecule.getAtomName(j);
-                const auto charge   = molecule.getPartialCharge(j);
+                writeAtomName(atomIndex, i);
 
-                buffer << std::format("{:>5}{}\t", atomName, i + 1);
-                buffer << std::format("{:15.8f}\n", charge);
-                buffer << std::flush;
+                _buffer.appendFixed(molecule.getPartialCharge(j), 15, 8);
+                _buffer.append('\n');
             }
         }
+    }
 
     // Write the buffer to the file
-    _fp << buffer.str();
+    _buffer.writeTo(_fp);
     _fp << std::flush;
-}
\ No newline at end of file
+}
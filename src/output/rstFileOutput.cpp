@@ -22,27 +22,22 @@
 
 #include "rstFileOutput.hpp"
 
-#include <format>    // for format
-#include <ostream>   // for basic_ostream, operator<<, flush, std
-#include <sstream>   // for ostringstream
-#include <string>    // for char_traits, operator<<
-#include <vector>    // for vector
-
-#include "molecule.hpp"               // for Molecule
-#include "noseHooverThermostat.hpp"   // for NoseHooverThermostat
-#include "simulationBox.hpp"          // for SimulationBox
-#include "thermostatSettings.hpp"     // for ThermostatType
-#include "vector3d.hpp"               // for operator<<
+#include <cstddef>   // for size_t
+#include <ostream>   // for flush
+
+#include "frameSnapshot.hpp"   // for FrameSnapshot
+#include "simulationBox.hpp"   // for SimulationBox
+#include "thermostat.hpp"      // for Thermostat
 
 using namespace output;
 using namespace simulationBox;
 using namespace thermostat;
-using namespace settings;
 
 /**
  * @brief Write the restart file
  *
  * @param simBox
+ * @param thermostat
  * @param step
  */
 void RstFileOutput::write(
@@ -51,78 +46,96 @@ void RstFileOutput::write(
     const size_t      step
 )
 {
-    std::ostringstream buffer;
+    FrameSnapshot snapshot;
+    snapshot.captureSimulationBox(simBox);
+    snapshot.captureThermostat(thermostat);
+    snapshot.setStep(step);
+
+    write(snapshot);
+}
 
+/**
+ * @brief Write the restart file from a frame snapshot
+ *
+ * @param snapshot
+ */
+void RstFileOutput::write(const FrameSnapshot &snapshot)
+{
     _fp.close();
 
     _fp.open(_fileName);
 
-    buffer << "Step " << step << '\n';
+    _buffer.append("Step ");
+    _buffer.appendInteger(snapshot.getStep(), 0);
+    _buffer.append('\n');
 
-    const auto &boxDim = simBox.getBoxDimensions();
-    const auto &boxAng = simBox.getBoxAngles();
+    _buffer.append("Box   ");
+    _buffer.appendGeneral(snapshot.getBoxDimensions());
+    _buffer.append("  ");
+    _buffer.appendGeneral(snapshot.getBoxAngles());
+    _buffer.append('\n');
 
-    buffer << "Box   " << boxDim << "  " << boxAng << '\n';
+    if (snapshot.isNoseHoover())
+        writeNHChain(snapshot);
 
-    if (thermostat.getThermostatType() == ThermostatType::NOSE_HOOVER)
-        writeNHChain(thermostat, buffer);
+    const auto nAtoms = snapshot.getNumberOfAtoms();
 
-    for (const auto &molecule : simBox.getMolecules())
+    for (size_t i = 0; i < nAtoms; ++i)
     {
-        const auto nAtoms = molecule.getNumberOfAtoms();
+        const auto &position = snapshot.getPosition(i);
+        const auto &velocity = snapshot.getVelocity(i);
+        const auto &force    = snapshot.getForce(i);
+
+        _buffer.appendLeft(snapshot.getAtomName(i), 5);
+        _buffer.append('\t');
+        _buffer.appendInteger(snapshot.getAtomIndex(i) + 1, 5, true);
+        _buffer.append('\t');
+        _buffer.appendInteger(snapshot.getMoleculeType(i), 5, true);
+        _buffer.append('\t');
+
+        for (size_t j = 0; j < 3; ++j)
+        {
+            _buffer.appendFixed(position[j], 15, 8);
+            _buffer.append('\t');
+        }
 
-        for (size_t i = 0; i < nAtoms; ++i)
+        for (size_t j = 0; j < 3; ++j)
         {
-            const auto atomName = molecule.getAtomName(i);
-            const auto molType  = molecule.getMoltype();
-            const auto x        = molecule.getAtomPosition(i)[0];
-            const auto y        = molecule.getAtomPosition(i)[1];
-            const auto z        = molecule.getAtomPosition(i)[2];
-            const auto vx       = molecule.getAtomVelocity(i)[0];
-            const auto vy       = molecule.getAtomVelocity(i)[1];
-            const auto vz       = molecule.getAtomVelocity(i)[2];
-            const auto fx       = molecule.getAtomForce(i)[0];
-            const auto fy       = molecule.getAtomForce(i)[1];
-            const auto fz       = molecule.getAtomForce(i)[2];
-
-            buffer << std::format("{:<5}\t", atomName);
-            buffer << std::format("{:<5}\t", i + 1);
-            buffer << std::format("{:<5}\t", molType);
-
-            buffer << std::format("{:15.8f}\t{:15.8f}\t{:15.8f}\t", x, y, z);
-            buffer << std::format("{:19.8e}\t{:19.8e}\t{:19.8e}\t", vx, vy, vz);
-            buffer << std::format("{:15.8f}\t{:15.8f}\t{:15.8f}", fx, fy, fz);
-
-            buffer << '\n' << std::flush;
+            _buffer.appendScientific(velocity[j], 19, 8);
+            _buffer.append('\t');
         }
+
+        _buffer.appendFixed(force[0], 15, 8);
+        _buffer.append('\t');
+        _buffer.appendFixed(force[1], 15, 8);
+        _buffer.append('\t');
+        _buffer.appendFixed(force[2], 15, 8);
+        _buffer.append('\n');
     }
 
     // Write the buffer to the file
-    _fp << buffer.str();
+    _buffer.writeTo(_fp);
     _fp << std::flush;
 }
 
 /**
- * @brief write Nose-Hoover thermostat chi/zeta info to the restart file
+ * @brief write Nose-Hoover thermostat chi/zeta info into the output buffer
  *
- * @param thermostat
- * @param buffer
+ * @param snapshot
  */
-void RstFileOutput::writeNHChain(
-    const Thermostat   &thermostat,
-    std::ostringstream &buffer
-)
+void RstFileOutput::writeNHChain(const FrameSnapshot &snapshot)
 {
-    const auto &nh = dynamic_cast<const NoseHooverThermostat &>(thermostat);
-
-    const auto &chi  = nh.getChi();
-    const auto &zeta = nh.getZeta();
+    const auto &chi  = snapshot.getChi();
+    const auto &zeta = snapshot.getZeta();
 
     for (size_t i = 0; i < chi.size() - 1; ++i)
     {
-        buffer
-            << "chi "
-            << std::format("{:2d}\t{:10.5e}\t{:10.5e}", i + 1, chi[i], zeta[i])
-            << '\n';
+        _buffer.append("chi ");
+        _buffer.appendInteger(i + 1, 2);
+        _buffer.append('\t');
+        _buffer.appendScientific(chi[i], 10, 5);
+        _buffer.append('\t');
+        _buffer.appendScientific(zeta[i], 10, 5);
+        _buffer.append('\n');
     }
-}
\ No newline at end of file
+}
@@ -22,17 +22,18 @@
 
 #include "stressOutput.hpp"
 
-#include <format>    // for format
-#include <fstream>   // for basic_ostream, ofstream
-#include <string>    // for operator<<
+#include <fstream>       // for ofstream
+#include <ostream>       // for flush
+#include <string_view>   // for string_view
 
-#include "physicalData.hpp"   // for PhysicalData
+#include "observableTable.hpp"   // for ObservableTable
+#include "physicalData.hpp"      // for PhysicalData
 
 using output::StressOutput;
 using namespace physicalData;
 
 /**
- * @brief Write the stress output
+ * @brief visits all observables of the stress output in file order
  *
  * @details The stress output is written in the following format:
  * - step
@@ -46,23 +47,51 @@ using namespace physicalData;
  * - s_zy
  * - s_zz
  *
+ * @param data
+ * @param visit
+ */
+void StressOutput::visitObservables(
+    const PhysicalData      &data,
+    const ObservableVisitor &visit
+)
+{
+    constexpr auto format =
+        ObservableFormat{ObservableNotation::SCIENTIFIC, 20, 5};
+
+    const auto &tensor = data.getStressTensor();
+
+    visit("s_xx", format, tensor[0][0]);
+    visit("s_xy", format, tensor[0][1]);
+    visit("s_xz", format, tensor[0][2]);
+    visit("s_yx", format, tensor[1][0]);
+    visit("s_yy", format, tensor[1][1]);
+    visit("s_yz", format, tensor[1][2]);
+    visit("s_zx", format, tensor[2][0]);
+    visit("s_zy", format, tensor[2][1]);
+    visit("s_zz", format, tensor[2][2]);
+}
+
+/**
+ * @brief Write the stress output
+ *
+ * @details the columns are described in visitObservables
+ *
  * @param step
  * @param data
  */
 void StressOutput::write(const size_t step, const PhysicalData &data)
 {
-    const auto &stress = data.getStressTensor();
+    auto appendValue =
+        [this](std::string_view, const ObservableFormat &format, double value)
+    {
+        _buffer.append('\t');
+        ObservableTable::appendValue(_buffer, format, value);
+    };
 
-    _fp << std::format("{:10d}\t", step);
-    _fp << std::format("{:20.5e}\t", stress[0][0]);
-    _fp << std::format("{:20.5e}\t", stress[0][1]);
-    _fp << std::format("{:20.5e}\t", stress[0][2]);
-    _fp << std::format("{:20.5e}\t", stress[1][0]);
-    _fp << std::format("{:20.5e}\t", stress[1][1]);
-    _fp << std::format("{:20.5e}\t", stress[1][2]);
-    _fp << std::format("{:20.5e}\t", stress[2][0]);
-    _fp << std::format("{:20.5e}\t", stress[2][1]);
-    _fp << std::format("{:20.5e}\n", stress[2][2]);
+    _buffer.appendInteger(step, 10);
+    visitObservables(data, appendValue);
+    _buffer.append('\n');
 
+    _buffer.writeTo(_fp);
     _fp << std::flush;
-}
\ No newline at end of file
+}
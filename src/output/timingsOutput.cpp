@@ -22,19 +22,24 @@
 
 #include "timingsOutput.hpp"
 
-#include <format>   // for std::format
+#include <algorithm>   // for ranges::none_of, max
+#include <format>      // for std::format
 
-#include "globalTimer.hpp"   // for GlobalTimer
+#include "globalTimer.hpp"        // for GlobalTimer
+#include "hardwareCounters.hpp"   // for HardwareCounters
+#include "timingsSettings.hpp"    // for TimingsSettings
 
 using namespace output;
 using namespace timings;
+using namespace settings;
 
 /**
  * @brief Write the timings to the output file
  *
  * @param timer The timer object
+ * @param nAtoms number of atoms used to normalize the hardware counters
  */
-void TimingsOutput::write(GlobalTimer &timer)
+void TimingsOutput::write(GlobalTimer &timer, const size_t nAtoms)
 {
     timer.sortTimers();
 
@@ -86,19 +91,23 @@ void TimingsOutput::write(GlobalTimer &timer)
     _fp << "\n";
 
     _fp << std::format(
-        "{:<30}\t{:>10}\t{:>10}\t{:>10}\n",
+        "{:<30}\t{:>10}\t{:>10}\t{:>10}\t{:>10}\t{:>10}\n",
         "Section",
         "Time [s]",
         "Time [%]",
-        "RelT [%]"
+        "RelT [%]",
+        "p50 [ms]",
+        "p99 [ms]"
     );
 
     // write a line consisting only of '-'
     _fp << std::format(
-        "{:<30}\t{:>10}\t{:>10}\t{:>10}\n",
+        "{:<30}\t{:>10}\t{:>10}\t{:>10}\t{:>10}\t{:>10}\n",
         std::string(30, '-'),
         std::string(10, '-'),
         std::string(10, '-'),
+        std::string(10, '-'),
+        std::string(10, '-'),
         std::string(10, '-')
     );
 
@@ -135,25 +144,123 @@ void TimingsOutput::write(GlobalTimer &timer)
             100.0
         );
 
+        // nested sections are indented by their depth
         for (const auto &subSection : subsections)
         {
-            const auto elapsedTime      = subSection.calculateElapsedTime();
-            const auto subName          = subSection.getName();
-            const auto subTime          = subSection.calculateElapsedTime();
-            const auto subPercentage    = (subTime / time) * 100.0;
+            const auto elapsedTime   = timer.calculateElapsedTime();
+            const auto depth         = subSection.getDepth();
+            const auto indent        = std::string(2 * depth, ' ');
+            const auto subName       = indent + subSection.getName();
+            const auto subTime       = subSection.calculateElapsedTime();
+            const auto subPercentage = (subTime / time) * 100.0;
             const auto subTotPercentage = (subTime / elapsedTime) * 100.0;
 
+            const auto p50 = subSection.calculatePercentileLoopTime(0.50);
+            const auto p99 = subSection.calculatePercentileLoopTime(0.99);
+
             _fp << std::format(
-                "{:<30}\t{:>10.3f}\t{:>10.3f}\t{:>10.3f}\n",
+                "{:<30}\t{:>10.3f}\t{:>10.3f}\t{:>10.3f}\t"
+                "{:>10.4f}\t{:>10.4f}\n",
                 subName,
                 subTime * 1e-3,
                 subTotPercentage,
-                subPercentage
+                subPercentage,
+                p50 * 1e3,
+                p99 * 1e3
             );
         }
 
         _fp << "\n";
     }
 
+    if (TimingsSettings::isHardwareCounters())
+        writeHardwareCounters(timer, nAtoms);
+
     _fp << std::flush;
+}
+
+/**
+ * @brief Write the hardware counters of all timings sections
+ *
+ * @details the instructions per cycle (IPC) and the counters per atom and
+ * execution of the section (atom-step) are written. If the counters could
+ * not be opened the reason is written instead.
+ *
+ * @param timer The timer object
+ * @param nAtoms number of atoms
+ */
+void TimingsOutput::writeHardwareCounters(
+    const GlobalTimer &timer,
+    const size_t       nAtoms
+)
+{
+    _fp << "\n";
+    _fp << "\n";
+    _fp << "\n";
+
+    if (const auto error = HardwareCounters::getErrorMessage(); !error.empty())
+        _fp << std::format("Hardware counters not available: {}\n\n", error);
+
+    _fp << std::format(
+        "{:<30}\t{:>10}\t{:>10}\t{:>10}\t{:>10}\t{:>10}\n",
+        "Section",
+        "IPC",
+        "Cyc/AS",
+        "Ins/AS",
+        "CMiss/AS",
+        "BMiss/AS"
+    );
+
+    // write a line consisting only of '-'
+    _fp << std::format(
+        "{:<30}\t{:>10}\t{:>10}\t{:>10}\t{:>10}\t{:>10}\n",
+        std::string(30, '-'),
+        std::string(10, '-'),
+        std::string(10, '-'),
+        std::string(10, '-'),
+        std::string(10, '-'),
+        std::string(10, '-')
+    );
+
+    for (const auto &section : timer.getTimers())
+    {
+        const auto subsections = section.getTimingDetails();
+
+        auto hasCounters = [](const TimingsSection &subSection)
+        { return subSection.getCounters().cycles > 0; };
+
+        if (std::ranges::none_of(subsections, hasCounters))
+            continue;
+
+        _fp << "\n";
+        _fp << section.getTimerName() << "\n";
+
+        for (const auto &subSection : subsections)
+        {
+            if (!hasCounters(subSection))
+                continue;
+
+            const auto &counters = subSection.getCounters();
+
+            const auto indent  = std::string(2 * subSection.getDepth(), ' ');
+            const auto subName = indent + subSection.getName();
+
+            const auto atomSteps =
+                double(std::max(nAtoms, size_t(1)) * subSection.getSteps());
+
+            const auto cycles = double(counters.cycles);
+            const auto ipc    = double(counters.instructions) / cycles;
+
+            _fp << std::format(
+                "{:<30}\t{:>10.3f}\t{:>10.2f}\t{:>10.2f}\t"
+                "{:>10.4f}\t{:>10.4f}\n",
+                subName,
+                ipc,
+                cycles / atomSteps,
+                double(counters.instructions) / atomSteps,
+                double(counters.cacheMisses) / atomSteps,
+                double(counters.branchMisses) / atomSteps
+            );
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,123 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "timingsTraceOutput.hpp"
+
+#include <format>   // for std::format
+#include <set>      // for set
+#include <vector>   // for vector
+
+#include "globalTimer.hpp"       // for GlobalTimer
+#include "timer.hpp"             // for Timer
+#include "timingsRegistry.hpp"   // for TimingsRegistry
+
+using namespace output;
+using namespace timings;
+
+/**
+ * @brief escapes a string for the use in a JSON string literal
+ *
+ * @param string
+ * @return std::string
+ */
+std::string TimingsTraceOutput::escape(const std::string_view string)
+{
+    std::string escaped;
+    escaped.reserve(string.size());
+
+    for (const auto character : string)
+    {
+        if (character == '"' || character == '\\')
+            escaped += '\\';
+
+        escaped += character;
+    }
+
+    return escaped;
+}
+
+/**
+ * @brief Write the recorded timings events as Chrome trace file
+ *
+ * @details the timer name is used as category of the events and all times
+ * are converted to µs as required by the trace event format
+ *
+ * @param timer The global timer object
+ */
+void TimingsTraceOutput::write(const GlobalTimer &timer)
+{
+    const auto nSections = TimingsRegistry::getNumberOfSections();
+
+    std::vector<std::string> sectionNames;
+    sectionNames.reserve(nSections);
+
+    for (size_t id = 0; id < nSections; ++id)
+        sectionNames.push_back(escape(TimingsRegistry::getName(id)));
+
+    std::vector<const Timer *> timers = {&timer.getSimulationTimer()};
+
+    for (const auto &executionTimer : timer.getTimers())
+        timers.push_back(&executionTimer);
+
+    std::set<size_t> trackIds;
+
+    _fp << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    auto separator = "\n";
+
+    for (const auto *executionTimer : timers)
+    {
+        const auto category = escape(executionTimer->getTimerName());
+
+        for (const auto &event : executionTimer->getEvents())
+        {
+            _fp << separator;
+            _fp << std::format(
+                "{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\","
+                "\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                sectionNames[event.sectionId],
+                category,
+                event.trackId,
+                event.start * 1e6,
+                event.duration * 1e6
+            );
+
+            separator = ",\n";
+            trackIds.insert(event.trackId);
+        }
+    }
+
+    for (const auto trackId : trackIds)
+    {
+        _fp << separator;
+        _fp << std::format(
+            "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},"
+            "\"args\":{{\"name\":\"Thread {}\"}}}}",
+            trackId,
+            trackId
+        );
+
+        separator = ",\n";
+    }
+
+    _fp << "\n]}\n" << std::flush;
+}
@@ -23,13 +23,9 @@
 #include "trajectoryOutput.hpp"
 
 #include <cstddef>   // for size_t
-#include <format>    // for format
-#include <ostream>   // for ofstream, basic_ostream, operator<<
-#include <sstream>   // for ostringstream
-#include <string>    // for operator<<
-#include <vector>    // for vector
+#include <ostream>   // for ofstream, flush
 
-#include "molecule.hpp"        // for Molecule
+#include "frameSnapshot.hpp"   // for FrameSnapshot
 #include "simulationBox.hpp"   // for SimulationBox
 #include "vector3d.hpp"        // for Vec3D
 
@@ -37,17 +33,18 @@ using namespace output;
 using namespace simulationBox;
 
 /**
- * @brief Write the header of a trajectory files
+ * @brief Write the header of a trajectory files into the output buffer
  *
- * @param simBox
+ * @param snapshot
  */
-void TrajectoryOutput::writeHeader(const SimulationBox &simBox)
+void TrajectoryOutput::writeHeader(const FrameSnapshot &snapshot)
 {
-    const auto  nAtoms    = simBox.getNumberOfAtoms();
-    const auto &boxDims   = simBox.getBoxDimensions();
-    const auto &boxAngles = simBox.getBoxAngles();
-
-    _fp << nAtoms << "  " << boxDims << "  " << boxAngles << '\n';
+    _buffer.appendInteger(snapshot.getNumberOfAtoms(), 0);
+    _buffer.append("  ");
+    _buffer.appendGeneral(snapshot.getBoxDimensions());
+    _buffer.append("  ");
+    _buffer.appendGeneral(snapshot.getBoxAngles());
+    _buffer.append('\n');
 }
 
 /**
@@ -57,126 +54,167 @@ void TrajectoryOutput::writeHeader(const SimulationBox &simBox)
  */
 void TrajectoryOutput::writeXyz(SimulationBox &simBox)
 {
-    std::ostringstream buffer;
+    FrameSnapshot snapshot;
+    snapshot.captureSimulationBox(simBox);
 
-    writeHeader(simBox);
-    buffer << '\n';
-
-    for (const auto &molecule : simBox.getMolecules())
-    {
-        const auto nAtoms = molecule.getNumberOfAtoms();
+    writeXyz(snapshot);
+}
 
-        for (size_t i = 0; i < nAtoms; ++i)
-        {
-            buffer << std::format("{:<5}\t", molecule.getAtomName(i));
+/**
+ * @brief Write velocities file
+ *
+ * @param simBox
+ */
+void TrajectoryOutput::writeVelocities(SimulationBox &simBox)
+{
+    FrameSnapshot snapshot;
+    snapshot.captureSimulationBox(simBox);
 
-            const auto &pos = molecule.getAtomPosition(i);
+    writeVelocities(snapshot);
+}
 
-            buffer << std::format("{:15.8f}\t", pos[0]);
-            buffer << std::format("{:15.8f}\t", pos[1]);
-            buffer << std::format("{:15.8f}\n", pos[2]);
-        }
-    }
+/**
+ * @brief Write forces file
+ *
+ * @param simBox
+ */
+void TrajectoryOutput::writeForces(SimulationBox &simBox)
+{
+    FrameSnapshot snapshot;
+    snapshot.captureSimulationBox(simBox);
 
-    // Write the buffer to the file
-    _fp << buffer.str();
-    _fp << std::flush;
+    writeForces(snapshot);
 }
 
 /**
- * @brief Write velocities file
+ * @brief Write charges file
  *
  * @param simBox
  */
-void TrajectoryOutput::writeVelocities(SimulationBox &simBox)
+void TrajectoryOutput::writeCharges(SimulationBox &simBox)
 {
-    std::ostringstream buffer;
-
-    writeHeader(simBox);
-    buffer << '\n';
+    FrameSnapshot snapshot;
+    snapshot.captureSimulationBox(simBox);
 
-    for (const auto &molecule : simBox.getMolecules())
-    {
-        const auto nAtoms = molecule.getNumberOfAtoms();
+    writeCharges(snapshot);
+}
 
-        for (size_t i = 0; i < nAtoms; ++i)
-        {
-            buffer << std::format("{:<5}\t", molecule.getAtomName(i));
+/**
+ * @brief Write xyz file from a frame snapshot
+ *
+ * @param snapshot
+ */
+void TrajectoryOutput::writeXyz(const FrameSnapshot &snapshot)
+{
+    writeHeader(snapshot);
+    _buffer.append('\n');
 
-            const auto &vel = molecule.getAtomVelocity(i);
+    const auto nAtoms = snapshot.getNumberOfAtoms();
 
-            buffer << std::format("{:20.8e}\t", vel[0]);
-            buffer << std::format("{:20.8e}\t", vel[1]);
-            buffer << std::format("{:20.8e}\n", vel[2]);
-        }
+    for (size_t i = 0; i < nAtoms; ++i)
+    {
+        const auto &pos = snapshot.getPosition(i);
+
+        _buffer.appendLeft(snapshot.getAtomName(i), 5);
+        _buffer.append('\t');
+        _buffer.appendFixed(pos[0], 15, 8);
+        _buffer.append('\t');
+        _buffer.appendFixed(pos[1], 15, 8);
+        _buffer.append('\t');
+        _buffer.appendFixed(pos[2], 15, 8);
+        _buffer.append('\n');
     }
 
     // Write the buffer to the file
-    _fp << buffer.str();
+    _buffer.writeTo(_fp);
     _fp << std::flush;
 }
 
 /**
- * @brief Write forces file
+ * @brief Write velocities file from a frame snapshot
  *
- * @param simBox
+ * @param snapshot
  */
-void TrajectoryOutput::writeForces(SimulationBox &simBox)
+void TrajectoryOutput::writeVelocities(const FrameSnapshot &snapshot)
 {
-    std::ostringstream buffer;
+    writeHeader(snapshot);
+    _buffer.append('\n');
 
-    writeHeader(simBox);
-    buffer << std::format(
-        "# Total force = {:.5e} kcal/mol/Angstrom\n",
-        simBox.calculateTotalForce()
-    );
+    const auto nAtoms = snapshot.getNumberOfAtoms();
 
-    for (const auto &molecule : simBox.getMolecules())
+    for (size_t i = 0; i < nAtoms; ++i)
     {
-        const auto nAtoms = molecule.getNumberOfAtoms();
+        const auto &vel = snapshot.getVelocity(i);
+
+        _buffer.appendLeft(snapshot.getAtomName(i), 5);
+        _buffer.append('\t');
+        _buffer.appendScientific(vel[0], 20, 8);
+        _buffer.append('\t');
+        _buffer.appendScientific(vel[1], 20, 8);
+        _buffer.append('\t');
+        _buffer.appendScientific(vel[2], 20, 8);
+        _buffer.append('\n');
+    }
 
-        for (size_t i = 0; i < nAtoms; ++i)
-        {
-            buffer << std::format("{:<5}\t", molecule.getAtomName(i));
+    // Write the buffer to the file
+    _buffer.writeTo(_fp);
+    _fp << std::flush;
+}
 
-            const auto &force = molecule.getAtomForce(i);
+/**
+ * @brief Write forces file from a frame snapshot
+ *
+ * @param snapshot
+ */
+void TrajectoryOutput::writeForces(const FrameSnapshot &snapshot)
+{
+    writeHeader(snapshot);
+    _buffer.append("# Total force = ");
+    _buffer.appendScientific(snapshot.getTotalForce(), 0, 5);
+    _buffer.append(" kcal/mol/Angstrom\n");
 
-            buffer << std::format("{:15.8f}\t", force[0]);
-            buffer << std::format("{:15.8f}\t", force[1]);
-            buffer << std::format("{:15.8f}\n", force[2]);
-        }
+    const auto nAtoms = snapshot.getNumberOfAtoms();
+
+    for (size_t i = 0; i < nAtoms; ++i)
+    {
+        const auto &force = snapshot.getForce(i);
+
+        _buffer.appendLeft(snapshot.getAtomName(i), 5);
+        _buffer.append('\t');
+        _buffer.appendFixed(force[0], 15, 8);
+        _buffer.append('\t');
+        _buffer.appendFixed(force[1], 15, 8);
+        _buffer.append('\t');
+        _buffer.appendFixed(force[2], 15, 8);
+        _buffer.append('\n');
     }
 
     // Write the buffer to the file
-    _fp << buffer.str();
+    _buffer.writeTo(_fp);
     _fp << std::flush;
 }
 
 /**
- * @brief Write charges file
+ * @brief Write charges file from a frame snapshot
  *
- * @param simBox
+ * @param snapshot
  */
-void TrajectoryOutput::writeCharges(SimulationBox &simBox)
+void TrajectoryOutput::writeCharges(const FrameSnapshot &snapshot)
 {
-    std::ostringstream buffer;
+    writeHeader(snapshot);
+    _buffer.append('\n');
 
-    writeHeader(simBox);
-    buffer << '\n';
+    const auto nAtoms = snapshot.getNumberOfAtoms();
 
-    for (const auto &molecule : simBox.getMolecules())
+    for (size_t i = 0; i < nAtoms; ++i)
     {
-        const auto nAtoms = molecule.getNumberOfAtoms();
-
-        for (size_t i = 0; i < nAtoms; ++i)
-        {
-            buffer << std::format("{:<5}\t", molecule.getAtomName(i));
-            buffer << std::format("{:15.8f}\n", molecule.getPartialCharge(i));
-            buffer << std::flush;
-        }
+        _buffer.appendLeft(snapshot.getAtomName(i), 5);
+        _buffer.append('\t');
+        _buffer.appendFixed(snapshot.getPartialCharge(i), 15, 8);
+        _buffer.append('\n');
     }
 
     // Write the buffer to the file
-    _fp << buffer.str();
+    _buffer.writeTo(_fp);
     _fp << std::flush;
-}
\ No newline at end of file
+}
@@ -22,17 +22,18 @@
 
 #include "virialOutput.hpp"
 
-#include <format>    // for format
-#include <fstream>   // for basic_ostream, ofstream
-#include <string>    // for operator<<
+#include <fstream>       // for ofstream
+#include <ostream>       // for flush
+#include <string_view>   // for string_view
 
-#include "physicalData.hpp"   // for PhysicalData
+#include "observableTable.hpp"   // for ObservableTable
+#include "physicalData.hpp"      // for PhysicalData
 
 using output::VirialOutput;
 using namespace physicalData;
 
 /**
- * @brief Write the virial output
+ * @brief visits all observables of the virial output in file order
  *
  * @details The virial output is written in the following format:
  * - step
@@ -46,23 +47,51 @@ using namespace physicalData;
  * - v_zy
  * - v_zz
  *
+ * @param data
+ * @param visit
+ */
+void VirialOutput::visitObservables(
+    const PhysicalData      &data,
+    const ObservableVisitor &visit
+)
+{
+    constexpr auto format =
+        ObservableFormat{ObservableNotation::SCIENTIFIC, 20, 5};
+
+    const auto tensor = data.getVirial();
+
+    visit("v_xx", format, tensor[0][0]);
+    visit("v_xy", format, tensor[0][1]);
+    visit("v_xz", format, tensor[0][2]);
+    visit("v_yx", format, tensor[1][0]);
+    visit("v_yy", format, tensor[1][1]);
+    visit("v_yz", format, tensor[1][2]);
+    visit("v_zx", format, tensor[2][0]);
+    visit("v_zy", format, tensor[2][1]);
+    visit("v_zz", format, tensor[2][2]);
+}
+
+/**
+ * @brief Write the virial output
+ *
+ * @details the columns are described in visitObservables
+ *
  * @param step
  * @param data
  */
 void VirialOutput::write(const size_t step, const PhysicalData &data)
 {
-    const auto virial = data.getVirial();
+    auto appendValue =
+        [this](std::string_view, const ObservableFormat &format, double value)
+    {
+        _buffer.append('\t');
+        ObservableTable::appendValue(_buffer, format, value);
+    };
 
-    _fp << std::format("{:10d}\t", step);
-    _fp << std::format("{:20.5e}\t", virial[0][0]);
-    _fp << std::format("{:20.5e}\t", virial[0][1]);
-    _fp << std::format("{:20.5e}\t", virial[0][2]);
-    _fp << std::format("{:20.5e}\t", virial[1][0]);
-    _fp << std::format("{:20.5e}\t", virial[1][1]);
-    _fp << std::format("{:20.5e}\t", virial[1][2]);
-    _fp << std::format("{:20.5e}\t", virial[2][0]);
-    _fp << std::format("{:20.5e}\t", virial[2][1]);
-    _fp << std::format("{:20.5e}\n", virial[2][2]);
+    _buffer.appendInteger(step, 10);
+    visitObservables(data, appendValue);
+    _buffer.append('\n');
 
+    _buffer.writeTo(_fp);
     _fp << std::flush;
-}
\ No newline at end of file
+}
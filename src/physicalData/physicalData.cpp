@@ -22,7 +22,7 @@
 
 #include "physicalData.hpp"
 
-#include <algorithm>   // for __for_each_fn
+#include <algorithm>   // for __for_each_fn, max
 #include <cstddef>     // for size_t
 
 #include "constants/conversionFactors.hpp"           // for _FS_TO_S_
@@ -41,43 +41,7 @@ using namespace constants;
  */
 void PhysicalData::calculateKinetics(SimulationBox &simulationBox)
 {
-    startTimingsSection("Calc Kinetics");
-
-    _momentum                  = Vec3D();
-    _kineticEnergyAtomicTensor = tensor3D();
-    _kinEnergyMolTensor        = tensor3D();
-
-    auto kinEnergyAndMomOfMol = [this](auto &molecule)
-    {
-        const auto numberOfAtoms   = molecule.getNumberOfAtoms();
-        auto       momentumSquared = tensor3D();
-
-        for (size_t i = 0; i < numberOfAtoms; ++i)
-        {
-            const auto velocities = molecule.getAtomVelocity(i);
-
-            const auto momentum = velocities * molecule.getAtomMass(i);
-
-            _momentum                  += momentum;
-            _kineticEnergyAtomicTensor += tensorProduct(momentum, velocities);
-            momentumSquared            += tensorProduct(momentum, momentum);
-        }
-
-        _kinEnergyMolTensor += momentumSquared / molecule.getMolMass();
-    };
-
-    std::ranges::for_each(simulationBox.getMolecules(), kinEnergyAndMomOfMol);
-
-    _kineticEnergyAtomicTensor *= _KINETIC_ENERGY_FACTOR_;
-    _kinEnergyMolTensor        *= _KINETIC_ENERGY_FACTOR_;
-    _kineticEnergy              = trace(_kineticEnergyAtomicTensor);
-
-    _angularMomentum  = simulationBox.calculateAngularMomentum(_momentum);
-    _angularMomentum *= _FS_TO_S_;
-
-    _momentum *= _FS_TO_S_;
-
-    stopTimingsSection("Calc Kinetics");
+    calculateKinetics(simulationBox, [](auto &, const size_t) {});
 }
 
 /**
@@ -140,19 +104,28 @@ void PhysicalData::updateAverages(const PhysicalData &physicalData)
     _upperDistanceConstraints += physicalData.getUpperDistanceConstraints();
 
     _ringPolymerEnergy += physicalData.getRingPolymerEnergy();
+
+    _nKineticsSkipped += physicalData._nKineticsSkipped;
+    _nVirialSkipped   += physicalData._nVirialSkipped;
 }
 
 /**
  * @brief calculates the average of all physicalData of last steps
  *
+ * @details the kinetic and virial observables are only averaged over the
+ * steps on which they were evaluated, see skipKinetics and skipVirial
+ *
  * @param outputFrequency
  */
 void PhysicalData::makeAverages(const double outputFrequency)
 {
+    const auto nKinetics = std::max(1.0, outputFrequency - _nKineticsSkipped);
+    const auto nVirial   = std::max(1.0, outputFrequency - _nVirialSkipped);
+
     _numberOfQMAtoms /= outputFrequency;
     _loopTime        /= outputFrequency;
 
-    _kineticEnergy         /= outputFrequency;
+    _kineticEnergy         /= nKinetics;
     _coulombEnergy         /= outputFrequency;
     _nonCoulombEnergy      /= outputFrequency;
     _intraCoulombEnergy    /= outputFrequency;
@@ -166,13 +139,13 @@ void PhysicalData::makeAverages(const double outputFrequency)
     _temperature /= outputFrequency;
     _volume      /= outputFrequency;
     _density     /= outputFrequency;
-    _virial      /= outputFrequency;
-    _pressure    /= outputFrequency;
+    _virial      /= nVirial;
+    _pressure    /= nVirial;
 
     _qmEnergy /= outputFrequency;
 
-    _momentum        /= outputFrequency;
-    _angularMomentum /= outputFrequency;
+    _momentum        /= nKinetics;
+    _angularMomentum /= nKinetics;
 
     _noseHooverMomentumEnergy /= outputFrequency;
     _noseHooverFrictionEnergy /= outputFrequency;
@@ -181,6 +154,9 @@ void PhysicalData::makeAverages(const double outputFrequency)
     _upperDistanceConstraints /= outputFrequency;
 
     _ringPolymerEnergy /= outputFrequency;
+
+    _nKineticsSkipped = 0.0;
+    _nVirialSkipped   = 0.0;
 }
 
 /**
@@ -221,6 +197,9 @@ void PhysicalData::reset()
     _upperDistanceConstraints = 0.0;
 
     _ringPolymerEnergy = 0.0;
+
+    _nKineticsSkipped = 0.0;
+    _nVirialSkipped   = 0.0;
 }
 
 /**
@@ -285,6 +264,42 @@ void PhysicalData::addIntraNonCoulombEnergy(const double intraNonCoulombEnergy)
     _nonCoulombEnergy      += intraNonCoulombEnergy;
 }
 
+/**
+ * @brief marks the kinetics of the current step as not evaluated
+ *
+ * @details the kinetic energy, momentum and angular momentum are zeroed and
+ * the step is excluded from their averages
+ */
+void PhysicalData::skipKinetics()
+{
+    _kineticEnergy   = 0.0;
+    _momentum        = {0.0, 0.0, 0.0};
+    _angularMomentum = {0.0, 0.0, 0.0};
+
+    _nKineticsSkipped = 1.0;
+}
+
+/**
+ * @brief marks the virial of the current step as not evaluated
+ *
+ * @details the virial and the pressure are zeroed and the step is excluded
+ * from their averages
+ */
+void PhysicalData::skipVirial()
+{
+    _virial   = {0.0};
+    _pressure = 0.0;
+
+    _nVirialSkipped = 1.0;
+}
+
+/**
+ * @brief checks if the kinetics of the current step were not evaluated
+ *
+ * @return true if skipKinetics was called since the last reset
+ */
+bool PhysicalData::isKineticsSkipped() const { return _nKineticsSkipped > 0.0; }
+
 /**
  * @brief change kinetic virial to atomic
  *
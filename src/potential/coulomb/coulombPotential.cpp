@@ -93,7 +93,7 @@ void CoulombPotential::setCoulombForceCutOff(const double coulombForceCutOff)
  *
  * @return double
  */
-double CoulombPotential::getCoulombRadiusCutOff()
+double CoulombPotential::getCoulombRadiusCutOff() const
 {
     return _coulombRadiusCutOff;
 }
@@ -103,7 +103,7 @@ double CoulombPotential::getCoulombRadiusCutOff()
  *
  * @return double
  */
-double CoulombPotential::getCoulombEnergyCutOff()
+double CoulombPotential::getCoulombEnergyCutOff() const
 {
     return _coulombEnergyCutOff;
 }
@@ -113,4 +113,7 @@ double CoulombPotential::getCoulombEnergyCutOff()
  *
  * @return double
  */
-double CoulombPotential::getCoulombForceCutOff() { return _coulombForceCutOff; }
\ No newline at end of file
+double CoulombPotential::getCoulombForceCutOff() const
+{
+    return _coulombForceCutOff;
+}
\ No newline at end of file
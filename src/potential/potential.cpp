@@ -37,6 +37,12 @@ using namespace simulationBox;
  * @brief inner part of the double loop to calculate non-bonded inter molecular
  * interactions
  *
+ * @details if computeForces is false only the energies are calculated and
+ * neither forces nor shift forces are stored. If computeShiftForces is false
+ * the forces are stored without the shift forces needed for the virial.
+ *
+ * @tparam computeForces
+ * @tparam computeShiftForces
  * @param box
  * @param molecule1
  * @param molecule2
@@ -44,6 +50,7 @@ using namespace simulationBox;
  * @param atom2
  * @return std::pair<double, double>
  */
+template <bool computeForces, bool computeShiftForces>
 std::pair<double, double> Potential::calculateSingleInteraction(
     const Box   &box,
     Molecule    &molecule1,
@@ -66,7 +73,7 @@ std::pair<double, double> Potential::calculateSingleInteraction(
 
     const double distanceSquared = normSquared(dxyz);
 
-    if (const auto RcCutOff = CoulombPotential::getCoulombRadiusCutOff();
+    if (const auto RcCutOff = _coulombPotential->getCoulombRadiusCutOff();
         distanceSquared < RcCutOff * RcCutOff)
     {
         const double distance   = ::sqrt(distanceSquared);
@@ -92,33 +99,179 @@ std::pair<double, double> Potential::calculateSingleInteraction(
         const auto charge_j         = molecule2.getPartialCharge(atomType_j);
         const auto coulombPreFactor = charge_i * charge_j;
 
-        auto [e, f] = _coulombPotential->calculate(distance, coulombPreFactor);
-        coulombEnergy = e;
-
         const auto nonCoulPair = _nonCoulombPot->getNonCoulPair(combinedIdx);
-        const auto rncCutOff   = nonCoulPair->getRadialCutOff();
 
-        if (distance < rncCutOff)
+        auto [coulE, nonCoulE, f] = calculatePairInteraction(
+            *_coulombPotential,
+            *nonCoulPair,
+            distance,
+            coulombPreFactor
+        );
+
+        coulombEnergy    = coulE;
+        nonCoulombEnergy = nonCoulE;
+
+        if constexpr (computeForces)
         {
-            const auto &[nonCoulE, nonCoulF] = nonCoulPair->calculate(distance);
-            nonCoulombEnergy                 = nonCoulE;
+            f /= distance;
+
+            const auto forcexyz = f * dxyz;
 
-            f += nonCoulF;
+            molecule1.addAtomForce(atom1, forcexyz);
+            molecule2.addAtomForce(atom2, -forcexyz);
+
+            if constexpr (computeShiftForces)
+                molecule1.addAtomShiftForce(atom1, forcexyz * txyz);
         }
+    }
+
+    return {coulombEnergy, nonCoulombEnergy};
+}
+
+template std::pair<double, double> Potential::calculateSingleInteraction<true>(
+    const Box &,
+    Molecule &,
+    Molecule &,
+    const size_t,
+    const size_t
+) const;
+
+template std::pair<double, double> Potential::
+    calculateSingleInteraction<true, false>(
+        const Box &,
+        Molecule &,
+        Molecule &,
+        const size_t,
+        const size_t
+    ) const;
+
+template std::pair<double, double> Potential::calculateSingleInteraction<false>(
+    const Box &,
+    Molecule &,
+    Molecule &,
+    const size_t,
+    const size_t
+) const;
+
+/**
+ * @brief Coulomb and non-Coulomb parts of a single inter molecular atom pair
+ *
+ * @details same pair as in calculateSingleInteraction, but the Coulomb and
+ * non-Coulomb forces on the first atom are returned separately and no force
+ * is stored in the molecules. This is used e.g. by the QM/MM engine, which
+ * only keeps parts of the MM interaction between QM and MM atoms.
+ *
+ * @param box
+ * @param molecule1
+ * @param molecule2
+ * @param atom1
+ * @param atom2
+ * @return PairInteraction zero if the pair is outside of the cut-off
+ */
+PairInteraction Potential::calculateSingleInteractionParts(
+    const Box   &box,
+    Molecule    &molecule1,
+    Molecule    &molecule2,
+    const size_t atom1,
+    const size_t atom2
+) const
+{
+    auto interaction = PairInteraction();
+
+    const auto xyz_i = molecule1.getAtomPosition(atom1);
+    const auto xyz_j = molecule2.getAtomPosition(atom2);
+
+    auto dxyz  = xyz_i - xyz_j;
+    dxyz      -= box.calcShiftVector(dxyz);
+
+    const double distanceSquared = normSquared(dxyz);
+    const auto   RcCutOff        = _coulombPotential->getCoulombRadiusCutOff();
+
+    if (distanceSquared >= RcCutOff * RcCutOff)
+        return interaction;
 
-        f /= distance;
+    const double distance   = ::sqrt(distanceSquared);
+    const size_t atomType_i = molecule1.getAtomType(atom1);
+    const size_t atomType_j = molecule2.getAtomType(atom2);
 
-        const auto forcexyz = f * dxyz;
+    const auto globalVdwType_i = molecule1.getInternalGlobalVDWType(atom1);
+    const auto globalVdwType_j = molecule2.getInternalGlobalVDWType(atom2);
 
-        const auto shiftForcexyz = forcexyz * txyz;
+    const auto moltype_i = molecule1.getMoltype();
+    const auto moltype_j = molecule2.getMoltype();
 
-        molecule1.addAtomForce(atom1, forcexyz);
-        molecule2.addAtomForce(atom2, -forcexyz);
+    const auto combinedIdx = {
+        moltype_i,
+        moltype_j,
+        atomType_i,
+        atomType_j,
+        globalVdwType_i,
+        globalVdwType_j
+    };
 
-        molecule1.addAtomShiftForce(atom1, shiftForcexyz);
+    const auto charge_i         = molecule1.getPartialCharge(atomType_i);
+    const auto charge_j         = molecule2.getPartialCharge(atomType_j);
+    const auto coulombPreFactor = charge_i * charge_j;
+
+    const auto [coulombEnergy, coulombForce] =
+        _coulombPotential->calculate(distance, coulombPreFactor);
+
+    interaction.coulombEnergy = coulombEnergy;
+    interaction.coulombForce  = coulombForce / distance * dxyz;
+
+    const auto nonCoulPair = _nonCoulombPot->getNonCoulPair(combinedIdx);
+
+    if (distance < nonCoulPair->getRadialCutOff())
+    {
+        const auto [nonCoulE, nonCoulF] = nonCoulPair->calculate(distance);
+
+        interaction.nonCoulombEnergy = nonCoulE;
+        interaction.nonCoulombForce  = nonCoulF / distance * dxyz;
     }
 
-    return {coulombEnergy, nonCoulombEnergy};
+    return interaction;
+}
+
+/**
+ * @brief pair kernel shared by the inter and intra molecular non-bonded
+ * interactions
+ *
+ * @details the Coulomb interaction is always evaluated, the non-Coulomb
+ * interaction only within the radial cut-off of the non-Coulomb pair. The
+ * scaling factors are used e.g. for 1-4 interactions.
+ *
+ * @param coulombPot
+ * @param nonCoulombPair
+ * @param distance
+ * @param chargeProduct
+ * @param coulombScale
+ * @param nonCoulombScale
+ * @return std::tuple<double, double, double> Coulomb energy, non-Coulomb
+ * energy and the scalar force
+ */
+std::tuple<double, double, double> Potential::calculatePairInteraction(
+    const CoulombPotential &coulombPot,
+    const NonCoulombPair   &nonCoulombPair,
+    const double            distance,
+    const double            chargeProduct,
+    const double            coulombScale,
+    const double            nonCoulombScale
+)
+{
+    auto [coulombEnergy, force]  = coulombPot.calculate(distance, chargeProduct);
+    coulombEnergy               *= coulombScale;
+    force                       *= coulombScale;
+
+    auto nonCoulombEnergy = 0.0;
+
+    if (distance < nonCoulombPair.getRadialCutOff())
+    {
+        auto [nonCoulE, nonCoulF]  = nonCoulombPair.calculate(distance);
+        nonCoulombEnergy           = nonCoulE * nonCoulombScale;
+        force                     += nonCoulF * nonCoulombScale;
+    }
+
+    return {coulombEnergy, nonCoulombEnergy, force};
 }
 
 /***************************
@@ -139,6 +292,19 @@ void Potential::setNonCoulombPotential(
     _nonCoulombPot = pot;
 }
 
+/**
+ * @brief set if the shift forces are accumulated in calculateForces
+ *
+ * @details the shift forces are only needed for the virial, therefore they
+ * can be skipped on steps where the virial is not required
+ *
+ * @param computeShiftForces
+ */
+void Potential::setComputeShiftForces(const bool computeShiftForces)
+{
+    _computeShiftForces = computeShiftForces;
+}
+
 /***************************
  *                         *
  * standard setter methods *
@@ -184,4 +350,11 @@ std::shared_ptr<NonCoulombPotential> Potential::getNonCoulombPotSharedPtr(
 ) const
 {
     return _nonCoulombPot;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief check if the shift forces are accumulated in calculateForces
+ *
+ * @return bool
+ */
+bool Potential::isComputeShiftForces() const { return _computeShiftForces; }
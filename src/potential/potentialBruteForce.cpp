@@ -44,11 +44,50 @@ PotentialBruteForce::~PotentialBruteForce() = default;
  *
  * @param simBox
  * @param physicalData
+ * @param cellList
  */
-inline void PotentialBruteForce::
-    calculateForces(SimulationBox &simBox, PhysicalData &physicalData, CellList &)
+void PotentialBruteForce::calculateForces(
+    SimulationBox &simBox,
+    PhysicalData  &physicalData,
+    CellList      &cellList
+)
 {
-    startTimingsSection("InterNonBonded");
+    if (_computeShiftForces)
+        calculate<true>(simBox, physicalData, cellList);
+    else
+        calculate<true, false>(simBox, physicalData, cellList);
+}
+
+/**
+ * @brief calculates only the coulombic and non-coulombic energy for brute
+ * force routine
+ *
+ * @param simBox
+ * @param physicalData
+ * @param cellList
+ */
+void PotentialBruteForce::calculateEnergy(
+    SimulationBox &simBox,
+    PhysicalData  &physicalData,
+    CellList      &cellList
+)
+{
+    calculate<false>(simBox, physicalData, cellList);
+}
+
+/**
+ * @brief brute force loop over all inter molecular atom pairs
+ *
+ * @tparam computeForces if false no forces are stored
+ * @tparam computeShiftForces if false no shift forces are stored
+ * @param simBox
+ * @param physicalData
+ */
+template <bool computeForces, bool computeShiftForces>
+void PotentialBruteForce::
+    calculate(SimulationBox &simBox, PhysicalData &physicalData, CellList &)
+{
+    startTimingsSection<"InterNonBonded">();
 
     const auto box = simBox.getBoxPtr();
 
@@ -73,7 +112,9 @@ inline void PotentialBruteForce::
                 for (size_t atom2 = 0; atom2 < nAtomsInMol_j; ++atom2)
                 {
                     const auto [coulombEnergy, nonCoulombEnergy] =
-                        calculateSingleInteraction(
+                        calculateSingleInteraction<
+                            computeForces,
+                            computeShiftForces>(
                             *box,
                             molecule_i,
                             molecule_j,
@@ -91,7 +132,7 @@ inline void PotentialBruteForce::
     physicalData.setCoulombEnergy(totalCoulombEnergy);
     physicalData.setNonCoulombEnergy(totalNonCoulombEnergy);
 
-    stopTimingsSection("InterNonBonded");
+    stopTimingsSection<"InterNonBonded">();
 }
 
 /**
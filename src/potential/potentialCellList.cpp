@@ -29,10 +29,12 @@
 #include "celllist.hpp"        // for CellList
 #include "physicalData.hpp"    // for PhysicalData
 #include "simulationBox.hpp"   // for SimulationBox
+#include "timer.hpp"           // for ScopedTimingsSection
 
 using namespace potential;
 using namespace simulationBox;
 using namespace physicalData;
+using namespace timings;
 
 /**
  * @brief Destroy the Potential Cell List:: Potential Cell List object
@@ -55,19 +57,60 @@ PotentialCellList::~PotentialCellList() = default;
  * @param physicalData
  * @param cellList
  */
-inline void PotentialCellList::calculateForces(
+void PotentialCellList::calculateForces(
     SimulationBox &simBox,
     PhysicalData  &physicalData,
     CellList      &cellList
 )
 {
-    startTimingsSection("InterNonBonded");
+    if (_computeShiftForces)
+        calculate<true>(simBox, physicalData, cellList);
+    else
+        calculate<true, false>(simBox, physicalData, cellList);
+}
+
+/**
+ * @brief calculates only the coulombic and non-coulombic energy for cell list
+ * routine
+ *
+ * @param simBox
+ * @param physicalData
+ * @param cellList
+ */
+void PotentialCellList::calculateEnergy(
+    SimulationBox &simBox,
+    PhysicalData  &physicalData,
+    CellList      &cellList
+)
+{
+    calculate<false>(simBox, physicalData, cellList);
+}
+
+/**
+ * @brief cell list loop over all inter molecular atom pairs
+ *
+ * @tparam computeForces if false no forces are stored
+ * @tparam computeShiftForces if false no shift forces are stored
+ * @param simBox
+ * @param physicalData
+ * @param cellList
+ */
+template <bool computeForces, bool computeShiftForces>
+void PotentialCellList::calculate(
+    SimulationBox &simBox,
+    PhysicalData  &physicalData,
+    CellList      &cellList
+)
+{
+    const ScopedTimingsSection scope(*this, sectionId<"InterNonBonded">());
 
     const auto box = simBox.getBoxPtr();
 
     double totalCoulombEnergy    = 0.0;
     double totalNonCoulombEnergy = 0.0;
 
+    startTimingsSection<"Intra Cell Pairs">();
+
     for (const auto &cell_i : cellList.getCells())
     {
         const auto nMols = cell_i.getNumberOfMolecules();
@@ -85,7 +128,9 @@ inline void PotentialCellList::calculateForces(
                     for (const size_t atom_j : cell_i.getAtomIndices(mol_j))
                     {
                         const auto [coulombEnergy, nonCoulombEnergy] =
-                            calculateSingleInteraction(
+                            calculateSingleInteraction<
+                                computeForces,
+                                computeShiftForces>(
                                 *box,
                                 *molecule_i,
                                 *molecule_j,
@@ -101,6 +146,9 @@ inline void PotentialCellList::calculateForces(
         }
     }
 
+    stopTimingsSection<"Intra Cell Pairs">();
+    startTimingsSection<"Neighbour Cell Pairs">();
+
     for (const auto &cell_i : cellList.getCells())
     {
         const auto nMolsInCell_i = cell_i.getNumberOfMolecules();
@@ -125,7 +173,9 @@ inline void PotentialCellList::calculateForces(
                         for (const auto atom_j : cell_j->getAtomIndices(mol_j))
                         {
                             const auto [coulombEnergy, nonCoulombEnergy] =
-                                calculateSingleInteraction(
+                                calculateSingleInteraction<
+                                    computeForces,
+                                    computeShiftForces>(
                                     *box,
                                     *molecule_i,
                                     *molecule_j,
@@ -142,10 +192,10 @@ inline void PotentialCellList::calculateForces(
         }
     }
 
+    stopTimingsSection<"Neighbour Cell Pairs">();
+
     physicalData.setCoulombEnergy(totalCoulombEnergy);
     physicalData.setNonCoulombEnergy(totalNonCoulombEnergy);
-
-    stopTimingsSection("InterNonBonded");
 }
 
 /**
@@ -50,7 +50,7 @@ void KokkosPotential::calculateForces(
     const KokkosCoulombWolf  &coulombWolf
 )
 {
-    startTimingsSection("InterNonBonded - Transfer");
+    startTimingsSection<"InterNonBonded - Transfer">();
 
     // set total coulombic and non-coulombic energy
     double totalCoulombEnergy    = 0.0;
@@ -74,9 +74,9 @@ void KokkosPotential::calculateForces(
 
     const auto rcCutoff = coulombWolf.getCoulombRadiusCutOff();
 
-    stopTimingsSection("InterNonBonded - Transfer");
+    stopTimingsSection<"InterNonBonded - Transfer">();
 
-    startTimingsSection("InterNonBonded");
+    startTimingsSection<"InterNonBonded">();
 
     Kokkos::parallel_reduce(
         "Reduction",
@@ -171,9 +171,9 @@ void KokkosPotential::calculateForces(
         totalNonCoulombEnergy
     );
 
-    stopTimingsSection("InterNonBonded");
+    stopTimingsSection<"InterNonBonded">();
 
-    startTimingsSection("InterNonBonded - Transfer");
+    startTimingsSection<"InterNonBonded - Transfer">();
 
     // half energy because of double counting
     totalCoulombEnergy    *= 0.5;
@@ -186,5 +186,5 @@ void KokkosPotential::calculateForces(
     physicalData.setCoulombEnergy(totalCoulombEnergy);
     physicalData.setNonCoulombEnergy(totalNonCoulombEnergy);
 
-    stopTimingsSection("InterNonBonded - Transfer");
+    stopTimingsSection<"InterNonBonded - Transfer">();
 }
@@ -81,7 +81,7 @@ void ResetKinetics::reset(
     SimulationBox &simBox
 )
 {
-    startTimingsSection("Reset Kinetics");
+    startTimingsSection<"Reset Kinetics">();
 
     _momentum        = data.getMomentum() * _S_TO_FS_;
     _angularMomentum = data.getAngularMomentum() * _S_TO_FS_;
@@ -113,7 +113,28 @@ void ResetKinetics::reset(
     data.setMomentum(_momentum * _FS_TO_S_);
     data.setAngularMomentum(_angularMomentum * _FS_TO_S_);
 
-    stopTimingsSection("Reset Kinetics");
+    stopTimingsSection<"Reset Kinetics">();
+}
+
+/**
+ * @brief checks if any reset is performed in the given step
+ *
+ * @details the reset needs the momentum and angular momentum of the current
+ * step, which are therefore only required on these steps
+ *
+ * @param step
+ * @return true if temperature, momentum or angular momentum are reset
+ */
+bool ResetKinetics::isResetStep(const size_t step) const
+{
+    auto isReset = (step <= _nStepsTemperatureReset);
+    isReset      = isReset || (0 == step % _frequencyTemperatureReset);
+    isReset      = isReset || (step <= _nStepsMomentumReset);
+    isReset      = isReset || (0 == step % _frequencyMomentumReset);
+    isReset      = isReset || (step <= _nStepsAngularReset);
+    isReset      = isReset || (0 == step % _frequencyAngularReset);
+
+    return isReset;
 }
 
 /**
@@ -22,8 +22,20 @@
 
 #include "constraintSettings.hpp"
 
+#include "settingsInstance.hpp"   // for SettingsInstance
+
 using namespace settings;
 
+/**
+ * @brief get the constraint settings state of the active settings instance
+ *
+ * @return ConstraintSettings::State&
+ */
+ConstraintSettings::State &ConstraintSettings::state()
+{
+    return SettingsInstance::getActive().getConstraintSettings();
+}
+
 /*****************************
  *                           *
  * standard activate methods *
@@ -34,25 +46,25 @@ using namespace settings;
  * @brief activate the shake algorithm
  *
  */
-void ConstraintSettings::activateShake() { _shakeActive = true; }
+void ConstraintSettings::activateShake() { state()._shakeActive = true; }
 
 /**
  * @brief deactivate the shake algorithm
  *
  */
-void ConstraintSettings::deactivateShake() { _shakeActive = false; }
+void ConstraintSettings::deactivateShake() { state()._shakeActive = false; }
 
 /**
  * @brief activate the M-shake algorithm
  *
  */
-void ConstraintSettings::activateMShake() { _mShakeActive = true; }
+void ConstraintSettings::activateMShake() { state()._mShakeActive = true; }
 
 /**
  * @brief deactivate the M-shake algorithm
  *
  */
-void ConstraintSettings::deactivateMShake() { _mShakeActive = false; }
+void ConstraintSettings::deactivateMShake() { state()._mShakeActive = false; }
 
 /**
  * @brief activate the distance constraints
@@ -60,7 +72,7 @@ void ConstraintSettings::deactivateMShake() { _mShakeActive = false; }
  */
 void ConstraintSettings::activateDistanceConstraints()
 {
-    _distanceConstsActive = true;
+    state()._distanceConstsActive = true;
 }
 
 /**
@@ -69,7 +81,7 @@ void ConstraintSettings::activateDistanceConstraints()
  */
 void ConstraintSettings::deactivateDistanceConstraints()
 {
-    _distanceConstsActive = false;
+    state()._distanceConstsActive = false;
 }
 
 /*****************************
@@ -83,14 +95,14 @@ void ConstraintSettings::deactivateDistanceConstraints()
  *
  * @return true if shake is activated
  */
-bool ConstraintSettings::isShakeActivated() { return _shakeActive; }
+bool ConstraintSettings::isShakeActivated() { return state()._shakeActive; }
 
 /**
  * @brief check if the M-shake algorithm is activated
  *
  * @return true if M-shake is activated
  */
-bool ConstraintSettings::isMShakeActivated() { return _mShakeActive; }
+bool ConstraintSettings::isMShakeActivated() { return state()._mShakeActive; }
 
 /**
  * @brief check if the distance constraints are activated
@@ -99,7 +111,7 @@ bool ConstraintSettings::isMShakeActivated() { return _mShakeActive; }
  */
 bool ConstraintSettings::isDistanceConstraintsActivated()
 {
-    return _distanceConstsActive;
+    return state()._distanceConstsActive;
 }
 
 /**
@@ -107,28 +119,34 @@ bool ConstraintSettings::isDistanceConstraintsActivated()
  *
  * @return the maximum number of iterations
  */
-size_t ConstraintSettings::getShakeMaxIter() { return _shakeMaxIter; }
+size_t ConstraintSettings::getShakeMaxIter() { return state()._shakeMaxIter; }
 
 /**
  * @brief get the maximum number of iterations for the rattle algorithm
  *
  * @return the maximum number of iterations
  */
-size_t ConstraintSettings::getRattleMaxIter() { return _rattleMaxIter; }
+size_t ConstraintSettings::getRattleMaxIter() { return state()._rattleMaxIter; }
 
 /**
  * @brief get the tolerance for the shake algorithm
  *
  * @return the tolerance
  */
-double ConstraintSettings::getShakeTolerance() { return _shakeTolerance; }
+double ConstraintSettings::getShakeTolerance()
+{
+    return state()._shakeTolerance;
+}
 
 /**
  * @brief get the tolerance for the rattle algorithm
  *
  * @return the tolerance
  */
-double ConstraintSettings::getRattleTolerance() { return _rattleTolerance; }
+double ConstraintSettings::getRattleTolerance()
+{
+    return state()._rattleTolerance;
+}
 
 /*****************************
  *                           *
@@ -143,7 +161,7 @@ double ConstraintSettings::getRattleTolerance() { return _rattleTolerance; }
  */
 void ConstraintSettings::setShakeMaxIter(const size_t shakeMaxIter)
 {
-    _shakeMaxIter = shakeMaxIter;
+    state()._shakeMaxIter = shakeMaxIter;
 }
 
 /**
@@ -153,7 +171,7 @@ void ConstraintSettings::setShakeMaxIter(const size_t shakeMaxIter)
  */
 void ConstraintSettings::setRattleMaxIter(const size_t rattleMaxIter)
 {
-    _rattleMaxIter = rattleMaxIter;
+    state()._rattleMaxIter = rattleMaxIter;
 }
 
 /**
@@ -163,7 +181,7 @@ void ConstraintSettings::setRattleMaxIter(const size_t rattleMaxIter)
  */
 void ConstraintSettings::setShakeTolerance(const double shakeTolerance)
 {
-    _shakeTolerance = shakeTolerance;
+    state()._shakeTolerance = shakeTolerance;
 }
 
 /**
@@ -173,5 +191,5 @@ void ConstraintSettings::setShakeTolerance(const double shakeTolerance)
  */
 void ConstraintSettings::setRattleTolerance(const double rattleTolerance)
 {
-    _rattleTolerance = rattleTolerance;
+    state()._rattleTolerance = rattleTolerance;
 }
\ No newline at end of file
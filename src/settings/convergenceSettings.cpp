@@ -23,10 +23,21 @@
 #include "convergenceSettings.hpp"
 
 #include "exceptions.hpp"
+#include "settingsInstance.hpp"
 
 using namespace settings;
 using namespace customException;
 
+/**
+ * @brief get the convergence settings state of the active settings instance
+ *
+ * @return ConvSettings::State&
+ */
+ConvSettings::State &ConvSettings::state()
+{
+    return SettingsInstance::getActive().getConvSettings();
+}
+
 /**
  * @brief returns the convergence strategy as string
  *
@@ -98,7 +109,7 @@ ConvStrategy ConvSettings::getConvStrategy(const std::string_view &strategy)
  */
 void ConvSettings::setEnergyConv(const double energyConv)
 {
-    _energyConv = energyConv;
+    state()._energyConv = energyConv;
 }
 
 /**
@@ -108,7 +119,7 @@ void ConvSettings::setEnergyConv(const double energyConv)
  */
 void ConvSettings::setRelEnergyConv(const double relEnergyConv)
 {
-    _relEnergyConv = relEnergyConv;
+    state()._relEnergyConv = relEnergyConv;
 }
 
 /**
@@ -118,7 +129,7 @@ void ConvSettings::setRelEnergyConv(const double relEnergyConv)
  */
 void ConvSettings::setAbsEnergyConv(const double absEnergyConv)
 {
-    _absEnergyConv = absEnergyConv;
+    state()._absEnergyConv = absEnergyConv;
 }
 
 /**
@@ -132,7 +143,7 @@ void ConvSettings::setAbsEnergyConv(const double absEnergyConv)
  */
 void ConvSettings::setForceConv(const double forceConv)
 {
-    _forceConv = forceConv;
+    state()._forceConv = forceConv;
 }
 
 /**
@@ -145,7 +156,7 @@ void ConvSettings::setForceConv(const double forceConv)
  */
 void ConvSettings::setMaxForceConv(const double maxForceConv)
 {
-    _maxForceConv = maxForceConv;
+    state()._maxForceConv = maxForceConv;
 }
 
 /**
@@ -158,7 +169,7 @@ void ConvSettings::setMaxForceConv(const double maxForceConv)
  */
 void ConvSettings::setRMSForceConv(const double rmsForceConv)
 {
-    _rmsForceConv = rmsForceConv;
+    state()._rmsForceConv = rmsForceConv;
 }
 
 /**
@@ -168,7 +179,7 @@ void ConvSettings::setRMSForceConv(const double rmsForceConv)
  */
 void ConvSettings::setUseEnergyConv(const bool useEnergyConvergence)
 {
-    _useEnergyConv = useEnergyConvergence;
+    state()._useEnergyConv = useEnergyConvergence;
 }
 
 /**
@@ -178,7 +189,7 @@ void ConvSettings::setUseEnergyConv(const bool useEnergyConvergence)
  */
 void ConvSettings::setUseForceConv(const bool useForceConvergence)
 {
-    _useForceConv = useForceConvergence;
+    state()._useForceConv = useForceConvergence;
 }
 
 /**
@@ -188,7 +199,7 @@ void ConvSettings::setUseForceConv(const bool useForceConvergence)
  */
 void ConvSettings::setUseMaxForceConv(const bool useMaxForceConvergence)
 {
-    _useMaxForceConv = useMaxForceConvergence;
+    state()._useMaxForceConv = useMaxForceConvergence;
 }
 
 /**
@@ -198,7 +209,7 @@ void ConvSettings::setUseMaxForceConv(const bool useMaxForceConvergence)
  */
 void ConvSettings::setUseRMSForceConv(const bool useRMSForceConvergence)
 {
-    _useRMSForceConv = useRMSForceConvergence;
+    state()._useRMSForceConv = useRMSForceConvergence;
 }
 
 /**
@@ -208,7 +219,7 @@ void ConvSettings::setUseRMSForceConv(const bool useRMSForceConvergence)
  */
 void ConvSettings::setEnergyConvStrategy(const ConvStrategy strategy)
 {
-    _energyConvStrategy = strategy;
+    state()._energyConvStrategy = strategy;
 }
 
 /**
@@ -218,7 +229,7 @@ void ConvSettings::setEnergyConvStrategy(const ConvStrategy strategy)
  */
 void ConvSettings::setEnergyConvStrategy(const std::string_view &strategy)
 {
-    _energyConvStrategy = getConvStrategy(strategy);
+    state()._energyConvStrategy = getConvStrategy(strategy);
 }
 
 /***************************
@@ -232,7 +243,10 @@ void ConvSettings::setEnergyConvStrategy(const std::string_view &strategy)
  *
  * @return std::optional<double>
  */
-std::optional<double> ConvSettings::getEnergyConv() { return _energyConv; }
+std::optional<double> ConvSettings::getEnergyConv()
+{
+    return state()._energyConv;
+}
 
 /**
  * @brief get relative energy convergence
@@ -241,7 +255,7 @@ std::optional<double> ConvSettings::getEnergyConv() { return _energyConv; }
  */
 std::optional<double> ConvSettings::getRelEnergyConv()
 {
-    return _relEnergyConv;
+    return state()._relEnergyConv;
 }
 
 /**
@@ -251,7 +265,7 @@ std::optional<double> ConvSettings::getRelEnergyConv()
  */
 std::optional<double> ConvSettings::getAbsEnergyConv()
 {
-    return _absEnergyConv;
+    return state()._absEnergyConv;
 }
 
 /**
@@ -259,49 +273,58 @@ std::optional<double> ConvSettings::getAbsEnergyConv()
  *
  * @return std::optional<double>
  */
-std::optional<double> ConvSettings::getForceConv() { return _forceConv; }
+std::optional<double> ConvSettings::getForceConv()
+{
+    return state()._forceConv;
+}
 
 /**
  * @brief get max force convergence
  *
  * @return std::optional<double>
  */
-std::optional<double> ConvSettings::getMaxForceConv() { return _maxForceConv; }
+std::optional<double> ConvSettings::getMaxForceConv()
+{
+    return state()._maxForceConv;
+}
 
 /**
  * @brief get rms force convergence
  *
  * @return std::optional<double>
  */
-std::optional<double> ConvSettings::getRMSForceConv() { return _rmsForceConv; }
+std::optional<double> ConvSettings::getRMSForceConv()
+{
+    return state()._rmsForceConv;
+}
 
 /**
  * @brief get use energy convergence
  *
  * @return bool
  */
-bool ConvSettings::getUseEnergyConv() { return _useEnergyConv; }
+bool ConvSettings::getUseEnergyConv() { return state()._useEnergyConv; }
 
 /**
  * @brief get use force convergence
  *
  * @return bool
  */
-bool ConvSettings::getUseForceConv() { return _useForceConv; }
+bool ConvSettings::getUseForceConv() { return state()._useForceConv; }
 
 /**
  * @brief get use max force convergence
  *
  * @return bool
  */
-bool ConvSettings::getUseMaxForceConv() { return _useMaxForceConv; }
+bool ConvSettings::getUseMaxForceConv() { return state()._useMaxForceConv; }
 
 /**
  * @brief get use rms force convergence
  *
  * @return bool
  */
-bool ConvSettings::getUseRMSForceConv() { return _useRMSForceConv; }
+bool ConvSettings::getUseRMSForceConv() { return state()._useRMSForceConv; }
 
 /**
  * @brief get energy convergence strategy
@@ -310,7 +333,7 @@ bool ConvSettings::getUseRMSForceConv() { return _useRMSForceConv; }
  */
 std::optional<ConvStrategy> ConvSettings::getEnConvStrategy()
 {
-    return _energyConvStrategy;
+    return state()._energyConvStrategy;
 }
 
 /**
@@ -320,5 +343,5 @@ std::optional<ConvStrategy> ConvSettings::getEnConvStrategy()
  */
 ConvStrategy ConvSettings::getDefaultEnergyConvStrategy()
 {
-    return getConvStrategy(_defaultEnergyConvStrategy);
+    return getConvStrategy(state()._defaultEnergyConvStrategy);
 }
\ No newline at end of file
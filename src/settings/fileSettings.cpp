@@ -22,9 +22,21 @@
 
 #include "fileSettings.hpp"
 
+#include "settingsInstance.hpp"   // for SettingsInstance
+
 using namespace settings;
 using namespace defaults;
 
+/**
+ * @brief get the file settings state of the active settings instance
+ *
+ * @return FileSettings::State&
+ */
+FileSettings::State &FileSettings::state()
+{
+    return SettingsInstance::getActive().getFileSettings();
+}
+
 /***************************
  *                         *
  * standard getter methods *
@@ -38,7 +50,7 @@ using namespace defaults;
  */
 std::string FileSettings::getMolDescriptorFileName()
 {
-    return _molDescriptorFile;
+    return state()._molDescriptorFile;
 }
 
 /**
@@ -46,21 +58,27 @@ std::string FileSettings::getMolDescriptorFileName()
  *
  * @return std::string
  */
-std::string FileSettings::getGuffDatFileName() { return _guffDatFile; }
+std::string FileSettings::getGuffDatFileName() { return state()._guffDatFile; }
 
 /**
  * @brief Get the topology file name
  *
  * @return std::string
  */
-std::string FileSettings::getTopologyFileName() { return _topologyFile; }
+std::string FileSettings::getTopologyFileName()
+{
+    return state()._topologyFile;
+}
 
 /**
  * @brief Get the parameter file name
  *
  * @return std::string
  */
-std::string FileSettings::getParameterFilename() { return _parameterFile; }
+std::string FileSettings::getParameterFilename()
+{
+    return state()._parameterFile;
+}
 
 /**
  * @brief Get the intra non bonded file name
@@ -69,7 +87,7 @@ std::string FileSettings::getParameterFilename() { return _parameterFile; }
  */
 std::string FileSettings::getIntraNonBondedFileName()
 {
-    return _intraNonBondedFile;
+    return state()._intraNonBondedFile;
 }
 
 /**
@@ -77,7 +95,7 @@ std::string FileSettings::getIntraNonBondedFileName()
  *
  * @return std::string
  */
-std::string FileSettings::getStartFileName() { return _startFile; }
+std::string FileSettings::getStartFileName() { return state()._startFile; }
 
 /**
  * @brief Get the ring polymer start file name
@@ -86,7 +104,7 @@ std::string FileSettings::getStartFileName() { return _startFile; }
  */
 std::string FileSettings::getRingPolymerStartFileName()
 {
-    return _rpmdStartFile;
+    return state()._rpmdStartFile;
 }
 
 /**
@@ -94,28 +112,34 @@ std::string FileSettings::getRingPolymerStartFileName()
  *
  * @return std::string
  */
-std::string FileSettings::getMShakeFileName() { return _mShakeFile; }
+std::string FileSettings::getMShakeFileName() { return state()._mShakeFile; }
 
 /**
  * @brief Get the DFTB setup file name
  *
  * @return std::string
  */
-std::string FileSettings::getDFTBFileName() { return _dftbFile; }
+std::string FileSettings::getDFTBFileName() { return state()._dftbFile; }
 
 /**
  * @brief Check if the topology file name is set
  *
  * @return bool
  */
-bool FileSettings::isTopologyFileNameSet() { return _isTopologyFileSet; }
+bool FileSettings::isTopologyFileNameSet()
+{
+    return state()._isTopologyFileSet;
+}
 
 /**
  * @brief Check if the parameter file name is set
  *
  * @return bool
  */
-bool FileSettings::isParameterFileNameSet() { return _isParameterFileSet; }
+bool FileSettings::isParameterFileNameSet()
+{
+    return state()._isParameterFileSet;
+}
 
 /**
  * @brief Check if the intra non bonded file name is set
@@ -124,7 +148,7 @@ bool FileSettings::isParameterFileNameSet() { return _isParameterFileSet; }
  */
 bool FileSettings::isIntraNonBondedFileNameSet()
 {
-    return _isIntraNonBondedFileSet;
+    return state()._isIntraNonBondedFileSet;
 }
 
 /**
@@ -134,7 +158,7 @@ bool FileSettings::isIntraNonBondedFileNameSet()
  */
 bool FileSettings::isRingPolymerStartFileNameSet()
 {
-    return _isRPMDStartFileSet;
+    return state()._isRPMDStartFileSet;
 }
 
 /**
@@ -142,14 +166,14 @@ bool FileSettings::isRingPolymerStartFileNameSet()
  *
  * @return bool
  */
-bool FileSettings::isMShakeFileNameSet() { return _isMShakeFileSet; }
+bool FileSettings::isMShakeFileNameSet() { return state()._isMShakeFileSet; }
 
 /**
  * @brief Check if the DFTB setup file name is set
  *
  * @return bool
  */
-bool FileSettings::isDFTBFileNameSet() { return _isDFTBFileSet; }
+bool FileSettings::isDFTBFileNameSet() { return state()._isDFTBFileSet; }
 
 /***************************
  *                         *
@@ -164,7 +188,7 @@ bool FileSettings::isDFTBFileNameSet() { return _isDFTBFileSet; }
  */
 void FileSettings::setMolDescriptorFileName(const std::string_view name)
 {
-    FileSettings::_molDescriptorFile = name;
+    state()._molDescriptorFile = name;
 }
 
 /**
@@ -174,7 +198,7 @@ void FileSettings::setMolDescriptorFileName(const std::string_view name)
  */
 void FileSettings::setGuffDatFileName(const std::string_view name)
 {
-    FileSettings::_guffDatFile = name;
+    state()._guffDatFile = name;
 }
 
 /**
@@ -184,7 +208,7 @@ void FileSettings::setGuffDatFileName(const std::string_view name)
  */
 void FileSettings::setTopologyFileName(const std::string_view name)
 {
-    FileSettings::_topologyFile = name;
+    state()._topologyFile = name;
 }
 
 /**
@@ -194,7 +218,7 @@ void FileSettings::setTopologyFileName(const std::string_view name)
  */
 void FileSettings::setParameterFileName(const std::string_view name)
 {
-    FileSettings::_parameterFile = name;
+    state()._parameterFile = name;
 }
 
 /**
@@ -204,7 +228,7 @@ void FileSettings::setParameterFileName(const std::string_view name)
  */
 void FileSettings::setIntraNonBondedFileName(const std::string_view name)
 {
-    FileSettings::_intraNonBondedFile = name;
+    state()._intraNonBondedFile = name;
 }
 
 /**
@@ -214,7 +238,7 @@ void FileSettings::setIntraNonBondedFileName(const std::string_view name)
  */
 void FileSettings::setStartFileName(const std::string_view name)
 {
-    FileSettings::_startFile = name;
+    state()._startFile = name;
 }
 
 /**
@@ -224,7 +248,7 @@ void FileSettings::setStartFileName(const std::string_view name)
  */
 void FileSettings::setRingPolymerStartFileName(const std::string_view name)
 {
-    FileSettings::_rpmdStartFile = name;
+    state()._rpmdStartFile = name;
 }
 
 /**
@@ -234,7 +258,7 @@ void FileSettings::setRingPolymerStartFileName(const std::string_view name)
  */
 void FileSettings::setMShakeFileName(const std::string_view name)
 {
-    FileSettings::_mShakeFile = name;
+    state()._mShakeFile = name;
 }
 
 /**
@@ -244,7 +268,7 @@ void FileSettings::setMShakeFileName(const std::string_view name)
  */
 void FileSettings::setDFTBFileName(const std::string_view name)
 {
-    FileSettings::_dftbFile = name;
+    state()._dftbFile = name;
 }
 
 /**
@@ -253,7 +277,7 @@ void FileSettings::setDFTBFileName(const std::string_view name)
  */
 void FileSettings::setIsTopologyFileNameSet()
 {
-    FileSettings::_isTopologyFileSet = true;
+    state()._isTopologyFileSet = true;
 }
 
 /**
@@ -262,7 +286,7 @@ void FileSettings::setIsTopologyFileNameSet()
  */
 void FileSettings::setIsParameterFileNameSet()
 {
-    FileSettings::_isParameterFileSet = true;
+    state()._isParameterFileSet = true;
 }
 
 /**
@@ -271,7 +295,7 @@ void FileSettings::setIsParameterFileNameSet()
  */
 void FileSettings::setIsIntraNonBondedFileNameSet()
 {
-    FileSettings::_isIntraNonBondedFileSet = true;
+    state()._isIntraNonBondedFileSet = true;
 }
 
 /**
@@ -280,7 +304,7 @@ void FileSettings::setIsIntraNonBondedFileNameSet()
  */
 void FileSettings::setIsRingPolymerStartFileNameSet()
 {
-    FileSettings::_isRPMDStartFileSet = true;
+    state()._isRPMDStartFileSet = true;
 }
 
 /**
@@ -289,7 +313,7 @@ void FileSettings::setIsRingPolymerStartFileNameSet()
  */
 void FileSettings::setIsMShakeFileNameSet()
 {
-    FileSettings::_isMShakeFileSet = true;
+    state()._isMShakeFileSet = true;
 }
 
 /**
@@ -298,7 +322,7 @@ void FileSettings::setIsMShakeFileNameSet()
  */
 void FileSettings::setIsDFTBFileNameSet()
 {
-    FileSettings::_isDFTBFileSet = true;
+    state()._isDFTBFileSet = true;
 }
 
 /**
@@ -307,7 +331,7 @@ void FileSettings::setIsDFTBFileNameSet()
  */
 void FileSettings::unsetIsTopologyFileNameSet()
 {
-    FileSettings::_isTopologyFileSet = false;
+    state()._isTopologyFileSet = false;
 }
 
 /**
@@ -316,7 +340,7 @@ void FileSettings::unsetIsTopologyFileNameSet()
  */
 void FileSettings::unsetIsParameterFileNameSet()
 {
-    FileSettings::_isParameterFileSet = false;
+    state()._isParameterFileSet = false;
 }
 
 /**
@@ -325,7 +349,7 @@ void FileSettings::unsetIsParameterFileNameSet()
  */
 void FileSettings::unsetIsIntraNonBondedFileNameSet()
 {
-    FileSettings::_isIntraNonBondedFileSet = false;
+    state()._isIntraNonBondedFileSet = false;
 }
 
 /**
@@ -334,7 +358,7 @@ void FileSettings::unsetIsIntraNonBondedFileNameSet()
  */
 void FileSettings::unsetIsRingPolymerStartFileNameSet()
 {
-    FileSettings::_isRPMDStartFileSet = false;
+    state()._isRPMDStartFileSet = false;
 }
 
 /**
@@ -343,7 +367,7 @@ void FileSettings::unsetIsRingPolymerStartFileNameSet()
  */
 void FileSettings::unsetIsMShakeFileNameSet()
 {
-    FileSettings::_isMShakeFileSet = false;
+    state()._isMShakeFileSet = false;
 }
 
 /**
@@ -352,5 +376,5 @@ void FileSettings::unsetIsMShakeFileNameSet()
  */
 void FileSettings::unsetIsDFTBFileNameSet()
 {
-    FileSettings::_isDFTBFileSet = false;
+    state()._isDFTBFileSet = false;
 }
\ No newline at end of file
@@ -22,8 +22,20 @@
 
 #include "forceFieldSettings.hpp"
 
+#include "settingsInstance.hpp"   // for SettingsInstance
+
 using namespace settings;
 
+/**
+ * @brief get the force field settings state of the active settings instance
+ *
+ * @return ForceFieldSettings::State&
+ */
+ForceFieldSettings::State &ForceFieldSettings::state()
+{
+    return SettingsInstance::getActive().getForceFieldSettings();
+}
+
 /********************
  * standard getters *
  ********************/
@@ -33,7 +45,7 @@ using namespace settings;
  *
  * @return ForceFieldType
  */
-bool ForceFieldSettings::isActive() { return _active; }
+bool ForceFieldSettings::isActive() { return state()._active; }
 
 /********************
  * standard setters *
@@ -43,10 +55,10 @@ bool ForceFieldSettings::isActive() { return _active; }
  * @brief set the force field active
  *
  */
-void ForceFieldSettings::activate() { _active = true; }
+void ForceFieldSettings::activate() { state()._active = true; }
 
 /**
  * @brief set the force field inactive
  *
  */
-void ForceFieldSettings::deactivate() { _active = false; }
\ No newline at end of file
+void ForceFieldSettings::deactivate() { state()._active = false; }
\ No newline at end of file
@@ -22,8 +22,20 @@
 
 #include "hybridSettings.hpp"
 
+#include "settingsInstance.hpp"   // for SettingsInstance
+
 using settings::HybridSettings;
 
+/**
+ * @brief get the hybrid settings state of the active settings instance
+ *
+ * @return HybridSettings::State&
+ */
+HybridSettings::State &HybridSettings::state()
+{
+    return SettingsInstance::getActive().getHybridSettings();
+}
+
 /********************
  *                  *
  * standard setters *
@@ -40,7 +52,7 @@ using settings::HybridSettings;
  */
 void HybridSettings::setCoreCenterString(const std::string_view coreCenter)
 {
-    _coreCenterString = coreCenter;
+    state()._coreCenterString = coreCenter;
 }
 
 /**
@@ -53,7 +65,7 @@ void HybridSettings::setCoreCenterString(const std::string_view coreCenter)
  */
 void HybridSettings::setCoreOnlyListString(const std::string_view list)
 {
-    _coreOnlyListString = list;
+    state()._coreOnlyListString = list;
 }
 
 /**
@@ -64,7 +76,7 @@ void HybridSettings::setCoreOnlyListString(const std::string_view list)
 void HybridSettings::setNonCoreOnlyListString(const std::string_view nonCoreOnly
 )
 {
-    _nonCoreOnlyListString = nonCoreOnly;
+    state()._nonCoreOnlyListString = nonCoreOnly;
 }
 
 /**
@@ -74,7 +86,7 @@ void HybridSettings::setNonCoreOnlyListString(const std::string_view nonCoreOnly
  */
 void HybridSettings::setUseQMCharges(const bool useQMCharges)
 {
-    _useQMCharges = useQMCharges;
+    state()._useQMCharges = useQMCharges;
 }
 
 /**
@@ -86,7 +98,7 @@ void HybridSettings::setUseQMCharges(const bool useQMCharges)
  */
 void HybridSettings::setCoreRadius(const double radius)
 {
-    _coreRadius = radius;
+    state()._coreRadius = radius;
 }
 
 /**
@@ -98,7 +110,7 @@ void HybridSettings::setCoreRadius(const double radius)
  */
 void HybridSettings::setLayerRadius(const double radius)
 {
-    _layerRadius = radius;
+    state()._layerRadius = radius;
 }
 
 /**
@@ -110,7 +122,7 @@ void HybridSettings::setLayerRadius(const double radius)
  */
 void HybridSettings::setSmoothingRadius(const double radius)
 {
-    _smoothingRadius = radius;
+    state()._smoothingRadius = radius;
 }
 
 /********************
@@ -124,7 +136,10 @@ void HybridSettings::setSmoothingRadius(const double radius)
  *
  * @return std::string
  */
-std::string HybridSettings::getCoreCenterString() { return _coreCenterString; }
+std::string HybridSettings::getCoreCenterString()
+{
+    return state()._coreCenterString;
+}
 
 /**
  * @brief get the coreOnlyList string
@@ -133,7 +148,7 @@ std::string HybridSettings::getCoreCenterString() { return _coreCenterString; }
  */
 std::string HybridSettings::getCoreOnlyListString()
 {
-    return _coreOnlyListString;
+    return state()._coreOnlyListString;
 }
 
 /**
@@ -143,7 +158,7 @@ std::string HybridSettings::getCoreOnlyListString()
  */
 std::string HybridSettings::getNonCoreOnlyListString()
 {
-    return _nonCoreOnlyListString;
+    return state()._nonCoreOnlyListString;
 }
 
 /**
@@ -151,25 +166,25 @@ std::string HybridSettings::getNonCoreOnlyListString()
  *
  * @return bool
  */
-bool HybridSettings::getUseQMCharges() { return _useQMCharges; }
+bool HybridSettings::getUseQMCharges() { return state()._useQMCharges; }
 
 /**
  * @brief get the coreRadius
  *
  * @return double
  */
-double HybridSettings::getCoreRadius() { return _coreRadius; }
+double HybridSettings::getCoreRadius() { return state()._coreRadius; }
 
 /**
  * @brief get the layerRadius
  *
  * @return double
  */
-double HybridSettings::getLayerRadius() { return _layerRadius; }
+double HybridSettings::getLayerRadius() { return state()._layerRadius; }
 
 /**
  * @brief get the smoothingRadius
  *
  * @return double
  */
-double HybridSettings::getSmoothingRadius() { return _smoothingRadius; }
\ No newline at end of file
+double HybridSettings::getSmoothingRadius() { return state()._smoothingRadius; }
\ No newline at end of file
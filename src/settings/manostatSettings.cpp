@@ -22,10 +22,21 @@
 
 #include "manostatSettings.hpp"
 
+#include "settingsInstance.hpp"
 #include "stringUtilities.hpp"
 
 using namespace settings;
 
+/**
+ * @brief get the manostat settings state of the active settings instance
+ *
+ * @return ManostatSettings::State&
+ */
+ManostatSettings::State &ManostatSettings::state()
+{
+    return SettingsInstance::getActive().getManostatSettings();
+}
+
 /**
  * @brief return string of manostatType
  *
@@ -39,6 +50,8 @@ std::string settings::string(const ManostatType &manostatType)
 
         case ManostatType::STOCHASTIC_RESCALING: return "stochastic_rescaling";
 
+        case ManostatType::MONTE_CARLO: return "monte_carlo";
+
         default: return "none";
     }
 }
@@ -80,13 +93,16 @@ void ManostatSettings::setManostatType(const std::string_view &manostatType)
     const auto manostatTypeToLower = utilities::toLowerAndReplaceDashesCopy(manostatType);
 
     if (manostatTypeToLower == "berendsen")
-        _manostatType = BERENDSEN;
+        state()._manostatType = BERENDSEN;
 
     else if (manostatTypeToLower == "stochastic_rescaling")
-        _manostatType = STOCHASTIC_RESCALING;
+        state()._manostatType = STOCHASTIC_RESCALING;
+
+    else if (manostatTypeToLower == "monte_carlo")
+        state()._manostatType = MONTE_CARLO;
 
     else
-        _manostatType = NONE;
+        state()._manostatType = NONE;
 }
 
 /**
@@ -96,7 +112,7 @@ void ManostatSettings::setManostatType(const std::string_view &manostatType)
  */
 void ManostatSettings::setManostatType(const ManostatType &manostatType)
 {
-    _manostatType = manostatType;
+    state()._manostatType = manostatType;
 }
 
 /**
@@ -110,19 +126,19 @@ void ManostatSettings::setIsotropy(const std::string_view &isotropy)
     const auto isotropyToLower = utilities::toLowerAndReplaceDashesCopy(isotropy);
 
     if (isotropyToLower == "isotropic")
-        _isotropy = ISOTROPIC;
+        state()._isotropy = ISOTROPIC;
 
     else if (isotropyToLower == "semi_isotropic")
-        _isotropy = SEMI_ISOTROPIC;
+        state()._isotropy = SEMI_ISOTROPIC;
 
     else if (isotropyToLower == "anisotropic")
-        _isotropy = ANISOTROPIC;
+        state()._isotropy = ANISOTROPIC;
 
     else if (isotropyToLower == "full_anisotropic")
-        _isotropy = FULL_ANISOTROPIC;
+        state()._isotropy = FULL_ANISOTROPIC;
 
     else
-        _isotropy = ISOTROPIC;
+        state()._isotropy = ISOTROPIC;
 }
 
 /**
@@ -132,7 +148,7 @@ void ManostatSettings::setIsotropy(const std::string_view &isotropy)
  */
 void ManostatSettings::setIsotropy(const Isotropy &isotropy)
 {
-    _isotropy = isotropy;
+    state()._isotropy = isotropy;
 }
 
 /**
@@ -142,7 +158,7 @@ void ManostatSettings::setIsotropy(const Isotropy &isotropy)
  */
 void ManostatSettings::setPressureSet(const bool pressureSet)
 {
-    _isPressureSet = pressureSet;
+    state()._isPressureSet = pressureSet;
 }
 
 /**
@@ -152,7 +168,7 @@ void ManostatSettings::setPressureSet(const bool pressureSet)
  */
 void ManostatSettings::setTargetPressure(const double targetPressure)
 {
-    _targetPressure = targetPressure;
+    state()._targetPressure = targetPressure;
 }
 
 /**
@@ -162,7 +178,7 @@ void ManostatSettings::setTargetPressure(const double targetPressure)
  */
 void ManostatSettings::setTauManostat(const double tauManostat)
 {
-    _tauManostat = tauManostat;
+    state()._tauManostat = tauManostat;
 }
 
 /**
@@ -172,7 +188,28 @@ void ManostatSettings::setTauManostat(const double tauManostat)
  */
 void ManostatSettings::setCompressibility(const double compressibility)
 {
-    _compressibility = compressibility;
+    state()._compressibility = compressibility;
+}
+
+/**
+ * @brief sets the frequency of the Monte Carlo volume moves in steps
+ *
+ * @param frequency
+ */
+void ManostatSettings::setMonteCarloFrequency(const size_t frequency)
+{
+    state()._monteCarloFreq = frequency;
+}
+
+/**
+ * @brief sets the initial maximum relative volume change of the Monte Carlo
+ * volume moves
+ *
+ * @param volumeChange
+ */
+void ManostatSettings::setVolumeChange(const double volumeChange)
+{
+    state()._volumeChange = volumeChange;
 }
 
 /**
@@ -182,7 +219,7 @@ void ManostatSettings::setCompressibility(const double compressibility)
  */
 void ManostatSettings::set2DIsotropicAxes(const std::vector<size_t> &indices)
 {
-    _2DIsotropicAxes = indices;
+    state()._2DIsotropicAxes = indices;
 }
 
 /**
@@ -192,7 +229,17 @@ void ManostatSettings::set2DIsotropicAxes(const std::vector<size_t> &indices)
  */
 void ManostatSettings::set2DAnisotropicAxis(const size_t index)
 {
-    _2DAnisotropicAxis = index;
+    state()._2DAnisotropicAxis = index;
+}
+
+/**
+ * @brief set the random number generator state read from a checkpoint file
+ *
+ * @param randomState
+ */
+void ManostatSettings::setRandomState(const std::string &randomState)
+{
+    state()._randomState = randomState;
 }
 
 /***************************
@@ -206,7 +253,7 @@ void ManostatSettings::set2DAnisotropicAxis(const size_t index)
  *
  * @return bool
  */
-bool ManostatSettings::isPressureSet() { return _isPressureSet; }
+bool ManostatSettings::isPressureSet() { return state()._isPressureSet; }
 
 /**
  * @brief get if manostat is Berendsen based
@@ -217,7 +264,9 @@ bool ManostatSettings::isBerendsenBased()
 {
     using enum ManostatType;
 
-    return _manostatType == BERENDSEN || _manostatType == STOCHASTIC_RESCALING;
+    const auto manostatType = state()._manostatType;
+
+    return manostatType == BERENDSEN || manostatType == STOCHASTIC_RESCALING;
 }
 
 /**
@@ -225,35 +274,59 @@ bool ManostatSettings::isBerendsenBased()
  *
  * @return ManostatType
  */
-ManostatType ManostatSettings::getManostatType() { return _manostatType; }
+ManostatType ManostatSettings::getManostatType()
+{
+    return state()._manostatType;
+}
 
 /**
  * @brief get the isotropy
  *
  * @return Isotropy
  */
-Isotropy ManostatSettings::getIsotropy() { return _isotropy; }
+Isotropy ManostatSettings::getIsotropy() { return state()._isotropy; }
 
 /**
  * @brief get the target pressure
  *
  * @return double
  */
-double ManostatSettings::getTargetPressure() { return _targetPressure; }
+double ManostatSettings::getTargetPressure() { return state()._targetPressure; }
 
 /**
  * @brief get the tauManostat
  *
  * @return double
  */
-double ManostatSettings::getTauManostat() { return _tauManostat; }
+double ManostatSettings::getTauManostat() { return state()._tauManostat; }
 
 /**
  * @brief get the compressibility
  *
  * @return double
  */
-double ManostatSettings::getCompressibility() { return _compressibility; }
+double ManostatSettings::getCompressibility()
+{
+    return state()._compressibility;
+}
+
+/**
+ * @brief get the frequency of the Monte Carlo volume moves in steps
+ *
+ * @return size_t
+ */
+size_t ManostatSettings::getMonteCarloFrequency()
+{
+    return state()._monteCarloFreq;
+}
+
+/**
+ * @brief get the initial maximum relative volume change of the Monte Carlo
+ * volume moves
+ *
+ * @return double
+ */
+double ManostatSettings::getVolumeChange() { return state()._volumeChange; }
 
 /**
  * @brief get the 2D isotropic axes
@@ -262,7 +335,7 @@ double ManostatSettings::getCompressibility() { return _compressibility; }
  */
 std::vector<size_t> ManostatSettings::get2DIsotropicAxes()
 {
-    return _2DIsotropicAxes;
+    return state()._2DIsotropicAxes;
 }
 
 /**
@@ -270,4 +343,14 @@ std::vector<size_t> ManostatSettings::get2DIsotropicAxes()
  *
  * @return size_t
  */
-size_t ManostatSettings::get2DAnisotropicAxis() { return _2DAnisotropicAxis; }
\ No newline at end of file
+size_t ManostatSettings::get2DAnisotropicAxis()
+{
+    return state()._2DAnisotropicAxis;
+}
+
+/**
+ * @brief get the random number generator state read from a checkpoint file
+ *
+ * @return std::string empty if no state was read
+ */
+std::string ManostatSettings::getRandomState() { return state()._randomState; }
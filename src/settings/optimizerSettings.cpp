@@ -22,11 +22,22 @@
 
 #include "optimizerSettings.hpp"
 
-#include "stringUtilities.hpp"   // for toLowerCopy
+#include "settingsInstance.hpp"   // for SettingsInstance
+#include "stringUtilities.hpp"    // for toLowerCopy
 
 using namespace settings;
 using namespace utilities;
 
+/**
+ * @brief get the optimizer settings state of the active settings instance
+ *
+ * @return OptimizerSettings::State&
+ */
+OptimizerSettings::State &OptimizerSettings::state()
+{
+    return SettingsInstance::getActive().getOptimizerSettings();
+}
+
 /**
  * @brief returns the optimizer as string
  *
@@ -41,6 +52,8 @@ std::string settings::string(const OptimizerType method)
 
         case STEEPEST_DESCENT: return "STEEPEST-DESCENT";
         case ADAM: return "ADAM";
+        case LBFGS: return "L-BFGS";
+        case FIRE: return "FIRE";
 
         default: return "none";
     }
@@ -89,6 +102,12 @@ void OptimizerSettings::setOptimizer(const std::string_view &optimizer)
     else if ("adam" == optimizerLower)
         setOptimizer(OptimizerType::ADAM);
 
+    else if ("lbfgs" == optimizerLower || "l_bfgs" == optimizerLower)
+        setOptimizer(OptimizerType::LBFGS);
+
+    else if ("fire" == optimizerLower)
+        setOptimizer(OptimizerType::FIRE);
+
     else
         setOptimizer(OptimizerType::NONE);
 }
@@ -100,7 +119,7 @@ void OptimizerSettings::setOptimizer(const std::string_view &optimizer)
  */
 void OptimizerSettings::setOptimizer(const OptimizerType optimizer)
 {
-    _optimizer = optimizer;
+    state()._optimizer = optimizer;
 }
 
 /**
@@ -137,7 +156,7 @@ void OptimizerSettings::setLearningRateStrategy(const std::string_view &method)
  */
 void OptimizerSettings::setLearningRateStrategy(const LREnum method)
 {
-    _LRStrategy = method;
+    state()._LRStrategy = method;
 }
 
 /**
@@ -147,7 +166,7 @@ void OptimizerSettings::setLearningRateStrategy(const LREnum method)
  */
 void OptimizerSettings::setNumberOfEpochs(const size_t nEpochs)
 {
-    _nEpochs = nEpochs;
+    state()._nEpochs = nEpochs;
 }
 
 /**
@@ -157,7 +176,17 @@ void OptimizerSettings::setNumberOfEpochs(const size_t nEpochs)
  */
 void OptimizerSettings::setLRUpdateFrequency(const size_t frequency)
 {
-    _LRupdateFrequency = frequency;
+    state()._LRupdateFrequency = frequency;
+}
+
+/**
+ * @brief sets the number of stored correction pairs of the L-BFGS optimizer
+ *
+ * @param memory
+ */
+void OptimizerSettings::setLBFGSMemory(const size_t memory)
+{
+    state()._LBFGSMemory = memory;
 }
 
 /**
@@ -167,7 +196,7 @@ void OptimizerSettings::setLRUpdateFrequency(const size_t frequency)
  */
 void OptimizerSettings::setInitialLearningRate(const double learningRate)
 {
-    _initialLearningRate = learningRate;
+    state()._initialLearningRate = learningRate;
 }
 
 /**
@@ -177,7 +206,7 @@ void OptimizerSettings::setInitialLearningRate(const double learningRate)
  */
 void OptimizerSettings::setLearningRateDecay(const double decay)
 {
-    _learningRateDecay = decay;
+    state()._learningRateDecay = decay;
 }
 
 /**
@@ -187,7 +216,7 @@ void OptimizerSettings::setLearningRateDecay(const double decay)
  */
 void OptimizerSettings::setMinLearningRate(const double minLearningRate)
 {
-    _minLearningRate = minLearningRate;
+    state()._minLearningRate = minLearningRate;
 }
 
 /**
@@ -197,7 +226,79 @@ void OptimizerSettings::setMinLearningRate(const double minLearningRate)
  */
 void OptimizerSettings::setMaxLearningRate(const double maxLearningRate)
 {
-    _maxLearningRate = maxLearningRate;
+    state()._maxLearningRate = maxLearningRate;
+}
+
+/**
+ * @brief sets the initial timestep of the FIRE optimizer
+ *
+ * @param timestep
+ */
+void OptimizerSettings::setFireTimestep(const double timestep)
+{
+    state()._fireTimestep = timestep;
+}
+
+/**
+ * @brief sets the maximum timestep of the FIRE optimizer
+ *
+ * @param maxTimestep
+ */
+void OptimizerSettings::setFireMaxTimestep(const double maxTimestep)
+{
+    state()._fireMaxTimestep = maxTimestep;
+}
+
+/**
+ * @brief sets the number of downhill steps of the FIRE optimizer before the timestep
+ * is increased
+ *
+ * @param nMin
+ */
+void OptimizerSettings::setFireNMin(const size_t nMin)
+{
+    state()._fireNMin = nMin;
+}
+
+/**
+ * @brief sets the timestep increase factor of the FIRE optimizer
+ *
+ * @param factor
+ */
+void OptimizerSettings::setFireTimestepIncrease(const double factor)
+{
+    state()._fireTimestepIncrease = factor;
+}
+
+/**
+ * @brief sets the timestep decrease factor of the FIRE optimizer
+ *
+ * @param factor
+ */
+void OptimizerSettings::setFireTimestepDecrease(const double factor)
+{
+    state()._fireTimestepDecrease = factor;
+}
+
+/**
+ * @brief sets the initial mixing parameter of the FIRE optimizer
+ *
+ * @param alpha
+ */
+void OptimizerSettings::setFireAlphaStart(const double alpha)
+{
+    state()._fireAlphaStart = alpha;
+}
+
+/**
+ * @brief sets the decrease factor of the mixing parameter of the FIRE
+ * optimizer
+ *
+ * @param factor
+ */
+void OptimizerSettings::setFireAlphaDecrease(const double factor)
+{
+    state()._fireAlphaDecrease = factor;
 }
 
 /***************************
@@ -211,28 +312,45 @@ void OptimizerSettings::setMaxLearningRate(const double maxLearningRate)
  *
  * @return OptimizerType
  */
-settings::OptimizerType OptimizerSettings::getOptimizer() { return _optimizer; }
+settings::OptimizerType OptimizerSettings::getOptimizer()
+{
+    return state()._optimizer;
+}
 
 /**
  * @brief returns the learning rate strategy as string
  *
  * @return LearningRateStrategy
  */
-LREnum OptimizerSettings::getLearningRateStrategy() { return _LRStrategy; }
+LREnum OptimizerSettings::getLearningRateStrategy()
+{
+    return state()._LRStrategy;
+}
 
 /**
  * @brief returns the number of epochs
  *
  * @return size_t
  */
-size_t OptimizerSettings::getNumberOfEpochs() { return _nEpochs; }
+size_t OptimizerSettings::getNumberOfEpochs() { return state()._nEpochs; }
 
 /**
  * @brief returns the learning rate update frequency
  *
  * @return size_t
  */
-size_t OptimizerSettings::getLRUpdateFrequency() { return _LRupdateFrequency; }
+size_t OptimizerSettings::getLRUpdateFrequency()
+{
+    return state()._LRupdateFrequency;
+}
+
+/**
+ * @brief returns the number of stored correction pairs of the L-BFGS
+ * optimizer
+ *
+ * @return size_t
+ */
+size_t OptimizerSettings::getLBFGSMemory() { return state()._LBFGSMemory; }
 
 /**
  * @brief returns the initial learning rate
@@ -241,7 +359,7 @@ size_t OptimizerSettings::getLRUpdateFrequency() { return _LRupdateFrequency; }
  */
 double OptimizerSettings::getInitialLearningRate()
 {
-    return _initialLearningRate;
+    return state()._initialLearningRate;
 }
 
 /**
@@ -249,7 +367,10 @@ double OptimizerSettings::getInitialLearningRate()
  *
  * @return double
  */
-double OptimizerSettings::getMinLearningRate() { return _minLearningRate; }
+double OptimizerSettings::getMinLearningRate()
+{
+    return state()._minLearningRate;
+}
 
 /**
  * @brief returns the learning rate decay
@@ -258,7 +379,7 @@ double OptimizerSettings::getMinLearningRate() { return _minLearningRate; }
  */
 std::optional<double> OptimizerSettings::getLearningRateDecay()
 {
-    return _learningRateDecay;
+    return state()._learningRateDecay;
 }
 
 /**
@@ -268,5 +389,71 @@ std::optional<double> OptimizerSettings::getLearningRateDecay()
  */
 std::optional<double> OptimizerSettings::getMaxLearningRate()
 {
-    return _maxLearningRate;
+    return state()._maxLearningRate;
+}
+
+/**
+ * @brief returns the initial timestep of the FIRE optimizer
+ *
+ * @return double
+ */
+double OptimizerSettings::getFireTimestep() { return state()._fireTimestep; }
+
+/**
+ * @brief returns the maximum timestep of the FIRE optimizer
+ *
+ * @return double
+ */
+double OptimizerSettings::getFireMaxTimestep()
+{
+    return state()._fireMaxTimestep;
+}
+
+/**
+ * @brief returns the number of downhill steps of the FIRE optimizer before the timestep
+ * is increased
+ *
+ * @return size_t
+ */
+size_t OptimizerSettings::getFireNMin() { return state()._fireNMin; }
+
+/**
+ * @brief returns the timestep increase factor of the FIRE optimizer
+ *
+ * @return double
+ */
+double OptimizerSettings::getFireTimestepIncrease()
+{
+    return state()._fireTimestepIncrease;
+}
+
+/**
+ * @brief returns the timestep decrease factor of the FIRE optimizer
+ *
+ * @return double
+ */
+double OptimizerSettings::getFireTimestepDecrease()
+{
+    return state()._fireTimestepDecrease;
+}
+
+/**
+ * @brief returns the initial mixing parameter of the FIRE optimizer
+ *
+ * @return double
+ */
+double OptimizerSettings::getFireAlphaStart()
+{
+    return state()._fireAlphaStart;
+}
+
+/**
+ * @brief returns the decrease factor of the mixing parameter of the FIRE
+ * optimizer
+ *
+ * @return double
+ */
+double OptimizerSettings::getFireAlphaDecrease()
+{
+    return state()._fireAlphaDecrease;
 }
\ No newline at end of file
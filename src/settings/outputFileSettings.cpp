@@ -27,9 +27,21 @@
 #include <string>      // for string, allocator
 #include <vector>      // for vector
 
+#include "settingsInstance.hpp"   // for SettingsInstance
+
 using settings::OutputFileSettings;
 using namespace defaults;
 
+/**
+ * @brief get the output file settings state of the active settings instance
+ *
+ * @return OutputFileSettings::State&
+ */
+OutputFileSettings::State &OutputFileSettings::state()
+{
+    return SettingsInstance::getActive().getOutputFileSettings();
+}
+
 /**
  * @brief Sets the output frequency of the simulation
  *
@@ -45,9 +57,9 @@ using namespace defaults;
 void OutputFileSettings::setOutputFrequency(const size_t outputFreq)
 {
     if (0 == outputFreq)
-        _outputFrequency = UINT64_MAX;
+        state()._outputFrequency = UINT64_MAX;
     else
-        _outputFrequency = outputFreq;
+        state()._outputFrequency = outputFreq;
 }
 
 /**
@@ -57,8 +69,8 @@ void OutputFileSettings::setOutputFrequency(const size_t outputFreq)
  */
 void OutputFileSettings::setFilePrefix(const std::string_view prefix)
 {
-    _filePrefixSet = true;
-    _filePrefix    = prefix;
+    state()._filePrefixSet = true;
+    state()._filePrefix    = prefix;
 }
 
 /**
@@ -68,79 +80,140 @@ void OutputFileSettings::setFilePrefix(const std::string_view prefix)
  */
 void OutputFileSettings::replaceDefaultValues(const std::string &prefix)
 {
-    if (_RESTART_FILE_DEFAULT_ == _rstFile)
-        _rstFile = prefix + ".rst";
+    if (_RESTART_FILE_DEFAULT_ == state()._rstFile)
+        state()._rstFile = prefix + ".rst";
+
+    if (_CHK_FILE_DEFAULT_ == state()._chkFile)
+        state()._chkFile = prefix + ".chk";
+
+    if (_OBS_FILE_DEFAULT_ == state()._obsFile)
+        state()._obsFile = prefix + ".obs";
 
-    if (_LOG_FILE_DEFAULT_ == _logFile)
-        _logFile = prefix + ".log";
+    if (_LOG_FILE_DEFAULT_ == state()._logFile)
+        state()._logFile = prefix + ".log";
 
-    if (_REF_FILE_DEFAULT_ == _refFile)
-        _refFile = prefix + ".ref";
+    if (_REF_FILE_DEFAULT_ == state()._refFile)
+        state()._refFile = prefix + ".ref";
 
-    if (_TRAJ_FILE_DEFAULT_ == _trajFile)
-        _trajFile = prefix + ".xyz";
+    if (_TRAJ_FILE_DEFAULT_ == state()._trajFile)
+        state()._trajFile = prefix + ".xyz";
 
-    if (_ENERGY_FILE_DEFAULT_ == _energyFile)
-        _energyFile = prefix + ".en";
+    if (_ENERGY_FILE_DEFAULT_ == state()._energyFile)
+        state()._energyFile = prefix + ".en";
 
-    if (_INSTEN_FILE_DEFAULT_ == _instEnFile)
-        _instEnFile = prefix + ".instant_en";
+    if (_INSTEN_FILE_DEFAULT_ == state()._instEnFile)
+        state()._instEnFile = prefix + ".instant_en";
 
-    if (_FORCE_FILE_DEFAULT_ == _forceFile)
-        _forceFile = prefix + ".force";
+    if (_FORCE_FILE_DEFAULT_ == state()._forceFile)
+        state()._forceFile = prefix + ".force";
 
-    if (_VEL_FILE_DEFAULT_ == _velFile)
-        _velFile = prefix + ".vel";
+    if (_VEL_FILE_DEFAULT_ == state()._velFile)
+        state()._velFile = prefix + ".vel";
 
-    if (_CHARGE_FILE_DEFAULT_ == _chargeFile)
-        _chargeFile = prefix + ".chrg";
+    if (_CHARGE_FILE_DEFAULT_ == state()._chargeFile)
+        state()._chargeFile = prefix + ".chrg";
 
-    if (_INFO_FILE_DEFAULT_ == _infoFile)
-        _infoFile = prefix + ".info";
+    if (_INFO_FILE_DEFAULT_ == state()._infoFile)
+        state()._infoFile = prefix + ".info";
 
-    if (_MOMENTUM_FILE_DEFAULT_ == _momFile)
-        _momFile = prefix + ".mom";
+    if (_MOMENTUM_FILE_DEFAULT_ == state()._momFile)
+        state()._momFile = prefix + ".mom";
 
-    if (_VIRIAL_FILE_DEFAULT_ == _virialFile)
-        _virialFile = prefix + ".vir";
+    if (_VIRIAL_FILE_DEFAULT_ == state()._virialFile)
+        state()._virialFile = prefix + ".vir";
 
-    if (_STRESS_FILE_DEFAULT_ == _stressFile)
-        _stressFile = prefix + ".stress";
+    if (_STRESS_FILE_DEFAULT_ == state()._stressFile)
+        state()._stressFile = prefix + ".stress";
 
-    if (_BOX_FILE_DEFAULT_ == _boxFile)
-        _boxFile = prefix + ".box";
+    if (_BOX_FILE_DEFAULT_ == state()._boxFile)
+        state()._boxFile = prefix + ".box";
 
-    if (_OPT_FILE_DEFAULT_ == _optFile)
-        _optFile = prefix + ".opt";
+    if (_OPT_FILE_DEFAULT_ == state()._optFile)
+        state()._optFile = prefix + ".opt";
 
     /*****************************
      * ring polymer output files *
      *****************************/
 
-    if (_RPMD_RST_FILE_DEFAULT_ == _rpmdRstFile)
-        _rpmdRstFile = prefix + ".rpmd.rst";
+    if (_RPMD_RST_FILE_DEFAULT_ == state()._rpmdRstFile)
+        state()._rpmdRstFile = prefix + ".rpmd.rst";
 
-    if (_RPMD_TRAJ_FILE_DEFAULT_ == _rpmdTrajFile)
-        _rpmdTrajFile = prefix + ".rpmd.xyz";
+    if (_RPMD_TRAJ_FILE_DEFAULT_ == state()._rpmdTrajFile)
+        state()._rpmdTrajFile = prefix + ".rpmd.xyz";
 
-    if (_RPMD_VEL_FILE_DEFAULT_ == _rpmdVelFile)
-        _rpmdVelFile = prefix + ".rpmd.vel";
+    if (_RPMD_VEL_FILE_DEFAULT_ == state()._rpmdVelFile)
+        state()._rpmdVelFile = prefix + ".rpmd.vel";
 
-    if (_RPMD_FORCE_FILE_DEFAULT_ == _rpmdForceFile)
-        _rpmdForceFile = prefix + ".rpmd.force";
+    if (_RPMD_FORCE_FILE_DEFAULT_ == state()._rpmdForceFile)
+        state()._rpmdForceFile = prefix + ".rpmd.force";
 
-    if (_RPMD_CHARGE_FILE_DEFAULT_ == _rpmdChargeFile)
-        _rpmdChargeFile = prefix + ".rpmd.chrg";
+    if (_RPMD_CHARGE_FILE_DEFAULT_ == state()._rpmdChargeFile)
+        state()._rpmdChargeFile = prefix + ".rpmd.chrg";
 
-    if (_RPMD_ENERGY_FILE_DEFAULT_ == _rpmdEnergyFile)
-        _rpmdEnergyFile = prefix + ".rpmd.en";
+    if (_RPMD_ENERGY_FILE_DEFAULT_ == state()._rpmdEnergyFile)
+        state()._rpmdEnergyFile = prefix + ".rpmd.en";
 
     /********************
      * the timings file *
      ********************/
 
-    if (_TIMINGS_FILE_DEFAULT_ == _timeFile)
-        _timeFile = prefix + ".timings";
+    if (_TIMINGS_FILE_DEFAULT_ == state()._timeFile)
+        state()._timeFile = prefix + ".timings";
+
+    if (_TRACE_FILE_DEFAULT_ == state()._traceFile)
+        state()._traceFile = prefix + ".trace.json";
+
+    /*********************************
+     * the replica exchange log file *
+     *********************************/
+
+    if (_REX_FILE_DEFAULT_ == state()._rexFile)
+        state()._rexFile = prefix + ".rex";
+}
+
+/**
+ * @brief adds a tag to the names of all output files
+ *
+ * @details the tag is inserted before the first '.' of the file name, e.g.
+ * md.rpmd.xyz becomes md.<tag>.rpmd.xyz. This is used to give every replica
+ * of a replica exchange run its own output files. The replica exchange file
+ * itself is shared by all replicas and therefore not tagged.
+ *
+ * @param tag
+ */
+void OutputFileSettings::addFileNameTag(const std::string &tag)
+{
+    auto &files = state();
+
+    auto addTag = [&tag](std::string *fileName)
+    {
+        const auto start = fileName->find_last_of('/');
+        const auto first = start == std::string::npos ? 0 : start + 1;
+        const auto pos   = fileName->find('.', first);
+
+        if (pos == std::string::npos)
+            fileName->append("." + tag);
+        else
+            fileName->insert(pos, "." + tag);
+    };
+
+    std::vector<std::string *> fileNames = {
+        &files._rstFile,       &files._logFile,        &files._trajFile,
+        &files._energyFile,    &files._instEnFile,     &files._forceFile,
+        &files._velFile,       &files._chargeFile,     &files._infoFile,
+        &files._momFile,       &files._chkFile,        &files._obsFile,
+        &files._refFile,
+
+        &files._virialFile,    &files._stressFile,     &files._boxFile,
+        &files._optFile,
+
+        &files._rpmdRstFile,   &files._rpmdTrajFile,   &files._rpmdVelFile,
+        &files._rpmdForceFile, &files._rpmdChargeFile, &files._rpmdEnergyFile,
+
+        &files._timeFile,      &files._traceFile
+    };
+
+    std::ranges::for_each(fileNames, addTag);
 }
 
 /**
@@ -150,17 +223,21 @@ void OutputFileSettings::replaceDefaultValues(const std::string &prefix)
  */
 std::string OutputFileSettings::determineMostCommonPrefix()
 {
+    const auto &files = state();
+
     std::vector<std::string> fileNames = {
-        _rstFile,        _logFile,      _trajFile,    _energyFile,
-        _instEnFile,     _forceFile,    _velFile,     _chargeFile,
-        _infoFile,       _momFile,
+        files._rstFile,        files._logFile,      files._trajFile,
+        files._energyFile,     files._instEnFile,   files._forceFile,
+        files._velFile,        files._chargeFile,   files._infoFile,
+        files._momFile,        files._chkFile,      files._obsFile,
 
-        _virialFile,     _stressFile,   _boxFile,     _optFile,
+        files._virialFile,     files._stressFile,   files._boxFile,
+        files._optFile,
 
-        _rpmdRstFile,    _rpmdTrajFile, _rpmdVelFile, _rpmdForceFile,
-        _rpmdChargeFile,
+        files._rpmdRstFile,    files._rpmdTrajFile, files._rpmdVelFile,
+        files._rpmdForceFile,  files._rpmdChargeFile,
 
-        _timeFile
+        files._timeFile,       files._traceFile
     };
 
     auto removeEnding = [](std::string &fileName)
@@ -214,7 +291,27 @@ std::string OutputFileSettings::determineMostCommonPrefix()
  */
 void OutputFileSettings::setRestartFileName(const std::string_view name)
 {
-    _rstFile = name;
+    state()._rstFile = name;
+}
+
+/**
+ * @brief sets the binary checkpoint file name
+ *
+ * @param name
+ */
+void OutputFileSettings::setCheckpointFileName(const std::string_view name)
+{
+    state()._chkFile = name;
+}
+
+/**
+ * @brief sets the binary observable file name
+ *
+ * @param name
+ */
+void OutputFileSettings::setObservableFileName(const std::string_view name)
+{
+    state()._obsFile = name;
 }
 
 /**
@@ -224,7 +321,7 @@ void OutputFileSettings::setRestartFileName(const std::string_view name)
  */
 void OutputFileSettings::setEnergyFileName(const std::string_view name)
 {
-    _energyFile = name;
+    state()._energyFile = name;
 }
 
 /**
@@ -234,7 +331,7 @@ void OutputFileSettings::setEnergyFileName(const std::string_view name)
  */
 void OutputFileSettings::setInstantEnergyFileName(const std::string_view name)
 {
-    _instEnFile = name;
+    state()._instEnFile = name;
 }
 /**
  * @brief sets the momentum file name
@@ -243,7 +340,7 @@ void OutputFileSettings::setInstantEnergyFileName(const std::string_view name)
  */
 void OutputFileSettings::setMomentumFileName(const std::string_view name)
 {
-    _momFile = name;
+    state()._momFile = name;
 }
 
 /**
@@ -253,7 +350,7 @@ void OutputFileSettings::setMomentumFileName(const std::string_view name)
  */
 void OutputFileSettings::setTrajectoryFileName(const std::string_view name)
 {
-    _trajFile = name;
+    state()._trajFile = name;
 }
 
 /**
@@ -263,7 +360,7 @@ void OutputFileSettings::setTrajectoryFileName(const std::string_view name)
  */
 void OutputFileSettings::setVelocityFileName(const std::string_view name)
 {
-    _velFile = name;
+    state()._velFile = name;
 }
 
 /**
@@ -273,7 +370,7 @@ void OutputFileSettings::setVelocityFileName(const std::string_view name)
  */
 void OutputFileSettings::setForceFileName(const std::string_view name)
 {
-    _forceFile = name;
+    state()._forceFile = name;
 }
 
 /**
@@ -283,7 +380,7 @@ void OutputFileSettings::setForceFileName(const std::string_view name)
  */
 void OutputFileSettings::setChargeFileName(const std::string_view name)
 {
-    _chargeFile = name;
+    state()._chargeFile = name;
 }
 
 /**
@@ -293,7 +390,7 @@ void OutputFileSettings::setChargeFileName(const std::string_view name)
  */
 void OutputFileSettings::setLogFileName(const std::string_view name)
 {
-    _logFile = name;
+    state()._logFile = name;
 }
 
 /**
@@ -303,7 +400,7 @@ void OutputFileSettings::setLogFileName(const std::string_view name)
  */
 void OutputFileSettings::setRefFileName(const std::string_view name)
 {
-    _refFile = name;
+    state()._refFile = name;
 }
 
 /**
@@ -313,7 +410,7 @@ void OutputFileSettings::setRefFileName(const std::string_view name)
  */
 void OutputFileSettings::setInfoFileName(const std::string_view name)
 {
-    _infoFile = name;
+    state()._infoFile = name;
 }
 
 /**
@@ -323,7 +420,7 @@ void OutputFileSettings::setInfoFileName(const std::string_view name)
  */
 void OutputFileSettings::setVirialFileName(const std::string_view name)
 {
-    _virialFile = name;
+    state()._virialFile = name;
 }
 
 /**
@@ -333,7 +430,7 @@ void OutputFileSettings::setVirialFileName(const std::string_view name)
  */
 void OutputFileSettings::setStressFileName(const std::string_view name)
 {
-    _stressFile = name;
+    state()._stressFile = name;
 }
 
 /**
@@ -343,7 +440,7 @@ void OutputFileSettings::setStressFileName(const std::string_view name)
  */
 void OutputFileSettings::setBoxFileName(const std::string_view name)
 {
-    _boxFile = name;
+    state()._boxFile = name;
 }
 
 /**
@@ -353,7 +450,7 @@ void OutputFileSettings::setBoxFileName(const std::string_view name)
  */
 void OutputFileSettings::setOptFileName(const std::string_view name)
 {
-    _optFile = name;
+    state()._optFile = name;
 }
 
 /**
@@ -365,7 +462,7 @@ void OutputFileSettings::setRingPolymerRestartFileName(
     const std::string_view name
 )
 {
-    _rpmdRstFile = name;
+    state()._rpmdRstFile = name;
 }
 
 /**
@@ -377,7 +474,7 @@ void OutputFileSettings::setRingPolymerTrajectoryFileName(
     const std::string_view name
 )
 {
-    _rpmdTrajFile = name;
+    state()._rpmdTrajFile = name;
 }
 
 /**
@@ -389,7 +486,7 @@ void OutputFileSettings::setRingPolymerVelocityFileName(
     const std::string_view name
 )
 {
-    _rpmdVelFile = name;
+    state()._rpmdVelFile = name;
 }
 
 /**
@@ -400,7 +497,7 @@ void OutputFileSettings::setRingPolymerVelocityFileName(
 void OutputFileSettings::setRingPolymerForceFileName(const std::string_view name
 )
 {
-    _rpmdForceFile = name;
+    state()._rpmdForceFile = name;
 }
 
 /**
@@ -412,7 +509,7 @@ void OutputFileSettings::setRingPolymerChargeFileName(
     const std::string_view name
 )
 {
-    _rpmdChargeFile = name;
+    state()._rpmdChargeFile = name;
 }
 
 /**
@@ -424,7 +521,7 @@ void OutputFileSettings::setRingPolymerEnergyFileName(
     const std::string_view name
 )
 {
-    _rpmdEnergyFile = name;
+    state()._rpmdEnergyFile = name;
 }
 
 /**
@@ -434,7 +531,59 @@ void OutputFileSettings::setRingPolymerEnergyFileName(
  */
 void OutputFileSettings::setTimingsFileName(const std::string_view name)
 {
-    _timeFile = name;
+    state()._timeFile = name;
+}
+
+/**
+ * @brief sets the timings trace file name
+ *
+ * @param name
+ */
+void OutputFileSettings::setTimingsTraceFileName(const std::string_view name)
+{
+    state()._traceFile = name;
+}
+
+/**
+ * @brief sets the replica exchange file name
+ *
+ * @param name
+ */
+void OutputFileSettings::setReplicaExchangeFileName(const std::string_view name)
+{
+    state()._rexFile = name;
+}
+
+/**
+ * @brief sets if the output files are written by a background thread
+ *
+ * @param isAsyncOutput
+ */
+void OutputFileSettings::setAsyncOutput(const bool isAsyncOutput)
+{
+    state()._isAsyncOutput = isAsyncOutput;
+}
+
+/**
+ * @brief sets if the observables are recorded into the binary observable
+ * file instead of the energy, momentum, virial, stress and box text files
+ *
+ * @param isObservableOutput
+ */
+void OutputFileSettings::setObservableOutput(const bool isObservableOutput)
+{
+    state()._isObsOutput = isObservableOutput;
+}
+
+/**
+ * @brief sets if the timings sections are recorded and written to the
+ * timings trace file
+ *
+ * @param isTraceOutput
+ */
+void OutputFileSettings::setTimingsTraceOutput(const bool isTraceOutput)
+{
+    state()._isTraceOutput = isTraceOutput;
 }
 
 /***************************
@@ -448,35 +597,90 @@ void OutputFileSettings::setTimingsFileName(const std::string_view name)
  *
  * @return size_t
  */
-size_t OutputFileSettings::getOutputFrequency() { return _outputFrequency; }
+size_t OutputFileSettings::getOutputFrequency()
+{
+    return state()._outputFrequency;
+}
+
+/**
+ * @brief determine if the output files are written by a background thread
+ *
+ * @return bool
+ */
+bool OutputFileSettings::isAsyncOutput() { return state()._isAsyncOutput; }
+
+/**
+ * @brief determine if the observables are recorded into the binary
+ * observable file
+ *
+ * @return bool
+ */
+bool OutputFileSettings::isObservableOutput() { return state()._isObsOutput; }
+
+/**
+ * @brief determine if the timings sections are recorded and written to the
+ * timings trace file
+ *
+ * @return bool
+ */
+bool OutputFileSettings::isTimingsTraceOutput()
+{
+    return state()._isTraceOutput;
+}
 
 /**
  * @brief determine if the file prefix is set
  *
  * @return std::string
  */
-bool OutputFileSettings::isFilePrefixSet() { return _filePrefixSet; }
+bool OutputFileSettings::isFilePrefixSet() { return state()._filePrefixSet; }
 
 /**
  * @brief get the file prefix
  *
  * @return std::string
  */
-std::string OutputFileSettings::getFilePrefix() { return _filePrefix; }
+std::string OutputFileSettings::getFilePrefix() { return state()._filePrefix; }
 
 /**
  * @brief get the restart file name
  *
  * @return std::string
  */
-std::string OutputFileSettings::getRestartFileName() { return _rstFile; }
+std::string OutputFileSettings::getRestartFileName()
+{
+    return state()._rstFile;
+}
+
+/**
+ * @brief get the binary checkpoint file name
+ *
+ * @return std::string
+ */
+std::string OutputFileSettings::getCheckpointFileName()
+{
+    return state()._chkFile;
+}
+
+/**
+ * @brief get the binary observable file name
+ *
+ * @return std::string
+ */
+std::string OutputFileSettings::getObservableFileName()
+{
+    return state()._obsFile;
+}
 
 /**
  * @brief get the energy file name
  *
  * @return std::string
  */
-std::string OutputFileSettings::getEnergyFileName() { return _energyFile; }
+std::string OutputFileSettings::getEnergyFileName()
+{
+    return state()._energyFile;
+}
 
 /**
  * @brief get the instant energy file name
@@ -485,7 +689,7 @@ std::string OutputFileSettings::getEnergyFileName() { return _energyFile; }
  */
 std::string OutputFileSettings::getInstantEnergyFileName()
 {
-    return _instEnFile;
+    return state()._instEnFile;
 }
 
 /**
@@ -493,84 +697,105 @@ std::string OutputFileSettings::getInstantEnergyFileName()
  *
  * @return std::string
  */
-std::string OutputFileSettings::getMomentumFileName() { return _momFile; }
+std::string OutputFileSettings::getMomentumFileName()
+{
+    return state()._momFile;
+}
 
 /**
  * @brief get the trajectory file name
  *
  * @return std::string
  */
-std::string OutputFileSettings::getTrajectoryFileName() { return _trajFile; }
+std::string OutputFileSettings::getTrajectoryFileName()
+{
+    return state()._trajFile;
+}
 
 /**
  * @brief get the velocity file name
  *
  * @return std::string
  */
-std::string OutputFileSettings::getVelocityFileName() { return _velFile; }
+std::string OutputFileSettings::getVelocityFileName()
+{
+    return state()._velFile;
+}
 
 /**
  * @brief get the force file name
  *
  * @return std::string
  */
-std::string OutputFileSettings::getForceFileName() { return _forceFile; }
+std::string OutputFileSettings::getForceFileName()
+{
+    return state()._forceFile;
+}
 
 /**
  * @brief get the charge file name
  *
  * @return std::string
  */
-std::string OutputFileSettings::getChargeFileName() { return _chargeFile; }
+std::string OutputFileSettings::getChargeFileName()
+{
+    return state()._chargeFile;
+}
 
 /**
  * @brief get the log file name
  *
  * @return std::string
  */
-std::string OutputFileSettings::getLogFileName() { return _logFile; }
+std::string OutputFileSettings::getLogFileName() { return state()._logFile; }
 
 /**
  * @brief get the ref file name
  *
  * @return std::string
  */
-std::string OutputFileSettings::getRefFileName() { return _refFile; }
+std::string OutputFileSettings::getRefFileName() { return state()._refFile; }
 
 /**
  * @brief get the info file name
  *
  * @return std::string
  */
-std::string OutputFileSettings::getInfoFileName() { return _infoFile; }
+std::string OutputFileSettings::getInfoFileName() { return state()._infoFile; }
 
 /**
  * @brief get the virial file name
  *
  * @return std::string
  */
-std::string OutputFileSettings::getVirialFileName() { return _virialFile; }
+std::string OutputFileSettings::getVirialFileName()
+{
+    return state()._virialFile;
+}
 
 /**
  * @brief get the stress file name
  *
  * @return std::string
  */
-std::string OutputFileSettings::getStressFileName() { return _stressFile; }
+std::string OutputFileSettings::getStressFileName()
+{
+    return state()._stressFile;
+}
 
 /**
  * @brief get the box file name
  *
  * @return std::string
  */
-std::string OutputFileSettings::getBoxFileName() { return _boxFile; }
+std::string OutputFileSettings::getBoxFileName() { return state()._boxFile; }
 
 /**
  * @brief get the optimization file name
  *
  * @return std::string
  */
-std::string OutputFileSettings::getOptFileName() { return _optFile; }
+std::string OutputFileSettings::getOptFileName() { return state()._optFile; }
 
 /**
  * @brief get the ring polymer restart file name
@@ -579,7 +804,7 @@ std::string OutputFileSettings::getOptFileName() { return _optFile; }
  */
 std::string OutputFileSettings::getRPMDRestartFileName()
 {
-    return _rpmdRstFile;
+    return state()._rpmdRstFile;
 }
 
 /**
@@ -587,7 +812,10 @@ std::string OutputFileSettings::getRPMDRestartFileName()
  *
  * @return std::string
  */
-std::string OutputFileSettings::getRPMDTrajFileName() { return _rpmdTrajFile; }
+std::string OutputFileSettings::getRPMDTrajFileName()
+{
+    return state()._rpmdTrajFile;
+}
 
 /**
  * @brief get the ring polymer velocity file name
@@ -596,7 +824,7 @@ std::string OutputFileSettings::getRPMDTrajFileName() { return _rpmdTrajFile; }
  */
 std::string OutputFileSettings::getRPMDVelocityFileName()
 {
-    return _rpmdVelFile;
+    return state()._rpmdVelFile;
 }
 
 /**
@@ -606,7 +834,7 @@ std::string OutputFileSettings::getRPMDVelocityFileName()
  */
 std::string OutputFileSettings::getRPMDForceFileName()
 {
-    return _rpmdForceFile;
+    return state()._rpmdForceFile;
 }
 
 /**
@@ -616,7 +844,7 @@ std::string OutputFileSettings::getRPMDForceFileName()
  */
 std::string OutputFileSettings::getRPMDChargeFileName()
 {
-    return _rpmdChargeFile;
+    return state()._rpmdChargeFile;
 }
 
 /**
@@ -626,7 +854,7 @@ std::string OutputFileSettings::getRPMDChargeFileName()
  */
 std::string OutputFileSettings::getRPMDEnergyFileName()
 {
-    return _rpmdEnergyFile;
+    return state()._rpmdEnergyFile;
 }
 
 /**
@@ -634,4 +862,27 @@ std::string OutputFileSettings::getRPMDEnergyFileName()
  *
  * @return std::string
  */
-std::string OutputFileSettings::getTimingsFileName() { return _timeFile; }
\ No newline at end of file
+std::string OutputFileSettings::getTimingsFileName()
+{
+    return state()._timeFile;
+}
+
+/**
+ * @brief get the timings trace file name
+ *
+ * @return std::string
+ */
+std::string OutputFileSettings::getTimingsTraceFileName()
+{
+    return state()._traceFile;
+}
+
+/**
+ * @brief get the replica exchange file name
+ *
+ * @return std::string
+ */
+std::string OutputFileSettings::getReplicaExchangeFileName()
+{
+    return state()._rexFile;
+}
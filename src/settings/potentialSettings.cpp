@@ -23,12 +23,23 @@
 #include "potentialSettings.hpp"
 
 #include "exceptions.hpp"
+#include "settingsInstance.hpp"
 #include "stringUtilities.hpp"
 
 using namespace settings;
 using namespace utilities;
 using namespace customException;
 
+/**
+ * @brief get the potential settings state of the active settings instance
+ *
+ * @return PotentialSettings::State&
+ */
+PotentialSettings::State &PotentialSettings::state()
+{
+    return SettingsInstance::getActive().getPotentialSettings();
+}
+
 /**
  * @brief return string of nonCoulombType
  *
@@ -88,22 +99,22 @@ void PotentialSettings::setNonCoulombType(const std::string_view &type)
     const auto typeToLower = toLowerAndReplaceDashesCopy(type);
 
     if (typeToLower == "lj")
-        _nonCoulombType = LJ;
+        state()._nonCoulombType = LJ;
 
     else if (typeToLower == "lj_9_12")
-        _nonCoulombType = LJ_9_12;
+        state()._nonCoulombType = LJ_9_12;
 
     else if (typeToLower == "buck")
-        _nonCoulombType = BUCKINGHAM;
+        state()._nonCoulombType = BUCKINGHAM;
 
     else if (typeToLower == "morse")
-        _nonCoulombType = MORSE;
+        state()._nonCoulombType = MORSE;
 
     else if (typeToLower == "guff")
-        _nonCoulombType = GUFF;
+        state()._nonCoulombType = GUFF;
 
     else
-        _nonCoulombType = NONE;
+        state()._nonCoulombType = NONE;
 }
 
 /**
@@ -113,7 +124,7 @@ void PotentialSettings::setNonCoulombType(const std::string_view &type)
  */
 void PotentialSettings::setNonCoulombType(const NonCoulombType type)
 {
-    _nonCoulombType = type;
+    state()._nonCoulombType = type;
 }
 
 void PotentialSettings::setCoulombLongRangeType(const std::string_view &type)
@@ -122,10 +133,10 @@ void PotentialSettings::setCoulombLongRangeType(const std::string_view &type)
     const auto typeToLower = toLowerCopy(type);
 
     if (typeToLower == "wolf")
-        _coulombLRType = WOLF;
+        state()._coulombLRType = WOLF;
 
     else if (typeToLower == "shifted")
-        _coulombLRType = SHIFTED;
+        state()._coulombLRType = SHIFTED;
 
     else
         throw UserInputException(
@@ -141,7 +152,7 @@ void PotentialSettings::setCoulombLongRangeType(const std::string_view &type)
 void PotentialSettings::setCoulombLongRangeType(const CoulombLongRangeType &type
 )
 {
-    _coulombLRType = type;
+    state()._coulombLRType = type;
 }
 
 /**
@@ -151,7 +162,7 @@ void PotentialSettings::setCoulombLongRangeType(const CoulombLongRangeType &type
  */
 void PotentialSettings::setCoulombRadiusCutOff(const double coulombRadiusCutOff)
 {
-    _coulombRadiusCutOff = coulombRadiusCutOff;
+    state()._coulombRadiusCutOff = coulombRadiusCutOff;
 }
 
 /**
@@ -161,7 +172,7 @@ void PotentialSettings::setCoulombRadiusCutOff(const double coulombRadiusCutOff)
  */
 void PotentialSettings::setScale14Coulomb(const double scale14Coulomb)
 {
-    _scale14Coulomb = scale14Coulomb;
+    state()._scale14Coulomb = scale14Coulomb;
 }
 
 /**
@@ -172,7 +183,7 @@ void PotentialSettings::setScale14Coulomb(const double scale14Coulomb)
  */
 void PotentialSettings::setScale14VanDerWaals(const double scale14VanDerWaals)
 {
-    _scale14VanDerWaals = scale14VanDerWaals;
+    state()._scale14VanDerWaals = scale14VanDerWaals;
 }
 
 /**
@@ -182,7 +193,7 @@ void PotentialSettings::setScale14VanDerWaals(const double scale14VanDerWaals)
  */
 void PotentialSettings::setWolfParameter(const double wolfParameter)
 {
-    _wolfParameter = wolfParameter;
+    state()._wolfParameter = wolfParameter;
 }
 
 /********************
@@ -198,7 +209,7 @@ void PotentialSettings::setWolfParameter(const double wolfParameter)
  */
 CoulombLongRangeType PotentialSettings::getCoulombLongRangeType()
 {
-    return _coulombLRType;
+    return state()._coulombLRType;
 }
 
 /**
@@ -208,7 +219,7 @@ CoulombLongRangeType PotentialSettings::getCoulombLongRangeType()
  */
 NonCoulombType PotentialSettings::getNonCoulombType()
 {
-    return _nonCoulombType;
+    return state()._nonCoulombType;
 }
 
 /**
@@ -218,7 +229,7 @@ NonCoulombType PotentialSettings::getNonCoulombType()
  */
 double PotentialSettings::getCoulombRadiusCutOff()
 {
-    return _coulombRadiusCutOff;
+    return state()._coulombRadiusCutOff;
 }
 
 /**
@@ -226,18 +237,24 @@ double PotentialSettings::getCoulombRadiusCutOff()
  *
  * @return double
  */
-double PotentialSettings::getScale14Coulomb() { return _scale14Coulomb; }
+double PotentialSettings::getScale14Coulomb()
+{
+    return state()._scale14Coulomb;
+}
 
 /**
  * @brief get the 1-4 Van der Waals scaling factor
  *
  * @return double
  */
-double PotentialSettings::getScale14VDW() { return _scale14VanDerWaals; }
+double PotentialSettings::getScale14VDW()
+{
+    return state()._scale14VanDerWaals;
+}
 
 /**
  * @brief get the Wolf parameter
  *
  * @return double
  */
-double PotentialSettings::getWolfParameter() { return _wolfParameter; }
\ No newline at end of file
+double PotentialSettings::getWolfParameter() { return state()._wolfParameter; }
\ No newline at end of file
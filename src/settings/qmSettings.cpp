@@ -24,8 +24,9 @@
 
 #include <format>   // for std::format
 
-#include "exceptions.hpp"        // for customException
-#include "stringUtilities.hpp"   // for toLowerCopy
+#include "exceptions.hpp"         // for customException
+#include "settingsInstance.hpp"   // for SettingsInstance
+#include "stringUtilities.hpp"    // for toLowerCopy
 
 using settings::MaceModelSize;
 using settings::MaceModelType;
@@ -34,6 +35,16 @@ using settings::QMSettings;
 using namespace customException;
 using namespace utilities;
 
+/**
+ * @brief get the QM settings state of the active settings instance
+ *
+ * @return QMSettings::State&
+ */
+QMSettings::State &QMSettings::state()
+{
+    return SettingsInstance::getActive().getQMSettings();
+}
+
 /**
  * @brief returns the qmMethod as string
  *
@@ -106,9 +117,9 @@ bool QMSettings::isExternalQMRunner()
 
     auto isExternal = false;
 
-    isExternal = isExternal || _qmMethod == DFTBPLUS;
-    isExternal = isExternal || _qmMethod == PYSCF;
-    isExternal = isExternal || _qmMethod == TURBOMOLE;
+    isExternal = isExternal || state()._qmMethod == DFTBPLUS;
+    isExternal = isExternal || state()._qmMethod == PYSCF;
+    isExternal = isExternal || state()._qmMethod == TURBOMOLE;
 
     return isExternal;
 }
@@ -130,19 +141,19 @@ void QMSettings::setQMMethod(const std::string_view &method)
     const auto methodToLower = toLowerCopy(method);
 
     if ("dftbplus" == methodToLower)
-        _qmMethod = DFTBPLUS;
+        state()._qmMethod = DFTBPLUS;
 
     else if ("pyscf" == methodToLower)
-        _qmMethod = PYSCF;
+        state()._qmMethod = PYSCF;
 
     else if ("turbomole" == methodToLower)
-        _qmMethod = TURBOMOLE;
+        state()._qmMethod = TURBOMOLE;
 
     else if ("mace" == methodToLower)
-        _qmMethod = MACE;
+        state()._qmMethod = MACE;
 
     else
-        _qmMethod = NONE;
+        state()._qmMethod = NONE;
 }
 
 /**
@@ -150,7 +161,10 @@ void QMSettings::setQMMethod(const std::string_view &method)
  *
  * @param method
  */
-void QMSettings::setQMMethod(const QMMethod method) { _qmMethod = method; }
+void QMSettings::setQMMethod(const QMMethod method)
+{
+    state()._qmMethod = method;
+}
 
 /**
  * @brief sets the maceModel to enum in settings
@@ -163,13 +177,13 @@ void QMSettings::setMaceModelSize(const std::string_view &model)
     const auto modelToLower = toLowerCopy(model);
 
     if ("large" == modelToLower)
-        _maceModelSize = LARGE;
+        state()._maceModelSize = LARGE;
 
     else if ("medium" == modelToLower)
-        _maceModelSize = MEDIUM;
+        state()._maceModelSize = MEDIUM;
 
     else if ("small" == modelToLower)
-        _maceModelSize = SMALL;
+        state()._maceModelSize = SMALL;
 
     else
         throw UserInputException(
@@ -184,7 +198,7 @@ void QMSettings::setMaceModelSize(const std::string_view &model)
  */
 void QMSettings::setMaceModelSize(const MaceModelSize model)
 {
-    _maceModelSize = model;
+    state()._maceModelSize = model;
 }
 
 /**
@@ -198,13 +212,13 @@ void QMSettings::setMaceModelType(const std::string_view &model)
     const auto modelToLower = toLowerAndReplaceDashesCopy(model);
 
     if ("mace_mp" == modelToLower)
-        _maceModelType = MACE_MP;
+        state()._maceModelType = MACE_MP;
 
     else if ("mace_off" == modelToLower)
-        _maceModelType = MACE_OFF;
+        state()._maceModelType = MACE_OFF;
 
     else if ("mace_anicc" == modelToLower)
-        _maceModelType = MACE_ANICC;
+        state()._maceModelType = MACE_ANICC;
 
     else
         throw UserInputException(
@@ -219,7 +233,7 @@ void QMSettings::setMaceModelType(const std::string_view &model)
  */
 void QMSettings::setMaceModelType(const MaceModelType model)
 {
-    _maceModelType = model;
+    state()._maceModelType = model;
 }
 
 /**
@@ -228,7 +242,7 @@ void QMSettings::setMaceModelType(const MaceModelType model)
  */
 void QMSettings::setMaceModelPath(const std::string_view &path)
 {
-    _maceModelPath = path;
+    state()._maceModelPath = path;
 }
 
 /**
@@ -238,7 +252,7 @@ void QMSettings::setMaceModelPath(const std::string_view &path)
  */
 void QMSettings::setQMScript(const std::string_view &script)
 {
-    _qmScript = toLowerAndReplaceDashesCopy(script);
+    state()._qmScript = toLowerAndReplaceDashesCopy(script);
 }
 
 /**
@@ -248,7 +262,7 @@ void QMSettings::setQMScript(const std::string_view &script)
  */
 void QMSettings::setQMScriptFullPath(const std::string_view &script)
 {
-    _qmScriptFullPath = script;
+    state()._qmScriptFullPath = script;
 }
 
 /**
@@ -257,7 +271,7 @@ void QMSettings::setQMScriptFullPath(const std::string_view &script)
  */
 void QMSettings::setUseDispersionCorrection(const bool useDispersionCorr)
 {
-    _useDispersionCorrection = useDispersionCorr;
+    state()._useDispersionCorrection = useDispersionCorr;
 }
 
 /**
@@ -267,7 +281,7 @@ void QMSettings::setUseDispersionCorrection(const bool useDispersionCorr)
  */
 void QMSettings::setQMLoopTimeLimit(const double time)
 {
-    _qmLoopTimeLimit = time;
+    state()._qmLoopTimeLimit = time;
 }
 
 /***************************
@@ -281,48 +295,54 @@ void QMSettings::setQMLoopTimeLimit(const double time)
  *
  * @return QMMethod
  */
-QMMethod QMSettings::getQMMethod() { return _qmMethod; }
+QMMethod QMSettings::getQMMethod() { return state()._qmMethod; }
 
 /**
  * @brief returns the maceModel
  *
  * @return MaceModelSize
  */
-MaceModelSize QMSettings::getMaceModelSize() { return _maceModelSize; }
+MaceModelSize QMSettings::getMaceModelSize() { return state()._maceModelSize; }
 
-MaceModelType QMSettings::getMaceModelType() { return _maceModelType; }
+MaceModelType QMSettings::getMaceModelType() { return state()._maceModelType; }
 
 /**
  * @brief returns the maceModelPath
  *
  * @return std::string
  */
-std::string QMSettings::getMaceModelPath() { return _maceModelPath; }
+std::string QMSettings::getMaceModelPath() { return state()._maceModelPath; }
 
 /**
  * @brief returns the qmScript
  *
  * @return std::string
  */
-std::string QMSettings::getQMScript() { return _qmScript; }
+std::string QMSettings::getQMScript() { return state()._qmScript; }
 
 /**
  * @brief returns the qmScriptFullPath
  *
  * @return std::string
  */
-std::string QMSettings::getQMScriptFullPath() { return _qmScriptFullPath; }
+std::string QMSettings::getQMScriptFullPath()
+{
+    return state()._qmScriptFullPath;
+}
 
 /**
  * @brief returns if the dispersion correction should be used
  *
  * @return bool
  */
-bool QMSettings::useDispersionCorr() { return _useDispersionCorrection; }
+bool QMSettings::useDispersionCorr()
+{
+    return state()._useDispersionCorrection;
+}
 
 /**
  * @brief returns the qmLoopTimeLimit
  *
  * @return double
  */
-double QMSettings::getQMLoopTimeLimit() { return _qmLoopTimeLimit; }
\ No newline at end of file
+double QMSettings::getQMLoopTimeLimit() { return state()._qmLoopTimeLimit; }
\ No newline at end of file
@@ -0,0 +1,145 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "replicaExchangeSettings.hpp"
+
+#include "settingsInstance.hpp"   // for SettingsInstance
+
+using settings::ReplicaExchangeSettings;
+
+/**
+ * @brief get the replica exchange settings state of the active settings
+ * instance
+ *
+ * @return ReplicaExchangeSettings::State&
+ */
+ReplicaExchangeSettings::State &ReplicaExchangeSettings::state()
+{
+    return SettingsInstance::getActive().getReplicaExchangeSettings();
+}
+
+/***************************
+ *                         *
+ * standard setter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief set the temperatures of the replicas in ascending order
+ *
+ * @param temperatures
+ */
+void ReplicaExchangeSettings::setTemperatures(
+    const std::vector<double> &temperatures
+)
+{
+    state()._temperatures = temperatures;
+}
+
+/**
+ * @brief set the number of steps between two exchange attempts
+ *
+ * @param exchangeFrequency
+ */
+void ReplicaExchangeSettings::setExchangeFrequency(
+    const size_t exchangeFrequency
+)
+{
+    state()._exchangeFrequency = exchangeFrequency;
+}
+
+/**
+ * @brief set the index of the replica of the current settings instance
+ *
+ * @param replicaIndex
+ */
+void ReplicaExchangeSettings::setReplicaIndex(const size_t replicaIndex)
+{
+    state()._replicaIndex = replicaIndex;
+}
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief get the temperatures of the replicas
+ *
+ * @return std::vector<double>
+ */
+std::vector<double> ReplicaExchangeSettings::getTemperatures()
+{
+    return state()._temperatures;
+}
+
+/**
+ * @brief get the number of replicas
+ *
+ * @return size_t
+ */
+size_t ReplicaExchangeSettings::getNumberOfReplicas()
+{
+    return state()._temperatures.size();
+}
+
+/**
+ * @brief get the number of steps between two exchange attempts
+ *
+ * @return size_t
+ */
+size_t ReplicaExchangeSettings::getExchangeFrequency()
+{
+    return state()._exchangeFrequency;
+}
+
+/**
+ * @brief get the index of the replica of the current settings instance
+ *
+ * @return size_t
+ */
+size_t ReplicaExchangeSettings::getReplicaIndex()
+{
+    return state()._replicaIndex;
+}
+
+/**
+ * @brief get the initial temperature of the replica of the current settings
+ * instance
+ *
+ * @return double
+ */
+double ReplicaExchangeSettings::getReplicaTemperature()
+{
+    return state()._temperatures[state()._replicaIndex];
+}
+
+/**
+ * @brief check if replica exchange md is activated
+ *
+ * @return bool
+ */
+bool ReplicaExchangeSettings::isReplicaExchangeActivated()
+{
+    return !state()._temperatures.empty();
+}
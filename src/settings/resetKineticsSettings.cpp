@@ -22,8 +22,20 @@
 
 #include "resetKineticsSettings.hpp"
 
+#include "settingsInstance.hpp"   // for SettingsInstance
+
 using settings::ResetKineticsSettings;
 
+/**
+ * @brief get the reset kinetics settings state of the active settings instance
+ *
+ * @return ResetKineticsSettings::State&
+ */
+ResetKineticsSettings::State &ResetKineticsSettings::state()
+{
+    return SettingsInstance::getActive().getResetKineticsSettings();
+}
+
 /***************************
  *                         *
  * standard setter methods *
@@ -35,28 +47,40 @@ using settings::ResetKineticsSettings;
  *
  * @param nScale
  */
-void ResetKineticsSettings::setNScale(const size_t nScale) { _nScale = nScale; }
+void ResetKineticsSettings::setNScale(const size_t nScale)
+{
+    state()._nScale = nScale;
+}
 
 /**
  * @brief set fScale
  *
  * @param fScale
  */
-void ResetKineticsSettings::setFScale(const size_t fScale) { _fScale = fScale; }
+void ResetKineticsSettings::setFScale(const size_t fScale)
+{
+    state()._fScale = fScale;
+}
 
 /**
  * @brief set nReset
  *
  * @param nReset
  */
-void ResetKineticsSettings::setNReset(const size_t nReset) { _nReset = nReset; }
+void ResetKineticsSettings::setNReset(const size_t nReset)
+{
+    state()._nReset = nReset;
+}
 
 /**
  * @brief set fReset
  *
  * @param fReset
  */
-void ResetKineticsSettings::setFReset(const size_t fReset) { _fReset = fReset; }
+void ResetKineticsSettings::setFReset(const size_t fReset)
+{
+    state()._fReset = fReset;
+}
 
 /**
  * @brief set nResetAngular
@@ -65,7 +89,7 @@ void ResetKineticsSettings::setFReset(const size_t fReset) { _fReset = fReset; }
  */
 void ResetKineticsSettings::setNResetAngular(const size_t nResetAngular)
 {
-    _nResetAngular = nResetAngular;
+    state()._nResetAngular = nResetAngular;
 }
 
 /**
@@ -75,7 +99,7 @@ void ResetKineticsSettings::setNResetAngular(const size_t nResetAngular)
  */
 void ResetKineticsSettings::setFResetAngular(const size_t fResetAngular)
 {
-    _fResetAngular = fResetAngular;
+    state()._fResetAngular = fResetAngular;
 }
 
 /***************************
@@ -89,39 +113,45 @@ void ResetKineticsSettings::setFResetAngular(const size_t fResetAngular)
  *
  * @return size_t
  */
-size_t ResetKineticsSettings::getNScale() { return _nScale; }
+size_t ResetKineticsSettings::getNScale() { return state()._nScale; }
 
 /**
  * @brief get fScale
  *
  * @return size_t
  */
-size_t ResetKineticsSettings::getFScale() { return _fScale; }
+size_t ResetKineticsSettings::getFScale() { return state()._fScale; }
 
 /**
  * @brief get nReset
  *
  * @return size_t
  */
-size_t ResetKineticsSettings::getNReset() { return _nReset; }
+size_t ResetKineticsSettings::getNReset() { return state()._nReset; }
 
 /**
  * @brief get fReset
  *
  * @return size_t
  */
-size_t ResetKineticsSettings::getFReset() { return _fReset; }
+size_t ResetKineticsSettings::getFReset() { return state()._fReset; }
 
 /**
  * @brief get nResetAngular
  *
  * @return size_t
  */
-size_t ResetKineticsSettings::getNResetAngular() { return _nResetAngular; }
+size_t ResetKineticsSettings::getNResetAngular()
+{
+    return state()._nResetAngular;
+}
 
 /**
  * @brief get fResetAngular
  *
  * @return size_t
  */
-size_t ResetKineticsSettings::getFResetAngular() { return _fResetAngular; }
\ No newline at end of file
+size_t ResetKineticsSettings::getFResetAngular()
+{
+    return state()._fResetAngular;
+}
\ No newline at end of file
@@ -22,8 +22,20 @@
 
 #include "ringPolymerSettings.hpp"
 
+#include "settingsInstance.hpp"   // for SettingsInstance
+
 using settings::RingPolymerSettings;
 
+/**
+ * @brief get the ring polymer settings state of the active settings instance
+ *
+ * @return RingPolymerSettings::State&
+ */
+RingPolymerSettings::State &RingPolymerSettings::state()
+{
+    return SettingsInstance::getActive().getRingPolymerSettings();
+}
+
 /**
  * @brief set number of beads for ring polymer md
  *
@@ -31,8 +43,8 @@ using settings::RingPolymerSettings;
  */
 void RingPolymerSettings::setNumberOfBeads(const size_t numberOfBeads)
 {
-    _numberOfBeads    = numberOfBeads;
-    _numberOfBeadsSet = true;
+    state()._numberOfBeads    = numberOfBeads;
+    state()._numberOfBeadsSet = true;
 }
 
 /**
@@ -40,11 +52,17 @@ void RingPolymerSettings::setNumberOfBeads(const size_t numberOfBeads)
  *
  * @return size_t
  */
-size_t RingPolymerSettings::getNumberOfBeads() { return _numberOfBeads; }
+size_t RingPolymerSettings::getNumberOfBeads()
+{
+    return state()._numberOfBeads;
+}
 
 /**
  * @brief check if number of beads for ring polymer md is set
  *
  * @return bool
  */
-bool RingPolymerSettings::isNumberOfBeadsSet() { return _numberOfBeadsSet; }
\ No newline at end of file
+bool RingPolymerSettings::isNumberOfBeadsSet()
+{
+    return state()._numberOfBeadsSet;
+}
\ No newline at end of file
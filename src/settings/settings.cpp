@@ -22,13 +22,26 @@
 
 #include "settings.hpp"
 
+#include <random>   // for random_device
 #include <string>   // for operator==, string
 
-#include "stringUtilities.hpp"   // for toLowerCopy
+#include "replicaExchangeSettings.hpp"   // for ReplicaExchangeSettings
+#include "settingsInstance.hpp"          // for SettingsInstance
+#include "stringUtilities.hpp"           // for toLowerCopy
 
 using namespace settings;
 using namespace utilities;
 
+/**
+ * @brief get the general settings state of the active settings instance
+ *
+ * @return Settings::State&
+ */
+Settings::State &Settings::state()
+{
+    return SettingsInstance::getActive().getGeneralSettings();
+}
+
 /**
  * @brief convert jobtype to string representation
  *
@@ -93,7 +106,7 @@ void Settings::setJobtype(const std::string_view jobtype)
  */
 void Settings::setJobtype(const JobType jobtype)
 {
-    _jobtype = jobtype;
+    state()._jobtype = jobtype;
 
     switch (jobtype)
     {
@@ -134,7 +147,7 @@ void Settings::setFloatingPointType(const std::string_view floatingPointType)
  */
 void Settings::setFloatingPointType(const FPType floatingPointType)
 {
-    _floatingPointType = floatingPointType;
+    state()._floatingPointType = floatingPointType;
 }
 
 /**
@@ -144,7 +157,7 @@ void Settings::setFloatingPointType(const FPType floatingPointType)
  */
 void Settings::setIsRingPolymerMDActivated(const bool isRingPolymerMD)
 {
-    _isRingPolymerMDActivated = isRingPolymerMD;
+    state()._isRingPolymerMDActivated = isRingPolymerMD;
 }
 
 /**
@@ -154,7 +167,17 @@ void Settings::setIsRingPolymerMDActivated(const bool isRingPolymerMD)
  */
 void Settings::setDimensionality(const size_t dimensionality)
 {
-    _dimensionality = dimensionality;
+    state()._dimensionality = dimensionality;
+}
+
+/**
+ * @brief sets the seed of the counter based random number generators
+ *
+ * @param randomSeed
+ */
+void Settings::setRandomSeed(const size_t randomSeed)
+{
+    state()._randomSeed = randomSeed;
 }
 
 /***************************
@@ -168,14 +191,14 @@ void Settings::setDimensionality(const size_t dimensionality)
  *
  * @return JobType
  */
-JobType Settings::getJobtype() { return _jobtype; }
+JobType Settings::getJobtype() { return state()._jobtype; }
 
 /**
  * @brief get the floating point type
  *
  * @return FPType
  */
-FPType Settings::getFloatingPointType() { return _floatingPointType; }
+FPType Settings::getFloatingPointType() { return state()._floatingPointType; }
 
 /**
  * @brief get the floating point string representation used in pybind11 bindings
@@ -183,7 +206,7 @@ FPType Settings::getFloatingPointType() { return _floatingPointType; }
  */
 std::string Settings::getFloatingPointPybindString()
 {
-    if (_floatingPointType == FPType::FLOAT)
+    if (state()._floatingPointType == FPType::FLOAT)
         return "float32";
     else
         return "float64";
@@ -194,7 +217,30 @@ std::string Settings::getFloatingPointPybindString()
  *
  * @return size_t
  */
-size_t Settings::getDimensionality() { return _dimensionality; }
+size_t Settings::getDimensionality() { return state()._dimensionality; }
+
+/**
+ * @brief get the seed of the counter based random number generators
+ *
+ * @details if no seed was given in the input file, a seed is drawn once from
+ * std::random_device and kept, so that all random number streams of the run
+ * share the same seed. The replica index of a replica exchange run is added
+ * to the seed, so that the replicas draw independent random numbers.
+ *
+ * @return size_t
+ */
+size_t Settings::getRandomSeed()
+{
+    auto &randomSeed = state()._randomSeed;
+
+    if (!randomSeed.has_value())
+    {
+        std::random_device randomDevice;
+        randomSeed = (size_t(randomDevice()) << 32) | randomDevice();
+    }
+
+    return randomSeed.value() + ReplicaExchangeSettings::getReplicaIndex();
+}
 
 /******************************
  *                            *
@@ -212,10 +258,10 @@ bool Settings::isQMOnly()
 {
     using enum JobType;
 
-    if (_jobtype == QM_MD)
+    if (state()._jobtype == QM_MD)
         return true;
 
-    else if (_jobtype == RING_POLYMER_QM_MD)
+    else if (state()._jobtype == RING_POLYMER_QM_MD)
         return true;
 
     else
@@ -233,10 +279,10 @@ bool Settings::isMDJobType()
     using enum JobType;
 
     auto isMD = false;
-    isMD      = isMD || _jobtype == MM_MD;
-    isMD      = isMD || _jobtype == QM_MD;
-    isMD      = isMD || _jobtype == QMMM_MD;
-    isMD      = isMD || _jobtype == RING_POLYMER_QM_MD;
+    isMD      = isMD || state()._jobtype == MM_MD;
+    isMD      = isMD || state()._jobtype == QM_MD;
+    isMD      = isMD || state()._jobtype == QMMM_MD;
+    isMD      = isMD || state()._jobtype == RING_POLYMER_QM_MD;
 
     return isMD;
 }
@@ -247,7 +293,7 @@ bool Settings::isMDJobType()
  * @return true/false
  *
  */
-bool Settings::isOptJobType() { return _jobtype == JobType::MM_OPT; }
+bool Settings::isOptJobType() { return state()._jobtype == JobType::MM_OPT; }
 
 /**
  * @brief Returns true if the MM simulations are activated
@@ -261,9 +307,9 @@ bool Settings::isMMActivated()
 
     auto isMM = false;
 
-    isMM = isMM || _jobtype == MM_MD;
-    isMM = isMM || _jobtype == QMMM_MD;
-    isMM = isMM || _jobtype == MM_OPT;
+    isMM = isMM || state()._jobtype == MM_MD;
+    isMM = isMM || state()._jobtype == QMMM_MD;
+    isMM = isMM || state()._jobtype == MM_OPT;
 
     return isMM;
 }
@@ -280,9 +326,9 @@ bool Settings::isQMActivated()
 
     auto isQM = false;
 
-    isQM = isQM || _jobtype == QM_MD;
-    isQM = isQM || _jobtype == QMMM_MD;
-    isQM = isQM || _jobtype == RING_POLYMER_QM_MD;
+    isQM = isQM || state()._jobtype == QM_MD;
+    isQM = isQM || state()._jobtype == QMMM_MD;
+    isQM = isQM || state()._jobtype == RING_POLYMER_QM_MD;
 
     return isQM;
 }
@@ -293,7 +339,10 @@ bool Settings::isQMActivated()
  * @return true/false
  *
  */
-bool Settings::isQMMMActivated() { return _jobtype == JobType::QMMM_MD; }
+bool Settings::isQMMMActivated()
+{
+    return state()._jobtype == JobType::QMMM_MD;
+}
 
 /**
  * @brief Returns true if only QM simulations are activated
@@ -323,7 +372,10 @@ bool Settings::isMMOnlyActivated()
  * @return true/false
  *
  */
-bool Settings::isRingPolymerMDActivated() { return _isRingPolymerMDActivated; }
+bool Settings::isRingPolymerMDActivated()
+{
+    return state()._isRingPolymerMDActivated;
+}
 
 /**
  * @brief Returns true if Kokkos is activated
@@ -331,7 +383,7 @@ bool Settings::isRingPolymerMDActivated() { return _isRingPolymerMDActivated; }
  * @return true/false
  *
  */
-bool Settings::useKokkos() { return _useKokkos; }
+bool Settings::useKokkos() { return state()._useKokkos; }
 
 /*****************************
  *                           *
@@ -343,16 +395,22 @@ bool Settings::useKokkos() { return _useKokkos; }
  * @brief activate ring polymer MD simulations
  *
  */
-void Settings::activateRingPolymerMD() { _isRingPolymerMDActivated = true; }
+void Settings::activateRingPolymerMD()
+{
+    state()._isRingPolymerMDActivated = true;
+}
 
 /**
  * @brief activate Kokkos
  *
  */
-void Settings::activateKokkos() { _useKokkos = true; }
+void Settings::activateKokkos() { state()._useKokkos = true; }
 
 /**
  * @brief deactivate ring polymer MD simulations
  *
  */
-void Settings::deactivateRingPolymerMD() { _isRingPolymerMDActivated = false; }
\ No newline at end of file
+void Settings::deactivateRingPolymerMD()
+{
+    state()._isRingPolymerMDActivated = false;
+}
\ No newline at end of file
@@ -0,0 +1,244 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "settingsInstance.hpp"
+
+using namespace settings;
+
+/**
+ * @brief get the settings instance bound to the calling thread
+ *
+ * @details falls back to the process wide default instance if no instance
+ * is bound, e.g. in the tests or on OpenMP worker threads
+ *
+ * @return SettingsInstance&
+ */
+SettingsInstance &SettingsInstance::getActive()
+{
+    if (_active != nullptr)
+        return *_active;
+
+    return getDefault();
+}
+
+/**
+ * @brief get the process wide default settings instance
+ *
+ * @return SettingsInstance&
+ */
+SettingsInstance &SettingsInstance::getDefault()
+{
+    static SettingsInstance defaultInstance;
+
+    return defaultInstance;
+}
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief get the state of the general settings
+ *
+ * @return Settings::State&
+ */
+Settings::State &SettingsInstance::getGeneralSettings()
+{
+    return _generalSettings;
+}
+
+/**
+ * @brief get the state of the constraint settings
+ *
+ * @return ConstraintSettings::State&
+ */
+ConstraintSettings::State &SettingsInstance::getConstraintSettings()
+{
+    return _constraintSettings;
+}
+
+/**
+ * @brief get the state of the convergence settings
+ *
+ * @return ConvSettings::State&
+ */
+ConvSettings::State &SettingsInstance::getConvSettings()
+{
+    return _convSettings;
+}
+
+/**
+ * @brief get the state of the file settings
+ *
+ * @return FileSettings::State&
+ */
+FileSettings::State &SettingsInstance::getFileSettings()
+{
+    return _fileSettings;
+}
+
+/**
+ * @brief get the state of the force field settings
+ *
+ * @return ForceFieldSettings::State&
+ */
+ForceFieldSettings::State &SettingsInstance::getForceFieldSettings()
+{
+    return _forceFieldSettings;
+}
+
+/**
+ * @brief get the state of the hybrid settings
+ *
+ * @return HybridSettings::State&
+ */
+HybridSettings::State &SettingsInstance::getHybridSettings()
+{
+    return _hybridSettings;
+}
+
+/**
+ * @brief get the state of the manostat settings
+ *
+ * @return ManostatSettings::State&
+ */
+ManostatSettings::State &SettingsInstance::getManostatSettings()
+{
+    return _manostatSettings;
+}
+
+/**
+ * @brief get the state of the optimizer settings
+ *
+ * @return OptimizerSettings::State&
+ */
+OptimizerSettings::State &SettingsInstance::getOptimizerSettings()
+{
+    return _optimizerSettings;
+}
+
+/**
+ * @brief get the state of the output file settings
+ *
+ * @return OutputFileSettings::State&
+ */
+OutputFileSettings::State &SettingsInstance::getOutputFileSettings()
+{
+    return _outputFileSettings;
+}
+
+/**
+ * @brief get the state of the potential settings
+ *
+ * @return PotentialSettings::State&
+ */
+PotentialSettings::State &SettingsInstance::getPotentialSettings()
+{
+    return _potentialSettings;
+}
+
+/**
+ * @brief get the state of the QM settings
+ *
+ * @return QMSettings::State&
+ */
+QMSettings::State &SettingsInstance::getQMSettings() { return _qmSettings; }
+
+/**
+ * @brief get the state of the reset kinetics settings
+ *
+ * @return ResetKineticsSettings::State&
+ */
+ResetKineticsSettings::State &SettingsInstance::getResetKineticsSettings()
+{
+    return _resetKineticsSettings;
+}
+
+/**
+ * @brief get the state of the replica exchange settings
+ *
+ * @return ReplicaExchangeSettings::State&
+ */
+ReplicaExchangeSettings::State &SettingsInstance::getReplicaExchangeSettings()
+{
+    return _replicaExchangeSettings;
+}
+
+/**
+ * @brief get the state of the ring polymer settings
+ *
+ * @return RingPolymerSettings::State&
+ */
+RingPolymerSettings::State &SettingsInstance::getRingPolymerSettings()
+{
+    return _ringPolymerSettings;
+}
+
+/**
+ * @brief get the state of the simulation box settings
+ *
+ * @return SimulationBoxSettings::State&
+ */
+SimulationBoxSettings::State &SettingsInstance::getSimulationBoxSettings()
+{
+    return _simulationBoxSettings;
+}
+
+/**
+ * @brief get the state of the thermostat settings
+ *
+ * @return ThermostatSettings::State&
+ */
+ThermostatSettings::State &SettingsInstance::getThermostatSettings()
+{
+    return _thermostatSettings;
+}
+
+/**
+ * @brief get the state of the timings settings
+ *
+ * @return TimingsSettings::State&
+ */
+TimingsSettings::State &SettingsInstance::getTimingsSettings()
+{
+    return _timingsSettings;
+}
+
+/**
+ * @brief Construct a new Settings Scope object and bind the given instance
+ * to the calling thread
+ *
+ * @param instance
+ */
+SettingsScope::SettingsScope(SettingsInstance &instance)
+    : _previous(SettingsInstance::_active)
+{
+    SettingsInstance::_active = &instance;
+}
+
+/**
+ * @brief Destroy the Settings Scope object and restore the previously bound
+ * instance
+ */
+SettingsScope::~SettingsScope() { SettingsInstance::_active = _previous; }
@@ -22,8 +22,20 @@
 
 #include "simulationBoxSettings.hpp"
 
+#include "settingsInstance.hpp"   // for SettingsInstance
+
 using settings::SimulationBoxSettings;
 
+/**
+ * @brief get the simulation box settings state of the active settings instance
+ *
+ * @return SimulationBoxSettings::State&
+ */
+SimulationBoxSettings::State &SimulationBoxSettings::state()
+{
+    return SettingsInstance::getActive().getSimulationBoxSettings();
+}
+
 /********************
  *                  *
  * standard setters *
@@ -37,7 +49,7 @@ using settings::SimulationBoxSettings;
  */
 void SimulationBoxSettings::setDensitySet(const bool densitySet)
 {
-    _isDensitySet = densitySet;
+    state()._isDensitySet = densitySet;
 }
 
 /**
@@ -45,7 +57,10 @@ void SimulationBoxSettings::setDensitySet(const bool densitySet)
  *
  * @param boxSet
  */
-void SimulationBoxSettings::setBoxSet(const bool boxSet) { _isBoxSet = boxSet; }
+void SimulationBoxSettings::setBoxSet(const bool boxSet)
+{
+    state()._isBoxSet = boxSet;
+}
 
 /**
  * @brief Set the initialize velocities
@@ -54,7 +69,19 @@ void SimulationBoxSettings::setBoxSet(const bool boxSet) { _isBoxSet = boxSet; }
  */
 void SimulationBoxSettings::setInitializeVelocities(const bool initVelocities)
 {
-    _initializeVelocities = initVelocities;
+    state()._initializeVelocities = initVelocities;
+}
+
+/**
+ * @brief Set the target hydrogen mass of the hydrogen mass repartitioning
+ *
+ * @details setting the mass activates the hydrogen mass repartitioning
+ *
+ * @param hydrogenMass in amu
+ */
+void SimulationBoxSettings::setHMRHydrogenMass(const double hydrogenMass)
+{
+    state()._hmrHydrogenMass = hydrogenMass;
 }
 
 /********************
@@ -69,7 +96,7 @@ void SimulationBoxSettings::setInitializeVelocities(const bool initVelocities)
  * @return true
  * @return false
  */
-bool SimulationBoxSettings::getDensitySet() { return _isDensitySet; }
+bool SimulationBoxSettings::getDensitySet() { return state()._isDensitySet; }
 
 /**
  * @brief get if the box is set
@@ -77,7 +104,7 @@ bool SimulationBoxSettings::getDensitySet() { return _isDensitySet; }
  * @return true
  * @return false
  */
-bool SimulationBoxSettings::getBoxSet() { return _isBoxSet; }
+bool SimulationBoxSettings::getBoxSet() { return state()._isBoxSet; }
 
 /**
  * @brief get if the velocities are initialized
@@ -87,5 +114,26 @@ bool SimulationBoxSettings::getBoxSet() { return _isBoxSet; }
  */
 bool SimulationBoxSettings::getInitializeVelocities()
 {
-    return _initializeVelocities;
-}
\ No newline at end of file
+    return state()._initializeVelocities;
+}
+
+/**
+ * @brief get if the hydrogen mass repartitioning is activated
+ *
+ * @return true
+ * @return false
+ */
+bool SimulationBoxSettings::isHMRActivated()
+{
+    return state()._hmrHydrogenMass.has_value();
+}
+
+/**
+ * @brief get the target hydrogen mass of the hydrogen mass repartitioning
+ *
+ * @return double in amu
+ */
+double SimulationBoxSettings::getHMRHydrogenMass()
+{
+    return state()._hmrHydrogenMass.value_or(0.0);
+}
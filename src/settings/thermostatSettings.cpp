@@ -22,11 +22,22 @@
 
 #include "thermostatSettings.hpp"
 
-#include "stringUtilities.hpp"   // for toLowerCopy
+#include "settingsInstance.hpp"   // for SettingsInstance
+#include "stringUtilities.hpp"    // for toLowerCopy
 
 using namespace settings;
 using namespace utilities;
 
+/**
+ * @brief get the thermostat settings state of the active settings instance
+ *
+ * @return ThermostatSettings::State&
+ */
+ThermostatSettings::State &ThermostatSettings::state()
+{
+    return SettingsInstance::getActive().getThermostatSettings();
+}
+
 /**
  * @brief return string of thermostatType
  *
@@ -53,12 +64,14 @@ std::string settings::string(const ThermostatType &thermostatType)
  *
  * @param index
  * @param chi
- * @return auto
+ * @return std::pair<std::map<size_t, double>::iterator, bool>
  */
-auto ThermostatSettings::addChi(const size_t index, const double chi)
-    -> decltype(_chi.try_emplace(index, chi))
+std::pair<std::map<size_t, double>::iterator, bool> ThermostatSettings::addChi(
+    const size_t index,
+    const double chi
+)
 {
-    return _chi.try_emplace(index, chi);
+    return state()._chi.try_emplace(index, chi);
 }
 
 /**
@@ -66,12 +79,14 @@ auto ThermostatSettings::addChi(const size_t index, const double chi)
  *
  * @param index
  * @param zeta
- * @return auto
+ * @return std::pair<std::map<size_t, double>::iterator, bool>
  */
-auto ThermostatSettings::addZeta(const size_t index, const double zeta)
-    -> decltype(_zeta.try_emplace(index, zeta))
+std::pair<std::map<size_t, double>::iterator, bool> ThermostatSettings::addZeta(
+    const size_t index,
+    const double zeta
+)
 {
-    return _zeta.try_emplace(index, zeta);
+    return state()._zeta.try_emplace(index, zeta);
 }
 
 /***************************
@@ -93,19 +108,19 @@ void ThermostatSettings::setThermostatType(
     const auto thermostatTypeToLower = toLowerAndReplaceDashesCopy(thermostatType);
 
     if (thermostatTypeToLower == "berendsen")
-        _thermostatType = BERENDSEN;
+        state()._thermostatType = BERENDSEN;
 
     else if (thermostatTypeToLower == "velocity_rescaling")
-        _thermostatType = VELOCITY_RESCALING;
+        state()._thermostatType = VELOCITY_RESCALING;
 
     else if (thermostatTypeToLower == "langevin")
-        _thermostatType = LANGEVIN;
+        state()._thermostatType = LANGEVIN;
 
     else if (thermostatTypeToLower == "nh_chain")
-        _thermostatType = NOSE_HOOVER;
+        state()._thermostatType = NOSE_HOOVER;
 
     else
-        _thermostatType = NONE;
+        state()._thermostatType = NONE;
 }
 
 /**
@@ -115,7 +130,7 @@ void ThermostatSettings::setThermostatType(
  */
 void ThermostatSettings::setThermostatType(const ThermostatType &thermostatType)
 {
-    _thermostatType = thermostatType;
+    state()._thermostatType = thermostatType;
 }
 
 /**
@@ -125,7 +140,7 @@ void ThermostatSettings::setThermostatType(const ThermostatType &thermostatType)
  */
 void ThermostatSettings::setNoseHooverChainLength(const size_t length)
 {
-    _nhChainLength = length;
+    state()._nhChainLength = length;
 }
 
 /**
@@ -135,7 +150,7 @@ void ThermostatSettings::setNoseHooverChainLength(const size_t length)
  */
 void ThermostatSettings::setTemperatureRampSteps(const size_t steps)
 {
-    _temperatureRampSteps = steps;
+    state()._temperatureRampSteps = steps;
 }
 
 /**
@@ -145,7 +160,7 @@ void ThermostatSettings::setTemperatureRampSteps(const size_t steps)
  */
 void ThermostatSettings::setTemperatureRampFrequency(const size_t frequency)
 {
-    _temperatureRampFrequency = frequency;
+    state()._temperatureRampFrequency = frequency;
 }
 
 /**
@@ -155,7 +170,7 @@ void ThermostatSettings::setTemperatureRampFrequency(const size_t frequency)
  */
 void ThermostatSettings::setTemperatureSet(const bool temperatureSet)
 {
-    _isTemperatureSet = temperatureSet;
+    state()._isTemperatureSet = temperatureSet;
 }
 
 /**
@@ -165,7 +180,7 @@ void ThermostatSettings::setTemperatureSet(const bool temperatureSet)
  */
 void ThermostatSettings::setStartTemperatureSet(const bool startTemperatureSet)
 {
-    _isStartTemperatureSet = startTemperatureSet;
+    state()._isStartTemperatureSet = startTemperatureSet;
 }
 
 /**
@@ -175,7 +190,7 @@ void ThermostatSettings::setStartTemperatureSet(const bool startTemperatureSet)
  */
 void ThermostatSettings::setEndTemperatureSet(const bool endTemperatureSet)
 {
-    _isEndTemperatureSet = endTemperatureSet;
+    state()._isEndTemperatureSet = endTemperatureSet;
 }
 
 /**
@@ -185,7 +200,7 @@ void ThermostatSettings::setEndTemperatureSet(const bool endTemperatureSet)
  */
 void ThermostatSettings::setTargetTemperature(const double targetTemperature)
 {
-    _targetTemperature = targetTemperature;
+    state()._targetTemperature = targetTemperature;
     setTemperatureSet(true);
     setActualTargetTemperature(targetTemperature);
 }
@@ -199,7 +214,7 @@ void ThermostatSettings::setActualTargetTemperature(
     const double actualTargetTemperature
 )
 {
-    _actualTargetTemperature = actualTargetTemperature;
+    state()._actualTargetTemperature = actualTargetTemperature;
 }
 
 /**
@@ -209,7 +224,7 @@ void ThermostatSettings::setActualTargetTemperature(
  */
 void ThermostatSettings::setStartTemperature(const double startTemperature)
 {
-    _startTemperature = startTemperature;
+    state()._startTemperature = startTemperature;
     setStartTemperatureSet(true);
 }
 
@@ -220,7 +235,7 @@ void ThermostatSettings::setStartTemperature(const double startTemperature)
  */
 void ThermostatSettings::setEndTemperature(const double endTemperature)
 {
-    _endTemperature = endTemperature;
+    state()._endTemperature = endTemperature;
     setEndTemperatureSet(true);
 }
 
@@ -231,7 +246,7 @@ void ThermostatSettings::setEndTemperature(const double endTemperature)
  */
 void ThermostatSettings::setRelaxationTime(const double relaxationTime)
 {
-    _relaxationTime = relaxationTime;
+    state()._relaxationTime = relaxationTime;
 }
 
 /**
@@ -241,7 +256,7 @@ void ThermostatSettings::setRelaxationTime(const double relaxationTime)
  */
 void ThermostatSettings::setFriction(const double friction)
 {
-    _friction = friction;
+    state()._friction = friction;
 }
 
 /**
@@ -251,7 +266,17 @@ void ThermostatSettings::setFriction(const double friction)
  */
 void ThermostatSettings::setNoseHooverCouplingFrequency(const double frequency)
 {
-    _nhCouplingFreq = frequency;
+    state()._nhCouplingFreq = frequency;
+}
+
+/**
+ * @brief set the random number generator state read from a checkpoint file
+ *
+ * @param randomState
+ */
+void ThermostatSettings::setRandomState(const std::string &randomState)
+{
+    state()._randomState = randomState;
 }
 
 /***************************
@@ -265,7 +290,10 @@ void ThermostatSettings::setNoseHooverCouplingFrequency(const double frequency)
  *
  * @return size_t
  */
-size_t ThermostatSettings::getNoseHooverChainLength() { return _nhChainLength; }
+size_t ThermostatSettings::getNoseHooverChainLength()
+{
+    return state()._nhChainLength;
+}
 
 /**
  * @brief get the temperature ramp steps
@@ -274,7 +302,7 @@ size_t ThermostatSettings::getNoseHooverChainLength() { return _nhChainLength; }
  */
 size_t ThermostatSettings::getTemperatureRampSteps()
 {
-    return _temperatureRampSteps;
+    return state()._temperatureRampSteps;
 }
 
 /**
@@ -284,7 +312,7 @@ size_t ThermostatSettings::getTemperatureRampSteps()
  */
 size_t ThermostatSettings::getTemperatureRampFrequency()
 {
-    return _temperatureRampFrequency;
+    return state()._temperatureRampFrequency;
 }
 
 /**
@@ -294,7 +322,7 @@ size_t ThermostatSettings::getTemperatureRampFrequency()
  */
 ThermostatType ThermostatSettings::getThermostatType()
 {
-    return _thermostatType;
+    return state()._thermostatType;
 }
 
 /**
@@ -302,7 +330,10 @@ ThermostatType ThermostatSettings::getThermostatType()
  *
  * @return bool
  */
-bool ThermostatSettings::isTemperatureSet() { return _isTemperatureSet; }
+bool ThermostatSettings::isTemperatureSet()
+{
+    return state()._isTemperatureSet;
+}
 
 /**
  * @brief is the start temperature set
@@ -311,7 +342,7 @@ bool ThermostatSettings::isTemperatureSet() { return _isTemperatureSet; }
  */
 bool ThermostatSettings::isStartTemperatureSet()
 {
-    return _isStartTemperatureSet;
+    return state()._isStartTemperatureSet;
 }
 
 /**
@@ -319,14 +350,20 @@ bool ThermostatSettings::isStartTemperatureSet()
  *
  * @return bool
  */
-bool ThermostatSettings::isEndTemperatureSet() { return _isEndTemperatureSet; }
+bool ThermostatSettings::isEndTemperatureSet()
+{
+    return state()._isEndTemperatureSet;
+}
 
 /**
  * @brief get the target temperature
  *
  * @return double
  */
-double ThermostatSettings::getTargetTemperature() { return _targetTemperature; }
+double ThermostatSettings::getTargetTemperature()
+{
+    return state()._targetTemperature;
+}
 
 /**
  * @brief get the actual target temperature
@@ -335,7 +372,7 @@ double ThermostatSettings::getTargetTemperature() { return _targetTemperature; }
  */
 double ThermostatSettings::getActualTargetTemperature()
 {
-    return _actualTargetTemperature;
+    return state()._actualTargetTemperature;
 }
 
 /**
@@ -343,28 +380,37 @@ double ThermostatSettings::getActualTargetTemperature()
  *
  * @return double
  */
-double ThermostatSettings::getStartTemperature() { return _startTemperature; }
+double ThermostatSettings::getStartTemperature()
+{
+    return state()._startTemperature;
+}
 
 /**
  * @brief get the end temperature
  *
  * @return double
  */
-double ThermostatSettings::getEndTemperature() { return _endTemperature; }
+double ThermostatSettings::getEndTemperature()
+{
+    return state()._endTemperature;
+}
 
 /**
  * @brief get the relaxation time
  *
  * @return double
  */
-double ThermostatSettings::getRelaxationTime() { return _relaxationTime; }
+double ThermostatSettings::getRelaxationTime()
+{
+    return state()._relaxationTime;
+}
 
 /**
  * @brief get the friction
  *
  * @return double
  */
-double ThermostatSettings::getFriction() { return _friction; }
+double ThermostatSettings::getFriction() { return state()._friction; }
 
 /**
  * @brief get the nose hoover coupling frequency
@@ -373,7 +419,7 @@ double ThermostatSettings::getFriction() { return _friction; }
  */
 double ThermostatSettings::getNoseHooverCouplingFrequency()
 {
-    return _nhCouplingFreq;
+    return state()._nhCouplingFreq;
 }
 
 /**
@@ -381,11 +427,21 @@ double ThermostatSettings::getNoseHooverCouplingFrequency()
  *
  * @return std::map<size_t, double>
  */
-std::map<size_t, double> ThermostatSettings::getChi() { return _chi; }
+std::map<size_t, double> ThermostatSettings::getChi() { return state()._chi; }
 
 /**
  * @brief get zeta
  *
  * @return std::map<size_t, double>
  */
-std::map<size_t, double> ThermostatSettings::getZeta() { return _zeta; }
\ No newline at end of file
+std::map<size_t, double> ThermostatSettings::getZeta() { return state()._zeta; }
+
+/**
+ * @brief get the random number generator state read from a checkpoint file
+ *
+ * @return std::string empty if no state was read
+ */
+std::string ThermostatSettings::getRandomState()
+{
+    return state()._randomState;
+}
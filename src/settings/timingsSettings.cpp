@@ -22,8 +22,20 @@
 
 #include "timingsSettings.hpp"
 
+#include "settingsInstance.hpp"   // for SettingsInstance
+
 using settings::TimingsSettings;
 
+/**
+ * @brief get the timings settings state of the active settings instance
+ *
+ * @return TimingsSettings::State&
+ */
+TimingsSettings::State &TimingsSettings::state()
+{
+    return SettingsInstance::getActive().getTimingsSettings();
+}
+
 /********************
  *                  *
  * standard setters *
@@ -37,8 +49,8 @@ using settings::TimingsSettings;
  */
 void TimingsSettings::setTimeStep(const double timeStep)
 {
-    _timeStep      = timeStep;
-    _isTimeStepSet = true;
+    state()._timeStep      = timeStep;
+    state()._isTimeStepSet = true;
 }
 
 /**
@@ -48,7 +60,7 @@ void TimingsSettings::setTimeStep(const double timeStep)
  */
 void TimingsSettings::setStepCount(const size_t stepCount)
 {
-    _stepCount = stepCount;
+    state()._stepCount = stepCount;
 }
 
 /**
@@ -58,7 +70,18 @@ void TimingsSettings::setStepCount(const size_t stepCount)
  */
 void TimingsSettings::setNumberOfSteps(const size_t numberOfSteps)
 {
-    _numberOfSteps = numberOfSteps;
+    state()._numberOfSteps = numberOfSteps;
+}
+
+/**
+ * @brief Set if the hardware performance counters are recorded for the
+ * timings sections
+ *
+ * @param isHardwareCounters
+ */
+void TimingsSettings::setHardwareCounters(const bool isHardwareCounters)
+{
+    state()._isHardwareCounters = isHardwareCounters;
 }
 
 /********************
@@ -72,25 +95,36 @@ void TimingsSettings::setNumberOfSteps(const size_t numberOfSteps)
  *
  * @return double
  */
-double TimingsSettings::getTimeStep() { return _timeStep; }
+double TimingsSettings::getTimeStep() { return state()._timeStep; }
 
 /**
  * @brief get the step count
  *
  * @return size_t
  */
-size_t TimingsSettings::getStepCount() { return _stepCount; }
+size_t TimingsSettings::getStepCount() { return state()._stepCount; }
 
 /**
  * @brief get the number of steps
  *
  * @return size_t
  */
-size_t TimingsSettings::getNumberOfSteps() { return _numberOfSteps; }
+size_t TimingsSettings::getNumberOfSteps() { return state()._numberOfSteps; }
 
 /**
  * @brief check if the time step is set
  *
  * @return bool
  */
-bool TimingsSettings::isTimeStepSet() { return _isTimeStepSet; }
\ No newline at end of file
+bool TimingsSettings::isTimeStepSet() { return state()._isTimeStepSet; }
+
+/**
+ * @brief check if the hardware performance counters are recorded for the
+ * timings sections
+ *
+ * @return bool
+ */
+bool TimingsSettings::isHardwareCounters()
+{
+    return state()._isHardwareCounters;
+}
@@ -22,14 +22,18 @@
 
 #include "constraintsSetup.hpp"
 
+#include "baoab.hpp"                // for BAOAB
 #include "constraintSettings.hpp"   // for getShakeMaxIter, getShakeTolerance, getRattleMaxIter, getRattleTolerance
 #include "constraints.hpp"    // for Constraints
 #include "engine.hpp"         // for Engine
+#include "exceptions.hpp"     // for InputFileException
 #include "mShakeReader.hpp"   // for readMShake
+#include "mdEngine.hpp"       // for MDEngine
 
 using namespace setup;
 using namespace engine;
 using namespace settings;
+using namespace customException;
 
 using input::mShake::readMShake;
 
@@ -65,15 +69,41 @@ ConstraintsSetup::ConstraintsSetup(Engine &engine) : _engine(engine){};
  */
 void ConstraintsSetup::setup()
 {
+    checkIntegrator();
     setupTolerances();
     setupMaxIterations();
     setupRefBondLengths();
     setupMShake();
+    setupSettle();
     setupDegreesOfFreedom();
 
     writeSetupInfo();
 }
 
+/**
+ * @brief checks that the integrator supports the constraints
+ *
+ * @details the O part of the BAOAB integrator adds random velocities to all
+ * atoms without projecting them onto the constraint manifold, therefore it
+ * cannot be combined with SHAKE, M-SHAKE or SETTLE
+ *
+ * @throw InputFileException if the BAOAB integrator is used with SHAKE like
+ * constraints
+ */
+void ConstraintsSetup::checkIntegrator()
+{
+    auto *mdEngine = dynamic_cast<MDEngine *>(&_engine);
+
+    if (mdEngine == nullptr || !_engine.getConstraints().isShakeLikeActive())
+        return;
+
+    if (dynamic_cast<const integrator::BAOAB *>(&mdEngine->getIntegrator()))
+        throw InputFileException(
+            "The BAOAB integrator cannot be combined with SHAKE, M-SHAKE or "
+            "SETTLE constraints"
+        );
+}
+
 /**
  * @brief setup M-SHAKE
  *
@@ -90,6 +120,24 @@ void ConstraintsSetup::setupMShake()
     constraints.initMShake();
 }
 
+/**
+ * @brief setup SETTLE for all rigid three-site molecules
+ *
+ * @details the molecules are detected from the M-SHAKE references and the
+ * SHAKE bond constraints
+ */
+void ConstraintsSetup::setupSettle()
+{
+    auto &constraints = _engine.getConstraints();
+
+    if (!constraints.isShakeLikeActive())
+        return;
+
+    constraints.initSettle(_engine.getSimulationBox());
+
+    _settleMolecules = constraints.getNumberOfSettleMolecules();
+}
+
 /**
  * @brief sets constraints tolerances
  *
@@ -273,6 +321,7 @@ void ConstraintsSetup::writeNConstraintBonds()
     const auto nShakeBondsMsg  = std::format("Number of SHAKE bonds:       {}", nShakeBonds);
     const auto nMShakeTypesMsg = std::format("Number of M-SHAKE types:     {}", nMShakeTypes);
     const auto nMShakeMolsMsg  = std::format("Number of M-SHAKE molecules: {}", nMShakeMols);
+    const auto nSettleMolsMsg  = std::format("Number of SETTLE molecules:  {}", _settleMolecules);
     // clang-format on
 
     auto &logOutput = _engine.getLogOutput();
@@ -280,5 +329,6 @@ void ConstraintsSetup::writeNConstraintBonds()
     logOutput.writeSetupInfo(nShakeBondsMsg);
     logOutput.writeSetupInfo(nMShakeTypesMsg);
     logOutput.writeSetupInfo(nMShakeMolsMsg);
+    logOutput.writeSetupInfo(nSettleMolsMsg);
     logOutput.writeEmptyLine();
 }
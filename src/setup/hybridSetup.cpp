@@ -22,7 +22,7 @@
 
 #include "hybridSetup.hpp"
 
-#include <algorithm>     // for min, unique
+#include <algorithm>     // for min, unique, none_of
 #include <cstddef>       // for size_t
 #include <format>        // for format
 #include <ranges>        // for sort
@@ -30,11 +30,14 @@
 #include <string_view>   // for string_view
 #include <vector>        // for vector
 
+#include "atom.hpp"             // for Atom
 #include "engine.hpp"           // for QMMMMDEngine
 #include "exceptions.hpp"       // for InputFileException
 #include "fileSettings.hpp"     // for FileSettings
 #include "hybridSettings.hpp"   // for HybridSettings
+#include "qmSettings.hpp"       // for QMSettings
 #include "settings.hpp"         // for Settings
+#include "simulationBox.hpp"    // for SimulationBox
 
 #ifdef PYTHON_ENABLED
 #include "selection.hpp"   // for select
@@ -75,10 +78,31 @@ HybridSetup::HybridSetup(Engine &engine) : _engine(engine){};
  */
 void HybridSetup::setup()
 {
+    checkQMRunner();
     setupQMCenter();
     setupQMOnlyList();
     setupMMOnlyList();
-    throw UserInputException("Not implemented yet");
+    checkRadii();
+    setupWriteInfo();
+}
+
+/**
+ * @brief check if the QM runner supports QM/MM calculations
+ *
+ * @details the QM region of a QM/MM calculation only contains a subset of the
+ * atoms of the system. This is only supported by the external QM programs,
+ * the ASE based QM runners always calculate the whole system.
+ *
+ * @throw InputFileException if the QM runner is not an external QM program
+ */
+void HybridSetup::checkQMRunner() const
+{
+    if (!QMSettings::isExternalQMRunner())
+        throw InputFileException(std::format(
+            "The QM method {} is not supported for QM/MM calculations. Please "
+            "use an external QM program via \"qm_prog\".",
+            string(QMSettings::getQMMethod())
+        ));
 }
 
 /**
@@ -101,10 +125,16 @@ void HybridSetup::setupQMCenter()
 /**
  * @brief setup QM only list
  *
+ * @details if no QM only list is given, no atom is treated as QM only atom
+ *
  */
 void HybridSetup::setupQMOnlyList()
 {
     const auto qmOnlyListString = HybridSettings::getCoreOnlyListString();
+
+    if (qmOnlyListString.empty())
+        return;
+
     const auto qmOnlyList = parseSelection(qmOnlyListString, "qm_only_list");
 
     _engine.getSimulationBox().setupQMOnlyAtoms(qmOnlyList);
@@ -113,15 +143,90 @@ void HybridSetup::setupQMOnlyList()
 /**
  * @brief setup MM only list
  *
+ * @details if no MM only list is given, no atom is treated as MM only atom
+ *
  */
 void HybridSetup::setupMMOnlyList()
 {
     const auto mmOnlyListString = HybridSettings::getNonCoreOnlyListString();
+
+    if (mmOnlyListString.empty())
+        return;
+
     const auto mmOnlyList = parseSelection(mmOnlyListString, "mm_only_list");
 
     _engine.getSimulationBox().setupMMOnlyAtoms(mmOnlyList);
 }
 
+/**
+ * @brief check the radii of the QM/MM regions
+ *
+ * @details the smoothing region is the outer shell of the QM core region and
+ * therefore the smoothing radius must not exceed the core radius. The point
+ * charges within the layer radius embed the QM region, therefore the layer
+ * radius must not be smaller than the core radius if it is set.
+ *
+ * @throw InputFileException if the smoothing radius is larger than the core
+ * radius
+ * @throw InputFileException if the layer radius is smaller than the core
+ * radius
+ * @throw UserInputException if the QM region is always empty
+ */
+void HybridSetup::checkRadii() const
+{
+    const auto coreRadius      = HybridSettings::getCoreRadius();
+    const auto layerRadius     = HybridSettings::getLayerRadius();
+    const auto smoothingRadius = HybridSettings::getSmoothingRadius();
+
+    if (smoothingRadius > coreRadius)
+        throw InputFileException(std::format(
+            "The qmmm_smoothing_radius {} is larger than the qm_core_radius "
+            "{}.",
+            smoothingRadius,
+            coreRadius
+        ));
+
+    if (layerRadius > 0.0 && layerRadius < coreRadius)
+        throw InputFileException(std::format(
+            "The qmmm_layer_radius {} is smaller than the qm_core_radius {}.",
+            layerRadius,
+            coreRadius
+        ));
+
+    const auto &atoms    = _engine.getSimulationBox().getAtoms();
+    const auto  isQMOnly = [](const auto &atom) { return atom->isQMOnly(); };
+
+    if (coreRadius <= 0.0 && std::ranges::none_of(atoms, isQMOnly))
+        throw UserInputException(
+            "The QM region of the QM/MM calculation is empty. Please set the "
+            "qm_core_radius or select QM atoms via the qm_only_list."
+        );
+}
+
+/**
+ * @brief write info about the QM/MM setup to the log file
+ *
+ */
+void HybridSetup::setupWriteInfo() const
+{
+    auto &logOutput = _engine.getLogOutput();
+
+    const auto coreRadius      = HybridSettings::getCoreRadius();
+    const auto layerRadius     = HybridSettings::getLayerRadius();
+    const auto smoothingRadius = HybridSettings::getSmoothingRadius();
+
+    // clang-format off
+    const auto coreMsg      = std::format("QM core radius:         {:.3f} Angstrom", coreRadius);
+    const auto layerMsg     = std::format("QM/MM layer radius:     {:.3f} Angstrom", layerRadius);
+    const auto smoothingMsg = std::format("QM/MM smoothing radius: {:.3f} Angstrom", smoothingRadius);
+    // clang-format on
+
+    logOutput.writeSetupInfo(coreMsg);
+    logOutput.writeSetupInfo(layerMsg);
+    logOutput.writeSetupInfo(smoothingMsg);
+    logOutput.writeEmptyLine();
+}
+
 /**
  * @brief parse selection string
  *
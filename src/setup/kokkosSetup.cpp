@@ -131,7 +131,7 @@ void KokkosSetup::setup()
     const auto wolfPotential = dynamic_cast<const CoulombWolf &>(coulombPot);
 
     _engine.initKokkosCoulombWolf(
-        CoulombWolf::getCoulombRadiusCutOff(),
+        wolfPotential.getCoulombRadiusCutOff(),
         wolfPotential.getKappa(),
         wolfPotential.getWolfParameter1(),
         wolfPotential.getWolfParameter2(),
@@ -27,12 +27,14 @@
 
 #include "berendsenManostat.hpp"             // for BerendsenManostat
 #include "constants/conversionFactors.hpp"   // for _PS_TO_FS_
-#include "exceptions.hpp"         // for InputFileException, customException
-#include "manostat.hpp"           // for BerendsenManostat, Manostat, manostat
-#include "manostatSettings.hpp"   // for ManostatSettings
-#include "mdEngine.hpp"           // for Engine
-#include "settings.hpp"           // for IsMDJobType
+#include "exceptions.hpp"           // for InputFileException, customException
+#include "manostat.hpp"             // for BerendsenManostat, Manostat, manostat
+#include "manostatSettings.hpp"     // for ManostatSettings
+#include "mdEngine.hpp"             // for Engine
+#include "monteCarloManostat.hpp"   // for MonteCarloManostat
+#include "settings.hpp"             // for IsMDJobType
 #include "stochasticRescalingManostat.hpp"   // for StochasticRescalingManostat
+#include "thermostatSettings.hpp"            // for ThermostatSettings
 #include "typeAliases.hpp"
 
 using namespace setup;
@@ -71,7 +73,8 @@ ManostatSetup::ManostatSetup(MDEngine &engine) : _engine(engine){};
  *
  * @details checks if a manostat was set in the input file,
  * If a manostat was selected than the user has to provide a target pressure for
- * the manostat.
+ * the manostat. The random number generator state of a stochastic manostat is
+ * restored if it was read from a checkpoint file.
  *
  * @note the base class manostat does not apply any pressure coupling to the
  * system and therefore it represents the none manostat.
@@ -94,9 +97,15 @@ void ManostatSetup::setup()
     else if (manostatType == STOCHASTIC_RESCALING)
         setupStochasticRescalingManostat();
 
+    else if (manostatType == MONTE_CARLO)
+        setupMonteCarloManostat();
+
     else
         _engine.makeManostat(Manostat());
 
+    if (const auto state = ManostatSettings::getRandomState(); !state.empty())
+        _engine.getManostat().setRandomState(state);
+
     writeSetupInfo();
 }
 
@@ -196,6 +205,53 @@ void ManostatSetup::setupStochasticRescalingManostat()
     }
 }
 
+/**
+ * @brief setup Monte Carlo manostat
+ *
+ * @details constructs a Monte Carlo manostat which evaluates the inter
+ * molecular energies with the potential and the cell list of the engine and
+ * adds it to the engine
+ *
+ * @throws InputFileException if the job type is not MM-MD
+ * @throws InputFileException if no temperature is set
+ * @throws InputFileException if the isotropy is full_anisotropic
+ */
+void ManostatSetup::setupMonteCarloManostat()
+{
+    if (Settings::getJobtype() != JobType::MM_MD)
+        throw InputFileException(
+            "Monte Carlo manostat is only implemented for MM-MD simulations"
+        );
+
+    if (!ThermostatSettings::isTemperatureSet())
+        throw InputFileException(
+            "Temperature not set for monte_carlo manostat"
+        );
+
+    const auto isotropy = ManostatSettings::getIsotropy();
+
+    if (isotropy == Isotropy::FULL_ANISOTROPIC)
+        throw InputFileException(
+            "Monte Carlo manostat does not support full_anisotropic isotropy"
+        );
+
+    const auto pTarget   = ManostatSettings::getTargetPressure();
+    const auto frequency = ManostatSettings::getMonteCarloFrequency();
+    const auto dVolume   = ManostatSettings::getVolumeChange();
+
+    auto manostat = MonteCarloManostat(pTarget, frequency, dVolume, isotropy);
+
+    manostat.set2DAxes(
+        ManostatSettings::get2DAnisotropicAxis(),
+        ManostatSettings::get2DIsotropicAxes()
+    );
+
+    manostat.setPotential(_engine.getSharedPotential());
+    manostat.setCellList(_engine.getSharedCellList());
+
+    _engine.makeManostat(manostat);
+}
+
 /**
  * @brief write setup info
  *
@@ -207,6 +263,9 @@ void ManostatSetup::writeSetupInfo() const
     if (ManostatSettings::isBerendsenBased())
         writeBerendsenSetup();
 
+    if (ManostatSettings::getManostatType() == ManostatType::MONTE_CARLO)
+        writeMonteCarloSetup();
+
     if (ManostatSettings::getManostatType() != ManostatType::NONE)
         writeIsotropy();
 }
@@ -231,6 +290,10 @@ void ManostatSetup::writeManostatSelection() const
             logOutput.writeSetupInfo("Stochastic rescaling manostat selected");
             break;
 
+        case MONTE_CARLO:
+            logOutput.writeSetupInfo("Monte Carlo manostat selected");
+            break;
+
         default: logOutput.writeSetupInfo("No manostat selected");
     }
 
@@ -255,6 +318,26 @@ void ManostatSetup::writeBerendsenSetup() const
     logOutput.writeEmptyLine();
 }
 
+/**
+ * @brief write Monte Carlo setup
+ *
+ */
+void ManostatSetup::writeMonteCarloSetup() const
+{
+    auto &logOutput = _engine.getLogOutput();
+
+    const auto pressure  = ManostatSettings::getTargetPressure();
+    const auto frequency = ManostatSettings::getMonteCarloFrequency();
+    const auto dVolume   = ManostatSettings::getVolumeChange();
+
+    // clang-format off
+    logOutput.writeSetupInfo(std::format("Target pressure:      {}", pressure));
+    logOutput.writeSetupInfo(std::format("Volume move freq:     {} steps", frequency));
+    logOutput.writeSetupInfo(std::format("Max. volume change:   {} V", dVolume));
+    // clang-format on
+    logOutput.writeEmptyLine();
+}
+
 /**
  * @brief write isotropy setup
  *
@@ -31,6 +31,8 @@
 #include "defaults.hpp"
 #include "engine.hpp"
 #include "expDecay.hpp"
+#include "fire.hpp"
+#include "lbfgs.hpp"
 #include "mmEvaluator.hpp"
 #include "optEngine.hpp"
 #include "optimizerSettings.hpp"
@@ -94,6 +96,8 @@ void OptimizerSetup::setup()
     learningRateStrategy->setEvaluator(evaluator);
     learningRateStrategy->setOptimizer(optimizer);
 
+    optimizer->setEvaluator(evaluator);
+
     _optEngine.setLearningRateStrategy(learningRateStrategy);
     _optEngine.setOptimizer(optimizer);
     _optEngine.setEvaluator(evaluator);
@@ -130,6 +134,20 @@ pq::SharedOptimizer OptimizerSetup::setupEmptyOptimizer()
             break;
         }
 
+        case LBFGS:
+        {
+            const auto nAtoms = simBox.getNumberOfAtoms();
+            const auto memory = OptimizerSettings::getLBFGSMemory();
+            optimizer = std::make_shared<opt::LBFGS>(nEpochs, memory, nAtoms);
+            break;
+        }
+
+        case FIRE:
+        {
+            optimizer = std::make_shared<opt::FIRE>(nEpochs, setupFIRE());
+            break;
+        }
+
         default:
             throw UserInputException(
                 std::format("Unknown optimizer type {}", string(optimizerType))
@@ -143,6 +161,35 @@ pq::SharedOptimizer OptimizerSetup::setupEmptyOptimizer()
     return optimizer;
 }
 
+/**
+ * @brief Setup the parameters of the FIRE optimizer
+ *
+ * @throws UserInputException if the initial timestep is larger than the
+ * maximum timestep
+ */
+opt::FIREParameters OptimizerSetup::setupFIRE()
+{
+    FIREParameters parameters;
+
+    parameters.timestep         = OptimizerSettings::getFireTimestep();
+    parameters.maxTimestep      = OptimizerSettings::getFireMaxTimestep();
+    parameters.nMin             = OptimizerSettings::getFireNMin();
+    parameters.timestepIncrease = OptimizerSettings::getFireTimestepIncrease();
+    parameters.timestepDecrease = OptimizerSettings::getFireTimestepDecrease();
+    parameters.alphaStart       = OptimizerSettings::getFireAlphaStart();
+    parameters.alphaDecrease    = OptimizerSettings::getFireAlphaDecrease();
+
+    if (parameters.timestep > parameters.maxTimestep)
+        throw UserInputException(std::format(
+            "The FIRE timestep {} is greater than the maximum FIRE timestep "
+            "{}, which is not allowed.",
+            parameters.timestep,
+            parameters.maxTimestep
+        ));
+
+    return parameters;
+}
+
 /**
  * @brief Setup the learning rate strategy
  *
@@ -385,6 +432,7 @@ void OptimizerSetup::writeSetupInfo() const
 
     // clang-format off
     const auto optMsg        = std::format("Optimizer:                   {}", string(optimizer));
+    const auto memoryMsg     = std::format("L-BFGS memory:               {}", OptimizerSettings::getLBFGSMemory());
 
     const auto lrMsg         = std::format("Learning rate strategy:      {}", string(lrStrategy));
     const auto initialLRMsg  = std::format("Initial learning rate:       {:.2e}", initialLR);
@@ -401,6 +449,8 @@ void OptimizerSetup::writeSetupInfo() const
     auto &logOutput = _optEngine.getLogOutput();
 
     logOutput.writeSetupInfo(optMsg);
+    if (optimizer == OptimizerType::LBFGS)
+        logOutput.writeSetupInfo(memoryMsg);
     logOutput.writeEmptyLine();
 
     logOutput.writeSetupInfo(lrMsg);
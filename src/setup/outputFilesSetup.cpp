@@ -22,17 +22,21 @@
 
 #include "outputFilesSetup.hpp"
 
+#include <format>   // for format
 #include <string>   // for string
 
 #include "boxOutput.hpp"                      // for BoxFileOutput
+#include "checkpointFileOutput.hpp"           // for CheckpointFileOutput
 #include "energyOutput.hpp"                   // for EnergyOutput
 #include "engine.hpp"                         // for Engine
 #include "infoOutput.hpp"                     // for InfoOutput
 #include "logOutput.hpp"                      // for LogOutput
 #include "mdEngine.hpp"                       // for MDEngine
 #include "momentumOutput.hpp"                 // for MomentumOutput
+#include "observableOutput.hpp"               // for ObservableOutput
 #include "optEngine.hpp"                      // for OptEngine
 #include "outputFileSettings.hpp"             // for OutputFileSettings
+#include "replicaExchangeSettings.hpp"        // for ReplicaExchangeSettings
 #include "ringPolymerRestartFileOutput.hpp"   // for RingPolymerRestartFileOutput
 #include "ringPolymerTrajectoryOutput.hpp"    // for RingPolymerTrajectoryOutput
 #include "rstFileOutput.hpp"                  // for RstFileOutput
@@ -68,6 +72,12 @@ OutputFilesSetup::OutputFilesSetup(Engine &engine) : _engine(engine){};
 /**
  * @brief setup output files
  *
+ * @details if the observable output of an MD run is active, the energy,
+ * instant energy, momentum, virial, stress and box text files are not
+ * created, because their data is recorded into the binary observable file.
+ * The output files of the replicas of a replica exchange run are tagged with
+ * the index of the replica.
+ *
  */
 void OutputFilesSetup::setup()
 {
@@ -81,6 +91,12 @@ void OutputFilesSetup::setup()
 
     OutputFileSettings::replaceDefaultValues(prefix);
 
+    if (ReplicaExchangeSettings::isReplicaExchangeActivated())
+    {
+        const auto index = ReplicaExchangeSettings::getReplicaIndex();
+        OutputFileSettings::addFileNameTag(std::format("replica_{}", index));
+    }
+
     const auto logFileName     = OutputFileSettings::getLogFileName();
     const auto timingsFileName = OutputFileSettings::getTimingsFileName();
     const auto restartFileName = OutputFileSettings::getRestartFileName();
@@ -92,11 +108,22 @@ void OutputFilesSetup::setup()
     _engine.getLogOutput().setFilename(logFileName);
     _engine.getTimingsOutput().setFilename(timingsFileName);
     _engine.getRstFileOutput().setFilename(restartFileName);
-    _engine.getEnergyOutput().setFilename(energyFileName);
     _engine.getXyzOutput().setFilename(xyzFileName);
     _engine.getInfoOutput().setFilename(infoFileName);
     _engine.getForceOutput().setFilename(forceFileName);
 
+    if (OutputFileSettings::isTimingsTraceOutput())
+    {
+        const auto traceFile = OutputFileSettings::getTimingsTraceFileName();
+        _engine.getTimingsTraceOutput().setFilename(traceFile);
+    }
+
+    const auto isObsOutput =
+        Settings::isMDJobType() && OutputFileSettings::isObservableOutput();
+
+    if (!isObsOutput)
+        _engine.getEnergyOutput().setFilename(energyFileName);
+
     if (Settings::isMDJobType())
     {
         auto &mdEngine = dynamic_cast<MDEngine &>(_engine);
@@ -108,14 +135,23 @@ void OutputFilesSetup::setup()
         const auto virialFile = OutputFileSettings::getVirialFileName();
         const auto stressFile = OutputFileSettings::getStressFileName();
         const auto boxFile    = OutputFileSettings::getBoxFileName();
+        const auto chkFile    = OutputFileSettings::getCheckpointFileName();
+        const auto obsFile    = OutputFileSettings::getObservableFileName();
 
-        mdEngine.getInstantEnergyOutput().setFilename(instEnFile);
         mdEngine.getVelOutput().setFilename(velFile);
         mdEngine.getChargeOutput().setFilename(chargeFile);
-        mdEngine.getMomentumOutput().setFilename(momFile);
-        mdEngine.getVirialOutput().setFilename(virialFile);
-        mdEngine.getStressOutput().setFilename(stressFile);
-        mdEngine.getBoxFileOutput().setFilename(boxFile);
+        mdEngine.getCheckpointFileOutput().setFilename(chkFile);
+
+        if (isObsOutput)
+            mdEngine.getObservableOutput().setFilename(obsFile);
+        else
+        {
+            mdEngine.getInstantEnergyOutput().setFilename(instEnFile);
+            mdEngine.getMomentumOutput().setFilename(momFile);
+            mdEngine.getVirialOutput().setFilename(virialFile);
+            mdEngine.getStressOutput().setFilename(stressFile);
+            mdEngine.getBoxFileOutput().setFilename(boxFile);
+        }
 
         if (Settings::isRingPolymerMDActivated())
         {
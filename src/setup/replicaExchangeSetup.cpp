@@ -0,0 +1,141 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "replicaExchangeSetup.hpp"
+
+#include <format>    // for format
+#include <memory>    // for unique_ptr, make_unique
+#include <utility>   // for move
+
+#include "exceptions.hpp"                // for UserInputException
+#include "inputFileReader.hpp"           // for readJobType
+#include "mdEngine.hpp"                  // for MDEngine
+#include "outputFileSettings.hpp"        // for OutputFileSettings
+#include "replicaExchangeEngine.hpp"     // for ReplicaExchangeEngine
+#include "replicaExchangeSettings.hpp"   // for ReplicaExchangeSettings
+#include "settings.hpp"                  // for Settings
+#include "settingsInstance.hpp"          // for SettingsInstance, SettingsScope
+#include "setup.hpp"                     // for setupRequestedJob
+#include "thermostatSettings.hpp"        // for ThermostatSettings
+
+using namespace engine;
+using namespace settings;
+using namespace customException;
+
+/**
+ * @brief sets up the remaining replicas of a replica exchange run
+ *
+ * @details the given engine is the already set up replica 0. Every further
+ * replica is set up from the same input file in a fresh settings instance,
+ * the replica index only changes the initial temperature and the names of
+ * the output files. Finally the engine is replaced by the replica exchange
+ * engine owning all replicas. Nothing is done if no replica temperatures
+ * are given in the input file.
+ *
+ * @param inputFileName
+ * @param engine
+ */
+void setup::setupReplicaExchange(
+    const std::string &inputFileName,
+    pq::UniqueEngine  &engine
+)
+{
+    const SettingsScope settingsScope(engine->getSettings());
+
+    if (!ReplicaExchangeSettings::isReplicaExchangeActivated())
+        return;
+
+    const auto nReplicas = ReplicaExchangeSettings::getNumberOfReplicas();
+
+    auto replicaExchange = std::make_unique<ReplicaExchangeEngine>();
+
+    replicaExchange->setTemperatures(ReplicaExchangeSettings::getTemperatures());
+    replicaExchange->setExchangeFrequency(
+        ReplicaExchangeSettings::getExchangeFrequency()
+    );
+    replicaExchange->setupOutputFiles(
+        OutputFileSettings::getReplicaExchangeFileName()
+    );
+
+    auto *replica0 = dynamic_cast<MDEngine *>(engine.release());
+    replicaExchange->addReplica(std::unique_ptr<MDEngine>(replica0));
+
+    for (size_t i = 1; i < nReplicas; ++i)
+    {
+        SettingsInstance    settings;
+        const SettingsScope replicaScope(settings);
+
+        ReplicaExchangeSettings::setReplicaIndex(i);
+
+        auto replica = pq::UniqueEngine();
+        input::readJobType(inputFileName, replica);
+
+        setupRequestedJob(inputFileName, *replica);
+
+        auto *mdReplica = dynamic_cast<MDEngine *>(replica.release());
+        replicaExchange->addReplica(std::unique_ptr<MDEngine>(mdReplica));
+    }
+
+    engine = std::move(replicaExchange);
+}
+
+/**
+ * @brief checks that the job of the active settings can be run as replica
+ * exchange and sets the temperature of the replica
+ *
+ * @details only mm_md is supported, as the external QM programs of qm_md
+ * all share the same files in the working directory and the ring polymer
+ * beads are already distributed over MPI ranks. The replica temperature
+ * replaces the target temperature of the input file.
+ *
+ * @throws UserInputException if the job type is not mm_md
+ * @throws UserInputException if no thermostat is set
+ * @throws UserInputException if a temperature ramp is set
+ */
+void setup::setupReplicaSettings()
+{
+    if (!ReplicaExchangeSettings::isReplicaExchangeActivated())
+        return;
+
+    if (Settings::getJobtype() != JobType::MM_MD)
+        throw UserInputException(std::format(
+            "Replica exchange is only supported for the {} jobtype",
+            string(JobType::MM_MD)
+        ));
+
+    if (ThermostatSettings::getThermostatType() == ThermostatType::NONE)
+        throw UserInputException(
+            "Replica exchange requires a thermostat to keep the replicas at "
+            "their temperatures"
+        );
+
+    if (ThermostatSettings::isStartTemperatureSet())
+        throw UserInputException(
+            "Temperature ramping is not supported for replica exchange"
+        );
+
+    const auto temperature = ReplicaExchangeSettings::getReplicaTemperature();
+
+    ThermostatSettings::setTemperatureSet(true);
+    ThermostatSettings::setEndTemperatureSet(false);
+    ThermostatSettings::setTargetTemperature(temperature);
+}
@@ -157,11 +157,10 @@ void RingPolymerSetup::initializeBeads()
  */
 void RingPolymerSetup::initializeVelocitiesOfBeads()
 {
-    auto initVelocities = [](auto &bead)
-    {
-        MaxwellBoltzmann maxwellBoltzmann;
-        maxwellBoltzmann.initializeVelocities(bead);
-    };
+    MaxwellBoltzmann maxwellBoltzmann;
+
+    auto initVelocities = [&maxwellBoltzmann](auto &bead)
+    { maxwellBoltzmann.initializeVelocities(bead); };
 
     std::ranges::for_each(_engine.getRingPolymerBeads(), initVelocities);
 }
\ No newline at end of file
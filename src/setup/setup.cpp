@@ -43,11 +43,13 @@
 #include "potentialSetup.hpp"         // for setupPotential
 #include "qmSetup.hpp"                // for setupQM
 #include "qmmdEngine.hpp"             // for QMMDEngine
+#include "replicaExchangeSetup.hpp"   // for setupReplicaSettings
 #include "resetKineticsSetup.hpp"     // for setupResetKinetics
 #include "restartFileReader.hpp"      // for readRestartFile
 #include "ringPolymerEngine.hpp"      // for RingPolymerEngine
 #include "ringPolymerSetup.hpp"       // for setupRingPolymer
 #include "settings.hpp"               // for Settings
+#include "settingsInstance.hpp"       // for SettingsScope
 #include "simulationBoxSetup.hpp"     // for setupSimulationBox
 #include "thermostatSetup.hpp"        // for setupThermostat
 #include "timer.hpp"                  // for Timings
@@ -71,11 +73,16 @@ using namespace setup::resetKinetics;
 /**
  * @brief setup the engine
  *
+ * @details all settings read from the input file are stored in the settings
+ * instance of the engine
+ *
  * @param inputFileName
  * @param engine
  */
 void setup::setupRequestedJob(const std::string &inputFileName, Engine &engine)
 {
+    const SettingsScope settingsScope(engine.getSettings());
+
     auto simulationTimer = Timer("Simulation");
     auto setupTimer      = Timer("Setup");
 
@@ -91,6 +98,8 @@ void setup::setupRequestedJob(const std::string &inputFileName, Engine &engine)
                 string(Settings::getJobtype())
             ));
 
+    setupReplicaSettings();
+
     setupOutputFiles(engine);
 
     readFiles(engine);
@@ -119,7 +128,7 @@ void setup::startSetup(
 )
 {
     simulationTimer.startTimingsSection();
-    setupTimer.startTimingsSection("TotalSetup");
+    setupTimer.startTimingsSection<"TotalSetup">();
 
     engine.getStdoutOutput().writeHeader();
 }
@@ -138,7 +147,7 @@ void setup::endSetup(
     engine.getStdoutOutput().writeSetupCompleted();
     engine.getLogOutput().writeSetupCompleted();
 
-    setupTimer.stopTimingsSection("TotalSetup");
+    setupTimer.stopTimingsSection<"TotalSetup">();
     engine.getTimer().addSimulationTimer(simulationTimer);
     engine.addTimer(setupTimer);
 }
@@ -29,16 +29,21 @@
 #include <map>           // for map
 #include <numeric>       // for accumulate
 #include <string>        // for string, allocator, operator+
-#include <string_view>   // for string_view
-#include <vector>        // for vector
+#include <string_view>     // for string_view
+#include <unordered_set>   // for unordered_set
+#include <utility>         // for swap
+#include <vector>          // for vector
 
 #include "atom.hpp"            // for Atom, simulationBox
 #include "atomMassMap.hpp"     // for atomMassMap
 #include "atomNumberMap.hpp"   // for atomNumberMap
+#include "bond.hpp"            // for Bond
 #include "constants/conversionFactors.hpp"   // for _AMU_PER_ANGSTROM_CUBIC_TO_KG_PER_LITER_CUBIC_
+#include "constraints.hpp"                   // for Constraints
 #include "engine.hpp"                        // for Engine
 #include "exceptions.hpp"              // for MolDescriptorException
 #include "fileSettings.hpp"            // for FileSettings
+#include "forceFieldClass.hpp"         // for ForceField
 #include "forceFieldSettings.hpp"      // for ForceFieldSettings
 #include "logOutput.hpp"               // for LogOutput
 #include "maxwellBoltzmann.hpp"        // for MaxwellBoltzmann
@@ -96,6 +101,7 @@ void SimulationBoxSetup::setup()
 
     setAtomMasses();
     setAtomicNumbers();
+    repartitionHydrogenMasses();
     calculateMolMasses();
     calculateTotalCharge();
 
@@ -273,6 +279,89 @@ void SimulationBoxSetup::setAtomicNumbers()
     std::ranges::for_each(molecules, setAtomicNumbers);
 }
 
+/**
+ * @brief hydrogen mass repartitioning
+ *
+ * @details every hydrogen atom bonded to a heavy atom is set to the target
+ * hydrogen mass and the difference is subtracted from the mass of the heavy
+ * atom. The bonds are taken from the bond section and the shake section of
+ * the topology file. Bonds between different molecules are ignored, therefore
+ * the molecular masses are preserved. Each hydrogen atom is only
+ * repartitioned once.
+ *
+ * @throw UserInputException if the mass of a heavy atom would not be
+ * positive after the repartitioning
+ */
+void SimulationBoxSetup::repartitionHydrogenMasses()
+{
+    if (!SimulationBoxSettings::isHMRActivated())
+        return;
+
+    const auto hydrogenMass = SimulationBoxSettings::getHMRHydrogenMass();
+
+    std::unordered_set<const pq::Atom *> hydrogens;
+    auto                                 transferredMass = 0.0;
+
+    auto repartition = [&hydrogens, &transferredMass, hydrogenMass](
+                           const connectivity::Bond &bond
+                       )
+    {
+        if (bond.getMolecule1() != bond.getMolecule2())
+            return;
+
+        auto *heavyAtom = &bond.getMolecule1()->getAtom(bond.getAtomIndex1());
+        auto *hydrogen  = &bond.getMolecule2()->getAtom(bond.getAtomIndex2());
+
+        if (heavyAtom->getAtomicNumber() == 1)
+            std::swap(heavyAtom, hydrogen);
+
+        if (hydrogen->getAtomicNumber() != 1)
+            return;
+
+        if (heavyAtom->getAtomicNumber() == 1)
+            return;
+
+        if (!hydrogens.insert(hydrogen).second)
+            return;
+
+        const auto deltaMass = hydrogenMass - hydrogen->getMass();
+        const auto newMass   = heavyAtom->getMass() - deltaMass;
+
+        if (newMass <= 0.0)
+            throw UserInputException(std::format(
+                "Hydrogen mass repartitioning with a hydrogen mass of {} amu "
+                "results in a non positive mass of {} amu for atom \"{}\"",
+                hydrogenMass,
+                newMass,
+                heavyAtom->getName()
+            ));
+
+        heavyAtom->setMass(newMass);
+        hydrogen->setMass(hydrogenMass);
+
+        transferredMass += deltaMass;
+    };
+
+    std::ranges::for_each(_engine.getForceField().getBonds(), repartition);
+
+    const auto &bondConstraints = _engine.getConstraints().getBondConstraints();
+    std::ranges::for_each(bondConstraints, repartition);
+
+    auto &log = _engine.getLogOutput();
+
+    const auto nHydrogens = hydrogens.size();
+
+    log.writeSetupInfo("hydrogen mass repartitioning:");
+    log.writeSetupInfo(
+        std::format("hydrogen mass:     {:14.5f} amu", hydrogenMass)
+    );
+    log.writeSetupInfo(std::format("hydrogens:         {:8d}", nHydrogens));
+    log.writeSetupInfo(
+        std::format("transferred mass:  {:14.5f} amu", transferredMass)
+    );
+    log.writeEmptyLine();
+}
+
 /**
  * @brief calculates the molecular mass of each molecule in the simulation box
  *
@@ -30,12 +30,14 @@
 #include <string>       // for string
 #include <vector>       // for vector
 
+#include "baoab.hpp"                         // for BAOAB
 #include "berendsenThermostat.hpp"           // for BerendsenThermostat
 #include "constants/conversionFactors.hpp"   // for _PS_TO_FS_, _PER_CM_TO_HZ_
 #include "exceptions.hpp"                    // for InputFileException
 #include "langevinThermostat.hpp"            // for LangevinThermostat
 #include "mdEngine.hpp"                      // for Engine
 #include "noseHooverThermostat.hpp"          // for NoseHooverThermostat
+#include "philox.hpp"                        // for Philox
 #include "settings.hpp"                      // for Settings
 #include "thermostat.hpp"                    // for Thermostat
 #include "thermostatSettings.hpp"   // for ThermostatSettings, ThermostatType
@@ -48,6 +50,8 @@ using namespace engine;
 using namespace thermostat;
 using namespace customException;
 using namespace constants;
+using namespace integrator;
+using namespace utilities;
 
 /**
  * @brief wrapper for thermostat setup
@@ -77,12 +81,16 @@ ThermostatSetup::ThermostatSetup(MDEngine &engine) : _engine(engine){};
  *
  * @details checks if a thermostat was set in the input file,
  * If a thermostat was selected than the user has to provide a target
- * temperature for the thermostat.
+ * temperature for the thermostat. The random number generator state of a
+ * stochastic thermostat is restored if it was read from a checkpoint file.
+ * The BAOAB integrator can only be combined with the langevin thermostat.
  *
  * @note the base class Thermostat does not apply any temperature coupling to
  * the system and therefore it represents the none thermostat.
  *
  * @throws InputFileException if no temperature was set for the thermostat
+ * @throws InputFileException if the BAOAB integrator is used without the
+ * langevin thermostat
  *
  */
 void ThermostatSetup::setup()
@@ -90,6 +98,14 @@ void ThermostatSetup::setup()
     using enum ThermostatType;
 
     const auto thermostatType = ThermostatSettings::getThermostatType();
+    const auto *baoab = dynamic_cast<BAOAB *>(&_engine.getIntegrator());
+
+    if (baoab != nullptr && thermostatType != LANGEVIN)
+        throw InputFileException(std::format(
+            "The BAOAB integrator requires the langevin thermostat - {} "
+            "thermostat given",
+            string(thermostatType)
+        ));
 
     if (thermostatType != NONE)
         isTargetTemperatureSet();
@@ -107,6 +123,9 @@ void ThermostatSetup::setup()
         default: _engine.makeThermostat(Thermostat());
     }
 
+    if (const auto state = ThermostatSettings::getRandomState(); !state.empty())
+        _engine.getThermostat().setRandomState(state);
+
     setupTemperatureRamp();
 }
 
@@ -188,7 +207,13 @@ void ThermostatSetup::setupVelocityRescalingThermostat()
 /**
  * @brief setup langevin thermostat
  *
- * @details constructs a langevin thermostat and adds it to the engine
+ * @details constructs a langevin thermostat and adds it to the engine. If
+ * the BAOAB integrator is used, the stochastic part is applied by the
+ * integrator instead and the engine only gets a plain thermostat, which
+ * keeps track of the target temperature e.g. for temperature ramping. The
+ * random numbers of the integrator continue from the state stored in the
+ * checkpoint file or, for restart files without a random state, from the
+ * step of the restart file.
  *
  */
 void ThermostatSetup::setupLangevinThermostat()
@@ -196,7 +221,24 @@ void ThermostatSetup::setupLangevinThermostat()
     const auto targetTemp = ThermostatSettings::getTargetTemperature();
     const auto friction   = ThermostatSettings::getFriction();
 
-    _engine.makeThermostat(LangevinThermostat(targetTemp, friction));
+    auto *baoab = dynamic_cast<BAOAB *>(&_engine.getIntegrator());
+
+    if (baoab == nullptr)
+    {
+        _engine.makeThermostat(LangevinThermostat(targetTemp, friction));
+        return;
+    }
+
+    auto random = Philox(Settings::getRandomSeed(), PhiloxStream::LANGEVIN);
+    random.setStep(TimingsSettings::getStepCount());
+
+    baoab->setFriction(friction);
+    baoab->setRandom(random);
+
+    if (const auto state = ThermostatSettings::getRandomState(); !state.empty())
+        baoab->setRandomState(state);
+
+    _engine.makeThermostat(Thermostat(targetTemp));
 }
 
 /**
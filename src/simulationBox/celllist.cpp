@@ -204,7 +204,7 @@ void CellList::updateCellList(SimulationBox &simulationBox)
     if (!_activated)
         return;
 
-    startTimingsSection("Update");
+    startTimingsSection<"Update">();
 
     if (simulationBox.getBoxSizeHasChanged())
     {
@@ -223,7 +223,7 @@ void CellList::updateCellList(SimulationBox &simulationBox)
 
     addMoleculesToCells(simulationBox);
 
-    stopTimingsSection("Update");
+    stopTimingsSection<"Update">();
 }
 
 /**
@@ -22,13 +22,13 @@
 
 #include "simulationBox.hpp"
 
-#include <algorithm>   // for sort, unique
+#include <algorithm>   // for sort, unique, lower_bound
 #include <format>      // for format
 #include <numeric>     // for accumulate
-#include <random>      // for random_device, mt19937
 
 #include "constants.hpp"           // for _TEMPERATURE_FACTOR_
 #include "exceptions.hpp"          // for RstFileException, UserInputException
+#include "philox.hpp"              // for Philox
 #include "potentialSettings.hpp"   // for PotentialSettings
 #include "settings.hpp"            // for Settings
 #include "stlVector.hpp"           // for rms
@@ -39,6 +39,7 @@ using namespace simulationBox;
 using namespace customException;
 using namespace constants;
 using namespace settings;
+using namespace utilities;
 
 /**
  * @brief copy simulationBox object this
@@ -191,6 +192,37 @@ void SimulationBox::setupMMOnlyAtoms(const std::vector<int>& atomIndices)
     }
 }
 
+/**
+ * @brief calculate the center of the QM region
+ *
+ * @details the QM center is the center of mass of all QM center atoms.
+ * Distances are calculated relative to the first QM center atom, such that
+ * the center is also correct if the QM center atoms are split by the periodic
+ * boundaries.
+ *
+ * @return Vec3D
+ */
+Vec3D SimulationBox::calculateQMCenter() const
+{
+    auto       center        = Vec3D{0.0};
+    auto       mass          = 0.0;
+    const auto positionAtom1 = _qmCenterAtoms[0]->getPosition();
+
+    for (const auto& atom : _qmCenterAtoms)
+    {
+        const auto atomMass = atom->getMass();
+        const auto position = atom->getPosition();
+        const auto deltaPos = position - positionAtom1;
+
+        center += atomMass * (position - _box->calcShiftVector(deltaPos));
+        mass   += atomMass;
+    }
+
+    center /= mass;
+
+    return center - _box->calcShiftVector(center);
+}
+
 /**
  * @brief find moleculeType by moleculeType if (size_t)
  *
@@ -255,11 +287,33 @@ std::optional<size_t> SimulationBox::findMoleculeTypeByString(
         return std::nullopt;
 }
 
+/**
+ * @brief initializes the cumulative atom offsets of all molecules
+ *
+ * @details the offsets are used by findMoleculeByAtomIndex for a binary
+ * search. They are rebuilt automatically if the number of molecules or the
+ * total number of atoms changes and are invalidated by addAtom and
+ * addMolecule. Call this before looking up atoms from several threads.
+ */
+void SimulationBox::initMoleculeAtomOffsets()
+{
+    _moleculeAtomOffsets.resize(_molecules.size() + 1);
+    _moleculeAtomOffsets[0]   = 0;
+    _moleculeAtomOffsetsAtoms = _atoms.size();
+
+    for (size_t i = 0; i < _molecules.size(); ++i)
+    {
+        const auto nAtoms           = _molecules[i].getNumberOfAtoms();
+        _moleculeAtomOffsets[i + 1] = _moleculeAtomOffsets[i] + nAtoms;
+    }
+}
+
 /**
  * @brief find molecule by atom index
  *
  * @details return a pair of a pointer to the molecule and the index of the atom
- * in the molecule
+ * in the molecule. The atom index is 1-based. The molecule is found with a
+ * binary search in the cumulative atom offsets of the molecules.
  *
  * @param atomIndex
  * @return pair<Molecule *, size_t>
@@ -268,25 +322,28 @@ std::pair<Molecule*, size_t> SimulationBox::findMoleculeByAtomIndex(
     const size_t atomIndex
 )
 {
-    size_t sum = 0;
+    const auto isOutdated =
+        _moleculeAtomOffsets.size() != _molecules.size() + 1 ||
+        _moleculeAtomOffsetsAtoms != _atoms.size();
 
-    for (auto& molecule : _molecules)
-    {
-        const auto nAtomsInMolecule  = molecule.getNumberOfAtoms();
-        sum                         += molecule.getNumberOfAtoms();
+    if (isOutdated)
+        initMoleculeAtomOffsets();
 
-        if (sum >= atomIndex)
-        {
-            const auto index = atomIndex - (sum - nAtomsInMolecule) - 1;
-            return std::make_pair(&molecule, index);
-        }
-    }
+    const auto begin = _moleculeAtomOffsets.begin() + 1;
+    const auto end   = _moleculeAtomOffsets.end();
+    const auto iter  = std::lower_bound(begin, end, atomIndex);
+
+    if (iter == end)
+        throw UserInputException(std::format(
+            "Atom index {} out of range - total number of atoms: {}",
+            atomIndex,
+            _moleculeAtomOffsets.back()
+        ));
 
-    throw UserInputException(std::format(
-        "Atom index {} out of range - total number of atoms: {}",
-        atomIndex,
-        sum
-    ));
+    const auto moleculeIndex = size_t(iter - begin);
+    const auto offset        = _moleculeAtomOffsets[moleculeIndex];
+
+    return std::make_pair(&_molecules[moleculeIndex], atomIndex - offset - 1);
 }
 
 /**
@@ -673,29 +730,31 @@ Vec3D SimulationBox::calcShiftVector(const Vec3D& position) const
 /**
  * @brief initialize positions of all atoms
  *
+ * @details each atom is displaced randomly by at most displacement in each
+ * direction, using the position stream of the global seed
+ *
  */
 void SimulationBox::initPositions(const double displacement)
 {
-    std::random_device             randomDevice;
-    std::mt19937                   randomGenerator(randomDevice());
-    std::uniform_real_distribution uniformDist{-displacement, displacement};
+    const auto seed   = Settings::getRandomSeed();
+    const auto random = Philox(seed, PhiloxStream::POSITIONS);
 
-    auto displacePositions = [&uniformDist, &randomGenerator, this](auto& atom)
+    for (size_t i = 0; i < _atoms.size(); ++i)
     {
-        const auto random = Vec3D{
-            uniformDist(randomGenerator),
-            uniformDist(randomGenerator),
-            uniformDist(randomGenerator)
+        const auto uniform = random.uniforms(i);
+
+        const auto shift = Vec3D{
+            (2.0 * uniform[0] - 1.0) * displacement,
+            (2.0 * uniform[1] - 1.0) * displacement,
+            (2.0 * uniform[2] - 1.0) * displacement
         };
 
-        auto position = atom->getPosition() + random;
+        auto position = _atoms[i]->getPosition() + shift;
 
         applyPBC(position);
 
-        atom->setPosition(position);
-    };
-
-    std::ranges::for_each(_atoms, displacePositions);
+        _atoms[i]->setPosition(position);
+    }
 }
 
 /**
@@ -38,6 +38,7 @@ using namespace simulationBox;
 void SimulationBox::addAtom(const std::shared_ptr<Atom> atom)
 {
     _atoms.push_back(atom);
+    _moleculeAtomOffsets.clear();
 }
 
 /**
@@ -58,6 +59,7 @@ void SimulationBox::addQMAtom(const std::shared_ptr<Atom> atom)
 void SimulationBox::addMolecule(const Molecule &molecule)
 {
     _molecules.push_back(molecule);
+    _moleculeAtomOffsets.clear();
 }
 
 /**
@@ -234,6 +236,16 @@ std::vector<std::shared_ptr<Atom>> &SimulationBox::getQMAtoms()
     return _qmAtoms;
 }
 
+/**
+ * @brief get all QM center atoms
+ *
+ * @return std::vector<std::shared_ptr<Atom>>&
+ */
+std::vector<std::shared_ptr<Atom>> &SimulationBox::getQMCenterAtoms()
+{
+    return _qmCenterAtoms;
+}
+
 /**
  * @brief get all molecules
  *
@@ -64,7 +64,7 @@ void BerendsenThermostat::applyThermostat(
     PhysicalData  &data
 )
 {
-    startTimingsSection("Berendsen");
+    startTimingsSection<"Berendsen">();
 
     data.calculateTemperature(simulationBox);
 
@@ -80,7 +80,7 @@ void BerendsenThermostat::applyThermostat(
 
     data.setTemperature(_temperature * berendsenFactor * berendsenFactor);
 
-    stopTimingsSection("Berendsen");
+    stopTimingsSection<"Berendsen">();
 }
 
 /**
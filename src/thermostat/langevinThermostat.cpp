@@ -22,13 +22,14 @@
 
 #include "langevinThermostat.hpp"
 
-#include <algorithm>    // for __for_each_fn, for_each
-#include <cmath>        // for sqrt
-#include <functional>   // for identity
+#include <cmath>     // for sqrt
+#include <cstddef>   // for size_t
 
+#include "atom.hpp"                          // for Atom
 #include "constants/conversionFactors.hpp"   // for _FS_TO_S_, _KG_TO_GRAM_
 #include "constants/natureConstants.hpp"     // for _UNIVERSAL_GAS_CONSTANT_
 #include "physicalData.hpp"                  // for PhysicalData
+#include "settings.hpp"                      // for Settings
 #include "simulationBox.hpp"                 // for SimulationBox
 #include "thermostatSettings.hpp"            // for ThermostatType
 #include "timingsSettings.hpp"               // for TimingsSettings
@@ -40,11 +41,13 @@ using namespace physicalData;
 using namespace simulationBox;
 using namespace settings;
 using namespace linearAlgebra;
+using namespace utilities;
 
 /**
  * @brief Constructor for Langevin Thermostat
  *
- * @details automatically calculates sigma from friction and target temperature
+ * @details automatically calculates sigma from friction and target temperature.
+ * The random numbers are drawn from the Langevin stream of the global seed.
  *
  * @param targetTemperature
  * @param friction
@@ -53,7 +56,9 @@ LangevinThermostat::LangevinThermostat(
     const double targetTemperature,
     const double friction
 )
-    : Thermostat(targetTemperature), _friction(friction)
+    : Thermostat(targetTemperature),
+      _random(Settings::getRandomSeed(), PhiloxStream::LANGEVIN),
+      _friction(friction)
 {
     calculateSigma(friction, targetTemperature);
 }
@@ -64,7 +69,10 @@ LangevinThermostat::LangevinThermostat(
  * @param other
  */
 LangevinThermostat::LangevinThermostat(const LangevinThermostat &other)
-    : Thermostat(other), _friction(other._friction), _sigma(other._sigma)
+    : Thermostat(other),
+      _random(other._random),
+      _friction(other._friction),
+      _sigma(other._sigma)
 {
 }
 
@@ -92,36 +100,66 @@ void LangevinThermostat::calculateSigma(
  * @brief apply Langevin thermostat
  *
  * @details calculates the friction and random factor for each atom and applies
- * the Langevin thermostat to the velocities
+ * the Langevin thermostat to the velocities. The random numbers of an atom
+ * only depend on the seed, the call counter and the atom index, therefore
+ * the atoms are processed in parallel with results independent of the number
+ * of threads.
  *
  * @param simBox
  */
 void LangevinThermostat::applyLangevin(SimulationBox &simBox)
 {
-    auto applyFriction = [this](auto &atom)
-    {
-        const auto mass     = atom->getMass();
-        const auto timeStep = TimingsSettings::getTimeStep();
+    const auto &atoms    = simBox.getAtoms();
+    const auto  nAtoms   = atoms.size();
+    const auto  timeStep = TimingsSettings::getTimeStep();
 
-        const auto propagationFactor = 0.5 * timeStep * _FS_TO_S_ / mass;
+    // clang-format off
+    #pragma omp parallel for schedule(static)
+    // clang-format on
+    for (size_t i = 0; i < nAtoms; ++i)
+        applyLangevin(*atoms[i], i, timeStep);
 
-        const Vec3D randomFactor = {
-            std::normal_distribution<double>(0.0, 1.0)(_generator),
-            std::normal_distribution<double>(0.0, 1.0)(_generator),
-            std::normal_distribution<double>(0.0, 1.0)(_generator)
-        };
+    advanceRandom();
+}
+
+/**
+ * @brief apply Langevin thermostat to a single atom
+ *
+ * @details the random numbers are drawn for the given atom index of the
+ * current call counter, which is only advanced by advanceRandom. Therefore,
+ * this method can be fused with other per atom operations as long as all
+ * atoms are processed before advanceRandom is called.
+ *
+ * @param atom
+ * @param index index of the atom in the simulation box
+ * @param timeStep
+ */
+void LangevinThermostat::applyLangevin(
+    Atom        &atom,
+    const size_t index,
+    const double timeStep
+) const
+{
+    const auto mass = atom.getMass();
+
+    const auto propagationFactor = 0.5 * timeStep * _FS_TO_S_ / mass;
 
-        const auto velocity = atom->getVelocity();
-        auto       dv       = -propagationFactor * _friction * mass * velocity;
+    const auto  random       = _random.normals(index);
+    const Vec3D randomFactor = {random[0], random[1], random[2]};
 
-        dv += propagationFactor * _sigma * std::sqrt(mass) * randomFactor;
+    const auto velocity = atom.getVelocity();
+    auto       dv       = -propagationFactor * _friction * mass * velocity;
 
-        atom->addVelocity(dv);
-    };
+    dv += propagationFactor * _sigma * std::sqrt(mass) * randomFactor;
 
-    std::ranges::for_each(simBox.getAtoms(), applyFriction);
+    atom.addVelocity(dv);
 }
 
+/**
+ * @brief advances the call counter of the random number generator
+ */
+void LangevinThermostat::advanceRandom() { _random.advance(); }
+
 /**
  * @brief apply thermostat - Langevin
  *
@@ -133,12 +171,12 @@ void LangevinThermostat::applyThermostat(
     PhysicalData  &data
 )
 {
-    startTimingsSection("LangevinThermostat - Full Step");
+    startTimingsSection<"LangevinThermostat - Full Step">();
 
     applyLangevin(simBox);
     data.calculateTemperature(simBox);
 
-    stopTimingsSection("LangevinThermostat - Full Step");
+    stopTimingsSection<"LangevinThermostat - Full Step">();
 }
 
 /**
@@ -152,11 +190,11 @@ void LangevinThermostat::applyThermostat(
 void LangevinThermostat::
     applyThermostatHalfStep(SimulationBox &simBox, PhysicalData &)
 {
-    startTimingsSection("LangevinThermostat - Half Step");
+    startTimingsSection<"LangevinThermostat - Half Step">();
 
     applyLangevin(simBox);
 
-    stopTimingsSection("LangevinThermostat - Half Step");
+    stopTimingsSection<"LangevinThermostat - Half Step">();
 }
 
 /***************************
@@ -213,6 +251,26 @@ double LangevinThermostat::getFriction() const { return _friction; }
  */
 double LangevinThermostat::getSigma() const { return _sigma; }
 
+/**
+ * @brief get the state of the random number generator
+ *
+ * @return std::string
+ */
+std::string LangevinThermostat::getRandomState() const
+{
+    return _random.getState();
+}
+
+/**
+ * @brief set the state of the random number generator
+ *
+ * @param state as returned by getRandomState
+ */
+void LangevinThermostat::setRandomState(const std::string &state)
+{
+    _random.setState(state);
+}
+
 /**
  * @brief get the ThermostatType
  *
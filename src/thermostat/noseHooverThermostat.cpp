@@ -69,7 +69,7 @@ NoseHooverThermostat::NoseHooverThermostat(
  */
 void NoseHooverThermostat::applyThermostatOnForces(SimulationBox &simBox)
 {
-    startTimingsSection("Nose-Hoover - Forces");
+    startTimingsSection<"Nose-Hoover - Forces">();
 
     const auto kB        = _BOLTZMANN_CONSTANT_IN_KCAL_PER_MOL_;
     const auto kT_target = kB * _targetTemperature;
@@ -86,7 +86,7 @@ void NoseHooverThermostat::applyThermostatOnForces(SimulationBox &simBox)
 
     std::ranges::for_each(simBox.getAtoms(), applyNoseHoover);
 
-    stopTimingsSection("Nose-Hoover - Forces");
+    stopTimingsSection<"Nose-Hoover - Forces">();
 }
 
 /**
@@ -103,7 +103,7 @@ void NoseHooverThermostat::applyThermostat(
     PhysicalData  &physicalData
 )
 {
-    startTimingsSection("Nose-Hoover - Velocities");
+    startTimingsSection<"Nose-Hoover - Velocities">();
 
     physicalData.calculateTemperature(simBox);
 
@@ -151,7 +151,7 @@ void NoseHooverThermostat::applyThermostat(
     physicalData.setNoseHooverMomentumEnergy(energyMomentum);
     physicalData.setNoseHooverFrictionEnergy(energyFriction);
 
-    stopTimingsSection("Nose-Hoover - Velocities");
+    stopTimingsSection<"Nose-Hoover - Velocities">();
 }
 
 /***************************
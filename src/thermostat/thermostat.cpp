@@ -53,11 +53,11 @@ void Thermostat::applyThermostat(
     PhysicalData  &physicalData
 )
 {
-    startTimingsSection("Calc Temperature");
+    startTimingsSection<"Calc Temperature">();
 
     physicalData.calculateTemperature(simulationBox);
 
-    stopTimingsSection("Calc Temperature");
+    stopTimingsSection<"Calc Temperature">();
 }
 
 /**
@@ -167,6 +167,22 @@ size_t Thermostat::getRampingStepsLeft() const { return _rampingStepsLeft; }
  * @return size_t
  */
 size_t Thermostat::getRampingFrequency() const { return _rampingFrequency; }
+/**
+ * @brief get the state of the random number generator
+ *
+ * @details the base thermostat is deterministic and has no state
+ *
+ * @return std::string
+ */
+std::string Thermostat::getRandomState() const { return ""; }
+
+/**
+ * @brief set the state of the random number generator
+ *
+ * @details the base thermostat is deterministic and ignores the state
+ */
+void Thermostat::setRandomState(const std::string &) {}
+
 /**
  * @brief get the ThermostatType
  *
@@ -22,9 +22,10 @@
 
 #include "velocityRescalingThermostat.hpp"
 
-#include <cmath>    // for sqrt
-#include <memory>   // for __shared_ptr_access, shared_ptr
-#include <vector>   // for vector
+#include <cmath>     // for sqrt
+#include <memory>    // for __shared_ptr_access, shared_ptr
+#include <sstream>   // for istringstream, ostringstream
+#include <vector>    // for vector
 
 #include "atom.hpp"                 // for Atom
 #include "physicalData.hpp"         // for PhysicalData
@@ -75,7 +76,7 @@ void VelocityRescalingThermostat::applyThermostat(
     PhysicalData  &physicalData
 )
 {
-    startTimingsSection("Velocity Rescaling");
+    startTimingsSection<"Velocity Rescaling">();
 
     physicalData.calculateTemperature(simulationBox);
 
@@ -102,7 +103,7 @@ void VelocityRescalingThermostat::applyThermostat(
 
     physicalData.setTemperature(temperature);
 
-    stopTimingsSection("Velocity Rescaling");
+    stopTimingsSection<"Velocity Rescaling">();
 }
 
 /**
@@ -118,6 +119,31 @@ double VelocityRescalingThermostat::getTau() const { return _tau; }
  * @param tau
  */
 void VelocityRescalingThermostat::setTau(const double tau) { _tau = tau; }
+
+/**
+ * @brief get the state of the random number generator
+ *
+ * @return std::string
+ */
+std::string VelocityRescalingThermostat::getRandomState() const
+{
+    std::ostringstream stream;
+    stream << _generator;
+
+    return stream.str();
+}
+
+/**
+ * @brief set the state of the random number generator
+ *
+ * @param state as returned by getRandomState
+ */
+void VelocityRescalingThermostat::setRandomState(const std::string &state)
+{
+    std::istringstream stream(state);
+    stream >> _generator;
+}
+
 /**
  * @brief Get thermostat type
  *
@@ -104,4 +104,14 @@ void GlobalTimer::addTimer(const Timer& timer) { _timers.push_back(timer); }
  *
  * @return const std::vector<Timer>&
  */
-const std::vector<Timer>& GlobalTimer::getTimers() const { return _timers; }
\ No newline at end of file
+const std::vector<Timer>& GlobalTimer::getTimers() const { return _timers; }
+
+/**
+ * @brief get the simulation timer
+ *
+ * @return const Timer&
+ */
+const Timer& GlobalTimer::getSimulationTimer() const
+{
+    return _simulationTimer;
+}
\ No newline at end of file
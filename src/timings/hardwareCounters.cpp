@@ -0,0 +1,287 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "hardwareCounters.hpp"
+
+#include <cerrno>    // for errno
+#include <cstring>   // for strerror, memset
+#include <format>    // for format
+#include <vector>    // for erase
+
+#ifdef __linux__
+#include <linux/perf_event.h>   // for perf_event_attr, PERF_*
+#include <sys/ioctl.h>          // for ioctl
+#include <sys/syscall.h>        // for SYS_perf_event_open
+#include <unistd.h>             // for syscall, read, close
+#endif
+
+using namespace timings;
+
+/**
+ * @brief adds the counter values of another measurement
+ *
+ * @param rhs
+ * @return CounterValues&
+ */
+CounterValues &CounterValues::operator+=(const CounterValues &rhs)
+{
+    cycles       += rhs.cycles;
+    instructions += rhs.instructions;
+    cacheMisses  += rhs.cacheMisses;
+    branchMisses += rhs.branchMisses;
+
+    return *this;
+}
+
+/**
+ * @brief difference of two counter readings
+ *
+ * @param rhs
+ * @return CounterValues
+ */
+CounterValues CounterValues::operator-(const CounterValues &rhs) const
+{
+    return {
+        cycles - rhs.cycles,
+        instructions - rhs.instructions,
+        cacheMisses - rhs.cacheMisses,
+        branchMisses - rhs.branchMisses
+    };
+}
+
+/**
+ * @brief Construct a new Hardware Counters:: Hardware Counters object
+ *
+ * @details the counters are not opened before open() is called
+ */
+HardwareCounters::HardwareCounters() { _fds.fill(-1); }
+
+/**
+ * @brief Destroy the Hardware Counters:: Hardware Counters object
+ *
+ */
+HardwareCounters::~HardwareCounters() { close(); }
+
+/**
+ * @brief opens the counter group for the calling thread
+ *
+ * @details the cycles counter is the group leader, so that all counters
+ * are scheduled together. If any counter cannot be opened all counters are
+ * closed again and the reason is stored.
+ */
+void HardwareCounters::open()
+{
+    if (isOpen())
+        return;
+
+#ifdef __linux__
+    static constexpr std::array<uint64_t, _N_COUNTERS_> configs = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES
+    };
+
+    static constexpr std::array<const char *, _N_COUNTERS_> names = {
+        "cycles",
+        "instructions",
+        "cache misses",
+        "branch misses"
+    };
+
+    for (size_t i = 0; i < _N_COUNTERS_; ++i)
+    {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+
+        attr.type           = PERF_TYPE_HARDWARE;
+        attr.size           = sizeof(attr);
+        attr.config         = configs[i];
+        attr.read_format    = PERF_FORMAT_GROUP;
+        attr.disabled       = i == 0 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+
+        const auto groupFd = i == 0 ? -1 : _fds[0];
+
+        // measure the calling thread on any cpu
+        _fds[i] = int(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+
+        if (_fds[i] == -1)
+        {
+            const auto error = std::format(
+                "perf_event_open failed for {}: {}",
+                names[i],
+                std::strerror(errno)
+            );
+
+            close();
+
+            const std::lock_guard lock(_mutex);
+            _errorMessage = error;
+            return;
+        }
+    }
+
+    ioctl(_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+    const std::lock_guard lock(_mutex);
+    _registry.push_back(this);
+#else
+    const std::lock_guard lock(_mutex);
+    _errorMessage = "hardware counters are only supported on Linux";
+#endif
+}
+
+/**
+ * @brief closes all opened counters and removes the group from the registry
+ *
+ */
+void HardwareCounters::close()
+{
+    {
+        const std::lock_guard lock(_mutex);
+        std::erase(_registry, this);
+    }
+
+#ifdef __linux__
+    for (auto &fd : _fds)
+        if (fd != -1)
+            ::close(fd);
+#endif
+
+    _fds.fill(-1);
+}
+
+/**
+ * @brief check if the counter group is open
+ *
+ * @return bool
+ */
+bool HardwareCounters::isOpen() const { return _fds[0] != -1; }
+
+/**
+ * @brief reads all counters of the group
+ *
+ * @return CounterValues zero if the group is not open or the read failed
+ */
+CounterValues HardwareCounters::read() const
+{
+    CounterValues values;
+
+#ifdef __linux__
+    if (!isOpen())
+        return values;
+
+    // layout of PERF_FORMAT_GROUP: number of counters followed by values
+    std::array<uint64_t, _N_COUNTERS_ + 1> buffer{};
+
+    const auto nBytes = ::read(_fds[0], buffer.data(), sizeof(buffer));
+
+    if (nBytes != sizeof(buffer) || buffer[0] != _N_COUNTERS_)
+        return values;
+
+    values.cycles       = buffer[1];
+    values.instructions = buffer[2];
+    values.cacheMisses  = buffer[3];
+    values.branchMisses = buffer[4];
+#endif
+
+    return values;
+}
+
+/**
+ * @brief get the counter group of the calling thread
+ *
+ * @details the group is opened on the first call of each thread
+ *
+ * @return HardwareCounters&
+ */
+HardwareCounters &HardwareCounters::getThreadCounters()
+{
+    thread_local HardwareCounters counters;
+    thread_local bool             isInitialized = false;
+
+    if (!isInitialized)
+    {
+        counters.open();
+        isInitialized = true;
+    }
+
+    return counters;
+}
+
+/**
+ * @brief opens the counter groups of all threads of the OpenMP team
+ *
+ * @details the work of the parallel kernels is done by the OpenMP worker
+ * threads, which never start a timings section themselves. Opening their
+ * groups once registers them, so that readAll() also counts their work.
+ * Without OpenMP only the calling thread is opened.
+ */
+void HardwareCounters::openTeamCounters()
+{
+    static std::once_flag isOpened;
+
+    std::call_once(
+        isOpened,
+        []
+        {
+#pragma omp parallel
+            { (void)getThreadCounters(); }
+        }
+    );
+}
+
+/**
+ * @brief sums the counters of all registered thread groups
+ *
+ * @details the groups of other threads are read from the calling thread,
+ * which the kernel supports for counters of the same process. The sum
+ * includes everything the registered threads did in the measured
+ * interval, e.g. also the spinning of idle OpenMP workers.
+ *
+ * @return CounterValues
+ */
+CounterValues HardwareCounters::readAll()
+{
+    const std::lock_guard lock(_mutex);
+
+    CounterValues values;
+
+    for (const auto *counters : _registry) values += counters->read();
+
+    return values;
+}
+
+/**
+ * @brief get the reason why the counters could not be opened
+ *
+ * @return std::string empty if no error occurred
+ */
+std::string HardwareCounters::getErrorMessage()
+{
+    const std::lock_guard lock(_mutex);
+
+    return _errorMessage;
+}
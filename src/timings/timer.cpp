@@ -22,14 +22,17 @@
 
 #include "timer.hpp"
 
-#include <algorithm>   // for ranges::sort
-#include <ranges>      // for ranges::sort
+#include <algorithm>    // for ranges::sort, ranges::find
+#include <functional>   // for function
+#include <ranges>       // for ranges::sort
 
 #include "exceptions.hpp"
+#include "outputFileSettings.hpp"   // for OutputFileSettings
 #include "timingsSettings.hpp"
 
 using namespace timings;
 using namespace customException;
+using namespace settings;
 
 /**
  * @brief Construct a new Timer:: Timer object
@@ -50,13 +53,17 @@ std::vector<TimingsSection> Timer::getTimingDetails() const
 /**
  * @brief calculates the elapsed time in ms
  *
+ * @details only top level sections are summed up, since nested sections
+ * are already contained in their enclosing section
+ *
  */
 double Timer::calculateElapsedTime() const
 {
-    auto elapsedTime = 0;
+    auto elapsedTime = 0.0;
 
     for (const auto& timing : _timingDetails)
-        elapsedTime += timing.calculateElapsedTime();
+        if (timing.getDepth() == 0)
+            elapsedTime += timing.calculateElapsedTime();
 
     return elapsedTime;
 }
@@ -64,13 +71,17 @@ double Timer::calculateElapsedTime() const
 /**
  * @brief calculates the loop time in s
  *
+ * @details only top level sections are summed up, since nested sections
+ * are already contained in their enclosing section
+ *
  */
 double Timer::calculateLoopTime() const
 {
     auto loopTime = 0.0;
 
     for (const auto& timing : _timingDetails)
-        loopTime += timing.calculateLoopTime();
+        if (timing.getDepth() == 0)
+            loopTime += timing.calculateLoopTime();
 
     return loopTime;
 }
@@ -81,32 +92,57 @@ double Timer::calculateLoopTime() const
  */
 void Timer::startTimingsSection()
 {
-    const auto index = findTimingsSectionIndex(_name);
-
-    if (index == _timingDetails.size())
-    {
-        _timingDetails.emplace_back(_name);
-        _timingDetails.back().beginTimer();
-    }
-    else
-        _timingDetails[index].beginTimer();
+    startTimingsSection(std::string_view(_name));
 }
 
 /**
  * @brief starts a new timer
  *
+ * @details the name is interned on every call, hot paths should use the
+ * compile time overload startTimingsSection<"name">() instead
+ *
  */
 void Timer::startTimingsSection(const std::string_view name)
 {
-    const auto index = findTimingsSectionIndex(name);
+    startTimingsSection(TimingsRegistry::intern(name));
+}
+
+/**
+ * @brief starts a timer by its interned section id
+ *
+ * @details if the section is started for the first time while another
+ * section of this timer is running, it is nested into the running section
+ *
+ * @param id
+ */
+void Timer::startTimingsSection(const size_t id)
+{
+    auto index = findTimingsSectionIndex(id);
 
     if (index == _timingDetails.size())
     {
-        _timingDetails.emplace_back(name);
-        _timingDetails.back().beginTimer();
+        auto parentId = TimingsSection::_NO_PARENT_;
+        auto depth    = size_t(0);
+
+        if (!_openSectionIds.empty())
+        {
+            parentId          = _openSectionIds.back();
+            const auto parent = findTimingsSectionIndex(parentId);
+            depth             = _timingDetails[parent].getDepth() + 1;
+        }
+
+        _timingDetails.emplace_back(id, parentId, depth);
+
+        if (_sectionIndices.size() <= id)
+            _sectionIndices.resize(id + 1, _NOT_FOUND_);
+
+        _sectionIndices[id] = index;
     }
-    else
-        _timingDetails[index].beginTimer();
+
+    if (std::ranges::find(_openSectionIds, id) == _openSectionIds.end())
+        _openSectionIds.push_back(id);
+
+    _timingDetails[index].beginTimer();
 }
 
 /**
@@ -115,12 +151,7 @@ void Timer::startTimingsSection(const std::string_view name)
  */
 void Timer::stopTimingsSection()
 {
-    const auto index = findTimingsSectionIndex(_name);
-
-    if (index == _timingDetails.size())
-        throw CustomException("Timer not found");
-
-    _timingDetails[index].endTimer();
+    stopTimingsSection(std::string_view(_name));
 }
 
 /**
@@ -129,12 +160,60 @@ void Timer::stopTimingsSection()
  */
 void Timer::stopTimingsSection(const std::string_view name)
 {
-    const auto index = findTimingsSectionIndex(name);
+    stopTimingsSection(TimingsRegistry::intern(name));
+}
+
+/**
+ * @brief stops a timer by its interned section id
+ *
+ * @details if the trace output is requested the finished section is
+ * recorded as event until the maximum number of events is reached
+ *
+ * @param id
+ *
+ * @throws CustomException if the section was never started
+ */
+void Timer::stopTimingsSection(const size_t id)
+{
+    const auto index = findTimingsSectionIndex(id);
 
     if (index == _timingDetails.size())
         throw CustomException("Timer not found");
 
-    _timingDetails[index].endTimer();
+    auto &section = _timingDetails[index];
+    section.endTimer();
+
+    if (const auto iter = std::ranges::find(_openSectionIds, id);
+        iter != _openSectionIds.end())
+        _openSectionIds.erase(iter);
+
+    if (!OutputFileSettings::isTimingsTraceOutput())
+        return;
+
+    if (_events.size() >= _MAX_TRACE_EVENTS_)
+        return;
+
+    const auto start = section.getStartTime() - TimingsRegistry::getEpoch();
+
+    _events.push_back(
+        {id,
+         TimingsRegistry::getTrackId(),
+         pq::Duration(start).count(),
+         section.calculateLoopTime()}
+    );
+}
+
+/**
+ * @brief find the index of a section by its interned id
+ *
+ * @return size_t number of sections if the section does not exist
+ */
+size_t Timer::findTimingsSectionIndex(const size_t id) const
+{
+    if (id < _sectionIndices.size() && _sectionIndices[id] != _NOT_FOUND_)
+        return _sectionIndices[id];
+
+    return _timingDetails.size();
 }
 
 /**
@@ -143,24 +222,67 @@ void Timer::stopTimingsSection(const std::string_view name)
  */
 size_t Timer::findTimingsSectionIndex(const std::string_view name) const
 {
+    return findTimingsSectionIndex(TimingsRegistry::intern(name));
+}
+
+/**
+ * @brief rebuilds the lookup from section ids to section indices
+ *
+ */
+void Timer::updateSectionIndices()
+{
+    _sectionIndices.assign(_sectionIndices.size(), _NOT_FOUND_);
+
     for (size_t i = 0; i < _timingDetails.size(); ++i)
-        if (_timingDetails[i].getName() == name)
-            return i;
+    {
+        const auto id = _timingDetails[i].getId();
 
-    return _timingDetails.size();
+        if (_sectionIndices.size() <= id)
+            _sectionIndices.resize(id + 1, _NOT_FOUND_);
+
+        _sectionIndices[id] = i;
+    }
 }
 
 /**
  * @brief sort the timings sections
  *
+ * @details sections are sorted by their elapsed time within their parent,
+ * nested sections directly follow their parent section
+ *
  */
 void Timer::sortTimingsSections()
 {
-    std::ranges::sort(
-        _timingDetails,
-        [](const TimingsSection& a, const TimingsSection& b)
-        { return a.calculateElapsedTime() > b.calculateElapsedTime(); }
-    );
+    std::vector<TimingsSection> sortedSections;
+    sortedSections.reserve(_timingDetails.size());
+
+    std::function<void(const size_t)> appendChildren;
+
+    appendChildren = [this, &sortedSections, &appendChildren](const size_t id)
+    {
+        std::vector<const TimingsSection*> children;
+
+        for (const auto& section : _timingDetails)
+            if (section.getParentId() == id)
+                children.push_back(&section);
+
+        std::ranges::sort(
+            children,
+            [](const TimingsSection* a, const TimingsSection* b)
+            { return a->calculateElapsedTime() > b->calculateElapsedTime(); }
+        );
+
+        for (const auto* child : children)
+        {
+            sortedSections.push_back(*child);
+            appendChildren(child->getId());
+        }
+    };
+
+    appendChildren(TimingsSection::_NO_PARENT_);
+
+    _timingDetails = std::move(sortedSections);
+    updateSectionIndices();
 }
 
 /********************
@@ -204,4 +326,40 @@ std::string Timer::getTimerName() const { return _name; }
  *
  * @return Timer
  */
-Timer Timer::getTimer() const { return *this; }
\ No newline at end of file
+Timer Timer::getTimer() const { return *this; }
+
+/**
+ * @brief get the recorded trace events
+ *
+ * @return const std::vector<TimingsEvent>&
+ */
+const std::vector<TimingsEvent>& Timer::getEvents() const { return _events; }
+
+/********************************
+ *                              *
+ * ScopedTimingsSection methods *
+ *                              *
+ ********************************/
+
+/**
+ * @brief Construct a new Scoped Timings Section:: Scoped Timings Section
+ * object and starts the section
+ *
+ * @param timer
+ * @param id interned id of the section, e.g. sectionId<"name">()
+ */
+ScopedTimingsSection::ScopedTimingsSection(Timer& timer, const size_t id)
+    : _timer(timer), _id(id)
+{
+    _timer.startTimingsSection(_id);
+}
+
+/**
+ * @brief Destroy the Scoped Timings Section:: Scoped Timings Section object
+ * and stops the section
+ *
+ */
+ScopedTimingsSection::~ScopedTimingsSection()
+{
+    _timer.stopTimingsSection(_id);
+}
@@ -0,0 +1,100 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "timingsHistogram.hpp"
+
+#include <algorithm>   // for clamp
+#include <cmath>       // for log10, pow, ceil
+
+using namespace timings;
+
+/**
+ * @brief adds a duration to the histogram
+ *
+ * @details durations outside of the covered range are counted in the
+ * first or last bin respectively
+ *
+ * @param time duration in s
+ */
+void TimingsHistogram::addSample(const double time)
+{
+    if (_counts.empty())
+        _counts.resize(_N_BINS_, 0);
+
+    auto bin = 0.0;
+
+    if (time > _MIN_TIME_)
+        bin = std::log10(time / _MIN_TIME_) * double(_BINS_PER_DECADE_);
+
+    const auto index = std::clamp(size_t(bin), size_t(0), _N_BINS_ - 1);
+
+    ++_counts[index];
+    ++_nSamples;
+}
+
+/**
+ * @brief calculates a percentile of the durations
+ *
+ * @details the geometric center of the bin containing the requested rank
+ * is returned
+ *
+ * @param fraction percentile as fraction between 0 and 1
+ * @return double duration in s, 0 if no sample was added
+ */
+double TimingsHistogram::calculatePercentile(const double fraction) const
+{
+    if (_nSamples == 0)
+        return 0.0;
+
+    const auto rank = std::max(
+        size_t(1),
+        size_t(std::ceil(std::clamp(fraction, 0.0, 1.0) * double(_nSamples)))
+    );
+
+    size_t cumulative = 0;
+    size_t index      = 0;
+
+    for (; index < _N_BINS_ - 1; ++index)
+    {
+        cumulative += _counts[index];
+
+        if (cumulative >= rank)
+            break;
+    }
+
+    const auto exponent = (double(index) + 0.5) / double(_BINS_PER_DECADE_);
+
+    return _MIN_TIME_ * std::pow(10.0, exponent);
+}
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
+/**
+ * @brief get the number of samples
+ *
+ * @return size_t
+ */
+size_t TimingsHistogram::getNumberOfSamples() const { return _nSamples; }
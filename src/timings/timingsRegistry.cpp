@@ -0,0 +1,109 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "timingsRegistry.hpp"
+
+#include <format>   // for format
+
+#include "exceptions.hpp"   // for CustomException
+
+using namespace timings;
+using namespace customException;
+
+/**
+ * @brief get the id of a section name, the name is registered if it is not
+ * known yet
+ *
+ * @param name
+ * @return size_t
+ */
+size_t TimingsRegistry::intern(const std::string_view name)
+{
+    const std::lock_guard lock(_mutex);
+
+    if (const auto iter = _ids.find(name); iter != _ids.end())
+        return iter->second;
+
+    const auto id = _names.size();
+
+    // deque keeps the stored names in place, so the view keys stay valid
+    const auto &storedName = _names.emplace_back(name);
+    _ids.emplace(storedName, id);
+
+    return id;
+}
+
+/**
+ * @brief get the name of a section id
+ *
+ * @param id
+ * @return std::string
+ *
+ * @throws CustomException if the id was never registered
+ */
+std::string TimingsRegistry::getName(const size_t id)
+{
+    const std::lock_guard lock(_mutex);
+
+    if (id >= _names.size())
+        throw CustomException(std::format("Unknown timings section id {}", id));
+
+    return _names[id];
+}
+
+/**
+ * @brief get the number of registered sections
+ *
+ * @return size_t
+ */
+size_t TimingsRegistry::getNumberOfSections()
+{
+    const std::lock_guard lock(_mutex);
+
+    return _names.size();
+}
+
+/**
+ * @brief get the track id of the calling thread
+ *
+ * @details the track ids are dense and assigned in the order in which the
+ * threads first request them
+ *
+ * @return size_t
+ */
+size_t TimingsRegistry::getTrackId()
+{
+    thread_local const auto trackId = []
+    {
+        const std::lock_guard lock(_mutex);
+        return _nTracks++;
+    }();
+
+    return trackId;
+}
+
+/**
+ * @brief get the common time origin of all timings events
+ *
+ * @return pq::Time
+ */
+pq::Time TimingsRegistry::getEpoch() { return _epoch; }
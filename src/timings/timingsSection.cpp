@@ -24,7 +24,11 @@
 
 #include <chrono>   // IWYU pragma: keep for time_point, milliseconds, nanoseconds
 
+#include "timingsRegistry.hpp"   // for TimingsRegistry
+#include "timingsSettings.hpp"   // for TimingsSettings
+
 using namespace timings;
+using namespace settings;
 using namespace std::chrono;
 
 using ms = milliseconds;
@@ -35,13 +39,54 @@ using ns = nanoseconds;
  *
  * @param name
  */
-TimingsSection::TimingsSection(const std::string_view name) : _name(name) {}
+TimingsSection::TimingsSection(const std::string_view name)
+    : _name(name), _id(TimingsRegistry::intern(name))
+{
+}
 
 /**
- * @brief
+ * @brief Construct a new Timings Section:: Timings Section object
  *
+ * @param id interned id of the section name
+ * @param parentId id of the enclosing section
+ * @param depth nesting depth of the section
  */
-void TimingsSection::beginTimer() { _start = high_resolution_clock::now(); }
+TimingsSection::TimingsSection(
+    const size_t id,
+    const size_t parentId,
+    const size_t depth
+)
+    : _name(TimingsRegistry::getName(id)),
+      _id(id),
+      _parentId(parentId),
+      _depth(depth)
+{
+}
+
+/**
+ * @brief start the timer
+ *
+ * @details the hardware counters are read before the clock, so that the
+ * reading of the counters is not part of the measured time
+ *
+ */
+void TimingsSection::beginTimer()
+{
+    _isCounting = false;
+
+    if (TimingsSettings::isHardwareCounters())
+    {
+        HardwareCounters::openTeamCounters();
+
+        if (HardwareCounters::getThreadCounters().isOpen())
+        {
+            _startCounters = HardwareCounters::readAll();
+            _isCounting    = true;
+        }
+    }
+
+    _start = pq::Clock::now();
+}
 
 /**
  * @brief end the timer
@@ -49,10 +94,18 @@ void TimingsSection::beginTimer() { _start = high_resolution_clock::now(); }
  */
 void TimingsSection::endTimer()
 {
-    _end           = high_resolution_clock::now();
+    _end           = pq::Clock::now();
     _steps         = _steps + 1;
     _totalTime    += _end - _start;
     _lastStepTime  = _end - _start;
+
+    _histogram.addSample(_lastStepTime.count());
+
+    if (_isCounting)
+    {
+        _counters   += HardwareCounters::readAll() - _startCounters;
+        _isCounting  = false;
+    }
 }
 
 /**
@@ -64,6 +117,10 @@ double TimingsSection::calculateElapsedTime() const
     return double(duration_cast<ns>(_totalTime).count()) * 1.0e-6;
 }
 
+/**
+ * @brief calculates the average loop time in s
+ *
+ */
 double TimingsSection::calculateAverageLoopTime() const
 {
     auto time = double(duration_cast<ns>(_totalTime).count());
@@ -84,9 +141,69 @@ double TimingsSection::calculateLoopTime() const
     return time;
 }
 
+/**
+ * @brief calculates a percentile of the loop times in s
+ *
+ * @param fraction percentile as fraction between 0 and 1, e.g. 0.99
+ * @return double
+ */
+double TimingsSection::calculatePercentileLoopTime(const double fraction
+) const
+{
+    return _histogram.calculatePercentile(fraction);
+}
+
+/***************************
+ *                         *
+ * standard getter methods *
+ *                         *
+ ***************************/
+
 /**
  * @brief get the name of the timings section
  *
  * @return std::string
  */
 std::string TimingsSection::getName() const { return _name; }
+
+/**
+ * @brief get the interned id of the timings section
+ *
+ * @return size_t
+ */
+size_t TimingsSection::getId() const { return _id; }
+
+/**
+ * @brief get the id of the enclosing section
+ *
+ * @return size_t _NO_PARENT_ for top level sections
+ */
+size_t TimingsSection::getParentId() const { return _parentId; }
+
+/**
+ * @brief get the nesting depth of the timings section
+ *
+ * @return size_t
+ */
+size_t TimingsSection::getDepth() const { return _depth; }
+
+/**
+ * @brief get the number of finished steps of the timings section
+ *
+ * @return size_t
+ */
+size_t TimingsSection::getSteps() const { return _steps; }
+
+/**
+ * @brief get the start time of the current or last step
+ *
+ * @return pq::Time
+ */
+pq::Time TimingsSection::getStartTime() const { return _start; }
+
+/**
+ * @brief get the accumulated hardware counters of the timings section
+ *
+ * @return const CounterValues&
+ */
+const CounterValues &TimingsSection::getCounters() const { return _counters; }
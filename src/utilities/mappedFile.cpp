@@ -0,0 +1,132 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "mappedFile.hpp"
+
+#include <fcntl.h>      // for open, O_RDONLY
+#include <sys/mman.h>   // for mmap, munmap, madvise
+#include <sys/stat.h>   // for fstat
+#include <unistd.h>     // for close
+
+using namespace utilities;
+
+/**
+ * @brief Construct a new Mapped File:: Mapped File object
+ *
+ * @details maps the whole file read-only into memory. Empty files are not
+ * mapped at all but are still considered open.
+ *
+ * @param fileName
+ */
+MappedFile::MappedFile(const std::string &fileName)
+{
+    const auto fileDescriptor = ::open(fileName.c_str(), O_RDONLY);
+
+    if (fileDescriptor < 0)
+        return;
+
+    struct stat fileStat{};
+
+    if (::fstat(fileDescriptor, &fileStat) != 0)
+    {
+        ::close(fileDescriptor);
+        return;
+    }
+
+    const auto fileSize = static_cast<size_t>(fileStat.st_size);
+
+    if (fileSize > 0)
+    {
+        auto *mapping = ::mmap(
+            nullptr,
+            fileSize,
+            PROT_READ,
+            MAP_PRIVATE,
+            fileDescriptor,
+            0
+        );
+
+        if (MAP_FAILED == mapping)
+        {
+            ::close(fileDescriptor);
+            return;
+        }
+
+        ::madvise(mapping, fileSize, MADV_SEQUENTIAL);
+
+        _mapping     = mapping;
+        _mappingSize = fileSize;
+        _data        = std::string_view(static_cast<char *>(mapping), fileSize);
+    }
+
+    ::close(fileDescriptor);
+
+    _isOpen = true;
+}
+
+/**
+ * @brief Destroy the Mapped File:: Mapped File object
+ *
+ */
+MappedFile::~MappedFile()
+{
+    if (nullptr != _mapping)
+        ::munmap(_mapping, _mappingSize);
+}
+
+/**
+ * @brief get the next line of the file
+ *
+ * @details the line is returned without the trailing newline and without a
+ * trailing carriage return of windows line endings. Behaves like getline on
+ * an ifstream, i.e. a last line without newline is still returned.
+ *
+ * @param line view into the mapped file
+ * @return true if a line was read
+ * @return false if the end of the file was reached
+ */
+bool MappedFile::getLine(std::string_view &line)
+{
+    if (eof())
+        return false;
+
+    auto end = _data.find('\n', _position);
+
+    if (std::string_view::npos == end)
+        end = _data.size();
+
+    line      = _data.substr(_position, end - _position);
+    _position = end + 1;
+
+    if (!line.empty() && '\r' == line.back())
+        line.remove_suffix(1);
+
+    return true;
+}
+
+/**
+ * @brief checks if all lines of the file have been read
+ *
+ * @return true if the end of the file is reached
+ */
+bool MappedFile::eof() const { return _position >= _data.size(); }
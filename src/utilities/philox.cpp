@@ -0,0 +1,74 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include "philox.hpp"
+
+#include <sstream>   // for istringstream, ostringstream
+
+using namespace utilities;
+
+/**
+ * @brief Construct a new Philox object
+ *
+ * @param seed
+ * @param stream
+ */
+Philox::Philox(const uint64_t seed, const PhiloxStream stream)
+    : _seed(seed), _stream(stream)
+{
+}
+
+/**
+ * @brief get the state of the generator
+ *
+ * @return std::string seed and step separated by a space
+ */
+std::string Philox::getState() const
+{
+    std::ostringstream stream;
+    stream << _seed << " " << _step;
+
+    return stream.str();
+}
+
+/**
+ * @brief set the state of the generator
+ *
+ * @details if the state cannot be parsed (e.g. a checkpoint written by an
+ * older version) the current state is kept
+ *
+ * @param state as returned by getState
+ */
+void Philox::setState(const std::string &state)
+{
+    std::istringstream stream(state);
+
+    uint64_t seed = 0;
+    uint64_t step = 0;
+
+    if (!(stream >> seed >> step) || !(stream >> std::ws).eof())
+        return;
+
+    _seed = seed;
+    _step = step;
+}
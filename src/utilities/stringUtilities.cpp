@@ -24,13 +24,14 @@
 
 #include <algorithm>    // for __for_each_fn
 #include <cctype>       // for isspace
+#include <charconv>     // for from_chars
 #include <format>       // for format
 #include <fstream>      // IWYU pragma: keep for basic_istream, ifstream
 #include <functional>   // for identity
 #include <ranges>   // for begin, end, operator|, views::split, views::transform
-#include <sstream>       // IWYU pragma: keep for basic_stringstream
 #include <string>        // for string
 #include <string_view>   // for string_view
+#include <system_error>  // for errc
 #include <vector>        // for vector
 
 #include "exceptions.hpp"
@@ -62,6 +63,23 @@ std::string utilities::removeComments(
     return line;
 }
 
+/**
+ * @brief Removes comments from a line without copying it
+ *
+ * @details same as removeComments but returns a view into the given line
+ *
+ * @param line
+ * @param commentChar
+ * @return std::string_view
+ */
+std::string_view utilities::stripComments(
+    const std::string_view line,
+    const std::string_view commentChar
+)
+{
+    return line.substr(0, line.find(commentChar));
+}
+
 /**
  * @brief get commands from a line
  *
@@ -109,18 +127,105 @@ std::vector<std::string> utilities::getLineCommands(
  * @param line
  * @return std::vector<std::string>
  */
-std::vector<std::string> utilities::splitString(const std::string &line)
+std::vector<std::string> utilities::splitString(const std::string_view line)
 {
-    std::string word;
+    const auto  lineViews    = splitStringView(line);
     pq::strings lineElements = {};
 
-    std::stringstream ss(line);
+    lineElements.reserve(lineViews.size());
 
-    while (ss >> word) lineElements.push_back(word);
+    for (const auto &view : lineViews) lineElements.emplace_back(view);
 
     return lineElements;
 }
 
+/**
+ * @brief Splits a string into views at every whitespace
+ *
+ * @details the views point into the given line, which therefore has to
+ * outlive the returned vector
+ *
+ * @param line
+ * @return std::vector<std::string_view>
+ */
+std::vector<std::string_view> utilities::splitStringView(
+    const std::string_view line
+)
+{
+    auto isSpace = [](const char c)
+    { return bool(::isspace(static_cast<unsigned char>(c))); };
+
+    pq::stringViews lineElements = {};
+
+    const auto end = line.end();
+    auto       it  = std::find_if_not(line.begin(), end, isSpace);
+
+    while (it != end)
+    {
+        const auto wordEnd = std::find_if(it, end, isSpace);
+
+        lineElements.emplace_back(it, wordEnd);
+
+        it = std::find_if_not(wordEnd, end, isSpace);
+    }
+
+    return lineElements;
+}
+
+/**
+ * @brief converts a string to a double with std::from_chars
+ *
+ * @details a leading plus sign is accepted like in std::stod
+ *
+ * @param string
+ * @return double
+ *
+ * @throw InputFileException if the string is not a number
+ */
+double utilities::stringToDouble(std::string_view string)
+{
+    if (string.starts_with('+'))
+        string.remove_prefix(1);
+
+    double     value = 0.0;
+    const auto end   = string.data() + string.size();
+
+    const auto [ptr, error] = std::from_chars(string.data(), end, value);
+
+    if (error != std::errc{})
+        throw InputFileException(
+            std::format("Cannot convert \"{}\" to a number", string)
+        );
+
+    return value;
+}
+
+/**
+ * @brief converts a string to an unsigned integer with std::from_chars
+ *
+ * @param string
+ * @return size_t
+ *
+ * @throw InputFileException if the string is not an unsigned integer
+ */
+size_t utilities::stringToSizeT(std::string_view string)
+{
+    if (string.starts_with('+'))
+        string.remove_prefix(1);
+
+    size_t     value = 0;
+    const auto end   = string.data() + string.size();
+
+    const auto [ptr, error] = std::from_chars(string.data(), end, value);
+
+    if (error != std::errc{})
+        throw InputFileException(
+            std::format("Cannot convert \"{}\" to an unsigned integer", string)
+        );
+
+    return value;
+}
+
 /**
  * @brief returns a copy of a string all lower case
  *
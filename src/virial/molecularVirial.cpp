@@ -79,7 +79,7 @@ void MolecularVirial::intraMolecularVirialCorrection(
     PhysicalData  &data
 )
 {
-    startTimingsSection("IntraMolecular Correction");
+    startTimingsSection<"IntraMolecular Correction">();
 
     _virial = {0.0};
 
@@ -103,5 +103,5 @@ void MolecularVirial::intraMolecularVirialCorrection(
 
     data.addVirial(_virial);
 
-    stopTimingsSection("IntraMolecular Correction");
+    stopTimingsSection<"IntraMolecular Correction">();
 }
\ No newline at end of file
@@ -45,7 +45,7 @@ using namespace linearAlgebra;
  */
 void Virial::calculateVirial(SimulationBox &simBox, PhysicalData &data)
 {
-    startTimingsSection("Virial");
+    startTimingsSection<"Virial">();
 
     _virial = {0.0};
 
@@ -69,7 +69,7 @@ void Virial::calculateVirial(SimulationBox &simBox, PhysicalData &data)
 
     data.setVirial(_virial);
 
-    stopTimingsSection("Virial");
+    stopTimingsSection<"Virial">();
 }
 
 /**
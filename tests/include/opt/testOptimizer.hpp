@@ -0,0 +1,172 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef _TEST_OPTIMIZER_HPP_
+
+#define _TEST_OPTIMIZER_HPP_
+
+#include <gtest/gtest.h>   // for Test
+
+#include <cstddef>   // for size_t
+#include <memory>    // for make_shared, shared_ptr
+#include <vector>    // for vector
+
+#include "atom.hpp"            // for Atom
+#include "evaluator.hpp"       // for Evaluator
+#include "optimizer.hpp"       // for Optimizer
+#include "physicalData.hpp"    // for PhysicalData
+#include "simulationBox.hpp"   // for SimulationBox
+#include "vector3d.hpp"        // for Vec3D, normSquared
+
+/**
+ * @class HarmonicEvaluator
+ *
+ * @brief evaluator of independent harmonic wells around a minimum per atom
+ *
+ * @details E = k/2 * sum_i |r_i - r0_i|^2. If _isUphill is set the energy
+ * grows with every evaluation, while the forces still point downhill, so
+ * that every line search has to fail.
+ */
+class HarmonicEvaluator : public opt::Evaluator
+{
+  public:
+    std::vector<linearAlgebra::Vec3D> _minima;
+
+    double _forceConstant = 1.0;
+    bool   _isUphill      = false;
+    size_t _nEvaluations  = 0;
+
+    pq::SharedEvaluator clone() const override
+    {
+        return std::make_shared<HarmonicEvaluator>(*this);
+    }
+
+    void evaluate() override
+    {
+        const auto &atoms = _simulationBox->getAtoms();
+
+        for (size_t i = 0; i < atoms.size(); ++i)
+        {
+            const auto dr = atoms[i]->getPosition() - _minima[i];
+            atoms[i]->setForce(-_forceConstant * dr);
+        }
+
+        evaluateEnergy();
+    }
+
+    void evaluateEnergy() override
+    {
+        ++_nEvaluations;
+
+        if (_isUphill)
+        {
+            _physicalData->setBondEnergy(double(_nEvaluations));
+            return;
+        }
+
+        const auto &atoms = _simulationBox->getAtoms();
+
+        auto energy = 0.0;
+
+        for (size_t i = 0; i < atoms.size(); ++i)
+        {
+            const auto dr  = atoms[i]->getPosition() - _minima[i];
+            energy        += 0.5 * _forceConstant * normSquared(dr);
+        }
+
+        _physicalData->setBondEnergy(energy);
+    }
+};
+
+/**
+ * @class TestOptimizer
+ *
+ * @brief Fixture for optimizer tests with two atoms in harmonic wells.
+ *
+ */
+class TestOptimizer : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        _box          = std::make_shared<simulationBox::SimulationBox>();
+        _physicalData = std::make_shared<physicalData::PhysicalData>();
+        _evaluator    = std::make_shared<HarmonicEvaluator>();
+
+        _box->setBoxDimensions({100.0, 100.0, 100.0});
+
+        const auto positions = std::vector<linearAlgebra::Vec3D>{
+            {1.0, 0.0, 0.0},
+            {0.0, 2.0, -1.0}
+        };
+
+        for (const auto &position : positions)
+        {
+            const auto atom = std::make_shared<simulationBox::Atom>();
+            atom->setPosition(position);
+            _box->addAtom(atom);
+        }
+
+        _evaluator->_minima = {
+            {0.0, 0.0, 0.0},
+            {0.5, 0.5, 0.5}
+        };
+
+        _evaluator->setSimulationBox(_box);
+        _evaluator->setPhysicalData(_physicalData);
+    }
+
+    /**
+     * @brief runs the optimizer in the same way as the OptEngine
+     *
+     * @param optimizer
+     * @param nEpochs
+     */
+    void runOptimizer(opt::Optimizer &optimizer, const size_t nEpochs)
+    {
+        optimizer.setSimulationBox(_box);
+        optimizer.setPhysicalData(_physicalData);
+        optimizer.setEvaluator(_evaluator);
+
+        _evaluator->evaluate();
+        optimizer.updateHistory();
+
+        for (size_t step = 1; step <= nEpochs; ++step)
+        {
+            optimizer.update(0.1, step);
+
+            if (!optimizer.evaluatesInUpdate())
+            {
+                _physicalData->reset();
+                _evaluator->evaluate();
+            }
+
+            optimizer.updateHistory();
+        }
+    }
+
+    std::shared_ptr<simulationBox::SimulationBox> _box;
+    std::shared_ptr<physicalData::PhysicalData>   _physicalData;
+    std::shared_ptr<HarmonicEvaluator>            _evaluator;
+};
+
+#endif   // _TEST_OPTIMIZER_HPP_
@@ -47,6 +47,34 @@ TEST_F(TestConstraints, calcRefBondLengths)
     );
 }
 
+/**
+ * @brief tests grouping of bond constraints into independent clusters
+ *
+ */
+TEST_F(TestConstraints, shakeClusters)
+{
+    _constraints->calculateConstraintBondRefs(*_box);
+
+    const auto &clusters = _constraints->getShakeClusters();
+    EXPECT_EQ(clusters.getNumberOfClusters(), 2);
+    EXPECT_EQ(clusters.getNumberOfBonds(), 2);
+    EXPECT_THAT(clusters.getClusterOffsets(), testing::ElementsAre(0, 1, 2));
+
+    auto bondConstraint3 = constraints::BondConstraint(
+        &(_box->getMolecules()[1]),
+        &(_box->getMolecules()[0]),
+        0,
+        0,
+        1.0
+    );
+    _constraints->addBondConstraint(bondConstraint3);
+    _constraints->calculateConstraintBondRefs(*_box);
+
+    EXPECT_EQ(clusters.getNumberOfClusters(), 2);
+    EXPECT_THAT(clusters.getBondOrder(), testing::ElementsAre(0, 2, 1));
+    EXPECT_THAT(clusters.getClusterOffsets(), testing::ElementsAre(0, 2, 3));
+}
+
 /**
  * @brief test apply shake algorithm to all bond constraints
  *
@@ -0,0 +1,147 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <gtest/gtest.h>   // for Test, TestInfo (ptr only), TEST
+
+#include <cmath>    // for sqrt, cos, sin
+#include <memory>   // for make_shared
+
+#include "atom.hpp"                          // for Atom
+#include "constants/conversionFactors.hpp"   // for _DEG_TO_RAD_
+#include "gtest/gtest.h"                     // for Message, TestPartResult
+#include "settle.hpp"                        // for Settle
+#include "simulationBox.hpp"                 // for SimulationBox
+
+using namespace constraints;
+using namespace simulationBox;
+using namespace linearAlgebra;
+
+/**
+ * @brief tests detection of the apex atom of a rigid three-site molecule
+ *
+ */
+TEST(TestSettle, findApex)
+{
+    const auto apex = Settle::findApex({1.0, 16.0, 1.0}, {1.0, 2.6, 1.0});
+
+    ASSERT_TRUE(apex.has_value());
+    EXPECT_EQ(apex.value()[0], 1);
+    EXPECT_EQ(apex.value()[1], 0);
+    EXPECT_EQ(apex.value()[2], 2);
+
+    EXPECT_FALSE(Settle::findApex({1.0, 2.0, 3.0}, {1.0, 1.0, 1.0}));
+    EXPECT_FALSE(Settle::findApex({16.0, 1.0, 1.0}, {1.0, 1.2, 1.0}));
+}
+
+/**
+ * @brief tests that SETTLE restores the rigid geometry of a water molecule
+ * and removes the velocity components along its bonds
+ *
+ */
+TEST(TestSettle, applySettle)
+{
+    const auto massO  = 15.999;
+    const auto massH  = 1.008;
+    const auto distOH = 1.0;
+    const auto angle  = 109.47 * constants::_DEG_TO_RAD_;
+    const auto distHH = 2.0 * distOH * std::sin(0.5 * angle);
+
+    auto atomO  = std::make_shared<Atom>();
+    auto atomH1 = std::make_shared<Atom>();
+    auto atomH2 = std::make_shared<Atom>();
+
+    atomO->setMass(massO);
+    atomH1->setMass(massH);
+    atomH2->setMass(massH);
+
+    const auto posO  = Vec3D(0.5, 0.5, 0.5);
+    const auto posH1 = posO + Vec3D(distOH, 0.0, 0.0);
+    const auto posH2 =
+        posO + distOH * Vec3D(std::cos(angle), std::sin(angle), 0.0);
+
+    atomO->setPosition(posO);
+    atomH1->setPosition(posH1);
+    atomH2->setPosition(posH2);
+
+    SimulationBox simBox;
+    simBox.setBoxDimensions({10.0, 10.0, 10.0});
+
+    Settle settle;
+
+    const auto params =
+        Settle::calculateParameters(massO, massH, distOH, distHH);
+
+    settle.addMolecule(
+        atomO.get(),
+        atomH1.get(),
+        atomH2.get(),
+        settle.addParameters(params)
+    );
+    EXPECT_EQ(settle.addParameters(params), 0);
+    EXPECT_EQ(settle.getNumberOfParameters(), 1);
+    EXPECT_EQ(settle.getNumberOfMolecules(), 1);
+
+    settle.calculateReferences(simBox);
+
+    atomO->setPosition(posO + Vec3D(0.01, -0.02, 0.005));
+    atomH1->setPosition(posH1 + Vec3D(0.05, 0.03, -0.04));
+    atomH2->setPosition(posH2 + Vec3D(-0.03, 0.06, 0.02));
+
+    atomO->setVelocity(Vec3D(0.0, 0.0, 0.0));
+    atomH1->setVelocity(Vec3D(0.0, 0.0, 0.0));
+    atomH2->setVelocity(Vec3D(0.0, 0.0, 0.0));
+
+    const auto comBefore = massO * atomO->getPosition() +
+                           massH * atomH1->getPosition() +
+                           massH * atomH2->getPosition();
+
+    EXPECT_EQ(settle.applySettle(simBox, 1.0), 0);
+
+    const auto newPosO  = atomO->getPosition();
+    const auto newPosH1 = atomH1->getPosition();
+    const auto newPosH2 = atomH2->getPosition();
+
+    EXPECT_NEAR(norm(newPosO - newPosH1), distOH, 1e-10);
+    EXPECT_NEAR(norm(newPosO - newPosH2), distOH, 1e-10);
+    EXPECT_NEAR(norm(newPosH1 - newPosH2), distHH, 1e-10);
+
+    const auto comAfter =
+        massO * newPosO + massH * newPosH1 + massH * newPosH2;
+
+    EXPECT_NEAR(comAfter[0], comBefore[0], 1e-10);
+    EXPECT_NEAR(comAfter[1], comBefore[1], 1e-10);
+    EXPECT_NEAR(comAfter[2], comBefore[2], 1e-10);
+
+    atomO->setVelocity(Vec3D(1.0, -2.0, 0.5));
+    atomH1->setVelocity(Vec3D(3.0, 1.0, -1.0));
+    atomH2->setVelocity(Vec3D(-2.0, 4.0, 2.0));
+
+    settle.applySettleRattle(simBox);
+
+    const auto velO  = atomO->getVelocity();
+    const auto velH1 = atomH1->getVelocity();
+    const auto velH2 = atomH2->getVelocity();
+
+    EXPECT_NEAR(dot(newPosO - newPosH1, velO - velH1), 0.0, 1e-10);
+    EXPECT_NEAR(dot(newPosO - newPosH2, velO - velH2), 0.0, 1e-10);
+    EXPECT_NEAR(dot(newPosH1 - newPosH2, velH1 - velH2), 0.0, 1e-10);
+}
@@ -0,0 +1,367 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <gtest/gtest.h>   // for Test, EXPECT_EQ
+
+#include <cstddef>   // for size_t
+#include <memory>    // for make_shared
+#include <vector>    // for vector
+
+#include "atom.hpp"                      // for Atom
+#include "bondForceField.hpp"            // for BondForceField
+#include "coulombShiftedPotential.hpp"   // for CoulombShiftedPotential
+#include "forceFieldClass.hpp"           // for ForceField
+#include "forceFieldNonCoulomb.hpp"      // for ForceFieldNonCoulomb
+#include "hybridSettings.hpp"            // for HybridSettings
+#include "mathUtilities.hpp"             // for compare
+#include "molecule.hpp"                  // for Molecule
+#include "physicalData.hpp"              // for PhysicalData
+#include "qmRunner.hpp"                  // for QMRunner
+#include "qmSettings.hpp"                // for QMMethod
+#include "qmmmMDEngine.hpp"              // for QMMMMDEngine
+#include "settingsInstance.hpp"          // for SettingsInstance, SettingsScope
+#include "simulationBox.hpp"             // for SimulationBox
+#include "vector3d.hpp"                  // for Vec3D
+
+using engine::QMMMMDEngine;
+using linearAlgebra::Vec3D;
+using settings::HybridSettings;
+
+namespace
+{
+    /**
+     * @brief adds a molecule with a single atom to the simulation box
+     *
+     * @param simBox
+     * @param position position and center of mass of the molecule
+     * @return std::shared_ptr<simulationBox::Atom>
+     */
+    std::shared_ptr<simulationBox::Atom> addMolecule(
+        simulationBox::SimulationBox &simBox,
+        const Vec3D                  &position
+    )
+    {
+        auto       molecule = simulationBox::Molecule();
+        const auto atom     = std::make_shared<simulationBox::Atom>();
+
+        atom->setPosition(position);
+        molecule.addAtom(atom);
+        molecule.setCenterOfMass(position);
+        molecule.setNumberOfAtoms(1);
+
+        simBox.addMolecule(molecule);
+        simBox.addAtom(atom);
+
+        return atom;
+    }
+
+    /**
+     * @brief adds a molecule with two atoms and a bond to the force field
+     *
+     * @details the atoms are placed at position -/+ 0.75 along x, i.e. the
+     * bond with an equilibrium length of 1 and a force constant of 2 has an
+     * energy of 0.25
+     *
+     * @param engine
+     * @param position center of mass of the molecule
+     */
+    void addBondedMolecule(QMMMMDEngine &engine, const Vec3D &position)
+    {
+        auto &simBox   = engine.getSimulationBox();
+        auto  molecule = simulationBox::Molecule();
+
+        for (const auto dx : {-0.75, 0.75})
+        {
+            const auto atom = std::make_shared<simulationBox::Atom>();
+
+            atom->setPosition(position + Vec3D(dx, 0.0, 0.0));
+            molecule.addAtom(atom);
+            simBox.addAtom(atom);
+        }
+
+        molecule.setCenterOfMass(position);
+        molecule.setNumberOfAtoms(2);
+
+        simBox.addMolecule(molecule);
+    }
+}   // namespace
+
+/**
+ * @brief tests the switching function of the smoothing region
+ *
+ * @details with a core radius of 5 and a smoothing radius of 2 the factor
+ * is 1 up to 3, 0 from 5 on and (rc² - r²)² (rc² + 2r² - 3rs²) / (rc² - rs²)³
+ * in between
+ *
+ */
+TEST(TestQMMMMDEngine, calculateSmoothingFactor)
+{
+    auto                          instance = settings::SettingsInstance();
+    const settings::SettingsScope scope(instance);
+
+    HybridSettings::setCoreRadius(5.0);
+    HybridSettings::setSmoothingRadius(2.0);
+
+    EXPECT_EQ(QMMMMDEngine::calculateSmoothingFactor(0.0), 1.0);
+    EXPECT_EQ(QMMMMDEngine::calculateSmoothingFactor(3.0), 1.0);
+    EXPECT_EQ(QMMMMDEngine::calculateSmoothingFactor(5.0), 0.0);
+    EXPECT_EQ(QMMMMDEngine::calculateSmoothingFactor(6.0), 0.0);
+
+    EXPECT_DOUBLE_EQ(
+        QMMMMDEngine::calculateSmoothingFactor(4.0),
+        81.0 * 30.0 / 4096.0
+    );
+
+    EXPECT_NEAR(QMMMMDEngine::calculateSmoothingFactor(3.0 + 1e-8), 1.0, 1e-6);
+    EXPECT_NEAR(QMMMMDEngine::calculateSmoothingFactor(5.0 - 1e-8), 0.0, 1e-6);
+
+    auto previous = 1.0;
+
+    for (auto distance = 3.1; distance < 5.0; distance += 0.1)
+    {
+        const auto factor = QMMMMDEngine::calculateSmoothingFactor(distance);
+
+        EXPECT_LT(factor, previous);
+        previous = factor;
+    }
+}
+
+/**
+ * @brief tests the selection of the QM region
+ *
+ * @details molecules are selected by the minimum image distance of their
+ * center of mass to the QM center. Molecules with QM only atoms are always
+ * selected, molecules with MM only atoms never.
+ *
+ */
+TEST(TestQMMMMDEngine, updateQMRegion)
+{
+    auto                          instance = settings::SettingsInstance();
+    const settings::SettingsScope scope(instance);
+
+    HybridSettings::setCoreRadius(5.0);
+    HybridSettings::setSmoothingRadius(2.0);
+
+    auto engine = QMMMMDEngine();
+    engine.setQMRunner(settings::QMMethod::DFTBPLUS);
+
+    auto &simBox = engine.getSimulationBox();
+    simBox.setBoxDimensions({20.0, 20.0, 20.0});
+
+    const auto center = Vec3D(1.0, 1.0, 1.0);
+
+    const auto inner    = addMolecule(simBox, {2.0, 1.0, 1.0});
+    const auto outer    = addMolecule(simBox, {9.0, 1.0, 1.0});
+    const auto imaged   = addMolecule(simBox, {1.0, 18.0, 1.0});
+    const auto mmOnly   = addMolecule(simBox, {1.0, 1.0, 2.0});
+    const auto qmOnly   = addMolecule(simBox, {11.0, 11.0, 11.0});
+    const auto smoothed = addMolecule(simBox, {1.0, 1.0, 5.0});
+
+    mmOnly->setMMOnly(true);
+    qmOnly->setQMOnly(true);
+
+    engine.updateQMRegion(center);
+
+    const auto expected = pq::SharedAtomVec{inner, imaged, qmOnly, smoothed};
+
+    EXPECT_EQ(simBox.getQMAtoms(), expected);
+    EXPECT_TRUE(engine.getQMRunner()->isQMRegionChanged());
+
+    engine.updateQMRegion(center);
+
+    EXPECT_EQ(simBox.getQMAtoms(), expected);
+    EXPECT_FALSE(engine.getQMRunner()->isQMRegionChanged());
+
+    outer->setPosition({4.0, 1.0, 1.0});
+    simBox.getMolecule(1).setCenterOfMass({4.0, 1.0, 1.0});
+
+    engine.updateQMRegion(center);
+
+    EXPECT_EQ(simBox.getNumberOfQMAtoms(), 5);
+    EXPECT_TRUE(engine.getQMRunner()->isQMRegionChanged());
+}
+
+/**
+ * @brief tests the positions of the QM atoms passed to the QM runner
+ *
+ * @details the QM molecule straddles the box boundary at x = 5, therefore
+ * its atoms are wrapped to opposite sides of the box. The QM runner gets the
+ * atoms in the periodic image around the QM center, i.e. in the same image
+ * as the point charge at x = 6.
+ *
+ */
+TEST(TestQMMMMDEngine, updateQMRegionAcrossBoundary)
+{
+    auto                          instance = settings::SettingsInstance();
+    const settings::SettingsScope scope(instance);
+
+    HybridSettings::setCoreRadius(1.0);
+    HybridSettings::setLayerRadius(3.0);
+
+    auto engine = QMMMMDEngine();
+    engine.setQMRunner(settings::QMMethod::DFTBPLUS);
+
+    auto &simBox = engine.getSimulationBox();
+    simBox.setBoxDimensions({10.0, 10.0, 10.0});
+
+    auto       molecule = simulationBox::Molecule();
+    const auto atom1    = std::make_shared<simulationBox::Atom>();
+    const auto atom2    = std::make_shared<simulationBox::Atom>();
+
+    atom1->setPosition({4.8, 0.0, 0.0});
+    atom2->setPosition({-4.6, 0.0, 0.0});
+    molecule.addAtom(atom1);
+    molecule.addAtom(atom2);
+    molecule.setCenterOfMass({-4.9, 0.0, 0.0});
+    molecule.setNumberOfAtoms(2);
+
+    simBox.addMolecule(molecule);
+    simBox.addAtom(atom1);
+    simBox.addAtom(atom2);
+
+    addMolecule(simBox, {-4.0, 0.0, 0.0});
+
+    const auto center = Vec3D(4.5, 0.0, 0.0);
+
+    engine.updateQMRegion(center);
+    engine.updatePointCharges(center);
+
+    const auto &qmRunner = *engine.getQMRunner();
+
+    ASSERT_EQ(simBox.getNumberOfQMAtoms(), 2);
+
+    const auto position1 = qmRunner.getQMAtomPosition(simBox, 0);
+    const auto position2 = qmRunner.getQMAtomPosition(simBox, 1);
+
+    EXPECT_TRUE(utilities::compare(position1, {4.8, 0.0, 0.0}, 1e-12));
+    EXPECT_TRUE(utilities::compare(position2, {5.4, 0.0, 0.0}, 1e-12));
+
+    const auto &pointCharges = qmRunner.getPointChargePositions();
+
+    ASSERT_EQ(pointCharges.size(), 1);
+    EXPECT_TRUE(utilities::compare(pointCharges[0], {6.0, 0.0, 0.0}, 1e-12));
+}
+
+/**
+ * @brief tests the blending of the QM and MM forces of the QM atoms
+ *
+ * @details the MM forces are stored while selecting the QM region. Atoms of
+ * molecules within the inner radius keep their QM force, atoms in the
+ * smoothing region get S * F_QM + (1 - S) * F_MM.
+ *
+ */
+TEST(TestQMMMMDEngine, mixForces)
+{
+    auto                          instance = settings::SettingsInstance();
+    const settings::SettingsScope scope(instance);
+
+    HybridSettings::setCoreRadius(5.0);
+    HybridSettings::setSmoothingRadius(2.0);
+
+    auto engine = QMMMMDEngine();
+    engine.setQMRunner(settings::QMMethod::DFTBPLUS);
+
+    auto &simBox = engine.getSimulationBox();
+    simBox.setBoxDimensions({20.0, 20.0, 20.0});
+
+    const auto inner    = addMolecule(simBox, {1.0, 0.0, 0.0});
+    const auto smoothed = addMolecule(simBox, {4.0, 0.0, 0.0});
+    const auto mm       = addMolecule(simBox, {8.0, 0.0, 0.0});
+
+    inner->setForce({1.0, 0.0, 0.0});
+    smoothed->setForce({0.0, 2.0, 0.0});
+    mm->setForce({0.0, 0.0, 5.0});
+
+    engine.updateQMRegion({0.0, 0.0, 0.0});
+
+    // forces of the QM runner
+    inner->setForce({0.0, 0.0, 3.0});
+    smoothed->setForce({0.0, 0.0, 4.0});
+
+    engine.mixForces();
+
+    const auto factor = QMMMMDEngine::calculateSmoothingFactor(4.0);
+    const auto mixed  = Vec3D(0.0, 2.0 * (1.0 - factor), 4.0 * factor);
+
+    EXPECT_TRUE(utilities::compare(inner->getForce(), {0.0, 0.0, 3.0}));
+    EXPECT_TRUE(utilities::compare(smoothed->getForce(), mixed, 1e-12));
+    EXPECT_TRUE(utilities::compare(mm->getForce(), {0.0, 0.0, 5.0}));
+}
+
+/**
+ * @brief tests the removal of the bonded MM energies of the QM molecules
+ *
+ * @details the bond energy of each QM molecule is subtracted with the
+ * smoothing factor of the molecule, the bond of the MM molecule is kept
+ *
+ */
+TEST(TestQMMMMDEngine, subtractIntraEnergies)
+{
+    auto                          instance = settings::SettingsInstance();
+    const settings::SettingsScope scope(instance);
+
+    HybridSettings::setCoreRadius(5.0);
+    HybridSettings::setSmoothingRadius(2.0);
+
+    auto engine = QMMMMDEngine();
+    engine.setQMRunner(settings::QMMethod::DFTBPLUS);
+
+    auto &simBox = engine.getSimulationBox();
+    simBox.setBoxDimensions({20.0, 20.0, 20.0});
+
+    addBondedMolecule(engine, {1.0, 0.0, 0.0});
+    addBondedMolecule(engine, {4.0, 0.0, 0.0});
+    addBondedMolecule(engine, {10.0, 0.0, 0.0});
+
+    auto &forceField = engine.getForceField();
+
+    forceField.setCoulombPotential(
+        std::make_shared<potential::CoulombShiftedPotential>(10.0)
+    );
+    forceField.setNonCoulombPotential(
+        std::make_shared<potential::ForceFieldNonCoulomb>()
+    );
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        auto *molecule = &simBox.getMolecule(i);
+
+        auto bond = forceField::BondForceField(molecule, molecule, 0, 1, 0);
+
+        bond.setEquilibriumBondLength(1.0);
+        bond.setForceConstant(2.0);
+
+        forceField.addBond(bond);
+    }
+
+    engine.getPhysicalData().setBondEnergy(0.75);
+
+    engine.updateQMRegion({0.0, 0.0, 0.0});
+    engine.subtractIntraEnergies();
+
+    const auto factor = QMMMMDEngine::calculateSmoothingFactor(4.0);
+
+    EXPECT_DOUBLE_EQ(
+        engine.getPhysicalData().getBondEnergy(),
+        0.75 - 0.25 * (1.0 + factor)
+    );
+}
@@ -0,0 +1,184 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include <gtest/gtest.h>   // for Test, TestInfo (ptr only), TEST
+
+#include <cmath>    // for M_PI
+#include <memory>   // for make_shared
+#include <vector>   // for vector
+
+#include "angleForceField.hpp"           // for AngleForceField
+#include "atom.hpp"                      // for Atom
+#include "bondForceField.hpp"            // for BondForceField
+#include "coulombShiftedPotential.hpp"   // for CoulombShiftedPotential
+#include "dihedralForceField.hpp"        // for DihedralForceField
+#include "forceFieldNonCoulomb.hpp"      // for ForceFieldNonCoulomb
+#include "gtest/gtest.h"                 // for Message, TestPartResult
+#include "molecule.hpp"                  // for Molecule
+#include "packedBondedTerms.hpp"         // for PackedBondedTerms
+#include "physicalData.hpp"              // for PhysicalData
+#include "simulationBox.hpp"             // for SimulationBox
+
+/**
+ * @brief tests that the packed bonded terms reproduce the energies, forces
+ * and virial of the force field objects and skip linker terms. The energy-only
+ * path has to reproduce the energies without touching forces and virial.
+ *
+ */
+TEST(TestPackedBondedTerms, calculate)
+{
+    auto box = simulationBox::SimulationBox();
+    box.setBoxDimensions({10.0, 10.0, 10.0});
+
+    auto molecule = simulationBox::Molecule();
+    molecule.setNumberOfAtoms(5);
+
+    const std::vector<linearAlgebra::Vec3D> positions = {
+        {0.0, 0.0, 0.0},
+        {1.0, 1.0, 1.0},
+        {1.0, 2.0, 3.0},
+        {4.0, 2.0, 3.0},
+        {4.5, 4.8, -3.0}
+    };
+
+    for (const auto &position : positions)
+    {
+        auto atom = std::make_shared<simulationBox::Atom>();
+        atom->setPosition(position);
+        atom->setForce({0.0, 0.0, 0.0});
+        molecule.addAtom(atom);
+    }
+
+    auto *mol = &molecule;
+
+    auto bond1 = forceField::BondForceField(mol, mol, 0, 1, 0);
+    auto bond2 = forceField::BondForceField(mol, mol, 3, 4, 0);
+    bond1.setEquilibriumBondLength(1.2);
+    bond1.setForceConstant(3.0);
+    bond2.setEquilibriumBondLength(2.2);
+    bond2.setForceConstant(1.5);
+
+    auto linkerBond = bond2;
+    linkerBond.setIsLinker(true);
+
+    auto angle = forceField::AngleForceField({mol, mol, mol}, {1, 0, 2}, 0);
+    angle.setEquilibriumAngle(90 * M_PI / 180.0);
+    angle.setForceConstant(3.0);
+
+    auto dihedral =
+        forceField::DihedralForceField({mol, mol, mol, mol}, {0, 1, 2, 3}, 0);
+    dihedral.setPhaseShift(M_PI);
+    dihedral.setPeriodicity(3);
+    dihedral.setForceConstant(3.0);
+
+    auto improper =
+        forceField::DihedralForceField({mol, mol, mol, mol}, {4, 1, 2, 3}, 0);
+    improper.setPhaseShift(0.5);
+    improper.setPeriodicity(2);
+    improper.setForceConstant(1.0);
+
+    auto packedTerms = forceField::PackedBondedTerms();
+
+    packedTerms.build(
+        {bond1, bond2, linkerBond},
+        {angle},
+        {dihedral},
+        {improper}
+    );
+
+    EXPECT_TRUE(packedTerms.isBuilt());
+    EXPECT_EQ(packedTerms.getNumberOfAtoms(), 5);
+    EXPECT_EQ(packedTerms.getNumberOfBonds(), 2);
+    EXPECT_EQ(packedTerms.getNumberOfAngles(), 1);
+    EXPECT_EQ(packedTerms.getNumberOfDihedrals(), 1);
+    EXPECT_EQ(packedTerms.getNumberOfImproperDihedrals(), 1);
+    EXPECT_EQ(packedTerms.getLinkerBonds(), std::vector<size_t>{2});
+
+    auto packedData = physicalData::PhysicalData();
+    packedTerms.calculate(box, packedData);
+
+    std::vector<linearAlgebra::Vec3D> packedForces;
+    for (size_t i = 0; i < positions.size(); ++i)
+    {
+        packedForces.push_back(molecule.getAtomForce(i));
+        molecule.getAtom(i).setForce({0.0, 0.0, 0.0});
+    }
+
+    auto coulombPotential    = potential::CoulombShiftedPotential(20.0);
+    auto nonCoulombPotential = potential::ForceFieldNonCoulomb();
+
+    auto referenceData = physicalData::PhysicalData();
+
+    // clang-format off
+    bond1.calculateEnergyAndForces(box, referenceData, coulombPotential, nonCoulombPotential);
+    bond2.calculateEnergyAndForces(box, referenceData, coulombPotential, nonCoulombPotential);
+    angle.calculateEnergyAndForces(box, referenceData, coulombPotential, nonCoulombPotential);
+    dihedral.calculateEnergyAndForces(box, referenceData, false, coulombPotential, nonCoulombPotential);
+    improper.calculateEnergyAndForces(box, referenceData, true, coulombPotential, nonCoulombPotential);
+    // clang-format on
+
+    // clang-format off
+    EXPECT_NEAR(packedData.getBondEnergy(), referenceData.getBondEnergy(), 1e-12);
+    EXPECT_NEAR(packedData.getAngleEnergy(), referenceData.getAngleEnergy(), 1e-12);
+    EXPECT_NEAR(packedData.getDihedralEnergy(), referenceData.getDihedralEnergy(), 1e-12);
+    EXPECT_NEAR(packedData.getImproperEnergy(), referenceData.getImproperEnergy(), 1e-12);
+    // clang-format on
+
+    for (size_t i = 0; i < positions.size(); ++i)
+        for (size_t j = 0; j < 3; ++j)
+            EXPECT_NEAR(
+                packedForces[i][j],
+                molecule.getAtomForce(i)[j],
+                1e-12
+            );
+
+    const auto packedVirial    = packedData.getVirial();
+    const auto referenceVirial = referenceData.getVirial();
+
+    for (size_t i = 0; i < 3; ++i)
+        for (size_t j = 0; j < 3; ++j)
+            EXPECT_NEAR(packedVirial[i][j], referenceVirial[i][j], 1e-12);
+
+    auto energyData = physicalData::PhysicalData();
+    packedTerms.calculate<false>(box, energyData);
+
+    // clang-format off
+    EXPECT_NEAR(energyData.getBondEnergy(), packedData.getBondEnergy(), 1e-12);
+    EXPECT_NEAR(energyData.getAngleEnergy(), packedData.getAngleEnergy(), 1e-12);
+    EXPECT_NEAR(energyData.getDihedralEnergy(), packedData.getDihedralEnergy(), 1e-12);
+    EXPECT_NEAR(energyData.getImproperEnergy(), packedData.getImproperEnergy(), 1e-12);
+    // clang-format on
+
+    for (size_t i = 0; i < positions.size(); ++i)
+        for (size_t j = 0; j < 3; ++j)
+            EXPECT_NEAR(
+                packedForces[i][j],
+                molecule.getAtomForce(i)[j],
+                1e-12
+            );
+
+    const auto energyVirial = energyData.getVirial();
+
+    for (size_t i = 0; i < 3; ++i)
+        for (size_t j = 0; j < 3; ++j) EXPECT_EQ(energyVirial[i][j], 0.0);
+}
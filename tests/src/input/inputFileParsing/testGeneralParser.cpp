@@ -34,6 +34,7 @@
 #include "mmmdEngine.hpp"              // for MMMDEngine
 #include "optEngine.hpp"               // for MMOptEngine
 #include "qmmdEngine.hpp"              // for QMMDEngine
+#include "qmmmMDEngine.hpp"            // for QMMMMDEngine
 #include "ringPolymerqmmdEngine.hpp"   // for RingPolymerQMMDEngine
 #include "settings.hpp"                // for Settings
 #include "testInputFileReader.hpp"     // for TestInputFileReader
@@ -72,6 +73,14 @@ TEST_F(TestInputFileReader, JobType)
     EXPECT_EQ(Settings::isRingPolymerMDActivated(), true);
     EXPECT_EQ(typeid(*engine), typeid(engine::RingPolymerQMMDEngine));
 
+    lineElements = {"jobtype", "=", "qmmm-md"};
+    parser.parseJobTypeForEngine(lineElements, 0, engine);
+    EXPECT_EQ(Settings::getJobtype(), JobType::QMMM_MD);
+    EXPECT_EQ(Settings::isQMMMActivated(), true);
+    EXPECT_EQ(Settings::isQMActivated(), true);
+    EXPECT_EQ(Settings::isMMActivated(), true);
+    EXPECT_EQ(typeid(*engine), typeid(engine::QMMMMDEngine));
+
     lineElements = {"jobtype", "=", "mm-opt"};
     parser.parseJobTypeForEngine(lineElements, 0, engine);
     EXPECT_EQ(Settings::getJobtype(), JobType::MM_OPT);
@@ -88,6 +97,7 @@ TEST_F(TestInputFileReader, JobType)
         "- mm-md\n"
         "- qm-md\n"
         "- qm-rpmd\n"
+        "- qmmm-md\n"
     );
 
     EXPECT_NO_THROW(parser.parseJobType(lineElements, 0));
@@ -155,4 +165,24 @@ TEST_F(TestInputFileReader, parseFloatingPointType)
         "Invalid floating point type \"notValid\" in input file\n"
         "Possible values are: float, double"
     );
-}
\ No newline at end of file
+}
+
+/**
+ * @brief tests parsing the "random_seed" command
+ *
+ */
+TEST_F(TestInputFileReader, parseRandomSeed)
+{
+    GeneralInputParser       parser(*_engine);
+    std::vector<std::string> lineElements = {"random_seed", "=", "42"};
+    parser.parseRandomSeed(lineElements, 0);
+    EXPECT_EQ(Settings::getRandomSeed(), 42);
+
+    lineElements = {"random_seed", "=", "-1"};
+    EXPECT_THROW_MSG(
+        parser.parseRandomSeed(lineElements, 0),
+        customException::InputFileException,
+        "Invalid random seed \"-1\" in input file\n"
+        "The random seed must not be negative"
+    );
+}
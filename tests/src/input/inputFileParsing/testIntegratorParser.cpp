@@ -39,7 +39,8 @@ using namespace input;
 /**
  * @brief tests parsing the "integrator" command
  *
- * @details possible options are v-verlet - otherwise throws inputFileException
+ * @details possible options are v-verlet and baoab - otherwise throws
+ * inputFileException
  *
  */
 TEST_F(TestInputFileReader, testParseIntegrator)
@@ -49,6 +50,10 @@ TEST_F(TestInputFileReader, testParseIntegrator)
     parser.parseIntegrator(lineElements, 0);
     EXPECT_EQ(_mdEngine->getIntegrator().getIntegratorType(), "VelocityVerlet");
 
+    lineElements = {"integrator", "=", "BAOAB"};
+    parser.parseIntegrator(lineElements, 0);
+    EXPECT_EQ(_mdEngine->getIntegrator().getIntegratorType(), "BAOAB");
+
     lineElements = {"integrator", "=", "notValid"};
     ASSERT_THROW_MSG(
         parser.parseIntegrator(lineElements, 0),
@@ -77,7 +77,7 @@ TEST_F(TestInputFileReader, ParseRelaxationTimeManostat)
  * @brief tests parsing the "manostat" command
  *
  * @details if the manostat is not valid it throws inputFileException - valid
- * options are "none" and "berendsen"
+ * options are "none", "berendsen", "stochastic_rescaling" and "monte_carlo"
  *
  */
 TEST_F(TestInputFileReader, ParseManostat)
@@ -104,12 +104,20 @@ TEST_F(TestInputFileReader, ParseManostat)
         settings::ManostatType::STOCHASTIC_RESCALING
     );
 
+    lineElements = {"manostat", "=", "monte_carlo"};
+    parser.parseManostat(lineElements, 0);
+    EXPECT_EQ(
+        settings::ManostatSettings::getManostatType(),
+        settings::ManostatType::MONTE_CARLO
+    );
+
     lineElements = {"manostat", "=", "notValid"};
     EXPECT_THROW_MSG(
         parser.parseManostat(lineElements, 0),
         customException::InputFileException,
         "Invalid manostat \"notValid\" at line 0 in input file.\n"
-        "Possible options are: berendsen, stochastic_rescaling and none"
+        "Possible options are: berendsen, stochastic_rescaling, monte_carlo "
+        "and none"
     );
 }
 
@@ -134,6 +142,51 @@ TEST_F(TestInputFileReader, ParseCompressibility)
     );
 }
 
+/**
+ * @brief tests parsing the "mc_freq" command
+ *
+ * @details if the frequency is not positive it throws inputFileException
+ *
+ */
+TEST_F(TestInputFileReader, ParseMonteCarloFrequency)
+{
+    ManostatInputParser      parser(*_engine);
+    std::vector<std::string> lineElements = {"mc_freq", "=", "10"};
+    parser.parseMonteCarloFrequency(lineElements, 0);
+    EXPECT_EQ(settings::ManostatSettings::getMonteCarloFrequency(), 10);
+
+    lineElements = {"mc_freq", "=", "0"};
+    EXPECT_THROW_MSG(
+        parser.parseMonteCarloFrequency(lineElements, 0),
+        customException::InputFileException,
+        "Monte Carlo manostat frequency must be positive - in input file in "
+        "line 0"
+    );
+}
+
+/**
+ * @brief tests parsing the "mc_volume_change" command
+ *
+ * @details if the volume change is not in (0, 0.5] it throws
+ * inputFileException
+ *
+ */
+TEST_F(TestInputFileReader, ParseVolumeChange)
+{
+    ManostatInputParser      parser(*_engine);
+    std::vector<std::string> lineElements = {"mc_volume_change", "=", "0.05"};
+    parser.parseVolumeChange(lineElements, 0);
+    EXPECT_EQ(settings::ManostatSettings::getVolumeChange(), 0.05);
+
+    lineElements = {"mc_volume_change", "=", "0.6"};
+    EXPECT_THROW_MSG(
+        parser.parseVolumeChange(lineElements, 0),
+        customException::InputFileException,
+        "Monte Carlo volume change must be in (0, 0.5] - in input file in "
+        "line 0"
+    );
+}
+
 /**
  * @brief tests parsing the "isotropy" command
  *
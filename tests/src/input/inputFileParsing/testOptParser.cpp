@@ -42,6 +42,9 @@ using namespace defaults;
  *
  * @details Possible keys are:
  * - optimizer = steepest-descent
+ * - optimizer = adam
+ * - optimizer = lbfgs
+ * - optimizer = fire
  *
  */
 TEST_F(TestInputFileReader, parserOptimizer)
@@ -59,11 +62,17 @@ TEST_F(TestInputFileReader, parserOptimizer)
     parser.parseOptimizer({"optimizer", "=", "adam"}, 0);
     EXPECT_EQ(OptimizerSettings::getOptimizer(), ADAM);
 
+    parser.parseOptimizer({"optimizer", "=", "l-bfgs"}, 0);
+    EXPECT_EQ(OptimizerSettings::getOptimizer(), LBFGS);
+
+    parser.parseOptimizer({"optimizer", "=", "fire"}, 0);
+    EXPECT_EQ(OptimizerSettings::getOptimizer(), FIRE);
+
     ASSERT_THROW_MSG(
         parser.parseOptimizer({"optimizer", "=", "notValid"}, 0),
         InputFileException,
         "Unknown optimizer method \"notValid\" in input file at line 0.\n"
-        "Possible options are: steepest-descent, adam"
+        "Possible options are: steepest-descent, adam, lbfgs, fire"
     )
 }
 
@@ -234,6 +243,92 @@ TEST_F(TestInputFileReader, parserLRUpdateFrequency)
     )
 }
 
+/**
+ * @brief parse the number of stored correction pairs of the L-BFGS optimizer
+ *
+ * @details The memory must be greater than 0
+ *
+ */
+TEST_F(TestInputFileReader, parserLBFGSMemory)
+{
+    EXPECT_EQ(OptimizerSettings::getLBFGSMemory(), _LBFGS_MEMORY_DEFAULT_);
+
+    auto parser = OptInputParser(*_engine);
+    parser.parseLBFGSMemory({"lbfgs-memory", "=", "20"}, 0);
+    EXPECT_EQ(OptimizerSettings::getLBFGSMemory(), 20);
+
+    ASSERT_THROW_MSG(
+        parser.parseLBFGSMemory({"lbfgs-memory", "=", "0"}, 0),
+        InputFileException,
+        "L-BFGS memory must be greater than 0 in input file at line 0."
+    )
+}
+
+/**
+ * @brief parse the parameters of the FIRE optimizer
+ *
+ * @details The timesteps must be greater than 0.0, the timestep increase
+ * must be greater than 1.0 and the decrease factors as well as the initial
+ * mixing parameter must be between 0.0 and 1.0
+ *
+ */
+TEST_F(TestInputFileReader, parserFireParameters)
+{
+    EXPECT_EQ(OptimizerSettings::getFireTimestep(), _FIRE_TIMESTEP_DEFAULT_);
+    EXPECT_EQ(OptimizerSettings::getFireNMin(), _FIRE_N_MIN_DEFAULT_);
+
+    auto parser = OptInputParser(*_engine);
+
+    parser.parseFireTimestep({"fire-timestep", "=", "0.05"}, 0);
+    EXPECT_EQ(OptimizerSettings::getFireTimestep(), 0.05);
+
+    parser.parseFireMaxTimestep({"fire-max-timestep", "=", "0.5"}, 0);
+    EXPECT_EQ(OptimizerSettings::getFireMaxTimestep(), 0.5);
+
+    parser.parseFireNMin({"fire-n-min", "=", "3"}, 0);
+    EXPECT_EQ(OptimizerSettings::getFireNMin(), 3);
+
+    parser.parseFireTimestepIncrease({"fire-timestep-increase", "=", "1.2"}, 0);
+    EXPECT_EQ(OptimizerSettings::getFireTimestepIncrease(), 1.2);
+
+    parser.parseFireTimestepDecrease({"fire-timestep-decrease", "=", "0.4"}, 0);
+    EXPECT_EQ(OptimizerSettings::getFireTimestepDecrease(), 0.4);
+
+    parser.parseFireAlphaStart({"fire-alpha-start", "=", "0.2"}, 0);
+    EXPECT_EQ(OptimizerSettings::getFireAlphaStart(), 0.2);
+
+    parser.parseFireAlphaDecrease({"fire-alpha-decrease", "=", "0.9"}, 0);
+    EXPECT_EQ(OptimizerSettings::getFireAlphaDecrease(), 0.9);
+
+    ASSERT_THROW_MSG(
+        parser.parseFireTimestep({"fire-timestep", "=", "0.0"}, 0),
+        InputFileException,
+        "FIRE timestep must be greater than 0.0 in input file at line 0."
+    )
+
+    ASSERT_THROW_MSG(
+        parser.parseFireNMin({"fire-n-min", "=", "-1"}, 0),
+        InputFileException,
+        "FIRE n-min must not be negative in input file at line 0."
+    )
+
+    ASSERT_THROW_MSG(
+        parser.parseFireTimestepIncrease(
+            {"fire-timestep-increase", "=", "1.0"},
+            0
+        ),
+        InputFileException,
+        "FIRE timestep increase must be greater than 1.0 in input file at "
+        "line 0."
+    )
+
+    ASSERT_THROW_MSG(
+        parser.parseFireAlphaStart({"fire-alpha-start", "=", "1.0"}, 0),
+        InputFileException,
+        "FIRE alpha start must be between 0.0 and 1.0 in input file at line 0."
+    )
+}
+
 /**
  * @brief parse the minimum learning rate
  *
@@ -73,6 +73,86 @@ TEST_F(TestInputFileReader, testParseFilePrefix)
     EXPECT_EQ(settings::OutputFileSettings::getFilePrefix(), "prefix");
 }
 
+/**
+ * @brief tests parsing the "async_output" command
+ *
+ * @details if the keyword is not "on" or "off" it throws inputFileException
+ *
+ */
+TEST_F(TestInputFileReader, testParseAsyncOutput)
+{
+    OutputInputParser        parser(*_engine);
+    std::vector<std::string> lineElements = {"async_output", "=", "off"};
+    parser.parseAsyncOutput(lineElements, 0);
+    EXPECT_FALSE(settings::OutputFileSettings::isAsyncOutput());
+
+    lineElements = {"async_output", "=", "ON"};
+    parser.parseAsyncOutput(lineElements, 0);
+    EXPECT_TRUE(settings::OutputFileSettings::isAsyncOutput());
+
+    lineElements = {"async_output", "=", "sometimes"};
+    EXPECT_THROW_MSG(
+        parser.parseAsyncOutput(lineElements, 0),
+        customException::InputFileException,
+        "Invalid async_output keyword \"sometimes\" at line 0 in input file\n"
+        "Possible keywords are \"on\" and \"off\""
+    );
+}
+
+/**
+ * @brief tests parsing the "observable_output" command
+ *
+ * @details if the keyword is not "on" or "off" it throws inputFileException
+ *
+ */
+TEST_F(TestInputFileReader, testParseObservableOutput)
+{
+    OutputInputParser        parser(*_engine);
+    std::vector<std::string> lineElements = {"observable_output", "=", "on"};
+    parser.parseObservableOutput(lineElements, 0);
+    EXPECT_TRUE(settings::OutputFileSettings::isObservableOutput());
+
+    lineElements = {"observable_output", "=", "OFF"};
+    parser.parseObservableOutput(lineElements, 0);
+    EXPECT_FALSE(settings::OutputFileSettings::isObservableOutput());
+
+    lineElements = {"observable_output", "=", "sometimes"};
+    EXPECT_THROW_MSG(
+        parser.parseObservableOutput(lineElements, 0),
+        customException::InputFileException,
+        "Invalid observable_output keyword \"sometimes\" at line 0 in input "
+        "file\n"
+        "Possible keywords are \"on\" and \"off\""
+    );
+}
+
+/**
+ * @brief tests parsing the "timings_trace" command
+ *
+ * @details if the keyword is not "on" or "off" it throws inputFileException
+ *
+ */
+TEST_F(TestInputFileReader, testParseTimingsTrace)
+{
+    OutputInputParser        parser(*_engine);
+    std::vector<std::string> lineElements = {"timings_trace", "=", "on"};
+    parser.parseTimingsTrace(lineElements, 0);
+    EXPECT_TRUE(settings::OutputFileSettings::isTimingsTraceOutput());
+
+    lineElements = {"timings_trace", "=", "OFF"};
+    parser.parseTimingsTrace(lineElements, 0);
+    EXPECT_FALSE(settings::OutputFileSettings::isTimingsTraceOutput());
+
+    lineElements = {"timings_trace", "=", "sometimes"};
+    EXPECT_THROW_MSG(
+        parser.parseTimingsTrace(lineElements, 0),
+        customException::InputFileException,
+        "Invalid timings_trace keyword \"sometimes\" at line 0 in input "
+        "file\n"
+        "Possible keywords are \"on\" and \"off\""
+    );
+}
+
 /**
  * @brief tests parsing the "output_file" command
  *
@@ -192,6 +272,32 @@ TEST_F(TestInputFileReader, testParseRestartFilename)
     EXPECT_EQ(settings::OutputFileSettings::getRestartFileName(), _fileName);
 }
 
+/**
+ * @brief tests parsing the "checkpoint_file" command
+ *
+ */
+TEST_F(TestInputFileReader, testParseCheckpointFilename)
+{
+    OutputInputParser parser(*_engine);
+    _fileName = "restart.chk";
+    std::vector<std::string> lineElements = {"chkFilename", "=", _fileName};
+    parser.parseCheckpointFilename(lineElements, 0);
+    EXPECT_EQ(settings::OutputFileSettings::getCheckpointFileName(), _fileName);
+}
+
+/**
+ * @brief tests parsing the "observable_file" command
+ *
+ */
+TEST_F(TestInputFileReader, testParseObservableFilename)
+{
+    OutputInputParser parser(*_engine);
+    _fileName = "run.obs";
+    std::vector<std::string> lineElements = {"obsFilename", "=", _fileName};
+    parser.parseObservableFilename(lineElements, 0);
+    EXPECT_EQ(settings::OutputFileSettings::getObservableFileName(), _fileName);
+}
+
 /**
  * @brief tests parsing the "charge_file" command
  *
@@ -282,6 +388,26 @@ TEST_F(TestInputFileReader, testTimingsFilename)
     EXPECT_EQ(settings::OutputFileSettings::getTimingsFileName(), _fileName);
 }
 
+/**
+ * @brief tests parsing the "timings_trace_file" command
+ *
+ */
+TEST_F(TestInputFileReader, testTimingsTraceFilename)
+{
+    OutputInputParser parser(*_engine);
+    _fileName                                   = "trace.json";
+    const std::vector<std::string> lineElements = {
+        "timings_trace_file",
+        "=",
+        _fileName
+    };
+    parser.parseTimingsTraceFilename(lineElements, 0);
+    EXPECT_EQ(
+        settings::OutputFileSettings::getTimingsTraceFileName(),
+        _fileName
+    );
+}
+
 /**
  * @brief tests parsing the "rpmd_traj_file" command
  *
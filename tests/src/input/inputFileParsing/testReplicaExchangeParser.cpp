@@ -0,0 +1,111 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <gtest/gtest.h>   // for EXPECT_EQ, TestInfo (ptr only)
+
+#include <string>   // for string, allocator, basic_string
+#include <vector>   // for vector
+
+#include "exceptions.hpp"                   // for InputFileException
+#include "gtest/gtest.h"                    // for Message, TestPartResult
+#include "replicaExchangeInputParser.hpp"   // for ReplicaExchangeInputParser
+#include "replicaExchangeSettings.hpp"      // for ReplicaExchangeSettings
+#include "testInputFileReader.hpp"          // for TestInputFileReader
+#include "throwWithMessage.hpp"             // for EXPECT_THROW_MSG
+
+using namespace input;
+using settings::ReplicaExchangeSettings;
+
+/**
+ * @brief tests parsing the "replica_temperatures" command
+ *
+ * @details the temperatures are sorted and it throws inputFileException if
+ * less than two, non positive or duplicate temperatures are given
+ *
+ */
+TEST_F(TestInputFileReader, testParseReplicaTemperatures)
+{
+    ReplicaExchangeInputParser parser(*_engine);
+    std::vector<std::string>   lineElements =
+        {"replica_temperatures", "=", "320.0", "300.0", "310.0"};
+    parser.parseTemperatures(lineElements, 0);
+
+    const auto temperatures = ReplicaExchangeSettings::getTemperatures();
+    EXPECT_EQ(temperatures, std::vector<double>({300.0, 310.0, 320.0}));
+    EXPECT_EQ(ReplicaExchangeSettings::getNumberOfReplicas(), 3);
+    EXPECT_TRUE(ReplicaExchangeSettings::isReplicaExchangeActivated());
+
+    ReplicaExchangeSettings::setReplicaIndex(1);
+    EXPECT_EQ(ReplicaExchangeSettings::getReplicaTemperature(), 310.0);
+    ReplicaExchangeSettings::setReplicaIndex(0);
+
+    lineElements = {"replica_temperatures", "=", "300.0"};
+    EXPECT_THROW_MSG(
+        parser.parseTemperatures(lineElements, 0),
+        customException::InputFileException,
+        "At least two replica temperatures are required - in input file in "
+        "line 0"
+    );
+
+    lineElements = {"replica_temperatures", "=", "300.0", "-1.0"};
+    EXPECT_THROW_MSG(
+        parser.parseTemperatures(lineElements, 0),
+        customException::InputFileException,
+        "Replica temperatures must be positive - in input file in line 0"
+    );
+
+    lineElements = {"replica_temperatures", "=", "300.0", "300.0"};
+    EXPECT_THROW_MSG(
+        parser.parseTemperatures(lineElements, 0),
+        customException::InputFileException,
+        "Replica temperatures must be unique - in input file in line 0"
+    );
+
+    ReplicaExchangeSettings::setTemperatures({});
+    EXPECT_FALSE(ReplicaExchangeSettings::isReplicaExchangeActivated());
+}
+
+/**
+ * @brief tests parsing the "replica_exchange_freq" command
+ *
+ * @details if the frequency is not positive it throws inputFileException
+ *
+ */
+TEST_F(TestInputFileReader, testParseReplicaExchangeFrequency)
+{
+    ReplicaExchangeInputParser parser(*_engine);
+    std::vector<std::string>   lineElements =
+        {"replica_exchange_freq", "=", "50"};
+    parser.parseExchangeFrequency(lineElements, 0);
+
+    EXPECT_EQ(ReplicaExchangeSettings::getExchangeFrequency(), 50);
+
+    lineElements = {"replica_exchange_freq", "=", "0"};
+    EXPECT_THROW_MSG(
+        parser.parseExchangeFrequency(lineElements, 0),
+        customException::InputFileException,
+        "Replica exchange frequency must be positive - in input file in line "
+        "0"
+    );
+
+    ReplicaExchangeSettings::setExchangeFrequency(100);
+}
@@ -114,4 +114,23 @@ TEST_F(TestInputFileReader, parseInitVelocities)
         "in input file.\n"
         "Possible options are: true, false"
     );
-}
\ No newline at end of file
+}
+
+TEST_F(TestInputFileReader, parseHMRHydrogenMass)
+{
+    SimulationBoxInputParser parser(*_engine);
+    EXPECT_FALSE(settings::SimulationBoxSettings::isHMRActivated());
+
+    const std::vector<std::string> lineElements = {"hmr_mass", "=", "3.024"};
+    parser.parseHMRHydrogenMass(lineElements, 0);
+    EXPECT_TRUE(settings::SimulationBoxSettings::isHMRActivated());
+    EXPECT_EQ(settings::SimulationBoxSettings::getHMRHydrogenMass(), 3.024);
+
+    const std::vector<std::string> lineElements2 = {"hmr_mass", "=", "0.0"};
+    EXPECT_THROW_MSG(
+        parser.parseHMRHydrogenMass(lineElements2, 0),
+        customException::InputFileException,
+        "Hydrogen mass for hydrogen mass repartitioning must be positive - "
+        "\"0.0\" at line 0 in input file"
+    );
+}
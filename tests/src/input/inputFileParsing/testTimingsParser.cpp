@@ -69,4 +69,31 @@ TEST_F(TestInputFileReader, testParseNumberOfSteps)
         customException::InputFileException,
         "Number of steps cannot be negative"
     );
-}
\ No newline at end of file
+}
+
+/**
+ * @brief tests parsing the "hardware_counters" command
+ *
+ * @details if the keyword is not "on" or "off" it throws inputFileException
+ *
+ */
+TEST_F(TestInputFileReader, testParseHardwareCounters)
+{
+    TimingsInputParser parser(*_engine);
+    vector<string>     lineElements = {"hardware_counters", "=", "on"};
+    parser.parseHardwareCounters(lineElements, 0);
+    EXPECT_TRUE(settings::TimingsSettings::isHardwareCounters());
+
+    lineElements = {"hardware_counters", "=", "OFF"};
+    parser.parseHardwareCounters(lineElements, 0);
+    EXPECT_FALSE(settings::TimingsSettings::isHardwareCounters());
+
+    lineElements = {"hardware_counters", "=", "sometimes"};
+    EXPECT_THROW_MSG(
+        parser.parseHardwareCounters(lineElements, 0),
+        customException::InputFileException,
+        "Invalid hardware_counters keyword \"sometimes\" at line 0 in input "
+        "file\n"
+        "Possible keywords are \"on\" and \"off\""
+    );
+}
@@ -22,8 +22,9 @@
 
 #include "testParameterFileSection.hpp"
 
-#include <ostream>   // for operator<<, ofstream, basic_ostream, endl
-#include <vector>    // for vector
+#include <ostream>       // for operator<<, ofstream, basic_ostream, endl
+#include <string_view>   // for string_view
+#include <vector>        // for vector
 
 #include "bondSection.hpp"   // for BondSection
 #include "gtest/gtest.h"     // for Message, TestPartResult
@@ -46,9 +47,12 @@ TEST_F(TestParameterFileSection, processParameterSection)
 
     outputStream.close();
 
-    auto          lineElements = std::vector{std::string("")};
-    std::ifstream fp(_parameterFileName.c_str());
-    getline(fp, lineElements[0]);
+    auto                  lineElements = std::vector{std::string("")};
+    utilities::MappedFile fp(_parameterFileName);
+    std::string_view      firstLine;
+
+    fp.getLine(firstLine);
+    lineElements[0] = firstLine;
 
     section.setFp(&fp);
     section.setLineNumber(1);
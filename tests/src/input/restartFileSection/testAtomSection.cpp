@@ -22,11 +22,11 @@
 
 #include <gtest/gtest.h>   // for TestInfo (ptr only), EXPECT_EQ
 
-#include <cstddef>   // for size_t
-#include <fstream>   // for ifstream, std
-#include <memory>    // for shared_ptr, __shared_ptr_access
-#include <string>    // for string, stod, allocator, basic_string
-#include <vector>    // for vector
+#include <cstddef>       // for size_t
+#include <memory>        // for shared_ptr, __shared_ptr_access
+#include <string>        // for string, stod, allocator, basic_string
+#include <string_view>   // for string_view
+#include <vector>        // for vector
 
 #include "atom.hpp"                 // for Atom
 #include "atomSection.hpp"          // for AtomSection
@@ -34,6 +34,7 @@
 #include "exceptions.hpp"           // for RstFileException, customException
 #include "gmock/gmock.h"            // for ElementsAre, MakePredicateFormatter
 #include "gtest/gtest.h"            // for Message, TestPartResult
+#include "mappedFile.hpp"           // for MappedFile
 #include "molecule.hpp"             // for Molecule
 #include "moleculeType.hpp"         // for MoleculeType
 #include "restartFileSection.hpp"   // for RstFileSection, AtomSection
@@ -103,7 +104,7 @@ TEST_F(TestAtomSection, notEnoughElementsInLine)
     molecule.setNumberOfAtoms(3);
     _engine->getSimulationBox().getMoleculeTypes().push_back(molecule);
 
-    std::ifstream fp(filename);
+    utilities::MappedFile fp(filename);
     _section->_fp = &fp;
 
     ASSERT_THROW(
@@ -115,7 +116,7 @@ TEST_F(TestAtomSection, notEnoughElementsInLine)
 
     std::string filename2 =
         "data/atomSection/testNotEnoughAtomsInMolecule2.rst";
-    std::ifstream fp2(filename2);
+    utilities::MappedFile fp2(filename2);
     _section->_fp = &fp2;
 
     ASSERT_THROW(
@@ -137,7 +138,7 @@ TEST_F(TestAtomSection, numberOfArgumentsWithinMolecule)
     molecule.setNumberOfAtoms(3);
     _engine->getSimulationBox().getMoleculeTypes().push_back(molecule);
 
-    std::ifstream fp(filename);
+    utilities::MappedFile fp(filename);
     _section->_fp = &fp;
 
     ASSERT_THROW(
@@ -162,7 +163,7 @@ TEST_F(TestAtomSection, testProcess)
     molecule2.setNumberOfAtoms(4);
     _engine->getSimulationBox().addMoleculeType(molecule2);
 
-    std::ifstream fp(filename);
+    utilities::MappedFile fp(filename);
     _section->_fp = &fp;
 
     _section->process(line, *_engine);
@@ -216,8 +217,10 @@ TEST_F(TestAtomSection, testProcessAtomLine)
     line[0]   = "Ar";
     for (size_t i = 3; i < 21; ++i) line[i] = std::to_string(i + i / 10.0);
 
+    auto lineViews = pq::stringViews(line.begin(), line.end());
+
     dynamic_cast<AtomSection *>(_section)
-        ->processAtomLine(line, _engine->getSimulationBox(), molecule);
+        ->processAtomLine(lineViews, _engine->getSimulationBox(), molecule);
 
     ASSERT_THAT(
         molecule.getAtomPosition(0),
@@ -241,8 +244,10 @@ TEST_F(TestAtomSection, testProcessQMAtomLine)
     line[0]   = "Ar";
     for (size_t i = 3; i < 21; ++i) line[i] = std::to_string(i + i / 10.0);
 
+    auto lineViews = pq::stringViews(line.begin(), line.end());
+
     dynamic_cast<AtomSection *>(_section)->processQMAtomLine(
-        line,
+        lineViews,
         _engine->getSimulationBox()
     );
 
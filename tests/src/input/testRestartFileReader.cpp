@@ -22,14 +22,26 @@
 
 #include "testRestartFileReader.hpp"
 
-#include <string>   // for string, allocator, basic_string
-#include <vector>   // for vector
-
-#include "fileSettings.hpp"          // for FileSettings
-#include "gtest/gtest.h"             // for Message, TestPartResult
-#include "moldescriptorReader.hpp"   // for MoldescriptorReader
-#include "restartFileReader.hpp"     // for RstFileReader, readRstFile
-#include "restartFileSection.hpp"    // for RstFileSection, readInput
+#include <filesystem>    // for remove
+#include <fstream>       // for fstream
+#include <string>        // for string, allocator, basic_string
+#include <string_view>   // for string_view
+#include <vector>        // for vector
+
+#include "atom.hpp"                   // for Atom
+#include "checkpointFileOutput.hpp"   // for CheckpointFileOutput
+#include "checkpointFileReader.hpp"   // for CheckpointFileReader
+#include "exceptions.hpp"             // for RstFileException
+#include "fileSettings.hpp"           // for FileSettings
+#include "gtest/gtest.h"              // for Message, TestPartResult
+#include "manostat.hpp"               // for Manostat
+#include "moldescriptorReader.hpp"    // for MoldescriptorReader
+#include "restartFileReader.hpp"      // for RstFileReader, readRstFile
+#include "restartFileSection.hpp"     // for RstFileSection, readInput
+#include "simulationBox.hpp"          // for SimulationBox
+#include "thermostat.hpp"             // for Thermostat
+#include "timingsSettings.hpp"        // for TimingsSettings
+#include "velocityVerlet.hpp"         // for VelocityVerlet
 
 using namespace input;
 
@@ -42,15 +54,15 @@ TEST_F(TestRstFileReader, determineSection)
     std::string                    filename = "examples/setup/h2o_qmcfc.rst";
     restartFile::RestartFileReader rstFileReader(filename, *_engine);
 
-    auto  lineElements = std::vector<std::string>{"sTeP", "1"};
+    auto  lineElements = std::vector<std::string_view>{"sTeP", "1"};
     auto *section      = rstFileReader.determineSection(lineElements);
     EXPECT_EQ(section->keyword(), "step");
 
-    lineElements = std::vector<std::string>{"Box"};
+    lineElements = std::vector<std::string_view>{"Box"};
     section      = rstFileReader.determineSection(lineElements);
     EXPECT_EQ(section->keyword(), "box");
 
-    lineElements = std::vector<std::string>{"notAHeaderSection"};
+    lineElements = std::vector<std::string_view>{"notAHeaderSection"};
     section      = rstFileReader.determineSection(lineElements);
     EXPECT_EQ(section->keyword(), "");
 }
@@ -71,4 +83,78 @@ TEST_F(TestRstFileReader, rstFileReading)
 
     moldescriptor.read();
     ASSERT_NO_THROW(restartFile::readRestartFile(*_engine));
-}
\ No newline at end of file
+}
+
+/**
+ * @brief tests that a binary checkpoint file restores the restart file
+ * exactly and that corrupted checkpoint files are rejected
+ *
+ */
+TEST_F(TestRstFileReader, checkpointFileRoundTrip)
+{
+    settings::FileSettings::setMolDescriptorFileName(
+        "examples/setup/moldescriptor.dat"
+    );
+    molDescriptor::MoldescriptorReader(*_engine).read();
+
+    settings::FileSettings::setStartFileName("examples/setup/h2o-qmcf.rst");
+    restartFile::readRestartFile(*_engine);
+
+    for (auto &atom : _engine->getSimulationBox().getAtoms())
+        atom->setName(atom->getAtomTypeName());
+
+    const std::string filename = "checkpointRoundTrip.chk";
+
+    auto checkpointOutput = output::CheckpointFileOutput(filename);
+    checkpointOutput.write(
+        _engine->getSimulationBox(),
+        thermostat::Thermostat(),
+        manostat::Manostat(),
+        integrator::VelocityVerlet(),
+        1232
+    );
+
+    EXPECT_TRUE(restartFile::CheckpointFileReader::isCheckpointFile(filename));
+
+    auto *engine = new engine::MMMDEngine();
+    molDescriptor::MoldescriptorReader(*engine).read();
+
+    settings::TimingsSettings::setStepCount(0);
+    settings::FileSettings::setStartFileName(filename);
+    restartFile::readRestartFile(*engine);
+
+    const auto &atoms         = _engine->getSimulationBox().getAtoms();
+    const auto &restoredAtoms = engine->getSimulationBox().getAtoms();
+
+    EXPECT_EQ(settings::TimingsSettings::getStepCount(), 1232);
+    EXPECT_EQ(
+        engine->getSimulationBox().getMolecules().size(),
+        _engine->getSimulationBox().getMolecules().size()
+    );
+    EXPECT_EQ(
+        engine->getSimulationBox().getBoxDimensions(),
+        _engine->getSimulationBox().getBoxDimensions()
+    );
+
+    ASSERT_EQ(restoredAtoms.size(), atoms.size());
+
+    for (size_t i = 0; i < atoms.size(); ++i)
+    {
+        EXPECT_EQ(restoredAtoms[i]->getAtomTypeName(), atoms[i]->getName());
+        EXPECT_EQ(restoredAtoms[i]->getPosition(), atoms[i]->getPosition());
+        EXPECT_EQ(restoredAtoms[i]->getVelocity(), atoms[i]->getVelocity());
+        EXPECT_EQ(restoredAtoms[i]->getForce(), atoms[i]->getForce());
+    }
+
+    delete engine;
+
+    auto file = std::fstream(filename, std::ios::in | std::ios::out);
+    file.seekp(output::CheckpointFileOutput::_HEADER_SIZE_ + 1);
+    file.put('x');
+    file.close();
+
+    auto reader = restartFile::CheckpointFileReader(filename, *_engine);
+    EXPECT_THROW(reader.read(), customException::RstFileException);
+
+    std::filesystem::remove(filename);
+}
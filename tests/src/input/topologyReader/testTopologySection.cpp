@@ -22,8 +22,9 @@
 
 #include "testTopologySection.hpp"
 
-#include <ostream>   // for operator<<, basic_ostream, ofstream
-#include <vector>    // for vector
+#include <ostream>       // for operator<<, basic_ostream, ofstream
+#include <string_view>   // for string_view
+#include <vector>        // for vector
 
 #include "bondConstraint.hpp"    // for BondConstraint
 #include "constraints.hpp"       // for Constraints
@@ -52,9 +53,12 @@ TEST_F(TestTopologySection, processShakeSection)
 
     outputStream.close();
 
-    auto          lineElements = std::vector{std::string("")};
-    std::ifstream fp(_topologyFileName.c_str());
-    getline(fp, lineElements[0]);
+    auto                  lineElements = std::vector{std::string("")};
+    utilities::MappedFile fp(_topologyFileName);
+    std::string_view      firstLine;
+
+    fp.getLine(firstLine);
+    lineElements[0] = firstLine;
 
     shakeSection.setFp(&fp);
     shakeSection.setLineNumber(1);
@@ -124,9 +128,12 @@ TEST_F(TestTopologySection, processShakeSection_incorrectNumberOfElements)
 
     outputStream.close();
 
-    auto          lineElements = std::vector{std::string("")};
-    std::ifstream fp(_topologyFileName.c_str());
-    getline(fp, lineElements[0]);
+    auto                  lineElements = std::vector{std::string("")};
+    utilities::MappedFile fp(_topologyFileName);
+    std::string_view      firstLine;
+
+    fp.getLine(firstLine);
+    lineElements[0] = firstLine;
     shakeSection.setFp(&fp);
 
     EXPECT_THROW(
@@ -151,9 +158,12 @@ TEST_F(TestTopologySection, processShakeSection_sameAtomTwice)
 
     outputStream.close();
 
-    auto          lineElements = std::vector{std::string("")};
-    std::ifstream fp(_topologyFileName.c_str());
-    getline(fp, lineElements[0]);
+    auto                  lineElements = std::vector{std::string("")};
+    utilities::MappedFile fp(_topologyFileName);
+    std::string_view      firstLine;
+
+    fp.getLine(firstLine);
+    lineElements[0] = firstLine;
     shakeSection.setFp(&fp);
 
     EXPECT_THROW(
@@ -180,9 +190,12 @@ TEST_F(TestTopologySection, processShakeSection_missingEnd)
 
     outputStream.close();
 
-    auto          lineElements = std::vector{std::string("")};
-    std::ifstream fp(_topologyFileName.c_str());
-    getline(fp, lineElements[0]);
+    auto                  lineElements = std::vector{std::string("")};
+    utilities::MappedFile fp(_topologyFileName);
+    std::string_view      firstLine;
+
+    fp.getLine(firstLine);
+    lineElements[0] = firstLine;
     shakeSection.setFp(&fp);
 
     EXPECT_THROW(
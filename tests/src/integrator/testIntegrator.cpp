@@ -22,12 +22,15 @@
 
 #include "testIntegrator.hpp"
 
-#include <string>   // for string
-#include <vector>   // for vector
+#include <cstddef>   // for size_t
+#include <string>    // for string
+#include <vector>    // for vector
 
+#include "baoab.hpp"                                 // for BAOAB
 #include "constants/conversionFactors.hpp"           // for _FS_TO_S_
 #include "constants/internalConversionFactors.hpp"   // for _V_VERLET_VELOCITY_FACTOR_
 #include "gtest/gtest.h"   // for CmpHelperFloatingPointEQ, Message, Test, TestPartResult, EXPECT_EQ, EXPECT_DOUBLE_EQ, EXPECT_TRUE, TestPartResultArray, InitGoogleTest, RUN_ALL_TESTS
+#include "thermostatSettings.hpp"   // for ThermostatSettings
 
 /**
  * @brief tests function integrate velocities of velocity verlet integrator
@@ -145,4 +148,65 @@ TEST_F(TestIntegrator, secondStep)
         molecule.getAtomVelocity(1)[2],
         3.0 + 0.1 * 2.5 * constants::_V_VERLET_VELOCITY_FACTOR_
     );
-}
\ No newline at end of file
+}
+
+/**
+ * @brief tests that the BAOAB integrator without friction reduces to the
+ * velocity verlet integrator
+ *
+ */
+TEST_F(TestIntegrator, baoabWithoutFriction)
+{
+    auto baoab = integrator::BAOAB();
+    baoab.setFriction(0.0);
+
+    baoab.firstStep(*_box);
+
+    const auto molecule = _box->getMolecules()[0];
+    EXPECT_EQ(molecule.getAtomVelocity(0), linearAlgebra::Vec3D(0.0, 0.0, 0.0));
+
+    auto velocities  = linearAlgebra::Vec3D(1.0, 2.0, 3.0);
+    velocities      += 0.1 * linearAlgebra::Vec3D(0.5, 1.5, 2.5) *
+                  constants::_V_VERLET_VELOCITY_FACTOR_;
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_DOUBLE_EQ(molecule.getAtomVelocity(1)[i], velocities[i]);
+        EXPECT_DOUBLE_EQ(
+            molecule.getAtomPosition(1)[i],
+            1.0 + 0.1 * velocities[i] * constants::_FS_TO_S_
+        );
+    }
+
+    EXPECT_EQ(molecule.getAtomForce(1), linearAlgebra::Vec3D(0.0, 0.0, 0.0));
+    EXPECT_EQ(baoab.getRandom().getStep(), 1);
+}
+
+/**
+ * @brief tests that the O part of the BAOAB integrator with infinite
+ * friction at zero temperature removes the velocities between the two half
+ * drifts
+ *
+ */
+TEST_F(TestIntegrator, baoabOverdamped)
+{
+    settings::ThermostatSettings::setActualTargetTemperature(0.0);
+
+    auto baoab = integrator::BAOAB();
+    baoab.setFriction(1.0e30);
+
+    baoab.firstStep(*_box);
+
+    const auto molecule = _box->getMolecules()[0];
+    EXPECT_EQ(molecule.getAtomVelocity(1), linearAlgebra::Vec3D(0.0, 0.0, 0.0));
+
+    auto velocities  = linearAlgebra::Vec3D(1.0, 2.0, 3.0);
+    velocities      += 0.1 * linearAlgebra::Vec3D(0.5, 1.5, 2.5) *
+                  constants::_V_VERLET_VELOCITY_FACTOR_;
+
+    for (size_t i = 0; i < 3; ++i)
+        EXPECT_DOUBLE_EQ(
+            molecule.getAtomPosition(1)[i],
+            1.0 + 0.5 * 0.1 * velocities[i] * constants::_FS_TO_S_
+        );
+}
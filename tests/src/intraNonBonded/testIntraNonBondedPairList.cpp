@@ -0,0 +1,211 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include <gtest/gtest.h>   // for Test, EXPECT_NEAR, EXPECT_EQ
+
+#include <cstddef>   // for size_t
+#include <memory>    // for shared_ptr, make_shared
+#include <vector>    // for vector
+
+#include "atom.hpp"                      // for Atom
+#include "coulombShiftedPotential.hpp"   // for CoulombShiftedPotential
+#include "forceFieldNonCoulomb.hpp"      // for ForceFieldNonCoulomb
+#include "gtest/gtest.h"                 // for Message, TestPartResult
+#include "intraNonBondedContainer.hpp"   // for IntraNonBondedContainer
+#include "intraNonBondedMap.hpp"         // for IntraNonBondedMap
+#include "intraNonBondedPairList.hpp"    // for IntraNonBondedPairList
+#include "lennardJonesPair.hpp"          // for LennardJonesPair
+#include "matrix.hpp"                    // for Matrix
+#include "molecule.hpp"                  // for Molecule
+#include "physicalData.hpp"              // for PhysicalData
+#include "potentialSettings.hpp"         // for PotentialSettings
+#include "simulationBox.hpp"             // for SimulationBox
+
+namespace potential
+{
+    class NonCoulombPair;   // forward declaration
+}
+
+/**
+ * @brief tests that the flattened pair list reproduces the interactions of
+ * the IntraNonBondedMap including the 1-4 scaling and that the energy-only
+ * path does not store any forces
+ */
+TEST(testIntraNonBondedPairList, buildAndCalculate)
+{
+    auto molecule = simulationBox::Molecule(0);
+    molecule.setNumberOfAtoms(3);
+
+    auto atom1 = std::make_shared<simulationBox::Atom>();
+    auto atom2 = std::make_shared<simulationBox::Atom>();
+    auto atom3 = std::make_shared<simulationBox::Atom>();
+
+    atom1->setPosition({0.0, 0.0, 0.0});
+    atom2->setPosition({0.0, 0.0, 11.0});
+    atom3->setPosition({0.0, 11.0, 0.0});
+
+    for (auto &atom : {atom1, atom2, atom3}) atom->setForce({0.0, 0.0, 0.0});
+
+    atom1->setInternalGlobalVDWType(0);
+    atom2->setInternalGlobalVDWType(1);
+    atom3->setInternalGlobalVDWType(1);
+    atom1->setAtomType(0);
+    atom2->setAtomType(1);
+    atom3->setAtomType(1);
+    atom1->setPartialCharge(0.5);
+    atom2->setPartialCharge(-0.5);
+    atom3->setPartialCharge(-0.5);
+
+    molecule.addAtom(atom1);
+    molecule.addAtom(atom2);
+    molecule.addAtom(atom3);
+
+    settings::PotentialSettings::setScale14Coulomb(0.75);
+    settings::PotentialSettings::setScale14VanDerWaals(0.5);
+
+    auto intraNonBondedType =
+        intraNonBonded::IntraNonBondedContainer(0, {{-1, 2}});
+    auto intraNonBondedMap =
+        intraNonBonded::IntraNonBondedMap(&molecule, &intraNonBondedType);
+
+    auto coulombPotential    = potential::CoulombShiftedPotential(10.0);
+    auto nonCoulombPotential = potential::ForceFieldNonCoulomb();
+    nonCoulombPotential.setNonCoulombPairsMatrix(
+        linearAlgebra::Matrix<std::shared_ptr<potential::NonCoulombPair>>(2, 2)
+    );
+
+    auto nonCoulombPair =
+        potential::LennardJonesPair(size_t(0), size_t(1), 10.0, 2.0, 3.0);
+    nonCoulombPotential.setNonCoulombPairsMatrix(0, 1, nonCoulombPair);
+    nonCoulombPotential.setNonCoulombPairsMatrix(1, 0, nonCoulombPair);
+
+    auto simulationBox = simulationBox::SimulationBox();
+    simulationBox.setBoxDimensions({10.0, 10.0, 10.0});
+
+    auto pairList = intraNonBonded::IntraNonBondedPairList();
+
+    EXPECT_FALSE(pairList.isBuilt());
+
+    pairList.build({intraNonBondedMap}, nonCoulombPotential);
+
+    EXPECT_TRUE(pairList.isBuilt());
+    EXPECT_EQ(pairList.getNumberOfPairs(), 2);
+    EXPECT_EQ(pairList.getNumberOfMolecules(), 1);
+    EXPECT_EQ(pairList.getNumberOfNonCoulPairs(), 1);
+
+    auto physicalData = physicalData::PhysicalData();
+
+    pairList.calculate(coulombPotential, simulationBox, physicalData);
+
+    const auto coulombEnergy = -67.242901903583757;
+
+    EXPECT_NEAR(
+        physicalData.getIntraCoulombEnergy(),
+        coulombEnergy * 0.75 + coulombEnergy,
+        1e-6
+    );
+    EXPECT_NEAR(
+        physicalData.getIntraNonCoulombEnergy(),
+        5.0 * 0.5 + 5.0,
+        1e-6
+    );
+
+    auto physicalDataMap = physicalData::PhysicalData();
+    auto forces          = std::vector<linearAlgebra::Vec3D>();
+
+    for (auto &atom : {atom1, atom2, atom3})
+    {
+        forces.push_back(atom->getForce());
+        atom->setForce({0.0, 0.0, 0.0});
+        atom->setShiftForce({0.0, 0.0, 0.0});
+    }
+
+    intraNonBondedMap.calculate(
+        &coulombPotential,
+        &nonCoulombPotential,
+        simulationBox,
+        physicalDataMap
+    );
+
+    EXPECT_NEAR(
+        physicalData.getIntraCoulombEnergy(),
+        physicalDataMap.getIntraCoulombEnergy(),
+        1e-10
+    );
+    EXPECT_NEAR(
+        physicalData.getIntraNonCoulombEnergy(),
+        physicalDataMap.getIntraNonCoulombEnergy(),
+        1e-10
+    );
+
+    EXPECT_NEAR(forces[0][2], atom1->getForce()[2], 1e-10);
+    EXPECT_NEAR(forces[1][2], atom2->getForce()[2], 1e-10);
+    EXPECT_NEAR(forces[2][1], atom3->getForce()[1], 1e-10);
+    EXPECT_NEAR(forces[0][1], atom1->getForce()[1], 1e-10);
+
+    auto physicalDataEnergy = physicalData::PhysicalData();
+
+    for (auto &atom : {atom1, atom2, atom3})
+    {
+        atom->setForce({0.0, 0.0, 0.0});
+        atom->setShiftForce({0.0, 0.0, 0.0});
+    }
+
+    pairList.calculate<false>(
+        coulombPotential,
+        simulationBox,
+        physicalDataEnergy
+    );
+
+    EXPECT_NEAR(
+        physicalDataEnergy.getIntraCoulombEnergy(),
+        physicalData.getIntraCoulombEnergy(),
+        1e-10
+    );
+    EXPECT_NEAR(
+        physicalDataEnergy.getIntraNonCoulombEnergy(),
+        physicalData.getIntraNonCoulombEnergy(),
+        1e-10
+    );
+
+    for (auto &atom : {atom1, atom2, atom3})
+    {
+        EXPECT_EQ(atom->getForce(), linearAlgebra::Vec3D(0.0, 0.0, 0.0));
+        EXPECT_EQ(atom->getShiftForce(), linearAlgebra::Vec3D(0.0, 0.0, 0.0));
+    }
+    auto physicalDataNoShift = physicalData::PhysicalData();
+
+    pairList.calculate<true, false>(
+        coulombPotential,
+        simulationBox,
+        physicalDataNoShift
+    );
+
+    EXPECT_NEAR(forces[0][2], atom1->getForce()[2], 1e-10);
+    EXPECT_NEAR(forces[1][2], atom2->getForce()[2], 1e-10);
+    EXPECT_NEAR(forces[2][1], atom3->getForce()[1], 1e-10);
+    EXPECT_NEAR(forces[0][1], atom1->getForce()[1], 1e-10);
+
+    for (auto &atom : {atom1, atom2, atom3})
+        EXPECT_EQ(atom->getShiftForce(), linearAlgebra::Vec3D(0.0, 0.0, 0.0));
+}
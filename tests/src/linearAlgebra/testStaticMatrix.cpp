@@ -0,0 +1,84 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include <gtest/gtest.h>   // for Test, TestInfo (ptr only), TEST
+
+#include "exceptions.hpp"     // for LinearAlgebraException
+#include "gtest/gtest.h"      // for Message, TestPartResult
+#include "staticMatrix.hpp"   // for StaticMatrix, StaticLUDecomposition
+
+using namespace linearAlgebra;
+
+TEST(TestStaticMatrix, indexOperator)
+{
+    StaticMatrix<double, 2, 3> mat(1.0);
+
+    mat(1, 2) = 5.0;
+
+    EXPECT_EQ(mat(0, 0), 1.0);
+    EXPECT_EQ(mat(1, 2), 5.0);
+    EXPECT_EQ(mat.rows(), 2);
+    EXPECT_EQ(mat.cols(), 3);
+    EXPECT_EQ(mat.size(), 6);
+}
+
+TEST(TestStaticLUDecomposition, solve)
+{
+    StaticMatrix<double, 4> mat;
+
+    // zero on the first diagonal element to force pivoting
+    mat(0, 0) = 0.0;
+    mat(0, 1) = 2.0;
+    mat(0, 2) = 1.0;
+    mat(1, 0) = 1.0;
+    mat(1, 1) = 1.0;
+    mat(1, 2) = 1.0;
+    mat(2, 0) = 4.0;
+    mat(2, 1) = -1.0;
+    mat(2, 2) = 3.0;
+
+    // entries outside of the actual 3x3 system have to be ignored
+    mat(3, 3) = 42.0;
+
+    const StaticLUDecomposition<double, 4> lu(mat, 3);
+
+    EXPECT_EQ(lu.size(), 3);
+
+    StaticVector<double, 4> rhs{6.0, 6.0, 15.0, 7.0};
+    lu.solve(rhs);
+
+    EXPECT_NEAR(rhs[0], 1.0, 1e-12);
+    EXPECT_NEAR(rhs[1], 1.0, 1e-12);
+    EXPECT_NEAR(rhs[2], 4.0, 1e-12);
+    EXPECT_EQ(rhs[3], 7.0);
+}
+
+TEST(TestStaticLUDecomposition, exceptions)
+{
+    StaticMatrix<double, 2> mat(1.0);
+
+    StaticLUDecomposition<double, 2> lu;
+
+    EXPECT_THROW(lu.decompose(mat, 2), customException::LinearAlgebraException);
+    EXPECT_THROW(lu.decompose(mat, 3), customException::LinearAlgebraException);
+}
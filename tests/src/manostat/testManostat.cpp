@@ -28,15 +28,20 @@
 
 #include "atom.hpp"                                  // for Atom
 #include "berendsenManostat.hpp"                     // for BerendsenManostat
+#include "celllist.hpp"                              // for CellList
 #include "constants/internalConversionFactors.hpp"   // for _PRESSURE_FACTOR_
 #include "exceptions.hpp"                            // for ManostatException
-#include "gtest/gtest.h"           // for Message, TestPartResult
-#include "mathUtilities.hpp"       // for compare
-#include "molecule.hpp"            // for Molecule
-#include "potentialSettings.hpp"   // for PotentialSettings
-#include "throwWithMessage.hpp"    // for EXPECT_THROW_MSG
-#include "timingsSettings.hpp"     // for TimingsSettings
-#include "vector3d.hpp"            // for Vector3D, Vec3D
+#include "gtest/gtest.h"             // for Message, TestPartResult
+#include "mathUtilities.hpp"         // for compare
+#include "molecule.hpp"              // for Molecule
+#include "monteCarloManostat.hpp"    // for MonteCarloManostat
+#include "potentialBruteForce.hpp"   // for PotentialBruteForce
+#include "potentialSettings.hpp"     // for PotentialSettings
+#include "settings.hpp"              // for Settings
+#include "thermostatSettings.hpp"    // for ThermostatSettings
+#include "throwWithMessage.hpp"      // for EXPECT_THROW_MSG
+#include "timingsSettings.hpp"       // for TimingsSettings
+#include "vector3d.hpp"              // for Vector3D, Vec3D
 
 /**
  * @brief tests function calculate pressure
@@ -163,4 +168,191 @@ TEST_F(TestManostat, testRotateMu)
             {0.0, 0.0, 9.0},
         })
     );
+}
+
+/**
+ * @brief tests that a rejected Monte Carlo volume move restores the box and
+ * the positions
+ *
+ * @details the move is always rejected, because the coulomb radius cut off
+ * is larger than half of the minimal box dimension
+ *
+ */
+TEST_F(TestManostat, monteCarloManostatRejectedMove)
+{
+    settings::PotentialSettings::setCoulombRadiusCutOff(10.0);
+    _box->setBoxDimensions({2.0, 2.0, 2.0});
+    _box->setVolume(8.0);
+
+    auto       molecule = simulationBox::Molecule();
+    const auto atom     = std::make_shared<simulationBox::Atom>();
+    atom->setPosition({1.0, 0.5, 0.0});
+    molecule.addAtom(atom);
+    molecule.setCenterOfMass({1.0, 0.5, 0.0});
+    molecule.setNumberOfAtoms(1);
+
+    _box->addMolecule(molecule);
+    _box->addAtom(atom);
+
+    _box->setTotalMass(18.0);
+    _box->calculateDensity();
+    const auto density = _box->getDensity();
+
+    auto manostat = manostat::MonteCarloManostat(
+        1.0,
+        1,
+        0.1,
+        settings::Isotropy::ISOTROPIC
+    );
+
+    EXPECT_FALSE(manostat.attemptVolumeMove(*_box, *_data));
+    EXPECT_EQ(_box->getBoxDimensions(), linearAlgebra::Vec3D(2.0, 2.0, 2.0));
+    EXPECT_EQ(_box->getVolume(), 8.0);
+    EXPECT_DOUBLE_EQ(_box->getDensity(), density);
+    EXPECT_EQ(atom->getPosition(), linearAlgebra::Vec3D(1.0, 0.5, 0.0));
+    EXPECT_EQ(manostat.getNumberOfAttempts(), 1);
+    EXPECT_EQ(manostat.getNumberOfAccepted(), 0);
+}
+
+/**
+ * @brief tests application of the Monte Carlo manostat
+ *
+ * @details for a single molecule the energy does not depend on the volume
+ * and at zero pressure all expansions and most compressions are accepted,
+ * therefore the maximum volume change is increased after 10 attempts.
+ * Accepted moves scale the center of mass of the molecule with the box.
+ *
+ */
+TEST_F(TestManostat, applyMonteCarloManostat)
+{
+    settings::PotentialSettings::setCoulombRadiusCutOff(1.0);
+    settings::ThermostatSettings::setTargetTemperature(300.0);
+    settings::Settings::setRandomSeed(42);
+
+    _box->setBoxDimensions({10.0, 10.0, 10.0});
+    _box->setVolume(1000.0);
+
+    auto       molecule = simulationBox::Molecule();
+    const auto atom     = std::make_shared<simulationBox::Atom>();
+    atom->setPosition({2.0, 3.0, 4.0});
+    molecule.addAtom(atom);
+    molecule.setCenterOfMass({2.0, 3.0, 4.0});
+    molecule.setNumberOfAtoms(1);
+
+    _box->addMolecule(molecule);
+    _box->addAtom(atom);
+
+    auto manostat = manostat::MonteCarloManostat(
+        0.0,
+        2,
+        0.1,
+        settings::Isotropy::ISOTROPIC
+    );
+    manostat.setPotential(std::make_shared<potential::PotentialBruteForce>());
+    manostat.setCellList(std::make_shared<simulationBox::CellList>());
+
+    size_t nVolumeChanges = 0;
+
+    for (size_t i = 0; i < 20; ++i)
+    {
+        const auto oldVolume = _box->getVolume();
+
+        _box->getMolecule(0).setCenterOfMass(atom->getPosition());
+        manostat.applyManostat(*_box, *_data);
+
+        if (_box->getVolume() != oldVolume)
+            ++nVolumeChanges;
+
+        const auto scale = _box->getBoxDimensions()[0] / 10.0;
+
+        EXPECT_DOUBLE_EQ(_data->getVolume(), _box->getVolume());
+        EXPECT_TRUE(utilities::compare(
+            atom->getPosition(),
+            linearAlgebra::Vec3D(2.0, 3.0, 4.0) * scale,
+            1e-9
+        ));
+    }
+
+    EXPECT_EQ(manostat.getNumberOfAttempts(), 10);
+    EXPECT_EQ(manostat.getNumberOfAccepted(), nVolumeChanges);
+    EXPECT_DOUBLE_EQ(manostat.getVolumeChange(), 0.1 * 1.1);
+}
+
+/**
+ * @brief tests that the Monte Carlo manostat keeps the intra molecular
+ * energies out of the acceptance test
+ *
+ * @details the inter molecular energy of a single molecule vanishes for
+ * every volume, so at zero pressure nearly all moves are accepted. The intra
+ * molecular energies are unchanged by a volume move and have to stay part
+ * of the total Coulomb and non Coulomb energies after accepted moves.
+ *
+ */
+TEST_F(TestManostat, monteCarloManostatIntraEnergies)
+{
+    settings::PotentialSettings::setCoulombRadiusCutOff(1.0);
+    settings::ThermostatSettings::setTargetTemperature(300.0);
+    settings::Settings::setRandomSeed(42);
+
+    _box->setBoxDimensions({10.0, 10.0, 10.0});
+    _box->setVolume(1000.0);
+
+    auto       molecule = simulationBox::Molecule();
+    const auto atom     = std::make_shared<simulationBox::Atom>();
+    atom->setPosition({2.0, 3.0, 4.0});
+    molecule.addAtom(atom);
+    molecule.setCenterOfMass({2.0, 3.0, 4.0});
+    molecule.setNumberOfAtoms(1);
+
+    _box->addMolecule(molecule);
+    _box->addAtom(atom);
+
+    _data->addIntraCoulombEnergy(-50.0);
+    _data->addIntraNonCoulombEnergy(-20.0);
+
+    auto manostat = manostat::MonteCarloManostat(
+        0.0,
+        1,
+        0.1,
+        settings::Isotropy::ISOTROPIC
+    );
+    manostat.setPotential(std::make_shared<potential::PotentialBruteForce>());
+    manostat.setCellList(std::make_shared<simulationBox::CellList>());
+
+    size_t nAccepted = 0;
+
+    for (size_t i = 0; i < 9; ++i)
+    {
+        if (manostat.attemptVolumeMove(*_box, *_data))
+            ++nAccepted;
+
+        EXPECT_DOUBLE_EQ(_data->getCoulombEnergy(), -50.0);
+        EXPECT_DOUBLE_EQ(_data->getNonCoulombEnergy(), -20.0);
+        EXPECT_DOUBLE_EQ(_data->getIntraCoulombEnergy(), -50.0);
+        EXPECT_DOUBLE_EQ(_data->getIntraNonCoulombEnergy(), -20.0);
+    }
+
+    EXPECT_GT(nAccepted, 0);
+    EXPECT_EQ(manostat.getNumberOfAccepted(), nAccepted);
+}
+
+/**
+ * @brief tests the random state of the Monte Carlo manostat
+ *
+ */
+TEST_F(TestManostat, monteCarloManostatRandomState)
+{
+    auto manostat = manostat::MonteCarloManostat(
+        1.0,
+        1,
+        0.1,
+        settings::Isotropy::ISOTROPIC
+    );
+
+    manostat.setRandomState("42 7 0.05");
+    EXPECT_EQ(manostat.getRandomState(), "42 7 0.05");
+    EXPECT_EQ(manostat.getVolumeChange(), 0.05);
+
+    manostat.setRandomState("invalid");
+    EXPECT_EQ(manostat.getRandomState(), "42 7 0.05");
 }
\ No newline at end of file
@@ -0,0 +1,86 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "testOptimizer.hpp"
+
+#include "defaults.hpp"        // for _FIRE_TIMESTEP_DEFAULT_
+#include "fire.hpp"            // for FIRE
+#include "gtest/gtest.h"       // for Message, TestPartResult
+#include "mathUtilities.hpp"   // for compare
+
+/**
+ * @brief tests that the first FIRE step is a plain MD step
+ *
+ * @details the power of the zeroed velocities vanishes in the first step,
+ * which must not be treated as an uphill move
+ *
+ */
+TEST_F(TestOptimizer, fireFirstStepKeepsTimestep)
+{
+    auto optimizer = opt::FIRE(1);
+
+    const auto positions = _box->getPositions();
+
+    runOptimizer(optimizer, 1);
+
+    const auto timestep = defaults::_FIRE_TIMESTEP_DEFAULT_;
+
+    EXPECT_DOUBLE_EQ(optimizer.getTimestep(), timestep);
+    EXPECT_DOUBLE_EQ(
+        optimizer.getAlpha(),
+        defaults::_FIRE_ALPHA_START_DEFAULT_
+    );
+
+    const auto &atoms = _box->getAtoms();
+
+    for (size_t i = 0; i < atoms.size(); ++i)
+    {
+        const auto force    = _evaluator->_minima[i] - positions[i];
+        const auto expected = positions[i] + timestep * timestep * force;
+
+        EXPECT_TRUE(
+            utilities::compare(atoms[i]->getPosition(), expected, 1e-12)
+        );
+    }
+}
+
+/**
+ * @brief tests that FIRE converges to the minima of harmonic wells
+ *
+ */
+TEST_F(TestOptimizer, fireConvergesOnHarmonicWells)
+{
+    auto optimizer = opt::FIRE(300);
+
+    runOptimizer(optimizer, 300);
+
+    const auto &atoms = _box->getAtoms();
+
+    for (size_t i = 0; i < atoms.size(); ++i)
+        EXPECT_TRUE(utilities::compare(
+            atoms[i]->getPosition(),
+            _evaluator->_minima[i],
+            1e-6
+        ));
+
+    EXPECT_GT(optimizer.getTimestep(), defaults::_FIRE_TIMESTEP_DEFAULT_);
+}
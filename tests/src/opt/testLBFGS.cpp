@@ -0,0 +1,80 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include "testOptimizer.hpp"
+
+#include "gtest/gtest.h"       // for Message, TestPartResult
+#include "lbfgs.hpp"           // for LBFGS
+#include "mathUtilities.hpp"   // for compare
+
+/**
+ * @brief tests that LBFGS converges to the minima of harmonic wells
+ *
+ */
+TEST_F(TestOptimizer, lbfgsConvergesOnHarmonicWells)
+{
+    auto optimizer = opt::LBFGS(50, _box->getNumberOfAtoms());
+
+    runOptimizer(optimizer, 50);
+
+    const auto &atoms = _box->getAtoms();
+
+    for (size_t i = 0; i < atoms.size(); ++i)
+        EXPECT_TRUE(utilities::compare(
+            atoms[i]->getPosition(),
+            _evaluator->_minima[i],
+            1e-6
+        ));
+
+    EXPECT_NEAR(_physicalData->getTotalEnergy(), 0.0, 1e-10);
+    EXPECT_GT(optimizer.getNumberOfStored(), 0);
+}
+
+/**
+ * @brief tests that a failed line search restores the starting point
+ *
+ * @details the energy of the uphill evaluator grows with every evaluation,
+ * so the Armijo condition is never fulfilled
+ *
+ */
+TEST_F(TestOptimizer, lbfgsRestoresStartingPointAfterFailedLineSearch)
+{
+    _evaluator->_isUphill = true;
+
+    const auto positions = _box->getPositions();
+
+    auto optimizer = opt::LBFGS(1, _box->getNumberOfAtoms());
+
+    runOptimizer(optimizer, 1);
+
+    const auto &atoms = _box->getAtoms();
+
+    for (size_t i = 0; i < atoms.size(); ++i)
+    {
+        const auto force = _evaluator->_minima[i] - positions[i];
+
+        EXPECT_TRUE(utilities::compare(atoms[i]->getPosition(), positions[i]));
+        EXPECT_TRUE(utilities::compare(atoms[i]->getForce(), force));
+    }
+
+    EXPECT_EQ(optimizer.getNumberOfStored(), 0);
+}
@@ -0,0 +1,273 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include <gtest/gtest.h>   // for Test, EXPECT_EQ
+
+#include <cstdio>        // for remove
+#include <filesystem>    // for resize_file, file_size
+#include <fstream>       // for ifstream, fstream
+#include <iterator>      // for istreambuf_iterator
+#include <string>        // for string
+#include <vector>        // for vector
+
+#include "boxOutput.hpp"              // for BoxFileOutput
+#include "energyOutput.hpp"           // for EnergyOutput
+#include "exceptions.hpp"             // for InputFileException
+#include "forceFieldSettings.hpp"     // for ForceFieldSettings
+#include "momentumOutput.hpp"         // for MomentumOutput
+#include "observableFileReader.hpp"   // for ObservableFileReader
+#include "observableOutput.hpp"       // for ObservableOutput
+#include "observableTable.hpp"        // for ObservableTable
+#include "physicalData.hpp"           // for PhysicalData
+#include "settings.hpp"               // for Settings
+#include "settingsInstance.hpp"       // for SettingsInstance, SettingsScope
+#include "stressOutput.hpp"           // for StressOutput
+#include "throwWithMessage.hpp"       // for EXPECT_THROW_MSG
+#include "vector3d.hpp"               // for Vec3D
+#include "virialOutput.hpp"           // for VirialOutput
+
+using namespace output;
+using namespace settings;
+using namespace linearAlgebra;
+using namespace physicalData;
+
+/**
+ * @brief reads the whole content of a file
+ *
+ * @param fileName
+ * @return std::string
+ */
+static std::string readFile(const std::string &fileName)
+{
+    std::ifstream file(fileName);
+
+    return {std::istreambuf_iterator<char>(file), {}};
+}
+
+/**
+ * @brief creates physical data which differs from frame to frame
+ *
+ * @param frame
+ * @return PhysicalData
+ */
+static PhysicalData createPhysicalData(const size_t frame)
+{
+    const auto value = 1.0 + 0.37 * double(frame);
+
+    PhysicalData data;
+    data.setTemperature(300.0 + value);
+    data.setPressure(-value);
+    data.setKineticEnergy(3.0 * value);
+    data.setCoulombEnergy(-4.0 * value);
+    data.setNonCoulombEnergy(5.0 / value);
+    data.setMomentum(Vec3D(value, -2.0 * value, 1.0e-7));
+    data.setAngularMomentum(Vec3D(0.5, value, 1.0e5));
+    data.setVirial(tensor3D(
+        Vec3D(value, 2.0, 3.0),
+        Vec3D(4.0, value, 6.0),
+        Vec3D(7.0, 8.0, value)
+    ));
+    data.setStressTensor(tensor3D(
+        Vec3D(-value, 1.0e-9, 0.0),
+        Vec3D(0.0, 1.0e9, 0.0),
+        Vec3D(0.0, 0.0, 1.0)
+    ));
+    data.setLoopTime(0.01 * value);
+
+    return data;
+}
+
+/**
+ * @brief tests that the text files converted from the binary observable
+ * file are identical to the text files written directly
+ *
+ */
+TEST(TestObservableOutput, convertReproducesTextFiles)
+{
+    auto                instance = SettingsInstance();
+    const SettingsScope scope(instance);
+
+    ForceFieldSettings::activate();
+    Settings::setJobtype(JobType::MM_MD);
+
+    auto energyOutput   = EnergyOutput("direct.en");
+    auto instEnOutput   = EnergyOutput("direct.instant_en");
+    auto momentumOutput = MomentumOutput("direct.mom");
+    auto virialOutput   = VirialOutput("direct.vir");
+    auto stressOutput   = StressOutput("direct.stress");
+    auto boxOutput      = BoxFileOutput("direct.box");
+
+    energyOutput.setFilename("direct.en");
+    instEnOutput.setFilename("direct.instant_en");
+    momentumOutput.setFilename("direct.mom");
+    virialOutput.setFilename("direct.vir");
+    stressOutput.setFilename("direct.stress");
+    boxOutput.setFilename("direct.box");
+
+    auto observableOutput = ObservableOutput("test.obs");
+    observableOutput.setFilename("test.obs");
+    observableOutput.setBlockSize(2);
+
+    for (size_t frame = 0; frame < 5; ++frame)
+    {
+        const auto step         = 10 * frame;
+        const auto physicalData = createPhysicalData(frame);
+        const auto averageData  = createPhysicalData(frame + 7);
+        const auto boxDims      = Vec3D(10.0 + double(frame), 11.0, 12.0);
+        const auto boxAngles    = Vec3D(90.0, 90.0, 120.0);
+
+        energyOutput.write(step, averageData);
+        instEnOutput.write(step, physicalData);
+        momentumOutput.write(step, averageData);
+        virialOutput.write(step, physicalData);
+        stressOutput.write(step, physicalData);
+        boxOutput.write(step, boxDims, boxAngles);
+
+        observableOutput
+            .record(step, physicalData, averageData, boxDims, boxAngles);
+    }
+
+    observableOutput.flush();
+    observableOutput.close();
+
+    energyOutput.close();
+    instEnOutput.close();
+    momentumOutput.close();
+    virialOutput.close();
+    stressOutput.close();
+    boxOutput.close();
+
+    auto reader = ObservableFileReader("test.obs");
+    reader.read();
+
+    EXPECT_FALSE(reader.isTruncated());
+    ASSERT_EQ(reader.getTables().size(), 6);
+    EXPECT_EQ(reader.getTables()[0].getNumberOfRows(), 5);
+    EXPECT_EQ(reader.getTables()[0].getColumns()[0].name, "temperature");
+
+    reader.convert("converted");
+
+    const auto extensions = std::vector<std::string>{
+        "en",
+        "instant_en",
+        "mom",
+        "vir",
+        "stress",
+        "box"
+    };
+
+    for (const auto &extension : extensions)
+    {
+        EXPECT_EQ(
+            readFile("converted." + extension),
+            readFile("direct." + extension)
+        );
+
+        ::remove(("converted." + extension).c_str());
+        ::remove(("direct." + extension).c_str());
+    }
+
+    ::remove("test.obs");
+}
+
+/**
+ * @brief tests that an incomplete trailing block is skipped and that a
+ * corrupted block is detected
+ *
+ */
+TEST(TestObservableOutput, truncatedAndCorruptedFile)
+{
+    auto observableOutput = ObservableOutput("test.obs");
+    observableOutput.setFilename("test.obs");
+    observableOutput.setBlockSize(3);
+
+    const auto box = Vec3D(10.0);
+
+    for (size_t frame = 0; frame < 6; ++frame)
+    {
+        const auto data = createPhysicalData(frame);
+        observableOutput.record(frame, data, data, box, box);
+    }
+
+    observableOutput.close();
+
+    const auto fileSize = std::filesystem::file_size("test.obs");
+    std::filesystem::resize_file("test.obs", fileSize - 12);
+
+    auto reader = ObservableFileReader("test.obs");
+    reader.read();
+
+    EXPECT_TRUE(reader.isTruncated());
+    EXPECT_EQ(reader.getTables()[0].getNumberOfRows(), 6);
+    EXPECT_EQ(reader.getTables()[4].getNumberOfRows(), 6);
+    EXPECT_EQ(reader.getTables()[5].getNumberOfRows(), 3);
+
+    // the incomplete box block has 3 * 7 * 8 + 24 - 12 = 180 bytes, the
+    // byte 100 bytes before it belongs to the values of the stress block
+    {
+        std::fstream file("test.obs", std::ios::in | std::ios::out);
+        file.seekp(-280, std::ios::end);
+        file.put('x');
+    }
+
+    EXPECT_THROW_MSG(
+        reader.read(),
+        customException::InputFileException,
+        "Checksum mismatch in observable file test.obs"
+    );
+
+    ::remove("test.obs");
+
+    EXPECT_THROW_MSG(
+        reader.read(),
+        customException::InputFileException,
+        "Could not open observable file test.obs"
+    );
+}
+
+/**
+ * @brief tests that rows with a wrong number of values are rejected
+ *
+ */
+TEST(TestObservableOutput, appendRowChecksNumberOfValues)
+{
+    auto table = ObservableTable("energy", "en", 10, false);
+
+    table.addColumn("temperature", {ObservableNotation::FIXED, 15, 5});
+    table.addColumn("pressure", {ObservableNotation::FIXED, 15, 5});
+
+    const std::vector<double> row      = {1.0, 2.0};
+    const std::vector<double> shortRow = {1.0};
+
+    table.appendRow(1, row);
+
+    EXPECT_THROW_MSG(
+        table.appendRow(2, shortRow),
+        customException::InputFileException,
+        "Row of observable table energy has 1 values but 2 columns"
+    );
+
+    EXPECT_EQ(table.getNumberOfRows(), 1);
+    EXPECT_EQ(table.getValues(0).size(), 1);
+    EXPECT_EQ(table.getValues(1).size(), 1);
+}
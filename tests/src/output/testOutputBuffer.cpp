@@ -0,0 +1,145 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include <gtest/gtest.h>   // for Test, EXPECT_EQ
+
+#include <cmath>     // for INFINITY, NAN
+#include <format>    // for format
+#include <sstream>   // for ostringstream
+#include <string>    // for string
+#include <vector>    // for vector
+
+#include "outputBuffer.hpp"   // for OutputBuffer
+#include "vector3d.hpp"       // for Vec3D
+
+using output::OutputBuffer;
+
+/**
+ * @brief values covering signs, rounding, large and small magnitudes and
+ * special values
+ *
+ */
+static const std::vector<double> testValues = {
+    0.0,     -0.0,    1.0,      -1.0,      0.5,      123.456789012345,
+    -9.99999999999, 1.0e-9, -3.2e-12, 1.0e10,  6.02214076e23, 1.0e300,
+    1.0 / 3.0, 2.675,  0.000123456, INFINITY, -INFINITY, NAN
+};
+
+/**
+ * @brief tests that fixed formatting matches std::format
+ *
+ */
+TEST(TestOutputBuffer, appendFixed)
+{
+    for (const auto value : testValues)
+    {
+        OutputBuffer buffer;
+        buffer.appendFixed(value, 15, 8);
+        EXPECT_EQ(buffer.str(), std::format("{:15.8f}", value));
+
+        buffer.clear();
+        buffer.appendFixed(value, 20, 12);
+        EXPECT_EQ(buffer.str(), std::format("{:20.12f}", value));
+    }
+}
+
+/**
+ * @brief tests that scientific formatting matches std::format
+ *
+ */
+TEST(TestOutputBuffer, appendScientific)
+{
+    for (const auto value : testValues)
+    {
+        OutputBuffer buffer;
+        buffer.appendScientific(value, 20, 8);
+        EXPECT_EQ(buffer.str(), std::format("{:20.8e}", value));
+
+        buffer.clear();
+        buffer.appendScientific(value, 0, 5);
+        EXPECT_EQ(buffer.str(), std::format("{:.5e}", value));
+    }
+}
+
+/**
+ * @brief tests that general formatting matches the default std::ostream
+ * formatting
+ *
+ */
+TEST(TestOutputBuffer, appendGeneral)
+{
+    for (const auto value : testValues)
+    {
+        OutputBuffer       buffer;
+        std::ostringstream stream;
+
+        buffer.appendGeneral(value);
+        stream << value;
+
+        EXPECT_EQ(buffer.str(), stream.str());
+    }
+
+    const auto vector = linearAlgebra::Vec3D(10.0, 12.3456789, 90.0);
+
+    OutputBuffer       buffer;
+    std::ostringstream stream;
+
+    buffer.appendGeneral(vector);
+    stream << vector;
+
+    EXPECT_EQ(buffer.str(), stream.str());
+}
+
+/**
+ * @brief tests integer and string padding
+ *
+ */
+TEST(TestOutputBuffer, appendIntegerAndStrings)
+{
+    OutputBuffer buffer;
+
+    buffer.appendInteger(42, 10);
+    buffer.appendInteger(7, 5, true);
+    buffer.appendInteger(123456, 2);
+    buffer.appendLeft("H", 5);
+    buffer.appendRight("C", 5);
+    buffer.appendLeft("LONGNAME", 5);
+
+    const auto expected = std::format(
+        "{:10d}{:<5}{:2d}{:<5}{:>5}{:<5}",
+        42,
+        7,
+        123456,
+        "H",
+        "C",
+        "LONGNAME"
+    );
+
+    EXPECT_EQ(buffer.str(), expected);
+
+    std::ostringstream stream;
+    buffer.writeTo(stream);
+
+    EXPECT_EQ(stream.str(), expected);
+    EXPECT_EQ(buffer.size(), 0);
+}
@@ -25,7 +25,8 @@
 #include <iosfwd>   // for ifstream
 #include <string>   // for getline, allocator, string
 
-#include "gtest/gtest.h"   // for Message, TestPartResult
+#include "frameSnapshot.hpp"   // for FrameSnapshot
+#include "gtest/gtest.h"       // for Message, TestPartResult
 
 /**
  * @brief Test the writeXyz method
@@ -129,4 +130,40 @@ TEST_F(TestTrajectoryOutput, writeCharges)
     EXPECT_EQ(line, "O    \t    -1.00000000");
     getline(file, line);
     EXPECT_EQ(line, "Ar   \t     0.00000000");
-}
\ No newline at end of file
+}
+/**
+ * @brief Test writing the xyz file from a frame snapshot
+ *
+ * @details the snapshot has to be independent of later changes of the
+ * simulation box
+ *
+ */
+TEST_F(TestTrajectoryOutput, writeXyzFromSnapshot)
+{
+    auto snapshot = output::FrameSnapshot();
+    snapshot.captureSimulationBox(*_simulationBox);
+
+    EXPECT_EQ(snapshot.getNumberOfAtoms(), 3);
+    EXPECT_EQ(snapshot.getAtomName(2), "Ar");
+    EXPECT_EQ(snapshot.getMoleculeType(2), 2);
+    EXPECT_EQ(snapshot.getAtomIndex(1), 1);
+    EXPECT_EQ(snapshot.getPartialCharge(1), -1.0);
+
+    _simulationBox->getMolecules()[0].getAtom(0).setPosition({5.0, 5.0, 5.0});
+
+    _trajectoryOutput->setFilename("default.xyz");
+    _trajectoryOutput->writeXyz(snapshot);
+    _trajectoryOutput->close();
+    std::ifstream file("default.xyz");
+    std::string   line;
+    getline(file, line);
+    EXPECT_EQ(line, "3  10 10 10  90 90 90");
+    getline(file, line);
+    EXPECT_EQ(line, "");
+    getline(file, line);
+    EXPECT_EQ(line, "H    \t     1.00000000\t     1.00000000\t     1.00000000");
+    getline(file, line);
+    EXPECT_EQ(line, "O    \t     1.00000000\t     2.00000000\t     3.00000000");
+    getline(file, line);
+    EXPECT_EQ(line, "Ar   \t     1.00000000\t     1.00000000\t     1.00000000");
+}
@@ -23,6 +23,7 @@
 #include "testPhysicalData.hpp"
 
 #include <memory>   // for allocator
+#include <vector>   // for vector
 
 #include "constants/conversionFactors.hpp"   // for _FS_TO_S_
 #include "constants/internalConversionFactors.hpp"   // for _KINETIC_ENERGY_FACTOR_, _TEMPERATURE_FACTOR_
@@ -48,6 +49,36 @@ TEST_F(TestPhysicalData, makeAverages)
     EXPECT_EQ(_physicalData->getQMEnergy(), 4.5);
 }
 
+/**
+ * @brief tests makeAverages with skipped kinetics and virial steps
+ *
+ */
+TEST_F(TestPhysicalData, makeAveragesSkipped)
+{
+    auto skipped = physicalData::PhysicalData();
+
+    skipped.setKineticEnergy(100.0);
+    skipped.setPressure(100.0);
+    skipped.setTemperature(1.0);
+
+    EXPECT_FALSE(skipped.isKineticsSkipped());
+
+    skipped.skipKinetics();
+    skipped.skipVirial();
+
+    EXPECT_TRUE(skipped.isKineticsSkipped());
+    EXPECT_EQ(skipped.getKineticEnergy(), 0.0);
+    EXPECT_EQ(skipped.getPressure(), 0.0);
+
+    _physicalData->updateAverages(skipped);
+    _physicalData->makeAverages(2);
+
+    EXPECT_EQ(_physicalData->getTemperature(), 2.0);
+    EXPECT_EQ(_physicalData->getKineticEnergy(), 5.0);
+    EXPECT_EQ(_physicalData->getMomentum(), linearAlgebra::Vec3D(4.0));
+    EXPECT_EQ(_physicalData->getPressure(), 8.0);
+}
+
 /**
  * @brief tests updateAverages function
  *
@@ -124,6 +155,51 @@ TEST_F(TestPhysicalData, calculateKinetics)
     );
 }
 
+/**
+ * @brief tests calculateKinetics function with a fused per atom update
+ *
+ */
+TEST_F(TestPhysicalData, calculateKineticsWithUpdate)
+{
+    auto reference = *_physicalData;
+    auto indices   = std::vector<size_t>();
+
+    auto scaleVelocity = [](auto &atom) { atom.scaleVelocity(2.0); };
+
+    for (auto &molecule : _simulationBox->getMolecules())
+        for (size_t i = 0; i < molecule.getNumberOfAtoms(); ++i)
+            scaleVelocity(molecule.getAtom(i));
+
+    reference.calculateKinetics(*_simulationBox);
+
+    for (auto &molecule : _simulationBox->getMolecules())
+        for (size_t i = 0; i < molecule.getNumberOfAtoms(); ++i)
+            molecule.getAtom(i).scaleVelocity(0.5);
+
+    auto update = [&indices, &scaleVelocity](auto &atom, const size_t index)
+    {
+        scaleVelocity(atom);
+        indices.push_back(index);
+    };
+
+    _physicalData->calculateKinetics(*_simulationBox, update);
+
+    EXPECT_EQ(indices, std::vector<size_t>({0, 1, 2}));
+    EXPECT_EQ(_physicalData->getMomentum(), reference.getMomentum());
+    EXPECT_EQ(
+        _physicalData->getKinEnergyAtomTensor(),
+        reference.getKinEnergyAtomTensor()
+    );
+    EXPECT_EQ(
+        _physicalData->getKinEnergyMolTensor(),
+        reference.getKinEnergyMolTensor()
+    );
+    EXPECT_EQ(
+        _physicalData->getKineticEnergy(),
+        reference.getKineticEnergy()
+    );
+}
+
 /**
  * @brief tests calculateTemperature function
  *
@@ -46,9 +46,14 @@ TEST(TestCoulombPotential, constructor)
  */
 TEST(TestCoulombPotential, setCoulombRadiusCutOff)
 {
-    CoulombPotential::setCoulombRadiusCutOff(2.0);
+    auto potential      = CoulombShiftedPotential(1.0);
+    auto otherPotential = CoulombShiftedPotential(1.0);
 
-    EXPECT_EQ(CoulombPotential::getCoulombRadiusCutOff(), 2.0);
-    EXPECT_EQ(CoulombPotential::getCoulombEnergyCutOff(), 0.5);
-    EXPECT_EQ(CoulombPotential::getCoulombForceCutOff(), 0.25);
+    potential.setCoulombRadiusCutOff(2.0);
+
+    EXPECT_EQ(potential.getCoulombRadiusCutOff(), 2.0);
+    EXPECT_EQ(potential.getCoulombEnergyCutOff(), 0.5);
+    EXPECT_EQ(potential.getCoulombForceCutOff(), 0.25);
+
+    EXPECT_EQ(otherPotential.getCoulombRadiusCutOff(), 1.0);
 }
\ No newline at end of file
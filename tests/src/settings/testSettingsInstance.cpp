@@ -0,0 +1,109 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <gtest/gtest.h>   // for EXPECT_EQ, Test, TestInfo (ptr only)
+
+#include <functional>   // for ref
+#include <thread>       // for thread
+
+#include "potentialSettings.hpp"   // for PotentialSettings
+#include "settingsInstance.hpp"    // for SettingsInstance, SettingsScope
+#include "timingsSettings.hpp"     // for TimingsSettings
+
+using namespace settings;
+
+/**
+ * @brief tests that settings are stored in the bound settings instance
+ *
+ */
+TEST(TestSettingsInstance, scope)
+{
+    TimingsSettings::setTimeStep(1.0);
+
+    auto instance = SettingsInstance();
+
+    {
+        const SettingsScope scope(instance);
+
+        EXPECT_EQ(&SettingsInstance::getActive(), &instance);
+        EXPECT_FALSE(TimingsSettings::isTimeStepSet());
+
+        TimingsSettings::setTimeStep(2.0);
+        EXPECT_EQ(TimingsSettings::getTimeStep(), 2.0);
+    }
+
+    EXPECT_EQ(&SettingsInstance::getActive(), &SettingsInstance::getDefault());
+    EXPECT_EQ(TimingsSettings::getTimeStep(), 1.0);
+    EXPECT_EQ(instance.getTimingsSettings()._timeStep, 2.0);
+}
+
+/**
+ * @brief tests that nested scopes restore the previous instance
+ *
+ */
+TEST(TestSettingsInstance, nestedScopes)
+{
+    auto outer = SettingsInstance();
+    auto inner = SettingsInstance();
+
+    const SettingsScope outerScope(outer);
+    PotentialSettings::setCoulombRadiusCutOff(10.0);
+
+    {
+        const SettingsScope innerScope(inner);
+        PotentialSettings::setCoulombRadiusCutOff(5.0);
+    }
+
+    EXPECT_EQ(&SettingsInstance::getActive(), &outer);
+    EXPECT_EQ(PotentialSettings::getCoulombRadiusCutOff(), 10.0);
+    EXPECT_EQ(inner.getPotentialSettings()._coulombRadiusCutOff, 5.0);
+}
+
+/**
+ * @brief tests that instances bound on different threads are independent
+ *
+ */
+TEST(TestSettingsInstance, threads)
+{
+    auto instance1 = SettingsInstance();
+    auto instance2 = SettingsInstance();
+
+    auto setCutOff = [](SettingsInstance &instance, const double cutOff)
+    {
+        const SettingsScope scope(instance);
+
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            PotentialSettings::setCoulombRadiusCutOff(cutOff);
+            EXPECT_EQ(PotentialSettings::getCoulombRadiusCutOff(), cutOff);
+        }
+    };
+
+    auto thread1 = std::thread(setCutOff, std::ref(instance1), 8.0);
+    auto thread2 = std::thread(setCutOff, std::ref(instance2), 9.0);
+
+    thread1.join();
+    thread2.join();
+
+    EXPECT_EQ(instance1.getPotentialSettings()._coulombRadiusCutOff, 8.0);
+    EXPECT_EQ(instance2.getPotentialSettings()._coulombRadiusCutOff, 9.0);
+}
@@ -24,12 +24,15 @@
 
 #include <string>   // for allocator, basic_string
 
+#include "baoab.hpp"                // for BAOAB
 #include "constraintSettings.hpp"   // for getShakeMaxIter, getShakeTolerance, getRattleMaxIter, getRattleTolerance
 #include "constraints.hpp"        // for Constraints
 #include "constraintsSetup.hpp"   // for ConstraintsSetup, setupConstraints
 #include "engine.hpp"             // for Engine
+#include "exceptions.hpp"         // for InputFileException
 #include "gtest/gtest.h"          // for Message, TestPartResult
 #include "testSetup.hpp"          // for TestSetup
+#include "throwWithMessage.hpp"   // for EXPECT_THROW_MSG
 
 using namespace setup;
 
@@ -88,4 +91,26 @@ TEST_F(TestSetup, setupConstraints)
         _engine->getConstraints().getShakeTolerance();
 
     EXPECT_NE(shakeToleranceDeactivated, shakeToleranceActivated);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief tests that the BAOAB integrator is rejected with SHAKE
+ *
+ */
+TEST_F(TestSetup, setupConstraints_baoab)
+{
+    _mdEngine->makeIntegrator(integrator::BAOAB());
+
+    ConstraintsSetup constraintsSetup(*_mdEngine);
+
+    _mdEngine->getConstraints().deactivateShake();
+    EXPECT_NO_THROW(constraintsSetup.setup());
+
+    _mdEngine->getConstraints().activateShake();
+    EXPECT_THROW_MSG(
+        constraintsSetup.setup(),
+        customException::InputFileException,
+        "The BAOAB integrator cannot be combined with SHAKE, M-SHAKE or "
+        "SETTLE constraints"
+    );
+}
@@ -24,15 +24,18 @@
 
 #include <string>   // for allocator, basic_string
 
-#include "berendsenManostat.hpp"   // for BerendsenManostat
-#include "exceptions.hpp"          // for InputFileException, customException
-#include "gtest/gtest.h"           // for Message, TestPartResult
-#include "manostat.hpp"            // for BerendsenManostat, Manostat
-#include "manostatSettings.hpp"    // for ManostatSettings
-#include "manostatSetup.hpp"       // for ManostatSetup, setupManostat, setup
-#include "mdEngine.hpp"            // for MDEngine
+#include "berendsenManostat.hpp"    // for BerendsenManostat
+#include "exceptions.hpp"           // for InputFileException, customException
+#include "gtest/gtest.h"            // for Message, TestPartResult
+#include "manostat.hpp"             // for BerendsenManostat, Manostat
+#include "manostatSettings.hpp"     // for ManostatSettings
+#include "manostatSetup.hpp"        // for ManostatSetup, setupManostat, setup
+#include "mdEngine.hpp"             // for MDEngine
+#include "monteCarloManostat.hpp"   // for MonteCarloManostat
+#include "settings.hpp"             // for Settings
 #include "stochasticRescalingManostat.hpp"   // for StochasticRescalingManostat
 #include "testSetup.hpp"                     // for TestSetup
+#include "thermostatSettings.hpp"            // for ThermostatSettings
 #include "throwWithMessage.hpp"              // for throwWithMessage
 
 using namespace setup;
@@ -226,4 +229,53 @@ TEST_F(TestSetup, setupManostatFullAnisotropicSStochasticRescaling)
     EXPECT_EQ(stochastic.getIsotropy(), Isotropy::FULL_ANISOTROPIC);
     EXPECT_EQ(stochastic.getTau(), 0.2 * 1000);
     EXPECT_EQ(stochastic.getCompressibility(), 4.0);
+}
+
+TEST_F(TestSetup, setupManostatMonteCarlo)
+{
+    Settings::setJobtype(JobType::MM_MD);
+    ThermostatSettings::setTemperatureSet(true);
+
+    ManostatSettings::setManostatType(ManostatType::MONTE_CARLO);
+    ManostatSettings::setIsotropy("isotropic");
+    ManostatSettings::setPressureSet(true);
+    ManostatSettings::setTargetPressure(300.0);
+    ManostatSettings::setMonteCarloFrequency(10);
+    ManostatSettings::setVolumeChange(0.02);
+
+    EXPECT_NO_THROW(setupManostat(*_mdEngine));
+
+    const auto &manostat = _mdEngine->getManostat();
+    EXPECT_EQ(manostat.getManostatType(), ManostatType::MONTE_CARLO);
+    EXPECT_FALSE(manostat.isVirialBased());
+
+    const auto monteCarlo = dynamic_cast<const MonteCarloManostat &>(manostat);
+    EXPECT_EQ(monteCarlo.getIsotropy(), Isotropy::ISOTROPIC);
+    EXPECT_EQ(monteCarlo.getFrequency(), 10);
+    EXPECT_EQ(monteCarlo.getVolumeChange(), 0.02);
+
+    ManostatSettings::setIsotropy("full_anisotropic");
+    EXPECT_THROW_MSG(
+        setupManostat(*_mdEngine),
+        customException::InputFileException,
+        "Monte Carlo manostat does not support full_anisotropic isotropy"
+    );
+
+    ThermostatSettings::setTemperatureSet(false);
+    EXPECT_THROW_MSG(
+        setupManostat(*_mdEngine),
+        customException::InputFileException,
+        "Temperature not set for monte_carlo manostat"
+    );
+
+    Settings::setJobtype(JobType::QMMM_MD);
+    EXPECT_THROW_MSG(
+        setupManostat(*_mdEngine),
+        customException::InputFileException,
+        "Monte Carlo manostat is only implemented for MM-MD simulations"
+    );
+
+    Settings::setJobtype(JobType::MM_MD);
+    ManostatSettings::setIsotropy("isotropic");
+    ManostatSettings::setManostatType(ManostatType::NONE);
 }
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <gtest/gtest.h>   // for EXPECT_EQ, TestInfo (ptr only)
+
+#include <memory>   // for make_unique
+#include <vector>   // for vector
+
+#include "exceptions.hpp"                // for UserInputException
+#include "gtest/gtest.h"                 // for Message, TestPartResult
+#include "mmmdEngine.hpp"                // for MMMDEngine
+#include "replicaExchangeEngine.hpp"     // for ReplicaExchangeEngine
+#include "replicaExchangeSettings.hpp"   // for ReplicaExchangeSettings
+#include "replicaExchangeSetup.hpp"      // for setupReplicaSettings
+#include "settings.hpp"                  // for Settings
+#include "settingsInstance.hpp"          // for SettingsInstance
+#include "thermostat.hpp"                // for Thermostat
+#include "thermostatSettings.hpp"        // for ThermostatSettings
+#include "throwWithMessage.hpp"          // for EXPECT_THROW_MSG
+
+using namespace setup;
+using namespace settings;
+
+TEST(TestReplicaExchangeSetup, setupReplicaSettings)
+{
+    SettingsInstance    instance;
+    const SettingsScope scope(instance);
+
+    ReplicaExchangeSettings::setTemperatures({300.0, 350.0});
+    ReplicaExchangeSettings::setReplicaIndex(1);
+
+    Settings::setJobtype(JobType::MM_OPT);
+    EXPECT_THROW_MSG(
+        setupReplicaSettings(),
+        customException::UserInputException,
+        "Replica exchange is only supported for the MM_MD jobtype"
+    );
+
+    Settings::setJobtype(JobType::MM_MD);
+    EXPECT_THROW_MSG(
+        setupReplicaSettings(),
+        customException::UserInputException,
+        "Replica exchange requires a thermostat to keep the replicas at their "
+        "temperatures"
+    );
+
+    ThermostatSettings::setThermostatType("berendsen");
+    ThermostatSettings::setTargetTemperature(100.0);
+    setupReplicaSettings();
+
+    EXPECT_TRUE(ThermostatSettings::isTemperatureSet());
+    EXPECT_EQ(ThermostatSettings::getTargetTemperature(), 350.0);
+}
+
+TEST(TestReplicaExchangeSetup, exchangeTemperatures)
+{
+    engine::ReplicaExchangeEngine replicaExchange;
+
+    replicaExchange.setTemperatures({300.0, 350.0, 400.0});
+    replicaExchange.setExchangeFrequency(10);
+    replicaExchange.setSeed(42);
+
+    for (size_t i = 0; i < 3; ++i)
+        replicaExchange.addReplica(std::make_unique<engine::MMMDEngine>());
+
+    // the colder replica has the higher energy - always accepted
+    replicaExchange.setPotentialEnergy(0, -10.0);
+    replicaExchange.setPotentialEnergy(1, -20.0);
+    replicaExchange.setPotentialEnergy(2, 1000.0);
+
+    EXPECT_TRUE(replicaExchange.isExchangeAccepted(0, 0.999));
+    EXPECT_FALSE(replicaExchange.isExchangeAccepted(1, 0.001));
+
+    replicaExchange.attemptExchanges();
+
+    using sizes = std::vector<size_t>;
+
+    EXPECT_EQ(replicaExchange.getReplicaOfTemperature(), sizes({1, 0, 2}));
+    EXPECT_EQ(replicaExchange.getNumberOfAttempts(), sizes({1, 0}));
+    EXPECT_EQ(replicaExchange.getNumberOfAccepted(), sizes({1, 0}));
+    EXPECT_EQ(replicaExchange.getNumberOfExchanges(), 1);
+
+    const auto &thermostat0 = replicaExchange.getReplica(0).getThermostat();
+    const auto &thermostat1 = replicaExchange.getReplica(1).getThermostat();
+
+    EXPECT_EQ(thermostat0.getTargetTemperature(), 350.0);
+    EXPECT_EQ(thermostat1.getTargetTemperature(), 300.0);
+
+    // second exchange attempts the odd pair 1-2 only
+    replicaExchange.attemptExchanges();
+
+    EXPECT_EQ(replicaExchange.getReplicaOfTemperature(), sizes({1, 0, 2}));
+    EXPECT_EQ(replicaExchange.getNumberOfAttempts(), sizes({1, 1}));
+    EXPECT_EQ(replicaExchange.getNumberOfAccepted(), sizes({1, 0}));
+}
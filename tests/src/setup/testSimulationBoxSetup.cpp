@@ -28,9 +28,13 @@
 #include <vector>   // for vector
 
 #include "atom.hpp"                          // for Atom
+#include "bondConstraint.hpp"                // for BondConstraint
+#include "bondForceField.hpp"                // for BondForceField
 #include "constants/conversionFactors.hpp"   // for _AMU_PER_ANGSTROM_CUBIC_TO_KG_PER_LITER_CUBIC_
+#include "constraints.hpp"                   // for Constraints
 #include "engine.hpp"                        // for Engine
 #include "exceptions.hpp"   // for MolDescriptorException, InputFileException
+#include "forceFieldClass.hpp"         // for ForceField
 #include "forceFieldSettings.hpp"      // for ForceFieldSettings
 #include "gtest/gtest.h"               // for Message, TestPartResult
 #include "molecule.hpp"                // for Molecule
@@ -563,4 +567,55 @@ TEST_F(TestSetup, testFullSetup)
     settings::PotentialSettings::setCoulombRadiusCutOff(4.0);
 
     EXPECT_NO_THROW(setup::simulationBox::setupSimulationBox(*_engine));
-}
\ No newline at end of file
+}
+
+TEST_F(TestSetup, testRepartitionHydrogenMasses)
+{
+    ::simulationBox::Molecule molecule(1);
+    molecule.setNumberOfAtoms(4);
+
+    for (const auto *name : {"C", "H", "H", "O"})
+    {
+        const auto atom = std::make_shared<::simulationBox::Atom>();
+        atom->setName(name);
+        molecule.addAtom(atom);
+    }
+
+    _engine->getSimulationBox().getMolecules().push_back(molecule);
+    auto *mol = &_engine->getSimulationBox().getMolecules()[0];
+
+    SimulationBoxSetup simulationBoxSetup(*_engine);
+    simulationBoxSetup.setAtomMasses();
+    simulationBoxSetup.setAtomicNumbers();
+
+    simulationBoxSetup.repartitionHydrogenMasses();
+    EXPECT_DOUBLE_EQ(mol->getAtomMass(1), 1.00794);
+
+    auto &forceField  = _engine->getForceField();
+    auto &constraints = _engine->getConstraints();
+
+    forceField.addBond(forceField::BondForceField(mol, mol, 1, 0, 0));
+    forceField.addBond(forceField::BondForceField(mol, mol, 0, 3, 0));
+    constraints.addBondConstraint(
+        constraints::BondConstraint(mol, mol, 0, 1, 1.0)
+    );
+    constraints.addBondConstraint(
+        constraints::BondConstraint(mol, mol, 2, 0, 1.0)
+    );
+
+    settings::SimulationBoxSettings::setHMRHydrogenMass(3.024);
+    simulationBoxSetup.repartitionHydrogenMasses();
+
+    const auto deltaMass = 3.024 - 1.00794;
+
+    EXPECT_DOUBLE_EQ(mol->getAtomMass(0), 12.0107 - 2.0 * deltaMass);
+    EXPECT_DOUBLE_EQ(mol->getAtomMass(1), 3.024);
+    EXPECT_DOUBLE_EQ(mol->getAtomMass(2), 3.024);
+    EXPECT_DOUBLE_EQ(mol->getAtomMass(3), 15.9994);
+
+    settings::SimulationBoxSettings::setHMRHydrogenMass(20.0);
+    EXPECT_THROW(
+        simulationBoxSetup.repartitionHydrogenMasses(),
+        customException::UserInputException
+    );
+}
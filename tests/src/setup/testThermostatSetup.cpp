@@ -25,6 +25,7 @@
 #include <cmath>    // for sqrt
 #include <string>   // for allocator, basic_string
 
+#include "baoab.hpp"                         // for BAOAB
 #include "berendsenThermostat.hpp"           // for BerendsenThermostat
 #include "constants/conversionFactors.hpp"   // for _FS_TO_S_, _KG_TO_GRAM_
 #include "constants/natureConstants.hpp"     // for _UNIVERSAL_GAS_CONSTANT_
@@ -256,6 +257,54 @@ TEST_F(TestSetup, setupThermostat_langevin)
     EXPECT_NO_THROW(setupThermostat(*_mdEngine));
 }
 
+TEST_F(TestSetup, setupThermostat_baoab)
+{
+    _mdEngine->makeIntegrator(integrator::BAOAB());
+    ThermostatSetup thermostatSetup(*_mdEngine);
+
+    settings::ThermostatSettings::setThermostatType("berendsen");
+    settings::ThermostatSettings::setTargetTemperature(300);
+    EXPECT_THROW_MSG(
+        thermostatSetup.setup(),
+        customException::InputFileException,
+        "The BAOAB integrator requires the langevin thermostat - berendsen "
+        "thermostat given"
+    );
+
+    settings::ThermostatSettings::setThermostatType("langevin");
+    EXPECT_NO_THROW(thermostatSetup.setup());
+
+    // needed because otherwise subsequent executions of .setup() will fail
+    // because the end temperature is automatically set to the target
+    // temperature for consistency
+    settings::ThermostatSettings::setEndTemperatureSet(false);
+
+    const auto &baoab =
+        dynamic_cast<integrator::BAOAB &>(_mdEngine->getIntegrator());
+    EXPECT_EQ(baoab.getFriction(), settings::ThermostatSettings::getFriction());
+    EXPECT_EQ(
+        baoab.getRandom().getStep(),
+        settings::TimingsSettings::getStepCount()
+    );
+
+    const auto *langevinThermostat =
+        dynamic_cast<thermostat::LangevinThermostat *>(
+            &_mdEngine->getThermostat()
+        );
+    EXPECT_EQ(langevinThermostat, nullptr);
+    EXPECT_EQ(_mdEngine->getThermostat().getTargetTemperature(), 300);
+
+    // the random state of a checkpoint file is restored into the integrator
+    settings::ThermostatSettings::setRandomState("7 42");
+    EXPECT_NO_THROW(thermostatSetup.setup());
+    settings::ThermostatSettings::setEndTemperatureSet(false);
+    settings::ThermostatSettings::setRandomState("");
+
+    const auto &restored =
+        dynamic_cast<integrator::BAOAB &>(_mdEngine->getIntegrator());
+    EXPECT_EQ(restored.getRandomState(), "7 42");
+}
+
 TEST_F(TestSetup, setupThermostat_nh_chain)
 {
     ThermostatSetup thermostatSetup(*_mdEngine);
@@ -122,6 +122,36 @@ TEST_F(TestSimulationBox, findMoleculeByAtomIndex)
                  , customException::UserInputException);
 }
 
+/**
+ * @brief tests findMoleculeByAtomIndex after the number of atoms of a
+ * molecule changed
+ *
+ */
+TEST_F(TestSimulationBox, findMoleculeByAtomIndexAfterAtomAdded)
+{
+    const auto &[molecule1, atomIndex1] =
+        _simulationBox->findMoleculeByAtomIndex(4);
+    EXPECT_EQ(molecule1, &(_simulationBox->getMolecules()[1]));
+    EXPECT_EQ(atomIndex1, 0);
+
+    auto atom6 = std::make_shared<simulationBox::Atom>();
+
+    auto &molecule = _simulationBox->getMolecule(0);
+    molecule.addAtom(atom6);
+    molecule.setNumberOfAtoms(4);
+    _simulationBox->addAtom(atom6);
+
+    const auto &[molecule2, atomIndex2] =
+        _simulationBox->findMoleculeByAtomIndex(4);
+    EXPECT_EQ(molecule2, &(_simulationBox->getMolecules()[0]));
+    EXPECT_EQ(atomIndex2, 3);
+
+    const auto &[molecule3, atomIndex3] =
+        _simulationBox->findMoleculeByAtomIndex(6);
+    EXPECT_EQ(molecule3, &(_simulationBox->getMolecules()[1]));
+    EXPECT_EQ(atomIndex3, 1);
+}
+
 /**
  * @brief tests findNecessaryMoleculeTypes function
  *
@@ -355,4 +385,25 @@ TEST_F(
         customException::UserInputException,
         "Molecule type 1 not found in molecule types"
     );
-}
\ No newline at end of file
+}
+/**
+ * @brief tests calculateQMCenter function
+ *
+ */
+TEST_F(TestSimulationBox, calculateQMCenter)
+{
+    _simulationBox->addQMCenterAtoms({1, 2});
+
+    EXPECT_EQ(
+        _simulationBox->calculateQMCenter(),
+        linearAlgebra::Vec3D(2 / 5.0, 3 / 5.0, 0.0)
+    );
+
+    _simulationBox->getAtom(2).setPosition({9.5, 0.0, 0.0});
+
+    const auto qmCenter = _simulationBox->calculateQMCenter();
+
+    EXPECT_NEAR(qmCenter[0], 0.1, 1e-12);
+    EXPECT_NEAR(qmCenter[1], 0.0, 1e-12);
+    EXPECT_NEAR(qmCenter[2], 0.0, 1e-12);
+}
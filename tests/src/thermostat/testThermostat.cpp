@@ -24,10 +24,12 @@
 
 #include <cmath>    // for sqrt
 #include <memory>   // for allocator
+#include <vector>   // for vector
 
 #include "berendsenThermostat.hpp"                   // for BerendsenThermostat
 #include "constants/internalConversionFactors.hpp"   // for _TEMPERATURE_FACTOR_
 #include "gtest/gtest.h"                             // for InitGoogleTest
+#include "langevinThermostat.hpp"                    // for LangevinThermostat
 #include "physicalData.hpp"                          // for PhysicalData
 #include "simulationBox.hpp"                         // for SimulationBox
 #include "timingsSettings.hpp"                       // for TimingsSettings
@@ -156,3 +158,33 @@ TEST_F(TestThermostat, applyThermostatBerendsen)
         oldTemperature * berendsenFactor * berendsenFactor
     );
 }
+
+TEST_F(TestThermostat, restoreRandomState)
+{
+    settings::TimingsSettings::setTimeStep(0.1);
+
+    auto thermostat1 = thermostat::LangevinThermostat(300.0, 10.0);
+    auto thermostat2 = thermostat::LangevinThermostat(300.0, 10.0);
+
+    thermostat2.setRandomState(thermostat1.getRandomState());
+
+    auto &atoms = _simulationBox->getAtoms();
+
+    std::vector<linearAlgebra::Vec3D> velocities;
+    for (const auto &atom : atoms) velocities.push_back(atom->getVelocity());
+
+    thermostat1.applyLangevin(*_simulationBox);
+
+    std::vector<linearAlgebra::Vec3D> velocities1;
+    for (const auto &atom : atoms) velocities1.push_back(atom->getVelocity());
+
+    for (size_t i = 0; i < atoms.size(); ++i)
+        atoms[i]->setVelocity(velocities[i]);
+
+    thermostat2.applyLangevin(*_simulationBox);
+
+    for (size_t i = 0; i < atoms.size(); ++i)
+        EXPECT_EQ(atoms[i]->getVelocity(), velocities1[i]);
+
+    EXPECT_EQ(thermostat::Thermostat().getRandomState(), "");
+}
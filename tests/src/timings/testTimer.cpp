@@ -0,0 +1,213 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <gtest/gtest.h>   // for Test, EXPECT_EQ, TEST
+
+#include <cstdio>    // for remove
+#include <fstream>   // for ifstream
+#include <sstream>   // for stringstream
+#include <string>    // for string
+
+#include "exceptions.hpp"           // for CustomException
+#include "globalTimer.hpp"          // for GlobalTimer
+#include "hardwareCounters.hpp"     // for HardwareCounters
+#include "outputFileSettings.hpp"   // for OutputFileSettings
+#include "timer.hpp"                // for Timer, ScopedTimingsSection
+#include "timingsHistogram.hpp"     // for TimingsHistogram
+#include "timingsRegistry.hpp"      // for TimingsRegistry, sectionId
+#include "timingsSettings.hpp"      // for TimingsSettings
+#include "timingsTraceOutput.hpp"   // for TimingsTraceOutput
+
+using namespace timings;
+
+/**
+ * @brief tests that section names are interned to unique ids
+ *
+ */
+TEST(TestTimer, interning)
+{
+    const auto id1 = TimingsRegistry::intern("interning section 1");
+    const auto id2 = TimingsRegistry::intern("interning section 2");
+
+    EXPECT_NE(id1, id2);
+    EXPECT_EQ(TimingsRegistry::intern("interning section 1"), id1);
+    EXPECT_EQ(sectionId<"interning section 2">(), id2);
+    EXPECT_EQ(TimingsRegistry::getName(id2), "interning section 2");
+}
+
+/**
+ * @brief tests nesting of sections and the sorting of nested sections
+ *
+ */
+TEST(TestTimer, nestedSections)
+{
+    Timer timer("timer");
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const ScopedTimingsSection scope(timer, sectionId<"outer">());
+
+        timer.startTimingsSection<"inner">();
+        timer.stopTimingsSection<"inner">();
+    }
+
+    timer.startTimingsSection("second");
+    timer.stopTimingsSection("second");
+
+    timer.sortTimingsSections();
+
+    const auto outer  = timer.getTimingsSection("outer");
+    const auto inner  = timer.getTimingsSection("inner");
+    const auto second = timer.getTimingsSection("second");
+
+    EXPECT_EQ(outer.getDepth(), 0);
+    EXPECT_EQ(outer.getParentId(), TimingsSection::_NO_PARENT_);
+    EXPECT_EQ(inner.getDepth(), 1);
+    EXPECT_EQ(inner.getParentId(), outer.getId());
+    EXPECT_EQ(second.getDepth(), 0);
+
+    EXPECT_EQ(outer.getSteps(), 3);
+    EXPECT_EQ(inner.getSteps(), 3);
+
+    const auto details = timer.getTimingDetails();
+    ASSERT_EQ(details.size(), 3);
+
+    // the nested section directly follows its parent
+    for (size_t i = 0; i < details.size(); ++i)
+        if (details[i].getName() == "inner")
+            EXPECT_EQ(details[i - 1].getName(), "outer");
+
+    // nested sections are not counted twice
+    EXPECT_DOUBLE_EQ(
+        timer.calculateElapsedTime(),
+        outer.calculateElapsedTime() + second.calculateElapsedTime()
+    );
+
+    EXPECT_THROW(
+        timer.stopTimingsSection("never started"),
+        customException::CustomException
+    );
+}
+
+/**
+ * @brief tests the percentiles of the timings histogram
+ *
+ */
+TEST(TestTimer, histogram)
+{
+    TimingsHistogram histogram;
+
+    EXPECT_EQ(histogram.calculatePercentile(0.5), 0.0);
+
+    for (size_t i = 0; i < 98; ++i) histogram.addSample(1.0e-3);
+    for (size_t i = 0; i < 2; ++i) histogram.addSample(1.0e-1);
+
+    EXPECT_EQ(histogram.getNumberOfSamples(), 100);
+    EXPECT_NEAR(histogram.calculatePercentile(0.50), 1.0e-3, 5.0e-5);
+    EXPECT_NEAR(histogram.calculatePercentile(0.98), 1.0e-3, 5.0e-5);
+    EXPECT_NEAR(histogram.calculatePercentile(0.99), 1.0e-1, 5.0e-3);
+}
+
+/**
+ * @brief tests writing the recorded events as Chrome trace file
+ *
+ */
+TEST(TestTimer, traceOutput)
+{
+    settings::OutputFileSettings::setTimingsTraceOutput(true);
+
+    Timer timer("trace timer");
+    timer.startTimingsSection<"traced section">();
+    timer.stopTimingsSection<"traced section">();
+
+    settings::OutputFileSettings::setTimingsTraceOutput(false);
+
+    timer.startTimingsSection<"traced section">();
+    timer.stopTimingsSection<"traced section">();
+
+    ASSERT_EQ(timer.getEvents().size(), 1);
+    EXPECT_EQ(timer.getEvents()[0].sectionId, sectionId<"traced section">());
+
+    GlobalTimer globalTimer;
+    globalTimer.addTimer(timer);
+
+    const std::string fileName = "timings.trace.json";
+
+    {
+        output::TimingsTraceOutput traceOutput(fileName);
+        traceOutput.setFilename(fileName);
+        traceOutput.write(globalTimer);
+    }
+
+    std::ifstream     file(fileName);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const auto content = buffer.str();
+
+    EXPECT_NE(content.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(
+        content.find("\"name\":\"traced section\",\"cat\":\"trace timer\""),
+        std::string::npos
+    );
+    EXPECT_NE(content.find("\"thread_name\""), std::string::npos);
+
+    ::remove(fileName.c_str());
+}
+
+/**
+ * @brief tests the hardware counters of a timings section
+ *
+ * @details if the counters are not available, e.g. in a container, the
+ * section is still timed and the reason is reported
+ *
+ */
+TEST(TestTimer, hardwareCounters)
+{
+    settings::TimingsSettings::setHardwareCounters(true);
+
+    Timer timer("counter timer");
+
+    timer.startTimingsSection<"counted section">();
+
+    volatile double sum = 0.0;
+    for (size_t i = 0; i < 100'000; ++i) sum = sum + double(i);
+
+    timer.stopTimingsSection<"counted section">();
+
+    settings::TimingsSettings::setHardwareCounters(false);
+
+    const auto section  = timer.getTimingsSection("counted section");
+    const auto counters = section.getCounters();
+
+    EXPECT_EQ(section.getSteps(), 1);
+
+    if (HardwareCounters::getThreadCounters().isOpen())
+    {
+        EXPECT_GT(counters.cycles, 0);
+        EXPECT_GT(counters.instructions, 100'000);
+    }
+    else
+    {
+        EXPECT_EQ(counters.cycles, 0);
+        EXPECT_FALSE(HardwareCounters::getErrorMessage().empty());
+    }
+}
@@ -0,0 +1,89 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include <gtest/gtest.h>   // for Test, TestInfo (ptr only), EXPECT_EQ
+
+#include <cstdio>        // for remove
+#include <fstream>       // for ofstream
+#include <string>        // for string
+#include <string_view>   // for string_view
+
+#include "gtest/gtest.h"    // for AssertionResult, Message, TestPartResult
+#include "mappedFile.hpp"   // for MappedFile
+
+/**
+ * @brief tests reading lines from a mapped file
+ *
+ */
+TEST(TestMappedFile, getLine)
+{
+    const std::string filename = "mappedFile.tmp";
+
+    std::ofstream file(filename);
+    file << "first line\n\nthird line\r\nlast line";
+    file.close();
+
+    utilities::MappedFile mappedFile(filename);
+    std::string_view      line;
+
+    EXPECT_TRUE(mappedFile.isOpen());
+
+    EXPECT_TRUE(mappedFile.getLine(line));
+    EXPECT_EQ(line, "first line");
+    EXPECT_TRUE(mappedFile.getLine(line));
+    EXPECT_TRUE(line.empty());
+    EXPECT_TRUE(mappedFile.getLine(line));
+    EXPECT_EQ(line, "third line");
+    EXPECT_TRUE(mappedFile.getLine(line));
+    EXPECT_EQ(line, "last line");
+
+    EXPECT_TRUE(mappedFile.eof());
+    EXPECT_FALSE(mappedFile.getLine(line));
+
+    ::remove(filename.c_str());
+}
+
+/**
+ * @brief tests empty and non existing files
+ *
+ */
+TEST(TestMappedFile, emptyAndMissingFile)
+{
+    const std::string filename = "mappedFileEmpty.tmp";
+
+    std::ofstream file(filename);
+    file.close();
+
+    utilities::MappedFile emptyFile(filename);
+    std::string_view      line;
+
+    EXPECT_TRUE(emptyFile.isOpen());
+    EXPECT_FALSE(emptyFile.getLine(line));
+
+    ::remove(filename.c_str());
+
+    utilities::MappedFile missingFile("nonExistingFile.tmp");
+
+    EXPECT_FALSE(missingFile.isOpen());
+    EXPECT_FALSE(missingFile.getLine(line));
+}
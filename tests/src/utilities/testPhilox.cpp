@@ -0,0 +1,144 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    PQ
+    Copyright (C) 2023-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+
+#include <gtest/gtest.h>   // for Test, TestInfo (ptr only), EXPECT_EQ
+
+#include <cmath>   // for fabs
+
+#include "gtest/gtest.h"   // for AssertionResult, Message, TestPartResult
+#include "philox.hpp"      // for Philox
+
+using namespace utilities;
+
+/**
+ * @brief tests the Philox4x32-10 block function against the known answer
+ * tests of the Random123 library
+ *
+ */
+TEST(TestPhilox, generate)
+{
+    using Block = Philox::Block;
+
+    EXPECT_EQ(
+        Philox::generate({0, 0, 0, 0}, {0, 0}),
+        (Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8})
+    );
+
+    EXPECT_EQ(
+        Philox::generate(
+            {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+            {0xffffffff, 0xffffffff}
+        ),
+        (Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd})
+    );
+
+    EXPECT_EQ(
+        Philox::generate(
+            {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+            {0xa4093822, 0x299f31d0}
+        ),
+        (Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1})
+    );
+}
+
+/**
+ * @brief tests that the random numbers only depend on seed, stream, step and
+ * index
+ *
+ */
+TEST(TestPhilox, counter)
+{
+    auto philox1 = Philox(42, PhiloxStream::LANGEVIN);
+    auto philox2 = Philox(42, PhiloxStream::LANGEVIN);
+    auto philox3 = Philox(42, PhiloxStream::VELOCITIES);
+
+    EXPECT_EQ(philox1.random(7), philox2.random(7));
+    EXPECT_NE(philox1.random(7), philox1.random(8));
+    EXPECT_NE(philox1.random(7), philox3.random(7));
+
+    philox2.advance();
+    EXPECT_NE(philox1.random(7), philox2.random(7));
+
+    philox1.advance();
+    EXPECT_EQ(philox1.random(7), philox2.random(7));
+
+    for (size_t i = 0; i < 100; ++i)
+        for (const auto uniform : philox1.uniforms(i))
+        {
+            EXPECT_GT(uniform, 0.0);
+            EXPECT_LT(uniform, 1.0);
+        }
+}
+
+/**
+ * @brief tests mean and variance of the normal distributed random numbers
+ *
+ */
+TEST(TestPhilox, normals)
+{
+    const auto philox = Philox(1234, PhiloxStream::LANGEVIN);
+
+    auto mean     = 0.0;
+    auto variance = 0.0;
+
+    const size_t nBlocks = 25000;
+
+    for (size_t i = 0; i < nBlocks; ++i)
+        for (const auto normal : philox.normals(i))
+        {
+            mean     += normal;
+            variance += normal * normal;
+        }
+
+    mean     /= 4.0 * nBlocks;
+    variance /= 4.0 * nBlocks;
+
+    EXPECT_NEAR(mean, 0.0, 0.02);
+    EXPECT_NEAR(variance, 1.0, 0.02);
+}
+
+/**
+ * @brief tests getting and setting the state of the generator
+ *
+ */
+TEST(TestPhilox, state)
+{
+    auto philox1 = Philox(42, PhiloxStream::LANGEVIN);
+    philox1.advance();
+    philox1.advance();
+
+    EXPECT_EQ(philox1.getState(), "42 2");
+
+    auto philox2 = Philox(0, PhiloxStream::LANGEVIN);
+    philox2.setState(philox1.getState());
+
+    EXPECT_EQ(philox2.getSeed(), 42);
+    EXPECT_EQ(philox2.getStep(), 2);
+    EXPECT_EQ(philox1.random(3), philox2.random(3));
+
+    philox2.setState("1 2 3");
+    EXPECT_EQ(philox2.getState(), "42 2");
+
+    philox2.setState("invalid");
+    EXPECT_EQ(philox2.getState(), "42 2");
+}
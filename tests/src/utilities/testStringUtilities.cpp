@@ -95,6 +95,46 @@ TEST(TestStringUtilities, splitString)
     EXPECT_EQ("test2", utilities::splitString(line)[1]);
 }
 
+/**
+ * @brief test splitStringView and stripComments
+ *
+ */
+TEST(TestStringUtilities, splitStringView)
+{
+    const std::string line = "  test\t test2  # comment";
+
+    const auto lineElements =
+        utilities::splitStringView(utilities::stripComments(line, "#"));
+
+    ASSERT_THAT(lineElements, testing::ElementsAre("test", "test2"));
+    EXPECT_TRUE(utilities::splitStringView("   ").empty());
+
+    const auto nonAscii = utilities::splitStringView("H\xc3\xa4 \xce\xb1");
+
+    ASSERT_THAT(nonAscii, testing::ElementsAre("H\xc3\xa4", "\xce\xb1"));
+}
+
+/**
+ * @brief test conversion of strings to numbers
+ *
+ */
+TEST(TestStringUtilities, stringToNumber)
+{
+    EXPECT_EQ(utilities::stringToDouble("1.5"), 1.5);
+    EXPECT_EQ(utilities::stringToDouble("+1.5e-3"), 1.5e-3);
+    EXPECT_EQ(utilities::stringToDouble("-2"), -2.0);
+    EXPECT_EQ(utilities::stringToSizeT("42"), 42);
+
+    EXPECT_THROW(
+        [[maybe_unused]] const auto dummy = utilities::stringToDouble("x"),
+        customException::InputFileException
+    );
+    EXPECT_THROW(
+        [[maybe_unused]] const auto dummy = utilities::stringToSizeT("-1"),
+        customException::InputFileException
+    );
+}
+
 /**
  * @brief test toLowerCopy function
  *